@@ -0,0 +1,891 @@
+/******************************************************************************
+ *
+ *                                analysis.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the static analysis outlined in
+ *                 analysis.h. Each block start has an entry state giving,
+ *                 for every register, either a sorted set of at most
+ *                 MAX_VALUES values it may hold or "any value" (with a
+ *                 note of whether the value is known not to be 0, which
+ *                 is all that is known about a segment id from map
+ *                 segment, and all an access needs to rule out segment
+ *                 0). Running a block from its entry state joins the
+ *                 state at its exit into those of its successors, and
+ *                 blocks are rerun from a worklist until no state grows.
+ *                 States only grow and each register can only grow
+ *                 MAX_VALUES + 2 times, so this terminates.
+ *
+ *                 Targets found along the way become block starts. A new
+ *                 start inside a block already run splits it, so the
+ *                 block that ran through it is queued again to stop there.
+ *                 Once nothing changes, every block is run one last time
+ *                 to record its exit, edges and statistics.
+ *
+ *****************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "analysis.h"
+#include "bitpack.h"
+#include "assert.h"
+
+#define NUM_REGISTERS 8
+#define OPCODE_LSB 28
+#define RA_LSB 6
+#define RB_LSB 3
+#define RC_LSB 0
+#define RA_13_LSB 25
+#define LV_VALUE_MASK 0x1ffffff
+#define MAX_VALUES 8
+#define ANY_VALUE 0xff
+#define NO_STATE UINT32_MAX
+
+typedef enum Um_opcode {
+    CMOV = 0, SLOAD, SSTORE, ADD, MUL, DIV, NAND, HALT, ACTIVATE,
+    INACTIVATE, OUT, IN, LOADP, LV, SPAWN, EXTEND
+} Um_opcode;
+
+/* Operations of opcode 15, as in instruction_executor.c */
+typedef enum Um_extension {
+    JOIN = 0, BULK_COPY, BULK_FILL, BULK_COMPARE
+} Um_extension;
+
+/* What is known about a register */
+typedef struct Value {
+    uint8_t count;       /* values known, or ANY_VALUE */
+    uint8_t nonzero;     /* with ANY_VALUE: known not to be 0 */
+    uint32_t values[MAX_VALUES];   /* sorted */
+} Value;
+
+typedef struct State {
+    Value registers[NUM_REGISTERS];
+} State;
+
+static const char *exit_names[] = {
+    "fall", "jump", "indirect", "load", "halt", "end"
+};
+
+struct Analysis_T {
+    const uint32_t *words;
+    uint32_t num_words;
+
+    /* Per pc: its entry state if a block starts there, the state of the
+       last block run through it, and whether it is read as data */
+    uint32_t *state_at;
+    uint32_t *covered_by;
+    uint8_t *read_as_data;
+
+    /* Entry states, the pc each belongs to, and the worklist */
+    State *states;
+    uint32_t *state_pc;
+    uint8_t *queued;
+    uint32_t num_states;
+    uint32_t states_capacity;
+    uint32_t *worklist;
+    uint32_t worklist_length;
+
+    Analysis_block *blocks;
+    uint32_t num_blocks;
+    uint32_t blocks_capacity;
+    uint32_t *successors;
+    uint32_t num_successors;
+    uint32_t successors_capacity;
+    Analysis_stats stats;
+};
+
+/* value_set
+ * Purpose:    Makes a register hold one known value.
+ * Parameters: Value *value - the register
+ *             uint32_t x - the value
+ * Returns:    none
+ */
+static void value_set(Value *value, uint32_t x)
+{
+    value->count = 1;
+    value->nonzero = x != 0;
+    value->values[0] = x;
+}
+
+/* value_any
+ * Purpose:    Makes a register hold a value not known.
+ * Parameters: Value *value - the register
+ *             int nonzero - nonzero if the value is known not to be 0
+ * Returns:    none
+ */
+static void value_any(Value *value, int nonzero)
+{
+    value->count = ANY_VALUE;
+    value->nonzero = nonzero;
+}
+
+/* may_be_zero
+ * Purpose:    Tells whether a register may hold 0.
+ * Parameters: const Value *value - the register
+ * Returns:    int - nonzero if it may
+ */
+static int may_be_zero(const Value *value)
+{
+    if (value->count == ANY_VALUE) {
+        return !value->nonzero;
+    }
+    return value->values[0] == 0;
+}
+
+/* may_be_nonzero
+ * Purpose:    Tells whether a register may hold something other than 0.
+ * Parameters: const Value *value - the register
+ * Returns:    int - nonzero if it may
+ */
+static int may_be_nonzero(const Value *value)
+{
+    return value->count == ANY_VALUE ||
+           value->values[value->count - 1] != 0;
+}
+
+/* value_add
+ * Purpose:    Adds a value a register may hold.
+ * Parameters: Value *value - the register
+ *             uint32_t x - the value
+ * Returns:    int - nonzero if what is known about the register changed
+ * Notes:      Once more than MAX_VALUES values are possible, the register
+ *             may hold any value.
+ */
+static int value_add(Value *value, uint32_t x)
+{
+    if (value->count == ANY_VALUE) {
+        if (x == 0 && value->nonzero) {
+            value->nonzero = 0;
+            return 1;
+        }
+        return 0;
+    }
+    int i = 0;
+    while (i < value->count && value->values[i] < x) {
+        i++;
+    }
+    if (i < value->count && value->values[i] == x) {
+        return 0;
+    } else if (value->count == MAX_VALUES) {
+        value_any(value, !may_be_zero(value) && x != 0);
+        return 1;
+    }
+    memmove(&value->values[i + 1], &value->values[i],
+            (value->count - i) * sizeof(value->values[0]));
+    value->values[i] = x;
+    value->count++;
+    return 1;
+}
+
+/* value_join
+ * Purpose:    Widens what is known about a register to cover another
+ *             register's possible values as well.
+ * Parameters: Value *into - the register widened
+ *             const Value *from - the other register
+ * Returns:    int - nonzero if into changed
+ */
+static int value_join(Value *into, const Value *from)
+{
+    if (from->count == ANY_VALUE) {
+        int nonzero = !may_be_zero(into) && from->nonzero;
+        if (into->count == ANY_VALUE && into->nonzero == nonzero) {
+            return 0;
+        }
+        value_any(into, nonzero);
+        return 1;
+    }
+    int changed = 0;
+    for (int i = 0; i < from->count; i++) {
+        changed |= value_add(into, from->values[i]);
+    }
+    return changed;
+}
+
+/* combine
+ * Purpose:    Computes what is known about the result of an arithmetic
+ *             instruction from what is known about its operands.
+ * Parameters: Value *result - register A, which may also be an operand
+ *             const Value *b, const Value *c - registers B and C
+ *             Um_opcode opcode - ADD, MUL, DIV or NAND
+ * Returns:    none
+ */
+static void combine(Value *result, const Value *b, const Value *c,
+                    Um_opcode opcode)
+{
+    Value combined;
+    combined.count = 0;
+    if (b->count == ANY_VALUE || c->count == ANY_VALUE) {
+        value_any(result, 0);
+        return;
+    }
+    for (int i = 0; i < b->count; i++) {
+        for (int j = 0; j < c->count; j++) {
+            uint32_t x = b->values[i], y = c->values[j];
+            if (opcode == DIV && y == 0) {
+                /* The UM fails there; no result to track */
+                continue;
+            }
+            value_add(&combined, opcode == ADD ? x + y :
+                                 opcode == MUL ? x * y :
+                                 opcode == DIV ? x / y : ~(x & y));
+        }
+    }
+    if (combined.count == 0) {
+        value_any(&combined, 0);
+    }
+    *result = combined;
+}
+
+/* state_join
+ * Purpose:    Widens an entry state to cover another state as well.
+ * Parameters: State *into - the entry state
+ *             const State *from - the state at the end of a predecessor
+ * Returns:    int - nonzero if into changed
+ */
+static int state_join(State *into, const State *from)
+{
+    int changed = 0;
+    for (int r = 0; r < NUM_REGISTERS; r++) {
+        changed |= value_join(&into->registers[r], &from->registers[r]);
+    }
+    return changed;
+}
+
+/* push
+ * Purpose:    Queues a block to be run again, unless it already is.
+ * Parameters: Analysis_T a - the analysis
+ *             uint32_t state - the block's entry state
+ * Returns:    none
+ */
+static void push(Analysis_T a, uint32_t state)
+{
+    if (!a->queued[state]) {
+        a->queued[state] = 1;
+        a->worklist[a->worklist_length++] = state;
+    }
+}
+
+/* new_state
+ * Purpose:    Starts a block at a pc.
+ * Parameters: Analysis_T a - the analysis
+ *             uint32_t pc - the first instruction of the block
+ *             const State *state - its entry state
+ * Returns:    uint32_t - the index of the entry state
+ */
+static uint32_t new_state(Analysis_T a, uint32_t pc, const State *state)
+{
+    if (a->num_states == a->states_capacity) {
+        a->states_capacity = a->states_capacity == 0
+                             ? 64 : 2 * a->states_capacity;
+        a->states = realloc(a->states, a->states_capacity *
+                                       sizeof(*a->states));
+        a->state_pc = realloc(a->state_pc, a->states_capacity *
+                                           sizeof(*a->state_pc));
+        a->queued = realloc(a->queued, a->states_capacity);
+        a->worklist = realloc(a->worklist, a->states_capacity *
+                                           sizeof(*a->worklist));
+        assert(a->states != NULL && a->state_pc != NULL &&
+               a->queued != NULL && a->worklist != NULL);
+    }
+    uint32_t index = a->num_states++;
+    a->states[index] = *state;
+    a->state_pc[index] = pc;
+    a->queued[index] = 0;
+    a->state_at[pc] = index;
+    return index;
+}
+
+/* enter
+ * Purpose:    Follows an edge during propagation: joins the state at the
+ *             end of a block into the entry state of a successor,
+ *             starting a block there if there is none yet.
+ * Parameters: Analysis_T a - the analysis
+ *             uint32_t pc - the successor
+ *             const State *state - the state along the edge
+ * Returns:    none
+ */
+static void enter(Analysis_T a, uint32_t pc, const State *state)
+{
+    uint32_t index = a->state_at[pc];
+    if (index == NO_STATE) {
+        index = new_state(a, pc, state);
+        /* A block that ran through pc has to stop there now */
+        if (a->covered_by[pc] != NO_STATE) {
+            push(a, a->covered_by[pc]);
+        }
+        push(a, index);
+    } else if (state_join(&a->states[index], state)) {
+        push(a, index);
+    }
+}
+
+/* add_successor
+ * Purpose:    Records an edge out of the block being recorded.
+ * Parameters: Analysis_T a - the analysis
+ *             Analysis_block *block - the block
+ *             uint32_t pc - the successor
+ * Returns:    none
+ */
+static void add_successor(Analysis_T a, Analysis_block *block, uint32_t pc)
+{
+    if (a->num_successors == a->successors_capacity) {
+        a->successors_capacity = a->successors_capacity == 0
+                                 ? 64 : 2 * a->successors_capacity;
+        a->successors = realloc(a->successors, a->successors_capacity *
+                                               sizeof(*a->successors));
+        assert(a->successors != NULL);
+    }
+    a->successors[a->num_successors++] = pc;
+    block->num_successors++;
+}
+
+/* follow
+ * Purpose:    Follows an edge: during propagation into the successor's
+ *             entry state, and while recording into the block's edges.
+ * Parameters: Analysis_T a - the analysis
+ *             Analysis_block *block - the block the edge leaves
+ *             uint32_t pc - the successor
+ *             const State *state - the state along the edge
+ *             int record - nonzero while recording
+ * Returns:    none
+ */
+static void follow(Analysis_T a, Analysis_block *block, uint32_t pc,
+                   const State *state, int record)
+{
+    if (record) {
+        add_successor(a, block, pc);
+    } else {
+        enter(a, pc, state);
+    }
+}
+
+/* read_code
+ * Purpose:    Notes an instruction that may read segment 0 as data.
+ * Parameters: Analysis_T a - the analysis
+ *             Analysis_block *block - the block holding it
+ *             const Value *offset - the first word read
+ *             const Value *count - how many words are read, or NULL for
+ *                                  one
+ *             int record - nonzero while recording
+ * Returns:    none
+ * Notes:      Runs are only marked when their start and length are both
+ *             known exactly.
+ */
+static void read_code(Analysis_T a, Analysis_block *block,
+                      const Value *offset, const Value *count, int record)
+{
+    block->reads_code = 1;
+    if (!record) {
+        return;
+    }
+    a->stats.code_reads++;
+    if (offset->count == ANY_VALUE ||
+        (count != NULL && (count->count != 1 || offset->count != 1))) {
+        a->stats.unknown_code_reads++;
+        return;
+    }
+    for (int i = 0; i < offset->count; i++) {
+        uint64_t first = offset->values[i];
+        uint64_t end = first + (count == NULL ? 1 : count->values[0]);
+        for (uint64_t pc = first; pc < end && pc < a->num_words; pc++) {
+            a->read_as_data[pc] = 1;
+        }
+    }
+}
+
+/* write_code
+ * Purpose:    Notes an instruction that may write segment 0.
+ * Parameters: Analysis_T a - the analysis
+ *             Analysis_block *block - the block holding it
+ *             int record - nonzero while recording
+ * Returns:    none
+ */
+static void write_code(Analysis_T a, Analysis_block *block, int record)
+{
+    block->writes_code = 1;
+    if (record) {
+        a->stats.code_writes++;
+    }
+}
+
+/* run_loadp
+ * Purpose:    Ends a block at a LOADP, following its edges.
+ * Parameters: Analysis_T a - the analysis
+ *             Analysis_block *block - the block
+ *             const State *state - the state at the LOADP
+ *             uint32_t word - the instruction
+ *             int record - nonzero while recording
+ * Returns:    none
+ */
+static void run_loadp(Analysis_T a, Analysis_block *block,
+                      const State *state, uint32_t word, int record)
+{
+    const Value *rB = &state->registers[(word >> RB_LSB) & 7];
+    const Value *rC = &state->registers[(word >> RC_LSB) & 7];
+    if (may_be_nonzero(rB)) {
+        block->exit = ANALYSIS_LOAD;
+    } else {
+        block->exit = rC->count == ANY_VALUE ? ANALYSIS_INDIRECT
+                                             : ANALYSIS_JUMP;
+    }
+    if (may_be_zero(rB) && rC->count != ANY_VALUE) {
+        for (int i = 0; i < rC->count; i++) {
+            if (rC->values[i] < a->num_words) {
+                follow(a, block, rC->values[i], state, record);
+            } else if (record) {
+                a->stats.bad_targets++;
+            }
+        }
+    }
+}
+
+/* run_extension
+ * Purpose:    Applies an opcode 15 instruction (see
+ *             instruction_executor.c) to the state.
+ * Parameters: Analysis_T a - the analysis
+ *             Analysis_block *block - the block holding it
+ *             State *state - the state, updated
+ *             uint32_t word - the instruction
+ *             int record - nonzero while recording
+ * Returns:    none
+ */
+static void run_extension(Analysis_T a, Analysis_block *block, State *state,
+                          uint32_t word, int record)
+{
+    int function = (word >> RA_13_LSB) & 7;
+    int ra = (word >> RA_LSB) & 7;
+    int rb = (word >> RB_LSB) & 7;
+    Value *rC = &state->registers[(word >> RC_LSB) & 7];
+    Value *registers = state->registers;
+    if (function == JOIN || function > BULK_COMPARE) {
+        return;
+    }
+    if (function != BULK_COMPARE && may_be_zero(&registers[ra])) {
+        write_code(a, block, record);
+    }
+    if (function != BULK_FILL && may_be_zero(&registers[rb])) {
+        read_code(a, block, &registers[(rb + 1) & 7], rC, record);
+    }
+    if (function == BULK_COMPARE) {
+        if (may_be_zero(&registers[ra])) {
+            read_code(a, block, &registers[(ra + 1) & 7], rC, record);
+        }
+        value_any(rC, 0);
+    }
+}
+
+/* count_constant
+ * Purpose:    Counts an instruction whose result is known exactly.
+ * Parameters: Analysis_T a - the analysis
+ *             const Value *result - the register it set
+ *             int record - nonzero while recording
+ * Returns:    none
+ */
+static void count_constant(Analysis_T a, const Value *result, int record)
+{
+    if (record && result->count == 1) {
+        a->stats.constant_results++;
+    }
+}
+
+/* run_block
+ * Purpose:    Runs a block from its entry state. During propagation the
+ *             state at its end flows into its successors; while
+ *             recording, its exit, edges and statistics are kept.
+ * Parameters: Analysis_T a - the analysis
+ *             uint32_t index - the block's entry state
+ *             int record - nonzero to record the block
+ * Returns:    none
+ */
+static void run_block(Analysis_T a, uint32_t index, int record)
+{
+    uint32_t start = a->state_pc[index];
+    State state = a->states[index];
+    Analysis_block block;
+    memset(&block, 0, sizeof(block));
+    block.start = start;
+    block.first_successor = a->num_successors;
+
+    uint32_t pc = start;
+    for (;;) {
+        if (pc >= a->num_words) {
+            block.exit = ANALYSIS_END;
+            break;
+        } else if (pc != start && a->state_at[pc] != NO_STATE) {
+            block.exit = ANALYSIS_FALL;
+            follow(a, &block, pc, &state, record);
+            break;
+        }
+        a->covered_by[pc] = index;
+        uint32_t word = a->words[pc++];
+        Value *rA = &state.registers[(word >> RA_LSB) & 7];
+        Value *rB = &state.registers[(word >> RB_LSB) & 7];
+        Value *rC = &state.registers[(word >> RC_LSB) & 7];
+        Um_opcode opcode = word >> OPCODE_LSB;
+
+        if (opcode == HALT) {
+            block.exit = ANALYSIS_HALT;
+            break;
+        } else if (opcode == LOADP) {
+            run_loadp(a, &block, &state, word, record);
+            break;
+        }
+        switch (opcode) {
+            case CMOV:
+                if (may_be_nonzero(rC)) {
+                    if (may_be_zero(rC)) {
+                        value_join(rA, rB);
+                    } else {
+                        *rA = *rB;
+                    }
+                }
+                count_constant(a, rA, record);
+                break;
+            case SLOAD:
+                if (may_be_zero(rB)) {
+                    read_code(a, &block, rC, NULL, record);
+                }
+                value_any(rA, 0);
+                break;
+            case SSTORE:
+                if (may_be_zero(rA)) {
+                    write_code(a, &block, record);
+                }
+                break;
+            case ADD:
+            case MUL:
+            case DIV:
+            case NAND:
+                combine(rA, rB, rC, opcode);
+                count_constant(a, rA, record);
+                break;
+            case ACTIVATE:
+                /* Segment 0 is always mapped, so a new id is never 0 */
+                value_any(rB, 1);
+                break;
+            case IN:
+                value_any(rC, 0);
+                break;
+            case LV:
+                rA = &state.registers[(word >> RA_13_LSB) & 7];
+                value_set(rA, word & LV_VALUE_MASK);
+                count_constant(a, rA, record);
+                break;
+            case SPAWN:
+                /* The new thread starts with 0 in register B */
+                if (rC->count != ANY_VALUE) {
+                    State spawned = state;
+                    value_set(&spawned.registers[(word >> RB_LSB) & 7], 0);
+                    for (int i = 0; i < rC->count; i++) {
+                        if (rC->values[i] < a->num_words && !record) {
+                            enter(a, rC->values[i], &spawned);
+                        }
+                    }
+                }
+                if (record) {
+                    a->stats.spawns++;
+                }
+                value_any(rB, 0);
+                break;
+            case EXTEND:
+                run_extension(a, &block, &state, word, record);
+                break;
+            default:
+                break;
+        }
+    }
+    block.length = pc - start;
+    if (!record) {
+        return;
+    }
+
+    if (a->num_blocks == a->blocks_capacity) {
+        a->blocks_capacity = a->blocks_capacity == 0
+                             ? 64 : 2 * a->blocks_capacity;
+        a->blocks = realloc(a->blocks, a->blocks_capacity *
+                                       sizeof(*a->blocks));
+        assert(a->blocks != NULL);
+    }
+    a->blocks[a->num_blocks++] = block;
+    a->stats.reachable_words += block.length;
+    a->stats.num_edges += block.num_successors;
+    a->stats.jumps += block.exit == ANALYSIS_JUMP;
+    a->stats.indirect_jumps += block.exit == ANALYSIS_INDIRECT;
+    a->stats.program_loads += block.exit == ANALYSIS_LOAD;
+    a->stats.halts += block.exit == ANALYSIS_HALT;
+}
+
+/* Analysis_read_program
+ * Purpose:    Reads a .um file as the UM does: big-endian words, with
+ *             the same checks on the file as read_um_file.
+ * Parameters: const char *filename - the program
+ *             uint32_t *num_words_p - set to the number of words
+ * Returns:    uint32_t * - the words, which the caller frees, or NULL
+ *             (after saying why) if the file is unusable
+ */
+uint32_t *Analysis_read_program(const char *filename, uint32_t *num_words_p)
+{
+    struct stat buf;
+    if (stat(filename, &buf) != 0) {
+        fprintf(stderr, "Could not determine file size.\n");
+        return NULL;
+    }
+    uint64_t num_bytes = buf.st_size;
+    if (num_bytes % 4 != 0) {
+        fprintf(stderr, "Improper total file size.\n");
+        return NULL;
+    } else if (num_bytes / 4 > UINT32_MAX) {
+        fprintf(stderr, "Program is too large for segment 0.\n");
+        return NULL;
+    }
+    FILE *fp = fopen(filename, "r");
+    if (fp == NULL) {
+        fprintf(stderr, "Could not open file.\n");
+        return NULL;
+    }
+
+    uint32_t num_words = num_bytes / 4;
+    uint32_t *words = malloc(((size_t)num_words + 1) * sizeof(*words));
+    assert(words != NULL);
+    uint32_t curr_word = 0;
+    for (uint32_t i = 0; i < num_words; i++) {
+        for (int j = 3; j >= 0; j--) {
+            int curr_byte = getc(fp);
+            if (curr_byte == EOF) {
+                fprintf(stderr, "Could not read contents of file.\n");
+                fclose(fp);
+                free(words);
+                return NULL;
+            }
+            curr_word = Bitpack_newu(curr_word, 8, 8 * j, curr_byte);
+        }
+        words[i] = curr_word;
+    }
+    fclose(fp);
+    *num_words_p = num_words;
+    return words;
+}
+
+/* Analysis_new
+ * Purpose:    Analyzes a program.
+ * Parameters: const uint32_t *words - the program, as in segment 0
+ *             uint32_t num_words - its length
+ * Returns:    Analysis_T - the results; the words must outlive them
+ */
+Analysis_T Analysis_new(const uint32_t *words, uint32_t num_words)
+{
+    Analysis_T a = calloc(1, sizeof(*a));
+    assert(a != NULL);
+    a->words = words;
+    a->num_words = num_words;
+    a->stats.num_words = num_words;
+    size_t per_pc = (size_t)num_words + 1;
+    a->state_at = malloc(per_pc * sizeof(*a->state_at));
+    a->covered_by = malloc(per_pc * sizeof(*a->covered_by));
+    a->read_as_data = calloc(per_pc, 1);
+    assert(a->state_at != NULL && a->covered_by != NULL &&
+           a->read_as_data != NULL);
+    memset(a->state_at, 0xff, per_pc * sizeof(*a->state_at));
+    memset(a->covered_by, 0xff, per_pc * sizeof(*a->covered_by));
+
+    if (num_words > 0) {
+        /* The UM starts at pc 0 with every register 0 */
+        State initial;
+        for (int r = 0; r < NUM_REGISTERS; r++) {
+            value_set(&initial.registers[r], 0);
+        }
+        enter(a, 0, &initial);
+    }
+    while (a->worklist_length > 0) {
+        uint32_t index = a->worklist[--a->worklist_length];
+        a->queued[index] = 0;
+        run_block(a, index, 0);
+    }
+
+    for (uint32_t pc = 0; pc < num_words; pc++) {
+        if (a->state_at[pc] != NO_STATE) {
+            run_block(a, a->state_at[pc], 1);
+        }
+    }
+    a->stats.num_blocks = a->num_blocks;
+    for (uint32_t pc = 0; pc < num_words; pc++) {
+        a->stats.words_read += a->read_as_data[pc];
+        a->stats.code_words_read += a->read_as_data[pc] &&
+                                    a->covered_by[pc] != NO_STATE;
+    }
+
+    /* Only the results are kept */
+    free(a->states);
+    free(a->state_pc);
+    free(a->queued);
+    free(a->worklist);
+    free(a->state_at);
+    free(a->covered_by);
+    a->states = NULL;
+    a->state_pc = NULL;
+    a->queued = NULL;
+    a->worklist = NULL;
+    a->state_at = NULL;
+    a->covered_by = NULL;
+    return a;
+}
+
+/* Analysis_free
+ * Purpose:    Frees the results of an analysis.
+ * Parameters: Analysis_T *analysis_p - the analysis; may be null, and is
+ *                                      set to NULL
+ * Returns:    none
+ */
+void Analysis_free(Analysis_T *analysis_p)
+{
+    if (analysis_p == NULL || *analysis_p == NULL) {
+        return;
+    }
+    Analysis_T a = *analysis_p;
+    free(a->read_as_data);
+    free(a->blocks);
+    free(a->successors);
+    free(a);
+    *analysis_p = NULL;
+}
+
+/* Analysis_num_blocks
+ * Purpose:    Returns the number of reachable blocks.
+ * Parameters: Analysis_T analysis - the analysis
+ * Returns:    uint32_t - the number of blocks
+ */
+uint32_t Analysis_num_blocks(Analysis_T analysis)
+{
+    return analysis->num_blocks;
+}
+
+/* Analysis_block_at
+ * Purpose:    Returns a block by index; blocks are in order of pc.
+ * Parameters: Analysis_T analysis - the analysis
+ *             uint32_t i - the index, less than Analysis_num_blocks
+ * Returns:    const Analysis_block * - the block
+ */
+const Analysis_block *Analysis_block_at(Analysis_T analysis, uint32_t i)
+{
+    return &analysis->blocks[i];
+}
+
+/* Analysis_find_block
+ * Purpose:    Finds the block starting at a pc, e.g. the target of a jump.
+ * Parameters: Analysis_T analysis - the analysis
+ *             uint32_t pc - the pc
+ * Returns:    const Analysis_block * - the block, or NULL if none starts
+ *             there
+ */
+const Analysis_block *Analysis_find_block(Analysis_T analysis, uint32_t pc)
+{
+    uint32_t low = 0, high = analysis->num_blocks;
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        if (analysis->blocks[middle].start < pc) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if (low < analysis->num_blocks && analysis->blocks[low].start == pc) {
+        return &analysis->blocks[low];
+    }
+    return NULL;
+}
+
+/* Analysis_successors
+ * Purpose:    Returns the successors of every block; those of a block
+ *             are num_successors entries from its first_successor.
+ * Parameters: Analysis_T analysis - the analysis
+ * Returns:    const uint32_t * - the first pc of each successor
+ */
+const uint32_t *Analysis_successors(Analysis_T analysis)
+{
+    return analysis->successors;
+}
+
+/* Analysis_read_as_data
+ * Purpose:    Tells whether a word of the program is read as data at an
+ *             offset known ahead of time.
+ * Parameters: Analysis_T analysis - the analysis
+ *             uint32_t pc - the word
+ * Returns:    int - nonzero if it is
+ */
+int Analysis_read_as_data(Analysis_T analysis, uint32_t pc)
+{
+    return pc < analysis->num_words && analysis->read_as_data[pc];
+}
+
+/* Analysis_get_stats
+ * Purpose:    Returns the statistics of an analysis.
+ * Parameters: Analysis_T analysis - the analysis
+ * Returns:    const Analysis_stats * - the statistics
+ */
+const Analysis_stats *Analysis_get_stats(Analysis_T analysis)
+{
+    return &analysis->stats;
+}
+
+/* Analysis_write
+ * Purpose:    Writes the results in a line-oriented text form:
+ *
+ *                 block START LENGTH EXIT FLAGS SUCCESSOR...
+ *                 data FIRST COUNT
+ *                 stat NAME VALUE
+ *
+ *             FLAGS is r if the block may read segment 0 as data, w if
+ *             it may write it, both, or - for neither. Data lines give
+ *             the runs of words read as data at known offsets.
+ * Parameters: Analysis_T analysis - the analysis
+ *             FILE *fp - where to write them
+ * Returns:    none
+ */
+void Analysis_write(Analysis_T analysis, FILE *fp)
+{
+    for (uint32_t i = 0; i < analysis->num_blocks; i++) {
+        const Analysis_block *block = &analysis->blocks[i];
+        fprintf(fp, "block %u %u %s %s%s%s", block->start, block->length,
+                exit_names[block->exit], block->reads_code ? "r" : "",
+                block->writes_code ? "w" : "",
+                block->reads_code || block->writes_code ? "" : "-");
+        for (uint32_t j = 0; j < block->num_successors; j++) {
+            fprintf(fp, " %u",
+                    analysis->successors[block->first_successor + j]);
+        }
+        fputc('\n', fp);
+    }
+    for (uint32_t pc = 0; pc < analysis->num_words; pc++) {
+        if (analysis->read_as_data[pc] &&
+            (pc == 0 || !analysis->read_as_data[pc - 1])) {
+            uint32_t end = pc;
+            while (end < analysis->num_words &&
+                   analysis->read_as_data[end]) {
+                end++;
+            }
+            fprintf(fp, "data %u %u\n", pc, end - pc);
+        }
+    }
+
+    const Analysis_stats *stats = &analysis->stats;
+    fprintf(fp, "stat words %u\n", stats->num_words);
+    fprintf(fp, "stat blocks %u\n", stats->num_blocks);
+    fprintf(fp, "stat reachable_words %u\n", stats->reachable_words);
+    fprintf(fp, "stat edges %u\n", stats->num_edges);
+    fprintf(fp, "stat jumps %u\n", stats->jumps);
+    fprintf(fp, "stat indirect_jumps %u\n", stats->indirect_jumps);
+    fprintf(fp, "stat program_loads %u\n", stats->program_loads);
+    fprintf(fp, "stat bad_targets %u\n", stats->bad_targets);
+    fprintf(fp, "stat halts %u\n", stats->halts);
+    fprintf(fp, "stat spawns %u\n", stats->spawns);
+    fprintf(fp, "stat code_reads %u\n", stats->code_reads);
+    fprintf(fp, "stat unknown_code_reads %u\n", stats->unknown_code_reads);
+    fprintf(fp, "stat code_writes %u\n", stats->code_writes);
+    fprintf(fp, "stat words_read %u\n", stats->words_read);
+    fprintf(fp, "stat code_words_read %u\n", stats->code_words_read);
+    fprintf(fp, "stat constant_results %u\n", stats->constant_results);
+}
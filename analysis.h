@@ -0,0 +1,96 @@
+/******************************************************************************
+ *
+ *                                analysis.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for the static analysis of a UM program image,
+ *                 for engines that want to know ahead of time where jumps
+ *                 go. The UM has no branch instruction: every jump is a
+ *                 LOADP of segment 0 to the pc in register C, which the
+ *                 program usually sets with LV, CMOV or a little
+ *                 arithmetic just before. The analysis tracks the
+ *                 registers through the program as small sets of known
+ *                 values, starting from the all-zero registers the UM
+ *                 starts with, and so finds the basic blocks reachable
+ *                 from pc 0 and the edges between them.
+ *
+ *                 It also finds the words of segment 0 that SLOAD (or a
+ *                 bulk copy) reads as data, and the instructions that may
+ *                 write segment 0, since code that is rewritten or read
+ *                 as data is where an engine's assumptions about segment
+ *                 0 stop holding.
+ *
+ *                 A block ends at a LOADP or HALT, at the start of another
+ *                 block, or at the end of the program. Its exit is one of:
+ *
+ *                     fall     - runs into the next block
+ *                     jump     - LOADP of segment 0 to known targets
+ *                     indirect - LOADP of segment 0 to an unknown target
+ *                     load     - LOADP that may replace segment 0; any
+ *                                targets in the current program are kept
+ *                     halt     - HALT
+ *                     end      - runs off the end of the program
+ *
+ *****************************************************************************/
+
+#ifndef ANALYSIS_H
+#define ANALYSIS_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+typedef enum Analysis_exit {
+    ANALYSIS_FALL = 0, ANALYSIS_JUMP, ANALYSIS_INDIRECT, ANALYSIS_LOAD,
+    ANALYSIS_HALT, ANALYSIS_END
+} Analysis_exit;
+
+typedef struct Analysis_block {
+    uint32_t start;            /* pc of the first instruction */
+    uint32_t length;           /* instructions in the block */
+    Analysis_exit exit;
+    uint32_t first_successor;  /* index into Analysis_successors */
+    uint32_t num_successors;
+    int reads_code;            /* may read segment 0 as data */
+    int writes_code;           /* may write segment 0 */
+} Analysis_block;
+
+typedef struct Analysis_stats {
+    uint32_t num_words;
+    uint32_t num_blocks;
+    uint32_t reachable_words;
+    uint32_t num_edges;
+    uint32_t jumps;               /* LOADPs with known targets */
+    uint32_t indirect_jumps;      /* LOADPs of segment 0, target unknown */
+    uint32_t program_loads;       /* LOADPs that may replace segment 0 */
+    uint32_t bad_targets;         /* known targets past the program */
+    uint32_t halts;
+    uint32_t spawns;              /* SPAWNs (opcode 14) reached */
+    uint32_t code_reads;          /* instructions that may read segment 0 */
+    uint32_t unknown_code_reads;  /* ... at an offset not known */
+    uint32_t code_writes;         /* instructions that may write it */
+    uint32_t words_read;          /* words read as data at known offsets */
+    uint32_t code_words_read;     /* ... that are also reachable code */
+    uint32_t constant_results;    /* instructions with one known result */
+} Analysis_stats;
+
+typedef struct Analysis_T *Analysis_T;
+
+extern uint32_t *Analysis_read_program(const char *filename,
+                                       uint32_t *num_words_p);
+extern Analysis_T Analysis_new(const uint32_t *words, uint32_t num_words);
+extern void Analysis_free(Analysis_T *analysis_p);
+
+extern uint32_t Analysis_num_blocks(Analysis_T analysis);
+extern const Analysis_block *Analysis_block_at(Analysis_T analysis,
+                                               uint32_t i);
+extern const Analysis_block *Analysis_find_block(Analysis_T analysis,
+                                                 uint32_t pc);
+extern const uint32_t *Analysis_successors(Analysis_T analysis);
+extern int Analysis_read_as_data(Analysis_T analysis, uint32_t pc);
+extern const Analysis_stats *Analysis_get_stats(Analysis_T analysis);
+extern void Analysis_write(Analysis_T analysis, FILE *fp);
+
+#endif
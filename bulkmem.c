@@ -0,0 +1,92 @@
+/******************************************************************************
+ *
+ *                                bulkmem.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the bulk memory kernels outlined in
+ *                 bulkmem.h. Copies go through memmove, which the C
+ *                 library already implements with the widest vector
+ *                 instructions the host has. Fill and compare work a
+ *                 vector of eight words at a time using GCC's generic
+ *                 vector types, which compile to SSE2 pairs on a plain
+ *                 x86-64 build and to single AVX2 instructions where that
+ *                 is enabled; segment storage is only word-aligned, so
+ *                 vectors are moved in and out with memcpy.
+ *
+ *****************************************************************************/
+
+#include <string.h>
+#include "bulkmem.h"
+
+#define VECTOR_WORDS 8
+
+typedef uint32_t Vector __attribute__((vector_size(VECTOR_WORDS *
+                                                   sizeof(uint32_t))));
+
+/* Bulkmem_copy
+ * Purpose:    Copies words, as memmove would.
+ * Parameters: uint32_t *destination - where to copy to
+ *             const uint32_t *source - where to copy from; may overlap
+ *                                      destination
+ *             size_t num_words - how many words to copy
+ * Returns:    none
+ */
+void Bulkmem_copy(uint32_t *destination, const uint32_t *source,
+                  size_t num_words)
+{
+    memmove(destination, source, num_words * sizeof(*destination));
+}
+
+/* Bulkmem_fill
+ * Purpose:    Sets words to a value.
+ * Parameters: uint32_t *destination - the first word
+ *             uint32_t value - the value
+ *             size_t num_words - how many words to set
+ * Returns:    none
+ */
+void Bulkmem_fill(uint32_t *destination, uint32_t value, size_t num_words)
+{
+    Vector fill = { 0 };
+    fill += value;
+    size_t i = 0;
+    for (; i + VECTOR_WORDS <= num_words; i += VECTOR_WORDS) {
+        memcpy(&destination[i], &fill, sizeof(fill));
+    }
+    for (; i < num_words; i++) {
+        destination[i] = value;
+    }
+}
+
+/* Bulkmem_compare
+ * Purpose:    Finds where two runs of words first differ.
+ * Parameters: const uint32_t *a, const uint32_t *b - the runs
+ *             size_t num_words - how many words to compare
+ * Returns:    size_t - the number of leading words that are equal, which
+ *             is num_words if all are
+ */
+size_t Bulkmem_compare(const uint32_t *a, const uint32_t *b,
+                       size_t num_words)
+{
+    size_t i = 0;
+    for (; i + VECTOR_WORDS <= num_words; i += VECTOR_WORDS) {
+        Vector x, y;
+        memcpy(&x, &a[i], sizeof(x));
+        memcpy(&y, &b[i], sizeof(y));
+        Vector differ = x ^ y;
+        uint32_t any = 0;
+        for (int j = 0; j < VECTOR_WORDS; j++) {
+            any |= differ[j];
+        }
+        if (any != 0) {
+            break;
+        }
+    }
+    /* Finishes the tail, or finds the word within the differing vector */
+    while (i < num_words && a[i] == b[i]) {
+        i++;
+    }
+    return i;
+}
@@ -0,0 +1,31 @@
+/******************************************************************************
+ *
+ *                                bulkmem.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for the host kernels behind the bulk memory
+ *                 extension (--bulk-memory): copying, filling and
+ *                 comparing runs of words, which guests would otherwise do
+ *                 one SLOAD or SSTORE, and one dispatch, per word. The
+ *                 kernels work on raw segment storage; the interpreter
+ *                 checks bounds and keeps its own bookkeeping in step.
+ *
+ *****************************************************************************/
+
+#ifndef BULKMEM_H
+#define BULKMEM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+extern void Bulkmem_copy(uint32_t *destination, const uint32_t *source,
+                         size_t num_words);
+extern void Bulkmem_fill(uint32_t *destination, uint32_t value,
+                         size_t num_words);
+extern size_t Bulkmem_compare(const uint32_t *a, const uint32_t *b,
+                              size_t num_words);
+
+#endif
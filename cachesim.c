@@ -0,0 +1,297 @@
+/******************************************************************************
+ *
+ *                               cachesim.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the cache simulator outlined in
+ *                 cachesim.h. Each set keeps its tags in order of use,
+ *                 most recent first, so a hit moves a tag to the front
+ *                 and a miss evicts the last one. Statistics are kept per
+ *                 segment (data accesses) and per region of REGION_WORDS
+ *                 program counters (both kinds), in arrays that grow as
+ *                 higher segment ids and program counters turn up.
+ *
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cachesim.h"
+#include "assert.h"
+
+/* Program counters per region of the report */
+#define REGION_WORDS 256
+
+typedef struct Cache {
+    unsigned line_bits;     /* log2 of the line size */
+    unsigned num_sets;      /* a power of two */
+    unsigned ways;
+    uintptr_t *tags;        /* num_sets * ways, each set most recent first */
+    uint64_t accesses;
+    uint64_t misses;
+} Cache;
+
+typedef struct Counts {
+    uint64_t accesses;
+    uint64_t misses;
+} Counts;
+
+typedef struct Region {
+    Counts fetch;
+    Counts data;
+} Region;
+
+static Cache instruction_cache, data_cache;
+static Counts *segments = NULL;
+static size_t num_segments = 0;
+static Region *regions = NULL;
+static size_t num_regions = 0;
+static const char *report_name = NULL;
+
+/* is_power_of_two
+ * Purpose:    Tells whether a number is a power of two.
+ * Parameters: unsigned long n - the number
+ * Returns:    int - nonzero if it is
+ */
+static int is_power_of_two(unsigned long n)
+{
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+/* cache_init
+ * Purpose:    Sets up an empty cache from a geometry.
+ * Parameters: Cache *cache - the cache
+ *             const char *geometry - "SIZE:LINE:WAYS", all in bytes but
+ *                                    the number of ways
+ * Returns:    none
+ * Notes:      Exits with EXIT_FAILURE if the geometry is not one with a
+ *             power-of-two line size and number of sets.
+ */
+static void cache_init(Cache *cache, const char *geometry)
+{
+    unsigned long size, line, ways;
+    if (sscanf(geometry, "%lu:%lu:%lu", &size, &line, &ways) != 3 ||
+        !is_power_of_two(line) || ways == 0 || size % (line * ways) != 0 ||
+        !is_power_of_two(size / (line * ways))) {
+        fprintf(stderr, "Cache geometry must be SIZE:LINE:WAYS with a "
+                "power-of-two line size and number of sets.\n");
+        exit(EXIT_FAILURE);
+    }
+    cache->line_bits = 0;
+    while ((1UL << cache->line_bits) < line) {
+        cache->line_bits++;
+    }
+    cache->num_sets = size / (line * ways);
+    cache->ways = ways;
+    cache->tags = malloc((size_t)cache->num_sets * ways *
+                         sizeof(*cache->tags));
+    assert(cache->tags != NULL);
+    /* No real line has the all-ones tag */
+    memset(cache->tags, 0xff, (size_t)cache->num_sets * ways *
+                              sizeof(*cache->tags));
+    cache->accesses = 0;
+    cache->misses = 0;
+}
+
+/* cache_access
+ * Purpose:    Simulates one access to a cache.
+ * Parameters: Cache *cache - the cache
+ *             const void *address - the host address accessed
+ * Returns:    int - 1 for a miss, 0 for a hit
+ */
+static int cache_access(Cache *cache, const void *address)
+{
+    uintptr_t tag = (uintptr_t)address >> cache->line_bits;
+    uintptr_t *set = &cache->tags[(tag & (cache->num_sets - 1)) *
+                                  cache->ways];
+    unsigned way = 0;
+    while (way < cache->ways && set[way] != tag) {
+        way++;
+    }
+    int miss = (way == cache->ways);
+    if (miss) {
+        way = cache->ways - 1;
+        cache->misses++;
+    }
+    memmove(&set[1], &set[0], way * sizeof(*set));
+    set[0] = tag;
+    cache->accesses++;
+    return miss;
+}
+
+/* grow
+ * Purpose:    Makes a zero-filled array long enough for an index.
+ * Parameters: void *array - the array, or NULL
+ *             size_t *length_p - its length, updated
+ *             size_t index - the index that must fit
+ *             size_t size - the size of an element
+ * Returns:    void * - the array, possibly moved
+ */
+static void *grow(void *array, size_t *length_p, size_t index, size_t size)
+{
+    size_t length = *length_p > 0 ? *length_p : 64;
+    while (length <= index) {
+        length *= 2;
+    }
+    array = realloc(array, length * size);
+    assert(array != NULL);
+    memset((char *)array + *length_p * size, 0,
+           (length - *length_p) * size);
+    *length_p = length;
+    return array;
+}
+
+/* region_at
+ * Purpose:    Finds the statistics of the region holding a program counter.
+ * Parameters: uint32_t pc - the program counter
+ * Returns:    Region * - the region's statistics
+ */
+static Region *region_at(uint32_t pc)
+{
+    size_t index = pc / REGION_WORDS;
+    if (index >= num_regions) {
+        regions = grow(regions, &num_regions, index, sizeof(*regions));
+    }
+    return &regions[index];
+}
+
+/* Cachesim_start
+ * Purpose:    Starts simulating, with the report written at exit.
+ * Parameters: const char *report_filename - where the report is written
+ *                                           ("-" for stderr)
+ *             const char *geometry - "SIZE:LINE:WAYS" for both caches
+ * Returns:    none
+ */
+void Cachesim_start(const char *report_filename, const char *geometry)
+{
+    report_name = report_filename;
+    cache_init(&instruction_cache, geometry);
+    cache_init(&data_cache, geometry);
+    atexit(Cachesim_stop);
+}
+
+/* Cachesim_fetch
+ * Purpose:    Simulates fetching an instruction.
+ * Parameters: uint32_t pc - its program counter
+ *             const uint32_t *address - where segment 0 holds it
+ * Returns:    none
+ */
+void Cachesim_fetch(uint32_t pc, const uint32_t *address)
+{
+    Counts *counts = &region_at(pc)->fetch;
+    counts->accesses++;
+    counts->misses += cache_access(&instruction_cache, address);
+}
+
+/* Cachesim_data
+ * Purpose:    Simulates an SLOAD or SSTORE of a word.
+ * Parameters: uint32_t pc - the program counter of the instruction
+ *             uint32_t segment - the segment id of the word
+ *             const uint32_t *address - where the word is stored
+ * Returns:    none
+ */
+void Cachesim_data(uint32_t pc, uint32_t segment, const uint32_t *address)
+{
+    int miss = cache_access(&data_cache, address);
+    Counts *counts = &region_at(pc)->data;
+    counts->accesses++;
+    counts->misses += miss;
+    if (segment >= num_segments) {
+        segments = grow(segments, &num_segments, segment,
+                        sizeof(*segments));
+    }
+    segments[segment].accesses++;
+    segments[segment].misses += miss;
+}
+
+/* hit_rate
+ * Purpose:    Works out the percentage of accesses that hit.
+ * Parameters: uint64_t accesses, uint64_t misses - the counts
+ * Returns:    double - the hit rate in percent (100 if none)
+ */
+static double hit_rate(uint64_t accesses, uint64_t misses)
+{
+    return accesses == 0 ? 100.0 : 100.0 * (accesses - misses) / accesses;
+}
+
+/* write_report
+ * Purpose:    Writes the totals, then a line per segment and per region
+ *             with any accesses.
+ * Parameters: FILE *fp - where to write
+ * Returns:    none
+ */
+static void write_report(FILE *fp)
+{
+    fprintf(fp, "# %u sets, %u ways, %u-byte lines\n",
+            data_cache.num_sets, data_cache.ways, 1U << data_cache.line_bits);
+    fprintf(fp, "icache %llu accesses %llu misses %.2f%% hits\n",
+            (unsigned long long)instruction_cache.accesses,
+            (unsigned long long)instruction_cache.misses,
+            hit_rate(instruction_cache.accesses, instruction_cache.misses));
+    fprintf(fp, "dcache %llu accesses %llu misses %.2f%% hits\n",
+            (unsigned long long)data_cache.accesses,
+            (unsigned long long)data_cache.misses,
+            hit_rate(data_cache.accesses, data_cache.misses));
+
+    fprintf(fp, "\n# segment\taccesses\tmisses\thit%%\n");
+    for (size_t i = 0; i < num_segments; i++) {
+        if (segments[i].accesses != 0) {
+            fprintf(fp, "%zu\t%llu\t%llu\t%.2f\n", i,
+                    (unsigned long long)segments[i].accesses,
+                    (unsigned long long)segments[i].misses,
+                    hit_rate(segments[i].accesses, segments[i].misses));
+        }
+    }
+
+    fprintf(fp, "\n# pc\tfetches\tfetch misses\tfetch hit%%\t"
+            "data\tdata misses\tdata hit%%\n");
+    for (size_t i = 0; i < num_regions; i++) {
+        Region *region = &regions[i];
+        if (region->fetch.accesses == 0) {
+            continue;
+        }
+        fprintf(fp, "%zu-%zu\t%llu\t%llu\t%.2f\t%llu\t%llu\t%.2f\n",
+                i * REGION_WORDS, (i + 1) * REGION_WORDS - 1,
+                (unsigned long long)region->fetch.accesses,
+                (unsigned long long)region->fetch.misses,
+                hit_rate(region->fetch.accesses, region->fetch.misses),
+                (unsigned long long)region->data.accesses,
+                (unsigned long long)region->data.misses,
+                hit_rate(region->data.accesses, region->data.misses));
+    }
+}
+
+/* Cachesim_stop
+ * Purpose:    Writes the report and frees the simulator. Safe to call more
+ *             than once.
+ * Parameters: none
+ * Returns:    none
+ */
+void Cachesim_stop(void)
+{
+    if (report_name == NULL) {
+        return;
+    }
+    FILE *fp = strcmp(report_name, "-") == 0 ? stderr
+                                              : fopen(report_name, "w");
+    if (fp == NULL) {
+        fprintf(stderr, "Could not write locality report to %s.\n",
+                report_name);
+    } else {
+        write_report(fp);
+        if (fp != stderr) {
+            fclose(fp);
+        }
+    }
+    free(instruction_cache.tags);
+    free(data_cache.tags);
+    free(segments);
+    free(regions);
+    segments = NULL;
+    regions = NULL;
+    num_segments = num_regions = 0;
+    report_name = NULL;
+}
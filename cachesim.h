@@ -0,0 +1,35 @@
+/******************************************************************************
+ *
+ *                               cachesim.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for the locality analysis mode. The interpreter
+ *                 reports every instruction fetch and every word SLOAD and
+ *                 SSTORE touch, at the host address where it is stored, to
+ *                 a simulated set-associative instruction cache and data
+ *                 cache with LRU replacement. Hit rates are reported per
+ *                 segment and per region of program counters, which tells
+ *                 whether misses come from the way main memory lays the
+ *                 segments out or from the guest's own access pattern.
+ *
+ *****************************************************************************/
+
+#ifndef CACHESIM_H
+#define CACHESIM_H
+
+#include <stdint.h>
+
+/* Cache geometry used unless another is given: 32KB, 64-byte lines, 8-way */
+#define CACHESIM_DEFAULT_GEOMETRY "32768:64:8"
+
+extern void Cachesim_start(const char *report_filename,
+                           const char *geometry);
+extern void Cachesim_fetch(uint32_t pc, const uint32_t *address);
+extern void Cachesim_data(uint32_t pc, uint32_t segment,
+                          const uint32_t *address);
+extern void Cachesim_stop(void);
+
+#endif
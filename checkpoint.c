@@ -0,0 +1,741 @@
+/******************************************************************************
+ *
+ *                               checkpoint.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the incremental checkpoints outlined in
+ *                 checkpoint.h. A checkpoint directory holds
+ *
+ *                     base       a full snapshot, including every
+ *                                increment up to its sequence number
+ *                     incr.<n>   the changes of checkpoint n
+ *
+ *                 and every file is written to a temporary name and renamed
+ *                 into place, so a crash never leaves a torn checkpoint.
+ *                 Files are in host byte order: a header (magic, kind,
+ *                 segment table size, sequence number, machine state)
+ *                 followed by tagged records:
+ *
+ *                     SEGMENT id length words...   whole segment
+ *                     RANGE id first count words...  part of a segment
+ *                     FREE count ids...            the unmapped addresses,
+ *                                                  in stack order
+ *                     END
+ *
+ *                 Compaction loads the base and its increments into an
+ *                 image, writes the image as the new base and deletes the
+ *                 increments it absorbed.
+ *
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include "checkpoint.h"
+#include "assert.h"
+
+#define MAGIC "UMCKPT01"
+#define MAGIC_LENGTH 8
+#define KIND_BASE 0
+#define KIND_INCREMENT 1
+#define TAG_SEGMENT 1
+#define TAG_RANGE 2
+#define TAG_FREE 3
+#define TAG_END 4
+
+#define PAGE_SHIFT 10          /* 1024 words: one 4KB page */
+#define MAX_CHUNKS 64
+#define COMPACT_AFTER 8        /* increments merged into the base */
+#define PATH_LENGTH 4096
+
+/* A checkpoint loaded from disk */
+typedef struct Image {
+    uint32_t num_segments;
+    uint32_t *lengths;
+    uint32_t **words;
+    uint32_t num_free;
+    uint32_t *free;
+    uint64_t sequence;
+    Checkpoint_machine machine;
+} Image;
+
+volatile sig_atomic_t Checkpoint_pending = 0;
+Checkpoint_segment *Checkpoint_segments = NULL;
+
+static uint32_t num_tracked = 0;
+static size_t tracked_capacity = 0;
+static const char *checkpoint_dir = NULL;
+static uint64_t sequence = 0;        /* newest checkpoint on disk */
+static uint64_t base_sequence = 0;   /* newest checkpoint in the base */
+static int have_base = 0;
+
+/* alarm_handler
+ * Purpose:    Asks the interpreter for a checkpoint at its next block
+ *             boundary.
+ * Parameters: int signum - SIGALRM
+ * Returns:    none
+ */
+static void alarm_handler(int signum)
+{
+    Checkpoint_pending = 1;
+    (void)signum;
+}
+
+/* checkpoint_path
+ * Purpose:    Builds the name of a file in the checkpoint directory.
+ * Parameters: char *path - a buffer of PATH_LENGTH bytes
+ *             const char *name - "base" or "tmp", or NULL for an increment
+ *             uint64_t number - the increment's sequence number
+ * Returns:    char * - path
+ */
+static char *checkpoint_path(char *path, const char *name, uint64_t number)
+{
+    if (name != NULL) {
+        snprintf(path, PATH_LENGTH, "%s/%s", checkpoint_dir, name);
+    } else {
+        snprintf(path, PATH_LENGTH, "%s/incr.%llu", checkpoint_dir,
+                 (unsigned long long)number);
+    }
+    return path;
+}
+
+/* write_words
+ * Purpose:    Writes an array of words, exiting if the write fails.
+ * Parameters: FILE *fp - the open checkpoint file
+ *             const void *words - the data
+ *             size_t count - the number of 32-bit words
+ * Returns:    none
+ */
+static void write_words(FILE *fp, const void *words, size_t count)
+{
+    if (count > 0 && fwrite(words, sizeof(uint32_t), count, fp) != count) {
+        fprintf(stderr, "Could not write checkpoint.\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/* write_word
+ * Purpose:    Writes a single word.
+ * Parameters: FILE *fp - the open checkpoint file
+ *             uint32_t word - the value
+ * Returns:    none
+ */
+static void write_word(FILE *fp, uint32_t word)
+{
+    write_words(fp, &word, 1);
+}
+
+/* read_words
+ * Purpose:    Reads an array of words, exiting if the file is truncated.
+ * Parameters: FILE *fp - the open checkpoint file
+ *             void *words - where to put the data
+ *             size_t count - the number of 32-bit words
+ * Returns:    none
+ */
+static void read_words(FILE *fp, void *words, size_t count)
+{
+    if (count > 0 && fread(words, sizeof(uint32_t), count, fp) != count) {
+        fprintf(stderr, "Checkpoint is truncated.\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/* read_word
+ * Purpose:    Reads a single word.
+ * Parameters: FILE *fp - the open checkpoint file
+ * Returns:    uint32_t - the value
+ */
+static uint32_t read_word(FILE *fp)
+{
+    uint32_t word;
+    read_words(fp, &word, 1);
+    return word;
+}
+
+/* open_file
+ * Purpose:    Starts a checkpoint file.
+ * Parameters: const char *path - where to write it
+ *             int kind - KIND_BASE or KIND_INCREMENT
+ *             uint32_t num_segments - the size of the segment table
+ *             uint64_t number - the checkpoint's sequence number
+ *             const Checkpoint_machine *machine - the machine state
+ * Returns:    FILE * - the file, positioned after the header
+ */
+static FILE *open_file(const char *path, int kind, uint32_t num_segments,
+                       uint64_t number, const Checkpoint_machine *machine)
+{
+    FILE *fp = fopen(path, "wb");
+    if (fp == NULL) {
+        fprintf(stderr, "Could not create checkpoint %s.\n", path);
+        exit(EXIT_FAILURE);
+    }
+    fwrite(MAGIC, 1, MAGIC_LENGTH, fp);
+    write_word(fp, kind);
+    write_word(fp, num_segments);
+    write_words(fp, &number, 2);
+    write_words(fp, machine->registers, CHECKPOINT_NUM_REGISTERS);
+    write_word(fp, machine->program_pointer);
+    write_words(fp, &machine->instructions_retired, 2);
+    return fp;
+}
+
+/* commit_file
+ * Purpose:    Finishes a checkpoint file and atomically renames it.
+ * Parameters: FILE *fp - the file from open_file
+ *             const char *from - the name it was written under
+ *             const char *to - its final name
+ * Returns:    none
+ */
+static void commit_file(FILE *fp, const char *from, const char *to)
+{
+    write_word(fp, TAG_END);
+    if (fflush(fp) != 0 || fsync(fileno(fp)) != 0 || fclose(fp) != 0 ||
+        rename(from, to) != 0) {
+        fprintf(stderr, "Could not write checkpoint %s.\n", to);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/* open_temporary
+ * Purpose:    Starts a file in the checkpoint directory under the
+ *             temporary name.
+ * Parameters: int kind - KIND_BASE or KIND_INCREMENT
+ *             uint32_t num_segments - the size of the segment table
+ *             uint64_t number - the checkpoint's sequence number
+ *             const Checkpoint_machine *machine - the machine state
+ * Returns:    FILE * - the file, positioned after the header
+ */
+static FILE *open_temporary(int kind, uint32_t num_segments, uint64_t number,
+                            const Checkpoint_machine *machine)
+{
+    char path[PATH_LENGTH];
+    return open_file(checkpoint_path(path, "tmp", 0), kind, num_segments,
+                     number, machine);
+}
+
+/* commit_temporary
+ * Purpose:    Finishes a file from open_temporary and gives it its name.
+ * Parameters: FILE *fp - the file from open_temporary
+ *             const char *name - "base", or NULL for an increment
+ *             uint64_t number - the increment's sequence number
+ * Returns:    none
+ */
+static void commit_temporary(FILE *fp, const char *name, uint64_t number)
+{
+    char from[PATH_LENGTH], to[PATH_LENGTH];
+    checkpoint_path(from, "tmp", 0);
+    checkpoint_path(to, name, number);
+    commit_file(fp, from, to);
+}
+
+/* write_free_list
+ * Purpose:    Writes the FREE record of the live memory.
+ * Parameters: FILE *fp - the open checkpoint file
+ *             Mem_T mem - main memory
+ * Returns:    none
+ */
+static void write_free_list(FILE *fp, Mem_T mem)
+{
+    uint32_t num_free = Mem_num_free(mem);
+    write_word(fp, TAG_FREE);
+    write_word(fp, num_free);
+    for (uint32_t i = 0; i < num_free; i++) {
+        write_word(fp, Mem_free_at(mem, i));
+    }
+}
+
+/* write_segment
+ * Purpose:    Writes a SEGMENT record.
+ * Parameters: FILE *fp - the open checkpoint file
+ *             uint32_t address - the segment
+ *             const uint32_t *words - its contents
+ *             uint32_t length - its length
+ * Returns:    none
+ */
+static void write_segment(FILE *fp, uint32_t address, const uint32_t *words,
+                          uint32_t length)
+{
+    write_word(fp, TAG_SEGMENT);
+    write_word(fp, address);
+    write_word(fp, length);
+    write_words(fp, words, length);
+}
+
+/* write_chunks
+ * Purpose:    Writes a RANGE record for each dirty chunk of a segment.
+ * Parameters: FILE *fp - the open checkpoint file
+ *             uint32_t address - the segment
+ *             Mem_segment segment - its descriptor
+ *             const Checkpoint_segment *dirty - its dirty map
+ * Returns:    none
+ */
+static void write_chunks(FILE *fp, uint32_t address, Mem_segment segment,
+                         const Checkpoint_segment *dirty)
+{
+    uint64_t chunks = dirty->chunks;
+    while (chunks != 0) {
+        int k = __builtin_ctzll(chunks);
+        chunks &= chunks - 1;
+        uint32_t first = (uint32_t)k << dirty->shift;
+        if (first >= segment->length) {
+            break;
+        }
+        uint32_t count = (uint32_t)1 << dirty->shift;
+        if (count > segment->length - first) {
+            count = segment->length - first;
+        }
+        write_word(fp, TAG_RANGE);
+        write_word(fp, address);
+        write_word(fp, first);
+        write_word(fp, count);
+        write_words(fp, segment->data + first, count);
+    }
+}
+
+/* grow_image
+ * Purpose:    Makes room for num_segments segments in an image.
+ * Parameters: Image *image - the image
+ *             uint32_t num_segments - the new size of its segment table
+ * Returns:    none
+ */
+static void grow_image(Image *image, uint32_t num_segments)
+{
+    if (num_segments <= image->num_segments) {
+        return;
+    }
+    image->lengths = realloc(image->lengths,
+                             (size_t)num_segments * sizeof(*image->lengths));
+    image->words = realloc(image->words,
+                           (size_t)num_segments * sizeof(*image->words));
+    assert(image->lengths != NULL && image->words != NULL);
+    for (uint32_t i = image->num_segments; i < num_segments; i++) {
+        image->lengths[i] = 0;
+        image->words[i] = NULL;
+    }
+    image->num_segments = num_segments;
+}
+
+/* load_file
+ * Purpose:    Applies one checkpoint file to an image.
+ * Parameters: Image *image - the image (empty for a base)
+ *             const char *path - the file
+ * Returns:    int - 1 if the file was applied, 0 if it does not exist
+ */
+static int load_file(Image *image, const char *path)
+{
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) {
+        return 0;
+    }
+    char magic[MAGIC_LENGTH];
+    if (fread(magic, 1, MAGIC_LENGTH, fp) != MAGIC_LENGTH ||
+        memcmp(magic, MAGIC, MAGIC_LENGTH) != 0) {
+        fprintf(stderr, "%s is not a UM checkpoint.\n", path);
+        exit(EXIT_FAILURE);
+    }
+    read_word(fp);
+    grow_image(image, read_word(fp));
+    read_words(fp, &image->sequence, 2);
+    read_words(fp, image->machine.registers, CHECKPOINT_NUM_REGISTERS);
+    image->machine.program_pointer = read_word(fp);
+    read_words(fp, &image->machine.instructions_retired, 2);
+
+    uint32_t tag, address, first, count;
+    while ((tag = read_word(fp)) != TAG_END) {
+        switch (tag) {
+            case TAG_SEGMENT:
+                address = read_word(fp);
+                count = read_word(fp);
+                grow_image(image, address + 1);
+                image->words[address] = realloc(image->words[address],
+                                                ((size_t)count + 1) *
+                                                sizeof(uint32_t));
+                assert(image->words[address] != NULL);
+                image->lengths[address] = count;
+                read_words(fp, image->words[address], count);
+                break;
+            case TAG_RANGE:
+                address = read_word(fp);
+                first = read_word(fp);
+                count = read_word(fp);
+                if (address >= image->num_segments ||
+                    (uint64_t)first + count > image->lengths[address]) {
+                    fprintf(stderr, "%s is corrupt.\n", path);
+                    exit(EXIT_FAILURE);
+                }
+                read_words(fp, image->words[address] + first, count);
+                break;
+            case TAG_FREE:
+                image->num_free = read_word(fp);
+                image->free = realloc(image->free,
+                                      ((size_t)image->num_free + 1) *
+                                      sizeof(uint32_t));
+                assert(image->free != NULL);
+                read_words(fp, image->free, image->num_free);
+                break;
+            default:
+                fprintf(stderr, "%s is corrupt.\n", path);
+                exit(EXIT_FAILURE);
+        }
+    }
+    fclose(fp);
+    return 1;
+}
+
+/* load_image
+ * Purpose:    Loads the base and every later increment on disk.
+ * Parameters: Image *image - an empty image to fill in
+ * Returns:    int - 1 if there was a checkpoint to load, 0 otherwise
+ * Notes:      Sets base_sequence and sequence to match the files.
+ */
+static int load_image(Image *image)
+{
+    char path[PATH_LENGTH];
+    memset(image, 0, sizeof(*image));
+    if (!load_file(image, checkpoint_path(path, "base", 0))) {
+        return 0;
+    }
+    base_sequence = image->sequence;
+    while (load_file(image, checkpoint_path(path, NULL,
+                                            image->sequence + 1))) {
+    }
+    sequence = image->sequence;
+    return 1;
+}
+
+/* free_image
+ * Purpose:    Frees an image's memory.
+ * Parameters: Image *image - the image
+ * Returns:    none
+ */
+static void free_image(Image *image)
+{
+    for (uint32_t i = 0; i < image->num_segments; i++) {
+        free(image->words[i]);
+    }
+    free(image->words);
+    free(image->lengths);
+    free(image->free);
+}
+
+/* remove_increments
+ * Purpose:    Deletes the increment files with sequence numbers in a range.
+ * Parameters: uint64_t first, uint64_t last - the range (inclusive)
+ * Returns:    none
+ */
+static void remove_increments(uint64_t first, uint64_t last)
+{
+    char path[PATH_LENGTH];
+    for (uint64_t n = first; n <= last; n++) {
+        unlink(checkpoint_path(path, NULL, n));
+    }
+}
+
+/* compact
+ * Purpose:    Merges the base and its increments into a new base, then
+ *             deletes the increments.
+ * Parameters: none
+ * Returns:    none
+ */
+static void compact(void)
+{
+    Image image;
+    uint64_t old_base = base_sequence;
+    load_image(&image);
+
+    char *is_free = calloc((size_t)image.num_segments + 1, 1);
+    assert(is_free != NULL);
+    for (uint32_t i = 0; i < image.num_free; i++) {
+        is_free[image.free[i]] = 1;
+    }
+    FILE *fp = open_temporary(KIND_BASE, image.num_segments, image.sequence,
+                              &image.machine);
+    for (uint32_t i = 0; i < image.num_segments; i++) {
+        if (!is_free[i]) {
+            write_segment(fp, i, image.words[i], image.lengths[i]);
+        }
+    }
+    write_word(fp, TAG_FREE);
+    write_word(fp, image.num_free);
+    write_words(fp, image.free, image.num_free);
+    commit_temporary(fp, "base", 0);
+
+    base_sequence = image.sequence;
+    remove_increments(old_base + 1, base_sequence);
+    free(is_free);
+    free_image(&image);
+}
+
+/* chunk_shift
+ * Purpose:    Picks the chunk size of a segment's dirty map.
+ * Parameters: uint32_t length - the segment's length
+ * Returns:    uint8_t - log2 of the chunk size in words
+ */
+static uint8_t chunk_shift(uint32_t length)
+{
+    uint8_t shift = PAGE_SHIFT;
+    while (((uint64_t)length + ((uint64_t)1 << shift) - 1) >> shift >
+           MAX_CHUNKS) {
+        shift++;
+    }
+    return shift;
+}
+
+/* Checkpoint_start
+ * Purpose:    Starts taking a checkpoint every interval_s seconds.
+ * Parameters: const char *directory - where checkpoints are kept (must
+ *                                     exist)
+ *             unsigned interval_s - the interval, in wall-clock seconds
+ * Returns:    none
+ */
+void Checkpoint_start(const char *directory, unsigned interval_s)
+{
+    checkpoint_dir = directory;
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = alarm_handler;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGALRM, &action, NULL);
+
+    struct itimerval timer;
+    timer.it_interval.tv_sec = interval_s;
+    timer.it_interval.tv_usec = 0;
+    timer.it_value = timer.it_interval;
+    setitimer(ITIMER_REAL, &timer, NULL);
+}
+
+/* rebuild_memory
+ * Purpose:    Creates main memory holding a loaded checkpoint.
+ * Parameters: Image *image - the checkpoint
+ *             int program_page_flags - passed on to Mem_new
+ *             Checkpoint_machine *machine - filled in with the registers,
+ *                                           program pointer and count
+ * Returns:    Mem_T - the restored memory
+ */
+static Mem_T rebuild_memory(Image *image, int program_page_flags,
+                            Checkpoint_machine *machine)
+{
+    char *is_free = calloc((size_t)image->num_segments + 1, 1);
+    assert(is_free != NULL);
+    for (uint32_t i = 0; i < image->num_free; i++) {
+        is_free[image->free[i]] = 1;
+    }
+
+    /* Mapping into an empty memory hands out addresses in order; the
+       unmapped ones are then unmapped in stack order, so later mappings
+       reuse addresses exactly as they would have */
+    Mem_T mem = Mem_new(program_page_flags);
+    for (uint32_t i = 0; i < image->num_segments; i++) {
+        uint32_t length = is_free[i] ? 0 : image->lengths[i];
+        Mem_Address address = Mem_create_segment(mem, length);
+        assert((uint32_t)address == i);
+        if (length > 0) {
+            memcpy(Mem_segment_at(mem, address)->data, image->words[i],
+                   (size_t)length * sizeof(uint32_t));
+        }
+        /* Give the copy back as soon as it is in place */
+        free(image->words[i]);
+        image->words[i] = NULL;
+        Checkpoint_mark_mapped(address, length);
+        Checkpoint_segments[address].rewritten = 0;
+    }
+    for (uint32_t i = 0; i < image->num_free; i++) {
+        Mem_remove_segment(mem, image->free[i]);
+        Checkpoint_mark_unmapped(image->free[i]);
+    }
+
+    *machine = image->machine;
+    free(is_free);
+    return mem;
+}
+
+/* Checkpoint_resume
+ * Purpose:    Rebuilds main memory and the machine state from the newest
+ *             checkpoint in the directory.
+ * Parameters: int program_page_flags - passed on to Mem_new
+ *             Checkpoint_machine *machine - filled in with the registers,
+ *                                           program pointer and count
+ * Returns:    Mem_T - the restored memory, or NULL if the directory holds
+ *             no checkpoint
+ * Notes:      Output written after the checkpoint was taken is written
+ *             again, and input read after it is read again from stdin.
+ */
+Mem_T Checkpoint_resume(int program_page_flags, Checkpoint_machine *machine)
+{
+    Image image;
+    if (!load_image(&image)) {
+        return NULL;
+    }
+    have_base = 1;
+    Mem_T mem = rebuild_memory(&image, program_page_flags, machine);
+    free_image(&image);
+    return mem;
+}
+
+/* Checkpoint_save_snapshot
+ * Purpose:    Writes a full, standalone snapshot of the machine outside
+ *             the checkpoint directory.
+ * Parameters: const char *path - its name
+ *             const char *temporary - the name to write it under before
+ *                                     it is renamed to path
+ *             Mem_T mem - main memory
+ *             const Checkpoint_machine *machine - the machine state
+ * Returns:    none
+ */
+void Checkpoint_save_snapshot(const char *path, const char *temporary,
+                              Mem_T mem, const Checkpoint_machine *machine)
+{
+    uint32_t num_segments = Mem_num_segments(mem);
+    char *is_free = calloc((size_t)num_segments + 1, 1);
+    assert(is_free != NULL);
+    for (uint32_t i = 0; i < Mem_num_free(mem); i++) {
+        is_free[Mem_free_at(mem, i)] = 1;
+    }
+    FILE *fp = open_file(temporary, KIND_BASE, num_segments, 0, machine);
+    for (uint32_t i = 0; i < num_segments; i++) {
+        if (!is_free[i]) {
+            Mem_segment segment = Mem_segment_at(mem, i);
+            write_segment(fp, i, segment->data, segment->length);
+        }
+    }
+    write_free_list(fp, mem);
+    commit_file(fp, temporary, path);
+    free(is_free);
+}
+
+/* Checkpoint_load_snapshot
+ * Purpose:    Rebuilds main memory and the machine state from a snapshot
+ *             written by Checkpoint_save_snapshot.
+ * Parameters: const char *path - the snapshot
+ *             int program_page_flags - passed on to Mem_new
+ *             Checkpoint_machine *machine - filled in with the registers,
+ *                                           program pointer and count
+ * Returns:    Mem_T - the restored memory, or NULL if there is no such
+ *             file
+ */
+Mem_T Checkpoint_load_snapshot(const char *path, int program_page_flags,
+                               Checkpoint_machine *machine)
+{
+    Image image;
+    memset(&image, 0, sizeof(image));
+    if (!load_file(&image, path)) {
+        return NULL;
+    }
+    Mem_T mem = rebuild_memory(&image, program_page_flags, machine);
+    free_image(&image);
+    return mem;
+}
+
+/* Checkpoint_mark_mapped
+ * Purpose:    Records that a segment was mapped, or segment 0 replaced, so
+ *             the next checkpoint writes all of it.
+ * Parameters: Mem_Address address - the segment
+ *             uint32_t length - its length
+ * Returns:    none
+ */
+void Checkpoint_mark_mapped(Mem_Address address, uint32_t length)
+{
+    if (address >= tracked_capacity) {
+        size_t capacity = tracked_capacity == 0 ? 64 : 2 * tracked_capacity;
+        while (capacity <= address) {
+            capacity *= 2;
+        }
+        Checkpoint_segments = realloc(Checkpoint_segments, capacity *
+                                      sizeof(*Checkpoint_segments));
+        assert(Checkpoint_segments != NULL);
+        tracked_capacity = capacity;
+    }
+    if (address >= num_tracked) {
+        num_tracked = address + 1;
+    }
+    Checkpoint_segments[address].chunks = 0;
+    Checkpoint_segments[address].shift = chunk_shift(length);
+    Checkpoint_segments[address].rewritten = 1;
+}
+
+/* Checkpoint_mark_unmapped
+ * Purpose:    Records that a segment was unmapped; its contents no longer
+ *             need to be saved.
+ * Parameters: Mem_Address address - the segment
+ * Returns:    none
+ */
+void Checkpoint_mark_unmapped(Mem_Address address)
+{
+    Checkpoint_segments[address].chunks = 0;
+    Checkpoint_segments[address].rewritten = 0;
+}
+
+/* Checkpoint_take
+ * Purpose:    Writes a checkpoint: a base snapshot if there is none yet,
+ *             otherwise an increment with the segments and chunks dirtied
+ *             since the last one. Compacts after COMPACT_AFTER increments.
+ * Parameters: Mem_T mem - main memory
+ *             const Checkpoint_machine *machine - the machine state
+ * Returns:    none
+ */
+void Checkpoint_take(Mem_T mem, const Checkpoint_machine *machine)
+{
+    Checkpoint_pending = 0;
+    uint32_t num_segments = Mem_num_segments(mem);
+    char *is_free = calloc((size_t)num_segments + 1, 1);
+    assert(is_free != NULL);
+
+    sequence++;
+    FILE *fp = open_temporary(have_base ? KIND_INCREMENT : KIND_BASE,
+                              num_segments, sequence, machine);
+    for (uint32_t i = 0; i < Mem_num_free(mem); i++) {
+        is_free[Mem_free_at(mem, i)] = 1;
+    }
+    for (uint32_t i = 0; i < num_segments; i++) {
+        Checkpoint_segment *dirty = &Checkpoint_segments[i];
+        Mem_segment segment = Mem_segment_at(mem, i);
+        if (is_free[i]) {
+            continue;
+        } else if (!have_base || dirty->rewritten) {
+            write_segment(fp, i, segment->data, segment->length);
+        } else if (dirty->chunks != 0) {
+            write_chunks(fp, i, segment, dirty);
+        }
+        dirty->chunks = 0;
+        dirty->rewritten = 0;
+    }
+    write_free_list(fp, mem);
+    free(is_free);
+
+    if (!have_base) {
+        commit_temporary(fp, "base", 0);
+        have_base = 1;
+        base_sequence = sequence;
+    } else {
+        commit_temporary(fp, NULL, sequence);
+        if (sequence - base_sequence >= COMPACT_AFTER) {
+            compact();
+        }
+    }
+}
+
+/* Checkpoint_finish
+ * Purpose:    Stops the timer and deletes the checkpoints once the program
+ *             has halted, so a later --resume starts afresh.
+ * Parameters: none
+ * Returns:    none
+ */
+void Checkpoint_finish(void)
+{
+    struct itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+    setitimer(ITIMER_REAL, &timer, NULL);
+
+    char path[PATH_LENGTH];
+    if (have_base) {
+        unlink(checkpoint_path(path, "base", 0));
+        remove_increments(base_sequence + 1, sequence);
+    }
+}
@@ -0,0 +1,103 @@
+/******************************************************************************
+ *
+ *                               checkpoint.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for incremental checkpoints of a running UM.
+ *                 A SIGALRM timer raises Checkpoint_pending; at the next
+ *                 block boundary the interpreter writes the machine state
+ *                 and only the parts of main memory modified since the
+ *                 previous checkpoint. The first checkpoint is a full base
+ *                 snapshot; later ones are increments, which are merged
+ *                 back into the base every few checkpoints so resuming
+ *                 after a crash reads a bounded number of files.
+ *
+ *                 Modifications are tracked per segment: SSTORE sets the
+ *                 bit of the chunk it wrote to, and mapping a segment (or
+ *                 replacing segment 0) marks the whole segment rewritten.
+ *                 Each segment is split into at most 64 chunks of at least
+ *                 one 4KB page, so one 64-bit word holds its dirty map.
+ *
+ *                 The same file format also serves for standalone
+ *                 snapshots of the whole machine (see imagecache.h).
+ *
+ *****************************************************************************/
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <signal.h>
+#include <stdint.h>
+#include "memory.h"
+
+#define CHECKPOINT_NUM_REGISTERS 8
+
+/* The state of the machine outside main memory */
+typedef struct Checkpoint_machine {
+    uint32_t registers[CHECKPOINT_NUM_REGISTERS];
+    uint32_t program_pointer;
+    uint64_t instructions_retired;
+} Checkpoint_machine;
+
+/* Dirty map of one segment: bit k of chunks covers the words whose index
+   shifted right by shift is k */
+typedef struct Checkpoint_segment {
+    uint64_t chunks;
+    uint8_t shift;
+    uint8_t rewritten;
+} Checkpoint_segment;
+
+/* Set by the timer when a checkpoint is due */
+extern volatile sig_atomic_t Checkpoint_pending;
+
+/* Dirty maps, indexed by segment address */
+extern Checkpoint_segment *Checkpoint_segments;
+
+extern void Checkpoint_start(const char *directory, unsigned interval_s);
+extern Mem_T Checkpoint_resume(int program_page_flags,
+                               Checkpoint_machine *machine);
+extern void Checkpoint_mark_mapped(Mem_Address address, uint32_t length);
+extern void Checkpoint_mark_unmapped(Mem_Address address);
+extern void Checkpoint_take(Mem_T mem, const Checkpoint_machine *machine);
+extern void Checkpoint_finish(void);
+extern void Checkpoint_save_snapshot(const char *path, const char *temporary,
+                                     Mem_T mem,
+                                     const Checkpoint_machine *machine);
+extern Mem_T Checkpoint_load_snapshot(const char *path,
+                                      int program_page_flags,
+                                      Checkpoint_machine *machine);
+
+/* Checkpoint_mark_store
+ * Purpose:    Records a store into a segment.
+ * Parameters: Mem_Address address - the segment (must be mapped)
+ *             uint32_t index - the word written
+ * Returns:    none
+ */
+static inline void Checkpoint_mark_store(Mem_Address address, uint32_t index)
+{
+    Checkpoint_segment *segment = &Checkpoint_segments[address];
+    segment->chunks |= (uint64_t)1 << (index >> segment->shift);
+}
+
+/* Checkpoint_mark_range
+ * Purpose:    Records a store of a run of words into a segment.
+ * Parameters: Mem_Address address - the segment (must be mapped)
+ *             uint32_t first - the first word written
+ *             uint32_t num_words - how many were written (at least 1)
+ * Returns:    none
+ */
+static inline void Checkpoint_mark_range(Mem_Address address, uint32_t first,
+                                         uint32_t num_words)
+{
+    Checkpoint_segment *segment = &Checkpoint_segments[address];
+    uint32_t first_chunk = first >> segment->shift;
+    uint32_t last_chunk = (first + num_words - 1) >> segment->shift;
+    uint64_t through_last = last_chunk == 63 ? UINT64_MAX
+                            : ((uint64_t)1 << (last_chunk + 1)) - 1;
+    segment->chunks |= through_last & ~(((uint64_t)1 << first_chunk) - 1);
+}
+
+#endif
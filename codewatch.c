@@ -0,0 +1,139 @@
+/******************************************************************************
+ *
+ *                               codewatch.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the self-modification detector outlined
+ *                 in codewatch.h. A page of segment 0 faults at most once
+ *                 per LOADP: compiled UM programs keep their globals next
+ *                 to their code, so a page that was written once is likely
+ *                 to be written again, and protecting it again would fault
+ *                 on nearly every store.
+ *
+ *****************************************************************************/
+
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "codewatch.h"
+#include "assert.h"
+
+#define SIZE_OF_UINT32 4
+
+/* The watched segment 0; written only outside the signal handler */
+static char *region = NULL;
+static size_t region_bytes = 0;
+static size_t region_words = 0;
+static uint16_t *region_keys = NULL;
+static uint16_t stale = 0;
+static size_t page_size = 0;
+
+static struct sigaction previous_action;
+
+/* fault_handler
+ * Purpose:    Handles a write to a protected page of segment 0 by making
+ *             its instructions stale and the page writable. Faults
+ *             anywhere else go to whatever handler was installed before.
+ * Parameters: int signum - SIGSEGV
+ *             siginfo_t *info - describes the faulting address
+ *             void *context - passed on to the previous handler
+ * Returns:    none
+ * Notes:      The keys are replaced before the page is unprotected, so by
+ *             the time the write lands, every thread runs the page's
+ *             instructions from its words.
+ */
+static void fault_handler(int signum, siginfo_t *info, void *context)
+{
+    char *address = info->si_addr;
+    if (region != NULL && address >= region &&
+        address < region + region_bytes) {
+        size_t page = (address - region) / page_size;
+        size_t first = page * (page_size / SIZE_OF_UINT32);
+        size_t end = first + page_size / SIZE_OF_UINT32;
+        for (size_t i = first; i < end && i < region_words; i++) {
+            region_keys[i] = stale;
+        }
+        mprotect(region + page * page_size, page_size,
+                 PROT_READ | PROT_WRITE);
+        return;
+    }
+
+    if (previous_action.sa_flags & SA_SIGINFO) {
+        previous_action.sa_sigaction(signum, info, context);
+    } else {
+        /* Let the fault happen again under the previous disposition */
+        sigaction(SIGSEGV, &previous_action, NULL);
+    }
+}
+
+/* Codewatch_init
+ * Purpose:    Installs the SIGSEGV handler. Must be called once before
+ *             Codewatch_protect.
+ * Parameters: none
+ * Returns:    none
+ */
+void Codewatch_init(void)
+{
+    page_size = sysconf(_SC_PAGESIZE);
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = fault_handler;
+    action.sa_flags = SA_SIGINFO | SA_NODEFER;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGSEGV, &action, &previous_action);
+}
+
+/* Codewatch_protect
+ * Purpose:    Starts watching a freshly decoded segment 0, every page of
+ *             it read-only.
+ * Parameters: uint32_t *code - the segment's storage, which must be
+ *                              page-aligned (see PAGES_ALIGNED)
+ *             size_t num_words - the length of the segment
+ *             uint16_t *keys - its dispatch keys
+ *             uint16_t stale_key - the key that runs an instruction from
+ *                                  its word
+ * Returns:    none
+ */
+void Codewatch_protect(uint32_t *code, size_t num_words, uint16_t *keys,
+                       uint16_t stale_key)
+{
+    assert(page_size != 0);
+    assert(((uintptr_t)code & (page_size - 1)) == 0);
+    Codewatch_release();
+
+    size_t bytes = num_words * SIZE_OF_UINT32;
+    region_bytes = (bytes + page_size - 1) & ~(page_size - 1);
+    region_words = num_words;
+    region_keys = keys;
+    stale = stale_key;
+    region = (char *)code;
+    if (region_bytes > 0) {
+        mprotect(region, region_bytes, PROT_READ);
+    }
+}
+
+/* Codewatch_release
+ * Purpose:    Stops watching segment 0 and makes it writable again, e.g.
+ *             before LOADP replaces it or its keys are freed.
+ * Parameters: none
+ * Returns:    none
+ */
+void Codewatch_release(void)
+{
+    if (region == NULL) {
+        return;
+    }
+    char *released = region;
+    region = NULL;
+    if (region_bytes > 0) {
+        mprotect(released, region_bytes, PROT_READ | PROT_WRITE);
+    }
+    region_bytes = 0;
+    region_words = 0;
+    region_keys = NULL;
+}
@@ -0,0 +1,30 @@
+/******************************************************************************
+ *
+ *                               codewatch.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for detecting self-modifying code without a
+ *                 check in SSTORE (see --protect-seg0). Segment 0 is mapped
+ *                 read-only; the first write to each page raises SIGSEGV,
+ *                 which points the dispatch keys of the page's instructions
+ *                 at a case that decodes them as they run, then makes the
+ *                 page writable for good, so later writes to it cost
+ *                 nothing.
+ *
+ *****************************************************************************/
+
+#ifndef CODEWATCH_H
+#define CODEWATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+extern void Codewatch_init(void);
+extern void Codewatch_protect(uint32_t *code, size_t num_words,
+                              uint16_t *keys, uint16_t stale_key);
+extern void Codewatch_release(void);
+
+#endif
@@ -0,0 +1,517 @@
+/******************************************************************************
+ *
+ *                                coldseg.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of cold segment compression as outlined in
+ *                 coldseg.h. Every address has a Cold_state recording how
+ *                 many sweeps its segment has gone untouched and, for
+ *                 segments that are hashed, the hash at the last sweep.
+ *                 Watched and compressed segments are listed in the watched
+ *                 and frozen arrays, which the SIGSEGV handler searches for
+ *                 the faulting address. The handler only marks an entry
+ *                 touched or thawed; the next sweep drops it from its
+ *                 array, and frees a thawed segment's compressed copy,
+ *                 outside the handler.
+ *
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include "coldseg.h"
+#include "lz.h"
+#include "pages.h"
+#include "telemetry.h"
+#include "assert.h"
+
+#define PROG_ADDRESS 0
+#define SIZE_OF_UINT32 4
+#define EPOCH_SECONDS 1
+#define MIN_COLD_BYTES (64 * 1024)
+#define MAX_BACKOFF 6
+
+typedef struct Cold_state {
+    uint64_t hash;       /* contents at the last sweep, if hashed */
+    uint32_t idle;       /* sweeps since the segment was last touched */
+    uint8_t backoff;     /* must stay idle for cold_epochs << backoff */
+    uint8_t frozen;      /* held compressed */
+} Cold_state;
+
+typedef struct Watched_segment {
+    Mem_Address address;
+    char *region;        /* the segment's storage, inaccessible until
+                            touched */
+    size_t bytes;
+    uint8_t exposed;     /* made accessible by Coldseg_expose and hashed */
+    volatile sig_atomic_t touched;
+} Watched_segment;
+
+typedef struct Frozen_segment {
+    Mem_Address address;
+    char *region;        /* the segment's storage, inaccessible when frozen */
+    size_t bytes;
+    void *compressed;
+    size_t compressed_bytes;
+    volatile sig_atomic_t thawed;
+} Frozen_segment;
+
+volatile sig_atomic_t Coldseg_pending = 0;
+
+static unsigned cold_epochs = 0;
+static size_t page_size = 0;
+static int supported = 1;
+
+static Cold_state *states = NULL;
+static uint32_t num_states = 0;
+
+static Frozen_segment *frozen = NULL;
+static int num_frozen = 0;
+static int frozen_capacity = 0;
+
+static Watched_segment *watched = NULL;
+static int num_watched = 0;
+static int watched_capacity = 0;
+
+static struct sigaction previous_action;
+
+/* epoch_handler
+ * Purpose:    Requests a sweep at the next block boundary.
+ * Parameters: int signum - SIGVTALRM
+ * Returns:    none
+ */
+static void epoch_handler(int signum)
+{
+    Coldseg_pending = 1;
+    (void)signum;
+}
+
+/* page_round
+ * Purpose:    Rounds a byte count up to whole pages.
+ * Parameters: size_t bytes - the byte count
+ * Returns:    size_t - the rounded count
+ */
+static size_t page_round(size_t bytes)
+{
+    return (bytes + page_size - 1) & ~(page_size - 1);
+}
+
+/* thaw
+ * Purpose:    Makes a frozen segment's storage accessible and decompresses
+ *             it in place.
+ * Parameters: Frozen_segment *entry - the segment
+ * Returns:    none
+ * Notes:      Runs in the SIGSEGV handler, so it allocates nothing.
+ */
+static void thaw(Frozen_segment *entry)
+{
+    mprotect(entry->region, page_round(entry->bytes),
+             PROT_READ | PROT_WRITE);
+    if (Lz_decompress(entry->compressed, entry->compressed_bytes,
+                      entry->region, entry->bytes) != 0) {
+        abort();
+    }
+    entry->thawed = 1;
+
+    Cold_state *state = &states[entry->address];
+    state->frozen = 0;
+    state->idle = 0;
+    if (state->backoff < MAX_BACKOFF) {
+        state->backoff++;
+    }
+    Telemetry->cold_segments--;
+    Telemetry->cold_bytes_saved -= entry->bytes - entry->compressed_bytes;
+}
+
+/* fault_handler
+ * Purpose:    Thaws the frozen segment holding the faulting address, or
+ *             marks the watched one holding it touched and makes it
+ *             accessible again. Faults anywhere else go to whatever
+ *             handler was installed before.
+ * Parameters: int signum - SIGSEGV
+ *             siginfo_t *info - describes the faulting address
+ *             void *context - passed on to the previous handler
+ * Returns:    none
+ */
+static void fault_handler(int signum, siginfo_t *info, void *context)
+{
+    char *address = info->si_addr;
+    for (int i = 0; i < num_frozen; i++) {
+        Frozen_segment *entry = &frozen[i];
+        if (!entry->thawed && address >= entry->region &&
+            address < entry->region + entry->bytes) {
+            thaw(entry);
+            return;
+        }
+    }
+    for (int i = 0; i < num_watched; i++) {
+        Watched_segment *entry = &watched[i];
+        if (!entry->touched && !entry->exposed &&
+            address >= entry->region &&
+            address < entry->region + entry->bytes) {
+            mprotect(entry->region, entry->bytes, PROT_READ | PROT_WRITE);
+            entry->touched = 1;
+            return;
+        }
+    }
+
+    if (previous_action.sa_flags & SA_SIGINFO) {
+        previous_action.sa_sigaction(signum, info, context);
+    } else {
+        /* Let the fault happen again under the previous disposition */
+        sigaction(SIGSEGV, &previous_action, NULL);
+    }
+}
+
+/* Coldseg_start
+ * Purpose:    Installs the SIGSEGV handler and starts the epoch timer.
+ *             Any other SIGSEGV handler must be installed first.
+ * Parameters: unsigned epochs - how many epochs a segment must go
+ *                               unchanged before it is compressed
+ * Returns:    none
+ */
+void Coldseg_start(unsigned epochs)
+{
+    cold_epochs = epochs;
+    page_size = sysconf(_SC_PAGESIZE);
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = fault_handler;
+    action.sa_flags = SA_SIGINFO | SA_NODEFER;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGSEGV, &action, &previous_action);
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = epoch_handler;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGVTALRM, &action, NULL);
+
+    struct itimerval timer;
+    timer.it_interval.tv_sec = EPOCH_SECONDS;
+    timer.it_interval.tv_usec = 0;
+    timer.it_value = timer.it_interval;
+    setitimer(ITIMER_VIRTUAL, &timer, NULL);
+}
+
+/* release_thawed
+ * Purpose:    Frees the compressed copies of segments thawed since the
+ *             last sweep and drops them from the frozen array.
+ * Parameters: none
+ * Returns:    none
+ */
+static void release_thawed(void)
+{
+    int kept = 0;
+    for (int i = 0; i < num_frozen; i++) {
+        if (frozen[i].thawed) {
+            free(frozen[i].compressed);
+        } else {
+            frozen[kept++] = frozen[i];
+        }
+    }
+    num_frozen = kept;
+}
+
+/* freeze
+ * Purpose:    Compresses a segment and moves it to inaccessible storage,
+ *             unless it does not compress well enough to be worth it.
+ * Parameters: Mem_T mem - main memory
+ *             Mem_Address address - the segment
+ * Returns:    none
+ */
+static void freeze(Mem_T mem, Mem_Address address)
+{
+    Cold_state *state = &states[address];
+    Mem_segment segment = Mem_segment_at(mem, address);
+    size_t bytes = (size_t)segment->length * SIZE_OF_UINT32;
+
+    /* Compress into scratch storage that goes straight back to the host,
+       then keep an exact-size copy */
+    int scratch_mapped;
+    size_t scratch_bytes = Lz_bound(bytes);
+    uint32_t *scratch = Pages_alloc(scratch_bytes, 0, &scratch_mapped);
+    assert(scratch != NULL);
+    size_t compressed_bytes = Lz_compress(segment->data, bytes, scratch);
+    void *compressed = NULL;
+    if (compressed_bytes <= bytes / 4 * 3) {
+        compressed = malloc(compressed_bytes);
+        assert(compressed != NULL);
+        memcpy(compressed, scratch, compressed_bytes);
+    }
+    Pages_free(scratch, scratch_bytes, scratch_mapped);
+
+    /* Saving under a quarter is not worth a fault; try again later */
+    char *region = NULL;
+    if (compressed == NULL ||
+        (region = (char *)Pages_reserve(bytes)) == NULL) {
+        free(compressed);
+        state->idle = 0;
+        if (state->backoff < MAX_BACKOFF) {
+            state->backoff++;
+        }
+        return;
+    }
+    if (!Mem_adopt_storage(mem, address, (uint32_t *)region, 1)) {
+        fprintf(stderr, "Cold segments cannot be compressed with the %s "
+                "memory backend.\n", Mem_backend_name());
+        Pages_free((uint32_t *)region, bytes, 1);
+        free(compressed);
+        supported = 0;
+        return;
+    }
+
+    if (num_frozen == frozen_capacity) {
+        frozen_capacity = frozen_capacity == 0 ? 16 : 2 * frozen_capacity;
+        frozen = realloc(frozen, frozen_capacity * sizeof(*frozen));
+        assert(frozen != NULL);
+    }
+    Frozen_segment *entry = &frozen[num_frozen];
+    entry->address = address;
+    entry->region = region;
+    entry->bytes = bytes;
+    entry->compressed = compressed;
+    entry->compressed_bytes = compressed_bytes;
+    entry->thawed = 0;
+    /* Only now may the handler see the entry */
+    num_frozen++;
+
+    state->frozen = 1;
+    Telemetry->cold_segments++;
+    Telemetry->cold_bytes_saved += bytes - compressed_bytes;
+}
+
+/* watch
+ * Purpose:    Makes the whole pages of a segment's storage inaccessible,
+ *             so that the next access to them faults and marks the
+ *             segment touched.
+ * Parameters: Mem_segment segment - the segment
+ *             Mem_Address address - its address
+ * Returns:    none
+ * Notes:      Pages the segment shares with other storage are left alone,
+ *             so an access to its first or last few words can go unseen.
+ *             That only costs a needless freeze and thaw.
+ */
+static void watch(Mem_segment segment, Mem_Address address)
+{
+    uintptr_t start = (uintptr_t)segment->data;
+    uintptr_t end = start + (size_t)segment->length * SIZE_OF_UINT32;
+    char *region = (char *)page_round(start);
+    end &= ~(uintptr_t)(page_size - 1);
+    if ((uintptr_t)region >= end) {
+        return;
+    }
+    size_t bytes = end - (uintptr_t)region;
+    if (mprotect(region, bytes, PROT_NONE) != 0) {
+        return;
+    }
+    if (num_watched == watched_capacity) {
+        watched_capacity = watched_capacity == 0 ? 16
+                                                 : 2 * watched_capacity;
+        watched = realloc(watched, watched_capacity * sizeof(*watched));
+        assert(watched != NULL);
+    }
+    Watched_segment *entry = &watched[num_watched];
+    entry->address = address;
+    entry->region = region;
+    entry->bytes = bytes;
+    entry->exposed = 0;
+    entry->touched = 0;
+    /* Only now may the handler see the entry */
+    num_watched++;
+}
+
+/* take_watched
+ * Purpose:    Makes every watched segment accessible again and records in
+ *             its Cold_state whether it was touched: a touched segment's
+ *             idle count is reset, and an exposed one is hashed to tell.
+ * Parameters: Mem_T mem - main memory
+ *             char *was_watched - set to 1 at each watched address
+ * Returns:    none
+ */
+static void take_watched(Mem_T mem, char *was_watched)
+{
+    for (int i = 0; i < num_watched; i++) {
+        Watched_segment *entry = &watched[i];
+        Cold_state *state = &states[entry->address];
+        if (!entry->touched && !entry->exposed) {
+            mprotect(entry->region, entry->bytes, PROT_READ | PROT_WRITE);
+        }
+        if (entry->exposed && !entry->touched) {
+            uint64_t hash = Mem_segment_hash(Mem_segment_at(mem,
+                                                            entry->address));
+            entry->touched = hash != state->hash;
+            state->hash = hash;
+        }
+        if (entry->touched) {
+            state->idle = 0;
+        } else {
+            state->idle++;
+        }
+        was_watched[entry->address] = 1;
+    }
+    num_watched = 0;
+}
+
+/* Coldseg_sweep
+ * Purpose:    Ages every large segment by one epoch and compresses those
+ *             that have gone untouched long enough.
+ * Parameters: Mem_T mem - main memory
+ * Returns:    none
+ * Notes:      Segment 0 is never compressed: it is the running program.
+ *             A segment is hashed the first time it is seen, then watched
+ *             with page protection from one sweep to the next.
+ */
+void Coldseg_sweep(Mem_T mem)
+{
+    Coldseg_pending = 0;
+    release_thawed();
+    if (!supported) {
+        return;
+    }
+
+    uint32_t num_segments = Mem_num_segments(mem);
+    if (num_segments > num_states) {
+        states = realloc(states, (size_t)num_segments * sizeof(*states));
+        assert(states != NULL);
+        memset(&states[num_states], 0,
+               (size_t)(num_segments - num_states) * sizeof(*states));
+        num_states = num_segments;
+    }
+    char *is_free = calloc((size_t)num_segments + 1, 1);
+    char *was_watched = calloc((size_t)num_segments + 1, 1);
+    assert(is_free != NULL && was_watched != NULL);
+    for (uint32_t i = 0; i < Mem_num_free(mem); i++) {
+        is_free[Mem_free_at(mem, i)] = 1;
+    }
+    take_watched(mem, was_watched);
+
+    for (Mem_Address address = PROG_ADDRESS + 1;
+         address < num_segments && supported; address++) {
+        Cold_state *state = &states[address];
+        Mem_segment segment = Mem_segment_at(mem, address);
+        if (is_free[address] || state->frozen ||
+            (size_t)segment->length * SIZE_OF_UINT32 < MIN_COLD_BYTES) {
+            continue;
+        }
+        if (!was_watched[address]) {
+            uint64_t hash = Mem_segment_hash(segment);
+            if (hash != state->hash) {
+                state->hash = hash;
+                state->idle = 0;
+            } else {
+                state->idle++;
+            }
+        }
+        if (state->idle >= cold_epochs << state->backoff) {
+            freeze(mem, address);
+        }
+        if (!state->frozen) {
+            watch(segment, address);
+        }
+    }
+    free(is_free);
+    free(was_watched);
+}
+
+/* Coldseg_expose
+ * Purpose:    Makes every watched segment accessible without marking it
+ *             touched, before a pass that reads main memory in bulk or
+ *             hands it to the kernel, which page protection would
+ *             disturb. Each is hashed now and again at the next sweep to
+ *             tell whether it changed in between.
+ * Parameters: Mem_T mem - main memory
+ * Returns:    none
+ */
+void Coldseg_expose(Mem_T mem)
+{
+    for (int i = 0; i < num_watched; i++) {
+        Watched_segment *entry = &watched[i];
+        if (entry->touched || entry->exposed) {
+            continue;
+        }
+        entry->exposed = 1;
+        mprotect(entry->region, entry->bytes, PROT_READ | PROT_WRITE);
+        states[entry->address].hash =
+            Mem_segment_hash(Mem_segment_at(mem, entry->address));
+    }
+}
+
+/* Coldseg_stop
+ * Purpose:    Makes every watched segment accessible again, before main
+ *             memory is freed and its storage goes back to the host or
+ *             the C library.
+ * Parameters: none
+ * Returns:    none
+ */
+void Coldseg_stop(void)
+{
+    for (int i = 0; i < num_watched; i++) {
+        Watched_segment *entry = &watched[i];
+        if (!entry->touched && !entry->exposed) {
+            mprotect(entry->region, entry->bytes, PROT_READ | PROT_WRITE);
+        }
+    }
+    num_watched = 0;
+}
+
+/* Coldseg_forget
+ * Purpose:    Drops what is known about a segment that is being unmapped.
+ *             If it is watched or frozen, its storage is made accessible
+ *             again (a frozen segment's is still unbacked, so it costs
+ *             nothing until reused) and a compressed copy is freed.
+ * Parameters: Mem_Address address - the segment
+ * Returns:    none
+ */
+void Coldseg_forget(Mem_Address address)
+{
+    if (address >= num_states) {
+        return;
+    }
+    Cold_state *state = &states[address];
+    for (int i = 0; i < num_watched; i++) {
+        Watched_segment *entry = &watched[i];
+        if (entry->address == address) {
+            if (!entry->touched && !entry->exposed) {
+                mprotect(entry->region, entry->bytes,
+                         PROT_READ | PROT_WRITE);
+            }
+            *entry = watched[--num_watched];
+            break;
+        }
+    }
+    if (state->frozen) {
+        for (int i = 0; i < num_frozen; i++) {
+            Frozen_segment *entry = &frozen[i];
+            if (entry->address == address && !entry->thawed) {
+                mprotect(entry->region, page_round(entry->bytes),
+                         PROT_READ | PROT_WRITE);
+                Telemetry->cold_segments--;
+                Telemetry->cold_bytes_saved -= entry->bytes -
+                                               entry->compressed_bytes;
+                free(entry->compressed);
+                *entry = frozen[--num_frozen];
+                break;
+            }
+        }
+    }
+    memset(state, 0, sizeof(*state));
+}
+
+/* Coldseg_frozen
+ * Purpose:    Reports whether a segment is held compressed, so passes over
+ *             main memory can leave it alone instead of thawing it.
+ * Parameters: Mem_Address address - the segment
+ * Returns:    int - nonzero if the segment is frozen
+ */
+int Coldseg_frozen(Mem_Address address)
+{
+    return address < num_states && states[address].frozen;
+}
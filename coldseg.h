@@ -0,0 +1,47 @@
+/******************************************************************************
+ *
+ *                                coldseg.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for compressing cold segments. A CPU-time timer
+ *                 divides the run into epochs; at the first block boundary
+ *                 of each epoch the interpreter sweeps main memory to see
+ *                 which large segments were touched. Each is left
+ *                 inaccessible for the epoch, and the first access to it
+ *                 faults and marks it touched, so a sweep costs a few
+ *                 system calls per segment rather than a pass over its
+ *                 words. A segment is hashed instead the first time it is
+ *                 seen, and when it is exposed to a pass that reads memory
+ *                 in bulk (see Coldseg_expose). A segment
+ *                 left untouched for enough epochs is compressed with the
+ *                 lz module and its storage swapped for an inaccessible
+ *                 reservation at a new address. The next SLOAD, SSTORE or
+ *                 LOADP that touches it faults, and the SIGSEGV handler
+ *                 decompresses it in place, so the interpreter never checks
+ *                 whether a segment is resident.
+ *
+ *                 Each time a segment is brought back it must stay
+ *                 untouched twice as long before it is compressed again.
+ *
+ *****************************************************************************/
+
+#ifndef COLDSEG_H
+#define COLDSEG_H
+
+#include <signal.h>
+#include "memory.h"
+
+/* Set by the timer when a sweep is due */
+extern volatile sig_atomic_t Coldseg_pending;
+
+extern void Coldseg_start(unsigned cold_epochs);
+extern void Coldseg_sweep(Mem_T mem);
+extern void Coldseg_expose(Mem_T mem);
+extern void Coldseg_stop(void);
+extern void Coldseg_forget(Mem_Address address);
+extern int Coldseg_frozen(Mem_Address address);
+
+#endif
@@ -0,0 +1,100 @@
+/******************************************************************************
+ *
+ *                               costmodel.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the cost vector outlined in
+ *                 costmodel.h. The report is one metric per line, a name
+ *                 and a count separated by a tab, in a fixed order, so
+ *                 reports from two builds can be compared with diff or
+ *                 joined by name.
+ *
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "costmodel.h"
+#include "telemetry.h"
+
+uint64_t Costmodel_opcodes[COSTMODEL_NUM_OPCODES];
+uint64_t Costmodel_lifted;
+
+static const char *opcode_names[COSTMODEL_NUM_OPCODES] = {
+    "CMOV", "SLOAD", "SSTORE", "ADD", "MUL", "DIV", "NAND", "HALT",
+    "ACTIVATE", "INACTIVATE", "OUT", "IN", "LOADP", "LV", "SPAWN",
+    "EXTEND"
+};
+
+static const char *report_name = NULL;
+
+/* Costmodel_start
+ * Purpose:    Starts counting; the report is written when the UM exits.
+ * Parameters: const char *report_filename - where to write the report,
+ *                                           or - for stderr
+ * Returns:    none
+ */
+void Costmodel_start(const char *report_filename)
+{
+    report_name = report_filename;
+    memset(Costmodel_opcodes, 0, sizeof(Costmodel_opcodes));
+    Costmodel_lifted = 0;
+    atexit(Costmodel_stop);
+}
+
+/* write_report
+ * Purpose:    Writes the cost vector.
+ * Parameters: FILE *fp - where to write it
+ * Returns:    none
+ */
+static void write_report(FILE *fp)
+{
+    uint64_t total = 0;
+    for (int op = 0; op < COSTMODEL_NUM_OPCODES; op++) {
+        total += Costmodel_opcodes[op];
+    }
+    fprintf(fp, "instructions\t%llu\n", (unsigned long long)total);
+    for (int op = 0; op < COSTMODEL_NUM_OPCODES; op++) {
+        fprintf(fp, "op.%s\t%llu\n", opcode_names[op],
+                (unsigned long long)Costmodel_opcodes[op]);
+    }
+    fprintf(fp, "loadp_words_copied\t%llu\n",
+            (unsigned long long)Telemetry->loadp_words_copied);
+    fprintf(fp, "map_words_zeroed\t%llu\n",
+            (unsigned long long)Telemetry->map_words_zeroed);
+    fprintf(fp, "table_entries_copied\t%llu\n",
+            (unsigned long long)Telemetry->table_entries_copied);
+    fprintf(fp, "storage_words_copied\t%llu\n",
+            (unsigned long long)Telemetry->storage_words_copied);
+    fprintf(fp, "allocations\t%llu\n",
+            (unsigned long long)Telemetry->allocations);
+    fprintf(fp, "lifted_idioms\t%llu\n",
+            (unsigned long long)Costmodel_lifted);
+}
+
+/* Costmodel_stop
+ * Purpose:    Writes the report. Safe to call more than once.
+ * Parameters: none
+ * Returns:    none
+ */
+void Costmodel_stop(void)
+{
+    if (report_name == NULL) {
+        return;
+    }
+    FILE *fp = strcmp(report_name, "-") == 0 ? stderr
+                                              : fopen(report_name, "w");
+    if (fp == NULL) {
+        fprintf(stderr, "Could not write cost report to %s.\n",
+                report_name);
+    } else {
+        write_report(fp);
+        if (fp != stderr) {
+            fclose(fp);
+        }
+    }
+    report_name = NULL;
+}
@@ -0,0 +1,42 @@
+/******************************************************************************
+ *
+ *                               costmodel.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for the deterministic cost vector of a run
+ *                 (--cost). Timings on a loaded host are noisy; counts of
+ *                 the work the UM did are not. The vector holds the
+ *                 instructions executed per opcode and the memory
+ *                 management work counted in the telemetry block: words
+ *                 copied by LOADP, words zeroed by map segment, segment
+ *                 table entries copied when the table grows, words of
+ *                 storage copied when a segment's storage grows in place,
+ *                 and host allocations. It also counts the lifted idioms
+ *                 (see gen_dispatch.c) executed, each of which saves the
+ *                 interpreter proper one dispatch. Two runs of the same
+ *                 program on the same input and build give the same
+ *                 vector, so a change in any entry is a real change in
+ *                 the work done.
+ *
+ *****************************************************************************/
+
+#ifndef COSTMODEL_H
+#define COSTMODEL_H
+
+#include <stdint.h>
+
+#define COSTMODEL_NUM_OPCODES 16
+
+/* Instructions executed, indexed by opcode */
+extern uint64_t Costmodel_opcodes[COSTMODEL_NUM_OPCODES];
+
+/* Lifted idioms executed */
+extern uint64_t Costmodel_lifted;
+
+extern void Costmodel_start(const char *report_filename);
+extern void Costmodel_stop(void);
+
+#endif
@@ -0,0 +1,306 @@
+/******************************************************************************
+ *
+ *                                 dedup.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of segment deduplication as outlined in
+ *                 dedup.h. Each address remembers which group of shared
+ *                 segments it belongs to (0 for none) and its hash when it
+ *                 joined, so a pass can tell that a group is still intact
+ *                 and leave it be. A group that gains a member is rebuilt
+ *                 on a fresh memory file; members that were written since
+ *                 simply hash differently and drop out of it.
+ *
+ *                 The pass timer is a POSIX CPU-time timer signalling
+ *                 SIGRTMIN, since the interval timers are taken by the
+ *                 profiler, checkpoints and cold segment compression.
+ *
+ *****************************************************************************/
+
+/* For memfd_create */
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "dedup.h"
+#include "coldseg.h"
+#include "pages.h"
+#include "telemetry.h"
+#include "assert.h"
+
+#define PROG_ADDRESS 0
+#define SIZE_OF_UINT32 4
+#define MIN_DEDUP_BYTES (16 * 1024)
+
+typedef struct Dedup_state {
+    uint64_t hash;       /* contents when the segment joined its group */
+    uint32_t group;      /* 0 if its storage is its own */
+} Dedup_state;
+
+typedef struct Candidate {
+    uint64_t hash;
+    uint32_t length;
+    Mem_Address address;
+} Candidate;
+
+volatile sig_atomic_t Dedup_pending = 0;
+
+static Dedup_state *states = NULL;
+static uint32_t num_states = 0;
+static uint32_t next_group = 1;
+static int supported = 1;
+
+/* pass_handler
+ * Purpose:    Requests a pass at the next block boundary.
+ * Parameters: int signum - SIGRTMIN
+ * Returns:    none
+ */
+static void pass_handler(int signum)
+{
+    Dedup_pending = 1;
+    (void)signum;
+}
+
+/* Dedup_start
+ * Purpose:    Starts the pass timer.
+ * Parameters: unsigned interval_s - seconds of CPU time between passes
+ * Returns:    none
+ */
+void Dedup_start(unsigned interval_s)
+{
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = pass_handler;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGRTMIN, &action, NULL);
+
+    struct sigevent event;
+    memset(&event, 0, sizeof(event));
+    event.sigev_notify = SIGEV_SIGNAL;
+    event.sigev_signo = SIGRTMIN;
+    timer_t timer;
+    if (timer_create(CLOCK_PROCESS_CPUTIME_ID, &event, &timer) != 0) {
+        fprintf(stderr, "Could not start the deduplication timer.\n");
+        exit(EXIT_FAILURE);
+    }
+    struct itimerspec spec;
+    memset(&spec, 0, sizeof(spec));
+    spec.it_interval.tv_sec = interval_s;
+    spec.it_value = spec.it_interval;
+    timer_settime(timer, 0, &spec, NULL);
+}
+
+/* compare_candidates
+ * Purpose:    Orders candidates by hash, then length, then address, so
+ *             possible duplicates are adjacent.
+ * Parameters: const void *a, const void *b - two Candidates
+ * Returns:    int - negative, zero or positive, as for qsort
+ */
+static int compare_candidates(const void *a, const void *b)
+{
+    const Candidate *x = a, *y = b;
+    if (x->hash != y->hash) {
+        return x->hash < y->hash ? -1 : 1;
+    } else if (x->length != y->length) {
+        return x->length < y->length ? -1 : 1;
+    }
+    return (x->address > y->address) - (x->address < y->address);
+}
+
+/* collect_candidates
+ * Purpose:    Hashes every mapped segment large enough to be worth sharing.
+ * Parameters: Mem_T mem - main memory
+ *             uint32_t *count_p - set to the number of candidates
+ * Returns:    Candidate * - the candidates, sorted; the caller frees them
+ * Notes:      Segment 0 is left alone (the interpreter holds on to its
+ *             storage), as are frozen cold segments, which hashing would
+ *             thaw.
+ */
+static Candidate *collect_candidates(Mem_T mem, uint32_t *count_p)
+{
+    uint32_t num_segments = Mem_num_segments(mem);
+    char *is_free = calloc((size_t)num_segments + 1, 1);
+    Candidate *candidates = malloc(((size_t)num_segments + 1) *
+                                   sizeof(*candidates));
+    assert(is_free != NULL && candidates != NULL);
+    for (uint32_t i = 0; i < Mem_num_free(mem); i++) {
+        is_free[Mem_free_at(mem, i)] = 1;
+    }
+
+    uint32_t count = 0;
+    for (Mem_Address address = PROG_ADDRESS + 1; address < num_segments;
+         address++) {
+        Mem_segment segment = Mem_segment_at(mem, address);
+        if (is_free[address] || Coldseg_frozen(address) ||
+            (size_t)segment->length * SIZE_OF_UINT32 < MIN_DEDUP_BYTES) {
+            continue;
+        }
+        candidates[count].hash = Mem_segment_hash(segment);
+        candidates[count].length = segment->length;
+        candidates[count].address = address;
+        count++;
+    }
+    free(is_free);
+    qsort(candidates, count, sizeof(*candidates), compare_candidates);
+    *count_p = count;
+    return candidates;
+}
+
+/* write_file
+ * Purpose:    Writes the contents of a segment to a new memory file.
+ * Parameters: Mem_segment segment - the segment
+ * Returns:    int - the file descriptor, or -1 on failure
+ */
+static int write_file(Mem_segment segment)
+{
+    int fd = memfd_create("um-dedup", MFD_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+    const char *data = (const char *)segment->data;
+    size_t left = (size_t)segment->length * SIZE_OF_UINT32;
+    while (left > 0) {
+        ssize_t written = write(fd, data, left);
+        if (written <= 0) {
+            close(fd);
+            return -1;
+        }
+        data += written;
+        left -= written;
+    }
+    return fd;
+}
+
+/* share
+ * Purpose:    Moves a group of identical segments onto private mappings of
+ *             one memory file holding their contents.
+ * Parameters: Mem_T mem - main memory
+ *             Candidate *members - the segments, all identical
+ *             uint32_t count - how many there are (at least 2)
+ * Returns:    none
+ */
+static void share(Mem_T mem, Candidate *members, uint32_t count)
+{
+    size_t bytes = (size_t)members[0].length * SIZE_OF_UINT32;
+    int fd = write_file(Mem_segment_at(mem, members[0].address));
+    if (fd < 0) {
+        return;
+    }
+    uint32_t group = next_group++;
+    for (uint32_t i = 0; i < count && supported; i++) {
+        uint32_t *storage = Pages_map_private(fd, bytes);
+        if (storage == NULL) {
+            break;
+        }
+        if (!Mem_adopt_storage(mem, members[i].address, storage, 1)) {
+            fprintf(stderr, "Segments cannot be deduplicated with the %s "
+                    "memory backend.\n", Mem_backend_name());
+            Pages_free(storage, bytes, 1);
+            supported = 0;
+            break;
+        }
+        states[members[i].address].hash = members[i].hash;
+        states[members[i].address].group = group;
+    }
+    /* The mappings keep the file alive */
+    close(fd);
+}
+
+/* intact_group
+ * Purpose:    Tells whether a run of identical segments is already one
+ *             group, unchanged since it was formed.
+ * Parameters: Candidate *members - the segments
+ *             uint32_t count - how many there are
+ * Returns:    int - nonzero if there is nothing to do for them
+ */
+static int intact_group(Candidate *members, uint32_t count)
+{
+    uint32_t group = states[members[0].address].group;
+    for (uint32_t i = 0; i < count; i++) {
+        Dedup_state *state = &states[members[i].address];
+        if (group == 0 || state->group != group ||
+            state->hash != members[i].hash) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Dedup_pass
+ * Purpose:    Finds identical segments and shares their storage, then
+ *             publishes how many bytes sharing saves.
+ * Parameters: Mem_T mem - main memory
+ * Returns:    none
+ */
+void Dedup_pass(Mem_T mem)
+{
+    Dedup_pending = 0;
+    if (!supported) {
+        return;
+    }
+    uint32_t num_segments = Mem_num_segments(mem);
+    if (num_segments > num_states) {
+        states = realloc(states, (size_t)num_segments * sizeof(*states));
+        assert(states != NULL);
+        memset(&states[num_states], 0,
+               (size_t)(num_segments - num_states) * sizeof(*states));
+        num_states = num_segments;
+    }
+
+    uint32_t count;
+    Candidate *candidates = collect_candidates(mem, &count);
+    Candidate *members = malloc(((size_t)count + 1) * sizeof(*members));
+    assert(members != NULL);
+    uint64_t saved = 0;
+    for (uint32_t start = 0, end; start < count; start = end) {
+        end = start + 1;
+        while (end < count && candidates[end].hash == candidates[start].hash
+               && candidates[end].length == candidates[start].length) {
+            end++;
+        }
+
+        /* A hash match is only a hint: compare the words */
+        Mem_Address leader = candidates[start].address;
+        const uint32_t *first = Mem_segment_at(mem, leader)->data;
+        size_t bytes = (size_t)candidates[start].length * SIZE_OF_UINT32;
+        uint32_t num_members = 0;
+        for (uint32_t i = start; i < end; i++) {
+            if (i == start || memcmp(first, Mem_segment_at(mem,
+                                     candidates[i].address)->data,
+                                     bytes) == 0) {
+                members[num_members++] = candidates[i];
+            }
+        }
+        if (num_members < 2) {
+            continue;
+        }
+        if (!intact_group(members, num_members)) {
+            share(mem, members, num_members);
+        }
+        saved += (uint64_t)(num_members - 1) * bytes;
+    }
+    Telemetry->dedup_bytes_saved = supported ? saved : 0;
+    free(members);
+    free(candidates);
+}
+
+/* Dedup_forget
+ * Purpose:    Drops a segment that is being unmapped from its group.
+ * Parameters: Mem_Address address - the segment
+ * Returns:    none
+ */
+void Dedup_forget(Mem_Address address)
+{
+    if (address < num_states) {
+        states[address].hash = 0;
+        states[address].group = 0;
+    }
+}
@@ -0,0 +1,34 @@
+/******************************************************************************
+ *
+ *                                 dedup.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for sharing the storage of identical segments.
+ *                 A CPU-time timer periodically requests a pass, which the
+ *                 interpreter runs at the next block boundary: every large
+ *                 segment is hashed, candidates with equal hashes are
+ *                 compared word for word, and each group of identical
+ *                 segments is moved onto private mappings of one memory
+ *                 file. The kernel then shares their pages until a segment
+ *                 writes to one, when that segment alone gets its own copy
+ *                 of the page, so SSTORE needs no copy-on-write check.
+ *
+ *****************************************************************************/
+
+#ifndef DEDUP_H
+#define DEDUP_H
+
+#include <signal.h>
+#include "memory.h"
+
+/* Set by the timer when a pass is due */
+extern volatile sig_atomic_t Dedup_pending;
+
+extern void Dedup_start(unsigned interval_s);
+extern void Dedup_pass(Mem_T mem);
+extern void Dedup_forget(Mem_Address address);
+
+#endif
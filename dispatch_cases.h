@@ -0,0 +1,16991 @@
+/* Generated by gen_dispatch; do not edit */
+
+case 0:
+    OP_END();
+case 1:
+    OP_CMOV(r0, r0, r0);
+    break;
+case 2:
+    OP_CMOV(r0, r0, r1);
+    break;
+case 3:
+    OP_CMOV(r0, r0, r2);
+    break;
+case 4:
+    OP_CMOV(r0, r0, r3);
+    break;
+case 5:
+    OP_CMOV(r0, r0, r4);
+    break;
+case 6:
+    OP_CMOV(r0, r0, r5);
+    break;
+case 7:
+    OP_CMOV(r0, r0, r6);
+    break;
+case 8:
+    OP_CMOV(r0, r0, r7);
+    break;
+case 9:
+    OP_CMOV(r0, r1, r0);
+    break;
+case 10:
+    OP_CMOV(r0, r1, r1);
+    break;
+case 11:
+    OP_CMOV(r0, r1, r2);
+    break;
+case 12:
+    OP_CMOV(r0, r1, r3);
+    break;
+case 13:
+    OP_CMOV(r0, r1, r4);
+    break;
+case 14:
+    OP_CMOV(r0, r1, r5);
+    break;
+case 15:
+    OP_CMOV(r0, r1, r6);
+    break;
+case 16:
+    OP_CMOV(r0, r1, r7);
+    break;
+case 17:
+    OP_CMOV(r0, r2, r0);
+    break;
+case 18:
+    OP_CMOV(r0, r2, r1);
+    break;
+case 19:
+    OP_CMOV(r0, r2, r2);
+    break;
+case 20:
+    OP_CMOV(r0, r2, r3);
+    break;
+case 21:
+    OP_CMOV(r0, r2, r4);
+    break;
+case 22:
+    OP_CMOV(r0, r2, r5);
+    break;
+case 23:
+    OP_CMOV(r0, r2, r6);
+    break;
+case 24:
+    OP_CMOV(r0, r2, r7);
+    break;
+case 25:
+    OP_CMOV(r0, r3, r0);
+    break;
+case 26:
+    OP_CMOV(r0, r3, r1);
+    break;
+case 27:
+    OP_CMOV(r0, r3, r2);
+    break;
+case 28:
+    OP_CMOV(r0, r3, r3);
+    break;
+case 29:
+    OP_CMOV(r0, r3, r4);
+    break;
+case 30:
+    OP_CMOV(r0, r3, r5);
+    break;
+case 31:
+    OP_CMOV(r0, r3, r6);
+    break;
+case 32:
+    OP_CMOV(r0, r3, r7);
+    break;
+case 33:
+    OP_CMOV(r0, r4, r0);
+    break;
+case 34:
+    OP_CMOV(r0, r4, r1);
+    break;
+case 35:
+    OP_CMOV(r0, r4, r2);
+    break;
+case 36:
+    OP_CMOV(r0, r4, r3);
+    break;
+case 37:
+    OP_CMOV(r0, r4, r4);
+    break;
+case 38:
+    OP_CMOV(r0, r4, r5);
+    break;
+case 39:
+    OP_CMOV(r0, r4, r6);
+    break;
+case 40:
+    OP_CMOV(r0, r4, r7);
+    break;
+case 41:
+    OP_CMOV(r0, r5, r0);
+    break;
+case 42:
+    OP_CMOV(r0, r5, r1);
+    break;
+case 43:
+    OP_CMOV(r0, r5, r2);
+    break;
+case 44:
+    OP_CMOV(r0, r5, r3);
+    break;
+case 45:
+    OP_CMOV(r0, r5, r4);
+    break;
+case 46:
+    OP_CMOV(r0, r5, r5);
+    break;
+case 47:
+    OP_CMOV(r0, r5, r6);
+    break;
+case 48:
+    OP_CMOV(r0, r5, r7);
+    break;
+case 49:
+    OP_CMOV(r0, r6, r0);
+    break;
+case 50:
+    OP_CMOV(r0, r6, r1);
+    break;
+case 51:
+    OP_CMOV(r0, r6, r2);
+    break;
+case 52:
+    OP_CMOV(r0, r6, r3);
+    break;
+case 53:
+    OP_CMOV(r0, r6, r4);
+    break;
+case 54:
+    OP_CMOV(r0, r6, r5);
+    break;
+case 55:
+    OP_CMOV(r0, r6, r6);
+    break;
+case 56:
+    OP_CMOV(r0, r6, r7);
+    break;
+case 57:
+    OP_CMOV(r0, r7, r0);
+    break;
+case 58:
+    OP_CMOV(r0, r7, r1);
+    break;
+case 59:
+    OP_CMOV(r0, r7, r2);
+    break;
+case 60:
+    OP_CMOV(r0, r7, r3);
+    break;
+case 61:
+    OP_CMOV(r0, r7, r4);
+    break;
+case 62:
+    OP_CMOV(r0, r7, r5);
+    break;
+case 63:
+    OP_CMOV(r0, r7, r6);
+    break;
+case 64:
+    OP_CMOV(r0, r7, r7);
+    break;
+case 65:
+    OP_CMOV(r1, r0, r0);
+    break;
+case 66:
+    OP_CMOV(r1, r0, r1);
+    break;
+case 67:
+    OP_CMOV(r1, r0, r2);
+    break;
+case 68:
+    OP_CMOV(r1, r0, r3);
+    break;
+case 69:
+    OP_CMOV(r1, r0, r4);
+    break;
+case 70:
+    OP_CMOV(r1, r0, r5);
+    break;
+case 71:
+    OP_CMOV(r1, r0, r6);
+    break;
+case 72:
+    OP_CMOV(r1, r0, r7);
+    break;
+case 73:
+    OP_CMOV(r1, r1, r0);
+    break;
+case 74:
+    OP_CMOV(r1, r1, r1);
+    break;
+case 75:
+    OP_CMOV(r1, r1, r2);
+    break;
+case 76:
+    OP_CMOV(r1, r1, r3);
+    break;
+case 77:
+    OP_CMOV(r1, r1, r4);
+    break;
+case 78:
+    OP_CMOV(r1, r1, r5);
+    break;
+case 79:
+    OP_CMOV(r1, r1, r6);
+    break;
+case 80:
+    OP_CMOV(r1, r1, r7);
+    break;
+case 81:
+    OP_CMOV(r1, r2, r0);
+    break;
+case 82:
+    OP_CMOV(r1, r2, r1);
+    break;
+case 83:
+    OP_CMOV(r1, r2, r2);
+    break;
+case 84:
+    OP_CMOV(r1, r2, r3);
+    break;
+case 85:
+    OP_CMOV(r1, r2, r4);
+    break;
+case 86:
+    OP_CMOV(r1, r2, r5);
+    break;
+case 87:
+    OP_CMOV(r1, r2, r6);
+    break;
+case 88:
+    OP_CMOV(r1, r2, r7);
+    break;
+case 89:
+    OP_CMOV(r1, r3, r0);
+    break;
+case 90:
+    OP_CMOV(r1, r3, r1);
+    break;
+case 91:
+    OP_CMOV(r1, r3, r2);
+    break;
+case 92:
+    OP_CMOV(r1, r3, r3);
+    break;
+case 93:
+    OP_CMOV(r1, r3, r4);
+    break;
+case 94:
+    OP_CMOV(r1, r3, r5);
+    break;
+case 95:
+    OP_CMOV(r1, r3, r6);
+    break;
+case 96:
+    OP_CMOV(r1, r3, r7);
+    break;
+case 97:
+    OP_CMOV(r1, r4, r0);
+    break;
+case 98:
+    OP_CMOV(r1, r4, r1);
+    break;
+case 99:
+    OP_CMOV(r1, r4, r2);
+    break;
+case 100:
+    OP_CMOV(r1, r4, r3);
+    break;
+case 101:
+    OP_CMOV(r1, r4, r4);
+    break;
+case 102:
+    OP_CMOV(r1, r4, r5);
+    break;
+case 103:
+    OP_CMOV(r1, r4, r6);
+    break;
+case 104:
+    OP_CMOV(r1, r4, r7);
+    break;
+case 105:
+    OP_CMOV(r1, r5, r0);
+    break;
+case 106:
+    OP_CMOV(r1, r5, r1);
+    break;
+case 107:
+    OP_CMOV(r1, r5, r2);
+    break;
+case 108:
+    OP_CMOV(r1, r5, r3);
+    break;
+case 109:
+    OP_CMOV(r1, r5, r4);
+    break;
+case 110:
+    OP_CMOV(r1, r5, r5);
+    break;
+case 111:
+    OP_CMOV(r1, r5, r6);
+    break;
+case 112:
+    OP_CMOV(r1, r5, r7);
+    break;
+case 113:
+    OP_CMOV(r1, r6, r0);
+    break;
+case 114:
+    OP_CMOV(r1, r6, r1);
+    break;
+case 115:
+    OP_CMOV(r1, r6, r2);
+    break;
+case 116:
+    OP_CMOV(r1, r6, r3);
+    break;
+case 117:
+    OP_CMOV(r1, r6, r4);
+    break;
+case 118:
+    OP_CMOV(r1, r6, r5);
+    break;
+case 119:
+    OP_CMOV(r1, r6, r6);
+    break;
+case 120:
+    OP_CMOV(r1, r6, r7);
+    break;
+case 121:
+    OP_CMOV(r1, r7, r0);
+    break;
+case 122:
+    OP_CMOV(r1, r7, r1);
+    break;
+case 123:
+    OP_CMOV(r1, r7, r2);
+    break;
+case 124:
+    OP_CMOV(r1, r7, r3);
+    break;
+case 125:
+    OP_CMOV(r1, r7, r4);
+    break;
+case 126:
+    OP_CMOV(r1, r7, r5);
+    break;
+case 127:
+    OP_CMOV(r1, r7, r6);
+    break;
+case 128:
+    OP_CMOV(r1, r7, r7);
+    break;
+case 129:
+    OP_CMOV(r2, r0, r0);
+    break;
+case 130:
+    OP_CMOV(r2, r0, r1);
+    break;
+case 131:
+    OP_CMOV(r2, r0, r2);
+    break;
+case 132:
+    OP_CMOV(r2, r0, r3);
+    break;
+case 133:
+    OP_CMOV(r2, r0, r4);
+    break;
+case 134:
+    OP_CMOV(r2, r0, r5);
+    break;
+case 135:
+    OP_CMOV(r2, r0, r6);
+    break;
+case 136:
+    OP_CMOV(r2, r0, r7);
+    break;
+case 137:
+    OP_CMOV(r2, r1, r0);
+    break;
+case 138:
+    OP_CMOV(r2, r1, r1);
+    break;
+case 139:
+    OP_CMOV(r2, r1, r2);
+    break;
+case 140:
+    OP_CMOV(r2, r1, r3);
+    break;
+case 141:
+    OP_CMOV(r2, r1, r4);
+    break;
+case 142:
+    OP_CMOV(r2, r1, r5);
+    break;
+case 143:
+    OP_CMOV(r2, r1, r6);
+    break;
+case 144:
+    OP_CMOV(r2, r1, r7);
+    break;
+case 145:
+    OP_CMOV(r2, r2, r0);
+    break;
+case 146:
+    OP_CMOV(r2, r2, r1);
+    break;
+case 147:
+    OP_CMOV(r2, r2, r2);
+    break;
+case 148:
+    OP_CMOV(r2, r2, r3);
+    break;
+case 149:
+    OP_CMOV(r2, r2, r4);
+    break;
+case 150:
+    OP_CMOV(r2, r2, r5);
+    break;
+case 151:
+    OP_CMOV(r2, r2, r6);
+    break;
+case 152:
+    OP_CMOV(r2, r2, r7);
+    break;
+case 153:
+    OP_CMOV(r2, r3, r0);
+    break;
+case 154:
+    OP_CMOV(r2, r3, r1);
+    break;
+case 155:
+    OP_CMOV(r2, r3, r2);
+    break;
+case 156:
+    OP_CMOV(r2, r3, r3);
+    break;
+case 157:
+    OP_CMOV(r2, r3, r4);
+    break;
+case 158:
+    OP_CMOV(r2, r3, r5);
+    break;
+case 159:
+    OP_CMOV(r2, r3, r6);
+    break;
+case 160:
+    OP_CMOV(r2, r3, r7);
+    break;
+case 161:
+    OP_CMOV(r2, r4, r0);
+    break;
+case 162:
+    OP_CMOV(r2, r4, r1);
+    break;
+case 163:
+    OP_CMOV(r2, r4, r2);
+    break;
+case 164:
+    OP_CMOV(r2, r4, r3);
+    break;
+case 165:
+    OP_CMOV(r2, r4, r4);
+    break;
+case 166:
+    OP_CMOV(r2, r4, r5);
+    break;
+case 167:
+    OP_CMOV(r2, r4, r6);
+    break;
+case 168:
+    OP_CMOV(r2, r4, r7);
+    break;
+case 169:
+    OP_CMOV(r2, r5, r0);
+    break;
+case 170:
+    OP_CMOV(r2, r5, r1);
+    break;
+case 171:
+    OP_CMOV(r2, r5, r2);
+    break;
+case 172:
+    OP_CMOV(r2, r5, r3);
+    break;
+case 173:
+    OP_CMOV(r2, r5, r4);
+    break;
+case 174:
+    OP_CMOV(r2, r5, r5);
+    break;
+case 175:
+    OP_CMOV(r2, r5, r6);
+    break;
+case 176:
+    OP_CMOV(r2, r5, r7);
+    break;
+case 177:
+    OP_CMOV(r2, r6, r0);
+    break;
+case 178:
+    OP_CMOV(r2, r6, r1);
+    break;
+case 179:
+    OP_CMOV(r2, r6, r2);
+    break;
+case 180:
+    OP_CMOV(r2, r6, r3);
+    break;
+case 181:
+    OP_CMOV(r2, r6, r4);
+    break;
+case 182:
+    OP_CMOV(r2, r6, r5);
+    break;
+case 183:
+    OP_CMOV(r2, r6, r6);
+    break;
+case 184:
+    OP_CMOV(r2, r6, r7);
+    break;
+case 185:
+    OP_CMOV(r2, r7, r0);
+    break;
+case 186:
+    OP_CMOV(r2, r7, r1);
+    break;
+case 187:
+    OP_CMOV(r2, r7, r2);
+    break;
+case 188:
+    OP_CMOV(r2, r7, r3);
+    break;
+case 189:
+    OP_CMOV(r2, r7, r4);
+    break;
+case 190:
+    OP_CMOV(r2, r7, r5);
+    break;
+case 191:
+    OP_CMOV(r2, r7, r6);
+    break;
+case 192:
+    OP_CMOV(r2, r7, r7);
+    break;
+case 193:
+    OP_CMOV(r3, r0, r0);
+    break;
+case 194:
+    OP_CMOV(r3, r0, r1);
+    break;
+case 195:
+    OP_CMOV(r3, r0, r2);
+    break;
+case 196:
+    OP_CMOV(r3, r0, r3);
+    break;
+case 197:
+    OP_CMOV(r3, r0, r4);
+    break;
+case 198:
+    OP_CMOV(r3, r0, r5);
+    break;
+case 199:
+    OP_CMOV(r3, r0, r6);
+    break;
+case 200:
+    OP_CMOV(r3, r0, r7);
+    break;
+case 201:
+    OP_CMOV(r3, r1, r0);
+    break;
+case 202:
+    OP_CMOV(r3, r1, r1);
+    break;
+case 203:
+    OP_CMOV(r3, r1, r2);
+    break;
+case 204:
+    OP_CMOV(r3, r1, r3);
+    break;
+case 205:
+    OP_CMOV(r3, r1, r4);
+    break;
+case 206:
+    OP_CMOV(r3, r1, r5);
+    break;
+case 207:
+    OP_CMOV(r3, r1, r6);
+    break;
+case 208:
+    OP_CMOV(r3, r1, r7);
+    break;
+case 209:
+    OP_CMOV(r3, r2, r0);
+    break;
+case 210:
+    OP_CMOV(r3, r2, r1);
+    break;
+case 211:
+    OP_CMOV(r3, r2, r2);
+    break;
+case 212:
+    OP_CMOV(r3, r2, r3);
+    break;
+case 213:
+    OP_CMOV(r3, r2, r4);
+    break;
+case 214:
+    OP_CMOV(r3, r2, r5);
+    break;
+case 215:
+    OP_CMOV(r3, r2, r6);
+    break;
+case 216:
+    OP_CMOV(r3, r2, r7);
+    break;
+case 217:
+    OP_CMOV(r3, r3, r0);
+    break;
+case 218:
+    OP_CMOV(r3, r3, r1);
+    break;
+case 219:
+    OP_CMOV(r3, r3, r2);
+    break;
+case 220:
+    OP_CMOV(r3, r3, r3);
+    break;
+case 221:
+    OP_CMOV(r3, r3, r4);
+    break;
+case 222:
+    OP_CMOV(r3, r3, r5);
+    break;
+case 223:
+    OP_CMOV(r3, r3, r6);
+    break;
+case 224:
+    OP_CMOV(r3, r3, r7);
+    break;
+case 225:
+    OP_CMOV(r3, r4, r0);
+    break;
+case 226:
+    OP_CMOV(r3, r4, r1);
+    break;
+case 227:
+    OP_CMOV(r3, r4, r2);
+    break;
+case 228:
+    OP_CMOV(r3, r4, r3);
+    break;
+case 229:
+    OP_CMOV(r3, r4, r4);
+    break;
+case 230:
+    OP_CMOV(r3, r4, r5);
+    break;
+case 231:
+    OP_CMOV(r3, r4, r6);
+    break;
+case 232:
+    OP_CMOV(r3, r4, r7);
+    break;
+case 233:
+    OP_CMOV(r3, r5, r0);
+    break;
+case 234:
+    OP_CMOV(r3, r5, r1);
+    break;
+case 235:
+    OP_CMOV(r3, r5, r2);
+    break;
+case 236:
+    OP_CMOV(r3, r5, r3);
+    break;
+case 237:
+    OP_CMOV(r3, r5, r4);
+    break;
+case 238:
+    OP_CMOV(r3, r5, r5);
+    break;
+case 239:
+    OP_CMOV(r3, r5, r6);
+    break;
+case 240:
+    OP_CMOV(r3, r5, r7);
+    break;
+case 241:
+    OP_CMOV(r3, r6, r0);
+    break;
+case 242:
+    OP_CMOV(r3, r6, r1);
+    break;
+case 243:
+    OP_CMOV(r3, r6, r2);
+    break;
+case 244:
+    OP_CMOV(r3, r6, r3);
+    break;
+case 245:
+    OP_CMOV(r3, r6, r4);
+    break;
+case 246:
+    OP_CMOV(r3, r6, r5);
+    break;
+case 247:
+    OP_CMOV(r3, r6, r6);
+    break;
+case 248:
+    OP_CMOV(r3, r6, r7);
+    break;
+case 249:
+    OP_CMOV(r3, r7, r0);
+    break;
+case 250:
+    OP_CMOV(r3, r7, r1);
+    break;
+case 251:
+    OP_CMOV(r3, r7, r2);
+    break;
+case 252:
+    OP_CMOV(r3, r7, r3);
+    break;
+case 253:
+    OP_CMOV(r3, r7, r4);
+    break;
+case 254:
+    OP_CMOV(r3, r7, r5);
+    break;
+case 255:
+    OP_CMOV(r3, r7, r6);
+    break;
+case 256:
+    OP_CMOV(r3, r7, r7);
+    break;
+case 257:
+    OP_CMOV(r4, r0, r0);
+    break;
+case 258:
+    OP_CMOV(r4, r0, r1);
+    break;
+case 259:
+    OP_CMOV(r4, r0, r2);
+    break;
+case 260:
+    OP_CMOV(r4, r0, r3);
+    break;
+case 261:
+    OP_CMOV(r4, r0, r4);
+    break;
+case 262:
+    OP_CMOV(r4, r0, r5);
+    break;
+case 263:
+    OP_CMOV(r4, r0, r6);
+    break;
+case 264:
+    OP_CMOV(r4, r0, r7);
+    break;
+case 265:
+    OP_CMOV(r4, r1, r0);
+    break;
+case 266:
+    OP_CMOV(r4, r1, r1);
+    break;
+case 267:
+    OP_CMOV(r4, r1, r2);
+    break;
+case 268:
+    OP_CMOV(r4, r1, r3);
+    break;
+case 269:
+    OP_CMOV(r4, r1, r4);
+    break;
+case 270:
+    OP_CMOV(r4, r1, r5);
+    break;
+case 271:
+    OP_CMOV(r4, r1, r6);
+    break;
+case 272:
+    OP_CMOV(r4, r1, r7);
+    break;
+case 273:
+    OP_CMOV(r4, r2, r0);
+    break;
+case 274:
+    OP_CMOV(r4, r2, r1);
+    break;
+case 275:
+    OP_CMOV(r4, r2, r2);
+    break;
+case 276:
+    OP_CMOV(r4, r2, r3);
+    break;
+case 277:
+    OP_CMOV(r4, r2, r4);
+    break;
+case 278:
+    OP_CMOV(r4, r2, r5);
+    break;
+case 279:
+    OP_CMOV(r4, r2, r6);
+    break;
+case 280:
+    OP_CMOV(r4, r2, r7);
+    break;
+case 281:
+    OP_CMOV(r4, r3, r0);
+    break;
+case 282:
+    OP_CMOV(r4, r3, r1);
+    break;
+case 283:
+    OP_CMOV(r4, r3, r2);
+    break;
+case 284:
+    OP_CMOV(r4, r3, r3);
+    break;
+case 285:
+    OP_CMOV(r4, r3, r4);
+    break;
+case 286:
+    OP_CMOV(r4, r3, r5);
+    break;
+case 287:
+    OP_CMOV(r4, r3, r6);
+    break;
+case 288:
+    OP_CMOV(r4, r3, r7);
+    break;
+case 289:
+    OP_CMOV(r4, r4, r0);
+    break;
+case 290:
+    OP_CMOV(r4, r4, r1);
+    break;
+case 291:
+    OP_CMOV(r4, r4, r2);
+    break;
+case 292:
+    OP_CMOV(r4, r4, r3);
+    break;
+case 293:
+    OP_CMOV(r4, r4, r4);
+    break;
+case 294:
+    OP_CMOV(r4, r4, r5);
+    break;
+case 295:
+    OP_CMOV(r4, r4, r6);
+    break;
+case 296:
+    OP_CMOV(r4, r4, r7);
+    break;
+case 297:
+    OP_CMOV(r4, r5, r0);
+    break;
+case 298:
+    OP_CMOV(r4, r5, r1);
+    break;
+case 299:
+    OP_CMOV(r4, r5, r2);
+    break;
+case 300:
+    OP_CMOV(r4, r5, r3);
+    break;
+case 301:
+    OP_CMOV(r4, r5, r4);
+    break;
+case 302:
+    OP_CMOV(r4, r5, r5);
+    break;
+case 303:
+    OP_CMOV(r4, r5, r6);
+    break;
+case 304:
+    OP_CMOV(r4, r5, r7);
+    break;
+case 305:
+    OP_CMOV(r4, r6, r0);
+    break;
+case 306:
+    OP_CMOV(r4, r6, r1);
+    break;
+case 307:
+    OP_CMOV(r4, r6, r2);
+    break;
+case 308:
+    OP_CMOV(r4, r6, r3);
+    break;
+case 309:
+    OP_CMOV(r4, r6, r4);
+    break;
+case 310:
+    OP_CMOV(r4, r6, r5);
+    break;
+case 311:
+    OP_CMOV(r4, r6, r6);
+    break;
+case 312:
+    OP_CMOV(r4, r6, r7);
+    break;
+case 313:
+    OP_CMOV(r4, r7, r0);
+    break;
+case 314:
+    OP_CMOV(r4, r7, r1);
+    break;
+case 315:
+    OP_CMOV(r4, r7, r2);
+    break;
+case 316:
+    OP_CMOV(r4, r7, r3);
+    break;
+case 317:
+    OP_CMOV(r4, r7, r4);
+    break;
+case 318:
+    OP_CMOV(r4, r7, r5);
+    break;
+case 319:
+    OP_CMOV(r4, r7, r6);
+    break;
+case 320:
+    OP_CMOV(r4, r7, r7);
+    break;
+case 321:
+    OP_CMOV(r5, r0, r0);
+    break;
+case 322:
+    OP_CMOV(r5, r0, r1);
+    break;
+case 323:
+    OP_CMOV(r5, r0, r2);
+    break;
+case 324:
+    OP_CMOV(r5, r0, r3);
+    break;
+case 325:
+    OP_CMOV(r5, r0, r4);
+    break;
+case 326:
+    OP_CMOV(r5, r0, r5);
+    break;
+case 327:
+    OP_CMOV(r5, r0, r6);
+    break;
+case 328:
+    OP_CMOV(r5, r0, r7);
+    break;
+case 329:
+    OP_CMOV(r5, r1, r0);
+    break;
+case 330:
+    OP_CMOV(r5, r1, r1);
+    break;
+case 331:
+    OP_CMOV(r5, r1, r2);
+    break;
+case 332:
+    OP_CMOV(r5, r1, r3);
+    break;
+case 333:
+    OP_CMOV(r5, r1, r4);
+    break;
+case 334:
+    OP_CMOV(r5, r1, r5);
+    break;
+case 335:
+    OP_CMOV(r5, r1, r6);
+    break;
+case 336:
+    OP_CMOV(r5, r1, r7);
+    break;
+case 337:
+    OP_CMOV(r5, r2, r0);
+    break;
+case 338:
+    OP_CMOV(r5, r2, r1);
+    break;
+case 339:
+    OP_CMOV(r5, r2, r2);
+    break;
+case 340:
+    OP_CMOV(r5, r2, r3);
+    break;
+case 341:
+    OP_CMOV(r5, r2, r4);
+    break;
+case 342:
+    OP_CMOV(r5, r2, r5);
+    break;
+case 343:
+    OP_CMOV(r5, r2, r6);
+    break;
+case 344:
+    OP_CMOV(r5, r2, r7);
+    break;
+case 345:
+    OP_CMOV(r5, r3, r0);
+    break;
+case 346:
+    OP_CMOV(r5, r3, r1);
+    break;
+case 347:
+    OP_CMOV(r5, r3, r2);
+    break;
+case 348:
+    OP_CMOV(r5, r3, r3);
+    break;
+case 349:
+    OP_CMOV(r5, r3, r4);
+    break;
+case 350:
+    OP_CMOV(r5, r3, r5);
+    break;
+case 351:
+    OP_CMOV(r5, r3, r6);
+    break;
+case 352:
+    OP_CMOV(r5, r3, r7);
+    break;
+case 353:
+    OP_CMOV(r5, r4, r0);
+    break;
+case 354:
+    OP_CMOV(r5, r4, r1);
+    break;
+case 355:
+    OP_CMOV(r5, r4, r2);
+    break;
+case 356:
+    OP_CMOV(r5, r4, r3);
+    break;
+case 357:
+    OP_CMOV(r5, r4, r4);
+    break;
+case 358:
+    OP_CMOV(r5, r4, r5);
+    break;
+case 359:
+    OP_CMOV(r5, r4, r6);
+    break;
+case 360:
+    OP_CMOV(r5, r4, r7);
+    break;
+case 361:
+    OP_CMOV(r5, r5, r0);
+    break;
+case 362:
+    OP_CMOV(r5, r5, r1);
+    break;
+case 363:
+    OP_CMOV(r5, r5, r2);
+    break;
+case 364:
+    OP_CMOV(r5, r5, r3);
+    break;
+case 365:
+    OP_CMOV(r5, r5, r4);
+    break;
+case 366:
+    OP_CMOV(r5, r5, r5);
+    break;
+case 367:
+    OP_CMOV(r5, r5, r6);
+    break;
+case 368:
+    OP_CMOV(r5, r5, r7);
+    break;
+case 369:
+    OP_CMOV(r5, r6, r0);
+    break;
+case 370:
+    OP_CMOV(r5, r6, r1);
+    break;
+case 371:
+    OP_CMOV(r5, r6, r2);
+    break;
+case 372:
+    OP_CMOV(r5, r6, r3);
+    break;
+case 373:
+    OP_CMOV(r5, r6, r4);
+    break;
+case 374:
+    OP_CMOV(r5, r6, r5);
+    break;
+case 375:
+    OP_CMOV(r5, r6, r6);
+    break;
+case 376:
+    OP_CMOV(r5, r6, r7);
+    break;
+case 377:
+    OP_CMOV(r5, r7, r0);
+    break;
+case 378:
+    OP_CMOV(r5, r7, r1);
+    break;
+case 379:
+    OP_CMOV(r5, r7, r2);
+    break;
+case 380:
+    OP_CMOV(r5, r7, r3);
+    break;
+case 381:
+    OP_CMOV(r5, r7, r4);
+    break;
+case 382:
+    OP_CMOV(r5, r7, r5);
+    break;
+case 383:
+    OP_CMOV(r5, r7, r6);
+    break;
+case 384:
+    OP_CMOV(r5, r7, r7);
+    break;
+case 385:
+    OP_CMOV(r6, r0, r0);
+    break;
+case 386:
+    OP_CMOV(r6, r0, r1);
+    break;
+case 387:
+    OP_CMOV(r6, r0, r2);
+    break;
+case 388:
+    OP_CMOV(r6, r0, r3);
+    break;
+case 389:
+    OP_CMOV(r6, r0, r4);
+    break;
+case 390:
+    OP_CMOV(r6, r0, r5);
+    break;
+case 391:
+    OP_CMOV(r6, r0, r6);
+    break;
+case 392:
+    OP_CMOV(r6, r0, r7);
+    break;
+case 393:
+    OP_CMOV(r6, r1, r0);
+    break;
+case 394:
+    OP_CMOV(r6, r1, r1);
+    break;
+case 395:
+    OP_CMOV(r6, r1, r2);
+    break;
+case 396:
+    OP_CMOV(r6, r1, r3);
+    break;
+case 397:
+    OP_CMOV(r6, r1, r4);
+    break;
+case 398:
+    OP_CMOV(r6, r1, r5);
+    break;
+case 399:
+    OP_CMOV(r6, r1, r6);
+    break;
+case 400:
+    OP_CMOV(r6, r1, r7);
+    break;
+case 401:
+    OP_CMOV(r6, r2, r0);
+    break;
+case 402:
+    OP_CMOV(r6, r2, r1);
+    break;
+case 403:
+    OP_CMOV(r6, r2, r2);
+    break;
+case 404:
+    OP_CMOV(r6, r2, r3);
+    break;
+case 405:
+    OP_CMOV(r6, r2, r4);
+    break;
+case 406:
+    OP_CMOV(r6, r2, r5);
+    break;
+case 407:
+    OP_CMOV(r6, r2, r6);
+    break;
+case 408:
+    OP_CMOV(r6, r2, r7);
+    break;
+case 409:
+    OP_CMOV(r6, r3, r0);
+    break;
+case 410:
+    OP_CMOV(r6, r3, r1);
+    break;
+case 411:
+    OP_CMOV(r6, r3, r2);
+    break;
+case 412:
+    OP_CMOV(r6, r3, r3);
+    break;
+case 413:
+    OP_CMOV(r6, r3, r4);
+    break;
+case 414:
+    OP_CMOV(r6, r3, r5);
+    break;
+case 415:
+    OP_CMOV(r6, r3, r6);
+    break;
+case 416:
+    OP_CMOV(r6, r3, r7);
+    break;
+case 417:
+    OP_CMOV(r6, r4, r0);
+    break;
+case 418:
+    OP_CMOV(r6, r4, r1);
+    break;
+case 419:
+    OP_CMOV(r6, r4, r2);
+    break;
+case 420:
+    OP_CMOV(r6, r4, r3);
+    break;
+case 421:
+    OP_CMOV(r6, r4, r4);
+    break;
+case 422:
+    OP_CMOV(r6, r4, r5);
+    break;
+case 423:
+    OP_CMOV(r6, r4, r6);
+    break;
+case 424:
+    OP_CMOV(r6, r4, r7);
+    break;
+case 425:
+    OP_CMOV(r6, r5, r0);
+    break;
+case 426:
+    OP_CMOV(r6, r5, r1);
+    break;
+case 427:
+    OP_CMOV(r6, r5, r2);
+    break;
+case 428:
+    OP_CMOV(r6, r5, r3);
+    break;
+case 429:
+    OP_CMOV(r6, r5, r4);
+    break;
+case 430:
+    OP_CMOV(r6, r5, r5);
+    break;
+case 431:
+    OP_CMOV(r6, r5, r6);
+    break;
+case 432:
+    OP_CMOV(r6, r5, r7);
+    break;
+case 433:
+    OP_CMOV(r6, r6, r0);
+    break;
+case 434:
+    OP_CMOV(r6, r6, r1);
+    break;
+case 435:
+    OP_CMOV(r6, r6, r2);
+    break;
+case 436:
+    OP_CMOV(r6, r6, r3);
+    break;
+case 437:
+    OP_CMOV(r6, r6, r4);
+    break;
+case 438:
+    OP_CMOV(r6, r6, r5);
+    break;
+case 439:
+    OP_CMOV(r6, r6, r6);
+    break;
+case 440:
+    OP_CMOV(r6, r6, r7);
+    break;
+case 441:
+    OP_CMOV(r6, r7, r0);
+    break;
+case 442:
+    OP_CMOV(r6, r7, r1);
+    break;
+case 443:
+    OP_CMOV(r6, r7, r2);
+    break;
+case 444:
+    OP_CMOV(r6, r7, r3);
+    break;
+case 445:
+    OP_CMOV(r6, r7, r4);
+    break;
+case 446:
+    OP_CMOV(r6, r7, r5);
+    break;
+case 447:
+    OP_CMOV(r6, r7, r6);
+    break;
+case 448:
+    OP_CMOV(r6, r7, r7);
+    break;
+case 449:
+    OP_CMOV(r7, r0, r0);
+    break;
+case 450:
+    OP_CMOV(r7, r0, r1);
+    break;
+case 451:
+    OP_CMOV(r7, r0, r2);
+    break;
+case 452:
+    OP_CMOV(r7, r0, r3);
+    break;
+case 453:
+    OP_CMOV(r7, r0, r4);
+    break;
+case 454:
+    OP_CMOV(r7, r0, r5);
+    break;
+case 455:
+    OP_CMOV(r7, r0, r6);
+    break;
+case 456:
+    OP_CMOV(r7, r0, r7);
+    break;
+case 457:
+    OP_CMOV(r7, r1, r0);
+    break;
+case 458:
+    OP_CMOV(r7, r1, r1);
+    break;
+case 459:
+    OP_CMOV(r7, r1, r2);
+    break;
+case 460:
+    OP_CMOV(r7, r1, r3);
+    break;
+case 461:
+    OP_CMOV(r7, r1, r4);
+    break;
+case 462:
+    OP_CMOV(r7, r1, r5);
+    break;
+case 463:
+    OP_CMOV(r7, r1, r6);
+    break;
+case 464:
+    OP_CMOV(r7, r1, r7);
+    break;
+case 465:
+    OP_CMOV(r7, r2, r0);
+    break;
+case 466:
+    OP_CMOV(r7, r2, r1);
+    break;
+case 467:
+    OP_CMOV(r7, r2, r2);
+    break;
+case 468:
+    OP_CMOV(r7, r2, r3);
+    break;
+case 469:
+    OP_CMOV(r7, r2, r4);
+    break;
+case 470:
+    OP_CMOV(r7, r2, r5);
+    break;
+case 471:
+    OP_CMOV(r7, r2, r6);
+    break;
+case 472:
+    OP_CMOV(r7, r2, r7);
+    break;
+case 473:
+    OP_CMOV(r7, r3, r0);
+    break;
+case 474:
+    OP_CMOV(r7, r3, r1);
+    break;
+case 475:
+    OP_CMOV(r7, r3, r2);
+    break;
+case 476:
+    OP_CMOV(r7, r3, r3);
+    break;
+case 477:
+    OP_CMOV(r7, r3, r4);
+    break;
+case 478:
+    OP_CMOV(r7, r3, r5);
+    break;
+case 479:
+    OP_CMOV(r7, r3, r6);
+    break;
+case 480:
+    OP_CMOV(r7, r3, r7);
+    break;
+case 481:
+    OP_CMOV(r7, r4, r0);
+    break;
+case 482:
+    OP_CMOV(r7, r4, r1);
+    break;
+case 483:
+    OP_CMOV(r7, r4, r2);
+    break;
+case 484:
+    OP_CMOV(r7, r4, r3);
+    break;
+case 485:
+    OP_CMOV(r7, r4, r4);
+    break;
+case 486:
+    OP_CMOV(r7, r4, r5);
+    break;
+case 487:
+    OP_CMOV(r7, r4, r6);
+    break;
+case 488:
+    OP_CMOV(r7, r4, r7);
+    break;
+case 489:
+    OP_CMOV(r7, r5, r0);
+    break;
+case 490:
+    OP_CMOV(r7, r5, r1);
+    break;
+case 491:
+    OP_CMOV(r7, r5, r2);
+    break;
+case 492:
+    OP_CMOV(r7, r5, r3);
+    break;
+case 493:
+    OP_CMOV(r7, r5, r4);
+    break;
+case 494:
+    OP_CMOV(r7, r5, r5);
+    break;
+case 495:
+    OP_CMOV(r7, r5, r6);
+    break;
+case 496:
+    OP_CMOV(r7, r5, r7);
+    break;
+case 497:
+    OP_CMOV(r7, r6, r0);
+    break;
+case 498:
+    OP_CMOV(r7, r6, r1);
+    break;
+case 499:
+    OP_CMOV(r7, r6, r2);
+    break;
+case 500:
+    OP_CMOV(r7, r6, r3);
+    break;
+case 501:
+    OP_CMOV(r7, r6, r4);
+    break;
+case 502:
+    OP_CMOV(r7, r6, r5);
+    break;
+case 503:
+    OP_CMOV(r7, r6, r6);
+    break;
+case 504:
+    OP_CMOV(r7, r6, r7);
+    break;
+case 505:
+    OP_CMOV(r7, r7, r0);
+    break;
+case 506:
+    OP_CMOV(r7, r7, r1);
+    break;
+case 507:
+    OP_CMOV(r7, r7, r2);
+    break;
+case 508:
+    OP_CMOV(r7, r7, r3);
+    break;
+case 509:
+    OP_CMOV(r7, r7, r4);
+    break;
+case 510:
+    OP_CMOV(r7, r7, r5);
+    break;
+case 511:
+    OP_CMOV(r7, r7, r6);
+    break;
+case 512:
+    OP_CMOV(r7, r7, r7);
+    break;
+case 513:
+    OP_SLOAD(r0, r0, r0);
+    break;
+case 514:
+    OP_SLOAD(r0, r0, r1);
+    break;
+case 515:
+    OP_SLOAD(r0, r0, r2);
+    break;
+case 516:
+    OP_SLOAD(r0, r0, r3);
+    break;
+case 517:
+    OP_SLOAD(r0, r0, r4);
+    break;
+case 518:
+    OP_SLOAD(r0, r0, r5);
+    break;
+case 519:
+    OP_SLOAD(r0, r0, r6);
+    break;
+case 520:
+    OP_SLOAD(r0, r0, r7);
+    break;
+case 521:
+    OP_SLOAD(r0, r1, r0);
+    break;
+case 522:
+    OP_SLOAD(r0, r1, r1);
+    break;
+case 523:
+    OP_SLOAD(r0, r1, r2);
+    break;
+case 524:
+    OP_SLOAD(r0, r1, r3);
+    break;
+case 525:
+    OP_SLOAD(r0, r1, r4);
+    break;
+case 526:
+    OP_SLOAD(r0, r1, r5);
+    break;
+case 527:
+    OP_SLOAD(r0, r1, r6);
+    break;
+case 528:
+    OP_SLOAD(r0, r1, r7);
+    break;
+case 529:
+    OP_SLOAD(r0, r2, r0);
+    break;
+case 530:
+    OP_SLOAD(r0, r2, r1);
+    break;
+case 531:
+    OP_SLOAD(r0, r2, r2);
+    break;
+case 532:
+    OP_SLOAD(r0, r2, r3);
+    break;
+case 533:
+    OP_SLOAD(r0, r2, r4);
+    break;
+case 534:
+    OP_SLOAD(r0, r2, r5);
+    break;
+case 535:
+    OP_SLOAD(r0, r2, r6);
+    break;
+case 536:
+    OP_SLOAD(r0, r2, r7);
+    break;
+case 537:
+    OP_SLOAD(r0, r3, r0);
+    break;
+case 538:
+    OP_SLOAD(r0, r3, r1);
+    break;
+case 539:
+    OP_SLOAD(r0, r3, r2);
+    break;
+case 540:
+    OP_SLOAD(r0, r3, r3);
+    break;
+case 541:
+    OP_SLOAD(r0, r3, r4);
+    break;
+case 542:
+    OP_SLOAD(r0, r3, r5);
+    break;
+case 543:
+    OP_SLOAD(r0, r3, r6);
+    break;
+case 544:
+    OP_SLOAD(r0, r3, r7);
+    break;
+case 545:
+    OP_SLOAD(r0, r4, r0);
+    break;
+case 546:
+    OP_SLOAD(r0, r4, r1);
+    break;
+case 547:
+    OP_SLOAD(r0, r4, r2);
+    break;
+case 548:
+    OP_SLOAD(r0, r4, r3);
+    break;
+case 549:
+    OP_SLOAD(r0, r4, r4);
+    break;
+case 550:
+    OP_SLOAD(r0, r4, r5);
+    break;
+case 551:
+    OP_SLOAD(r0, r4, r6);
+    break;
+case 552:
+    OP_SLOAD(r0, r4, r7);
+    break;
+case 553:
+    OP_SLOAD(r0, r5, r0);
+    break;
+case 554:
+    OP_SLOAD(r0, r5, r1);
+    break;
+case 555:
+    OP_SLOAD(r0, r5, r2);
+    break;
+case 556:
+    OP_SLOAD(r0, r5, r3);
+    break;
+case 557:
+    OP_SLOAD(r0, r5, r4);
+    break;
+case 558:
+    OP_SLOAD(r0, r5, r5);
+    break;
+case 559:
+    OP_SLOAD(r0, r5, r6);
+    break;
+case 560:
+    OP_SLOAD(r0, r5, r7);
+    break;
+case 561:
+    OP_SLOAD(r0, r6, r0);
+    break;
+case 562:
+    OP_SLOAD(r0, r6, r1);
+    break;
+case 563:
+    OP_SLOAD(r0, r6, r2);
+    break;
+case 564:
+    OP_SLOAD(r0, r6, r3);
+    break;
+case 565:
+    OP_SLOAD(r0, r6, r4);
+    break;
+case 566:
+    OP_SLOAD(r0, r6, r5);
+    break;
+case 567:
+    OP_SLOAD(r0, r6, r6);
+    break;
+case 568:
+    OP_SLOAD(r0, r6, r7);
+    break;
+case 569:
+    OP_SLOAD(r0, r7, r0);
+    break;
+case 570:
+    OP_SLOAD(r0, r7, r1);
+    break;
+case 571:
+    OP_SLOAD(r0, r7, r2);
+    break;
+case 572:
+    OP_SLOAD(r0, r7, r3);
+    break;
+case 573:
+    OP_SLOAD(r0, r7, r4);
+    break;
+case 574:
+    OP_SLOAD(r0, r7, r5);
+    break;
+case 575:
+    OP_SLOAD(r0, r7, r6);
+    break;
+case 576:
+    OP_SLOAD(r0, r7, r7);
+    break;
+case 577:
+    OP_SLOAD(r1, r0, r0);
+    break;
+case 578:
+    OP_SLOAD(r1, r0, r1);
+    break;
+case 579:
+    OP_SLOAD(r1, r0, r2);
+    break;
+case 580:
+    OP_SLOAD(r1, r0, r3);
+    break;
+case 581:
+    OP_SLOAD(r1, r0, r4);
+    break;
+case 582:
+    OP_SLOAD(r1, r0, r5);
+    break;
+case 583:
+    OP_SLOAD(r1, r0, r6);
+    break;
+case 584:
+    OP_SLOAD(r1, r0, r7);
+    break;
+case 585:
+    OP_SLOAD(r1, r1, r0);
+    break;
+case 586:
+    OP_SLOAD(r1, r1, r1);
+    break;
+case 587:
+    OP_SLOAD(r1, r1, r2);
+    break;
+case 588:
+    OP_SLOAD(r1, r1, r3);
+    break;
+case 589:
+    OP_SLOAD(r1, r1, r4);
+    break;
+case 590:
+    OP_SLOAD(r1, r1, r5);
+    break;
+case 591:
+    OP_SLOAD(r1, r1, r6);
+    break;
+case 592:
+    OP_SLOAD(r1, r1, r7);
+    break;
+case 593:
+    OP_SLOAD(r1, r2, r0);
+    break;
+case 594:
+    OP_SLOAD(r1, r2, r1);
+    break;
+case 595:
+    OP_SLOAD(r1, r2, r2);
+    break;
+case 596:
+    OP_SLOAD(r1, r2, r3);
+    break;
+case 597:
+    OP_SLOAD(r1, r2, r4);
+    break;
+case 598:
+    OP_SLOAD(r1, r2, r5);
+    break;
+case 599:
+    OP_SLOAD(r1, r2, r6);
+    break;
+case 600:
+    OP_SLOAD(r1, r2, r7);
+    break;
+case 601:
+    OP_SLOAD(r1, r3, r0);
+    break;
+case 602:
+    OP_SLOAD(r1, r3, r1);
+    break;
+case 603:
+    OP_SLOAD(r1, r3, r2);
+    break;
+case 604:
+    OP_SLOAD(r1, r3, r3);
+    break;
+case 605:
+    OP_SLOAD(r1, r3, r4);
+    break;
+case 606:
+    OP_SLOAD(r1, r3, r5);
+    break;
+case 607:
+    OP_SLOAD(r1, r3, r6);
+    break;
+case 608:
+    OP_SLOAD(r1, r3, r7);
+    break;
+case 609:
+    OP_SLOAD(r1, r4, r0);
+    break;
+case 610:
+    OP_SLOAD(r1, r4, r1);
+    break;
+case 611:
+    OP_SLOAD(r1, r4, r2);
+    break;
+case 612:
+    OP_SLOAD(r1, r4, r3);
+    break;
+case 613:
+    OP_SLOAD(r1, r4, r4);
+    break;
+case 614:
+    OP_SLOAD(r1, r4, r5);
+    break;
+case 615:
+    OP_SLOAD(r1, r4, r6);
+    break;
+case 616:
+    OP_SLOAD(r1, r4, r7);
+    break;
+case 617:
+    OP_SLOAD(r1, r5, r0);
+    break;
+case 618:
+    OP_SLOAD(r1, r5, r1);
+    break;
+case 619:
+    OP_SLOAD(r1, r5, r2);
+    break;
+case 620:
+    OP_SLOAD(r1, r5, r3);
+    break;
+case 621:
+    OP_SLOAD(r1, r5, r4);
+    break;
+case 622:
+    OP_SLOAD(r1, r5, r5);
+    break;
+case 623:
+    OP_SLOAD(r1, r5, r6);
+    break;
+case 624:
+    OP_SLOAD(r1, r5, r7);
+    break;
+case 625:
+    OP_SLOAD(r1, r6, r0);
+    break;
+case 626:
+    OP_SLOAD(r1, r6, r1);
+    break;
+case 627:
+    OP_SLOAD(r1, r6, r2);
+    break;
+case 628:
+    OP_SLOAD(r1, r6, r3);
+    break;
+case 629:
+    OP_SLOAD(r1, r6, r4);
+    break;
+case 630:
+    OP_SLOAD(r1, r6, r5);
+    break;
+case 631:
+    OP_SLOAD(r1, r6, r6);
+    break;
+case 632:
+    OP_SLOAD(r1, r6, r7);
+    break;
+case 633:
+    OP_SLOAD(r1, r7, r0);
+    break;
+case 634:
+    OP_SLOAD(r1, r7, r1);
+    break;
+case 635:
+    OP_SLOAD(r1, r7, r2);
+    break;
+case 636:
+    OP_SLOAD(r1, r7, r3);
+    break;
+case 637:
+    OP_SLOAD(r1, r7, r4);
+    break;
+case 638:
+    OP_SLOAD(r1, r7, r5);
+    break;
+case 639:
+    OP_SLOAD(r1, r7, r6);
+    break;
+case 640:
+    OP_SLOAD(r1, r7, r7);
+    break;
+case 641:
+    OP_SLOAD(r2, r0, r0);
+    break;
+case 642:
+    OP_SLOAD(r2, r0, r1);
+    break;
+case 643:
+    OP_SLOAD(r2, r0, r2);
+    break;
+case 644:
+    OP_SLOAD(r2, r0, r3);
+    break;
+case 645:
+    OP_SLOAD(r2, r0, r4);
+    break;
+case 646:
+    OP_SLOAD(r2, r0, r5);
+    break;
+case 647:
+    OP_SLOAD(r2, r0, r6);
+    break;
+case 648:
+    OP_SLOAD(r2, r0, r7);
+    break;
+case 649:
+    OP_SLOAD(r2, r1, r0);
+    break;
+case 650:
+    OP_SLOAD(r2, r1, r1);
+    break;
+case 651:
+    OP_SLOAD(r2, r1, r2);
+    break;
+case 652:
+    OP_SLOAD(r2, r1, r3);
+    break;
+case 653:
+    OP_SLOAD(r2, r1, r4);
+    break;
+case 654:
+    OP_SLOAD(r2, r1, r5);
+    break;
+case 655:
+    OP_SLOAD(r2, r1, r6);
+    break;
+case 656:
+    OP_SLOAD(r2, r1, r7);
+    break;
+case 657:
+    OP_SLOAD(r2, r2, r0);
+    break;
+case 658:
+    OP_SLOAD(r2, r2, r1);
+    break;
+case 659:
+    OP_SLOAD(r2, r2, r2);
+    break;
+case 660:
+    OP_SLOAD(r2, r2, r3);
+    break;
+case 661:
+    OP_SLOAD(r2, r2, r4);
+    break;
+case 662:
+    OP_SLOAD(r2, r2, r5);
+    break;
+case 663:
+    OP_SLOAD(r2, r2, r6);
+    break;
+case 664:
+    OP_SLOAD(r2, r2, r7);
+    break;
+case 665:
+    OP_SLOAD(r2, r3, r0);
+    break;
+case 666:
+    OP_SLOAD(r2, r3, r1);
+    break;
+case 667:
+    OP_SLOAD(r2, r3, r2);
+    break;
+case 668:
+    OP_SLOAD(r2, r3, r3);
+    break;
+case 669:
+    OP_SLOAD(r2, r3, r4);
+    break;
+case 670:
+    OP_SLOAD(r2, r3, r5);
+    break;
+case 671:
+    OP_SLOAD(r2, r3, r6);
+    break;
+case 672:
+    OP_SLOAD(r2, r3, r7);
+    break;
+case 673:
+    OP_SLOAD(r2, r4, r0);
+    break;
+case 674:
+    OP_SLOAD(r2, r4, r1);
+    break;
+case 675:
+    OP_SLOAD(r2, r4, r2);
+    break;
+case 676:
+    OP_SLOAD(r2, r4, r3);
+    break;
+case 677:
+    OP_SLOAD(r2, r4, r4);
+    break;
+case 678:
+    OP_SLOAD(r2, r4, r5);
+    break;
+case 679:
+    OP_SLOAD(r2, r4, r6);
+    break;
+case 680:
+    OP_SLOAD(r2, r4, r7);
+    break;
+case 681:
+    OP_SLOAD(r2, r5, r0);
+    break;
+case 682:
+    OP_SLOAD(r2, r5, r1);
+    break;
+case 683:
+    OP_SLOAD(r2, r5, r2);
+    break;
+case 684:
+    OP_SLOAD(r2, r5, r3);
+    break;
+case 685:
+    OP_SLOAD(r2, r5, r4);
+    break;
+case 686:
+    OP_SLOAD(r2, r5, r5);
+    break;
+case 687:
+    OP_SLOAD(r2, r5, r6);
+    break;
+case 688:
+    OP_SLOAD(r2, r5, r7);
+    break;
+case 689:
+    OP_SLOAD(r2, r6, r0);
+    break;
+case 690:
+    OP_SLOAD(r2, r6, r1);
+    break;
+case 691:
+    OP_SLOAD(r2, r6, r2);
+    break;
+case 692:
+    OP_SLOAD(r2, r6, r3);
+    break;
+case 693:
+    OP_SLOAD(r2, r6, r4);
+    break;
+case 694:
+    OP_SLOAD(r2, r6, r5);
+    break;
+case 695:
+    OP_SLOAD(r2, r6, r6);
+    break;
+case 696:
+    OP_SLOAD(r2, r6, r7);
+    break;
+case 697:
+    OP_SLOAD(r2, r7, r0);
+    break;
+case 698:
+    OP_SLOAD(r2, r7, r1);
+    break;
+case 699:
+    OP_SLOAD(r2, r7, r2);
+    break;
+case 700:
+    OP_SLOAD(r2, r7, r3);
+    break;
+case 701:
+    OP_SLOAD(r2, r7, r4);
+    break;
+case 702:
+    OP_SLOAD(r2, r7, r5);
+    break;
+case 703:
+    OP_SLOAD(r2, r7, r6);
+    break;
+case 704:
+    OP_SLOAD(r2, r7, r7);
+    break;
+case 705:
+    OP_SLOAD(r3, r0, r0);
+    break;
+case 706:
+    OP_SLOAD(r3, r0, r1);
+    break;
+case 707:
+    OP_SLOAD(r3, r0, r2);
+    break;
+case 708:
+    OP_SLOAD(r3, r0, r3);
+    break;
+case 709:
+    OP_SLOAD(r3, r0, r4);
+    break;
+case 710:
+    OP_SLOAD(r3, r0, r5);
+    break;
+case 711:
+    OP_SLOAD(r3, r0, r6);
+    break;
+case 712:
+    OP_SLOAD(r3, r0, r7);
+    break;
+case 713:
+    OP_SLOAD(r3, r1, r0);
+    break;
+case 714:
+    OP_SLOAD(r3, r1, r1);
+    break;
+case 715:
+    OP_SLOAD(r3, r1, r2);
+    break;
+case 716:
+    OP_SLOAD(r3, r1, r3);
+    break;
+case 717:
+    OP_SLOAD(r3, r1, r4);
+    break;
+case 718:
+    OP_SLOAD(r3, r1, r5);
+    break;
+case 719:
+    OP_SLOAD(r3, r1, r6);
+    break;
+case 720:
+    OP_SLOAD(r3, r1, r7);
+    break;
+case 721:
+    OP_SLOAD(r3, r2, r0);
+    break;
+case 722:
+    OP_SLOAD(r3, r2, r1);
+    break;
+case 723:
+    OP_SLOAD(r3, r2, r2);
+    break;
+case 724:
+    OP_SLOAD(r3, r2, r3);
+    break;
+case 725:
+    OP_SLOAD(r3, r2, r4);
+    break;
+case 726:
+    OP_SLOAD(r3, r2, r5);
+    break;
+case 727:
+    OP_SLOAD(r3, r2, r6);
+    break;
+case 728:
+    OP_SLOAD(r3, r2, r7);
+    break;
+case 729:
+    OP_SLOAD(r3, r3, r0);
+    break;
+case 730:
+    OP_SLOAD(r3, r3, r1);
+    break;
+case 731:
+    OP_SLOAD(r3, r3, r2);
+    break;
+case 732:
+    OP_SLOAD(r3, r3, r3);
+    break;
+case 733:
+    OP_SLOAD(r3, r3, r4);
+    break;
+case 734:
+    OP_SLOAD(r3, r3, r5);
+    break;
+case 735:
+    OP_SLOAD(r3, r3, r6);
+    break;
+case 736:
+    OP_SLOAD(r3, r3, r7);
+    break;
+case 737:
+    OP_SLOAD(r3, r4, r0);
+    break;
+case 738:
+    OP_SLOAD(r3, r4, r1);
+    break;
+case 739:
+    OP_SLOAD(r3, r4, r2);
+    break;
+case 740:
+    OP_SLOAD(r3, r4, r3);
+    break;
+case 741:
+    OP_SLOAD(r3, r4, r4);
+    break;
+case 742:
+    OP_SLOAD(r3, r4, r5);
+    break;
+case 743:
+    OP_SLOAD(r3, r4, r6);
+    break;
+case 744:
+    OP_SLOAD(r3, r4, r7);
+    break;
+case 745:
+    OP_SLOAD(r3, r5, r0);
+    break;
+case 746:
+    OP_SLOAD(r3, r5, r1);
+    break;
+case 747:
+    OP_SLOAD(r3, r5, r2);
+    break;
+case 748:
+    OP_SLOAD(r3, r5, r3);
+    break;
+case 749:
+    OP_SLOAD(r3, r5, r4);
+    break;
+case 750:
+    OP_SLOAD(r3, r5, r5);
+    break;
+case 751:
+    OP_SLOAD(r3, r5, r6);
+    break;
+case 752:
+    OP_SLOAD(r3, r5, r7);
+    break;
+case 753:
+    OP_SLOAD(r3, r6, r0);
+    break;
+case 754:
+    OP_SLOAD(r3, r6, r1);
+    break;
+case 755:
+    OP_SLOAD(r3, r6, r2);
+    break;
+case 756:
+    OP_SLOAD(r3, r6, r3);
+    break;
+case 757:
+    OP_SLOAD(r3, r6, r4);
+    break;
+case 758:
+    OP_SLOAD(r3, r6, r5);
+    break;
+case 759:
+    OP_SLOAD(r3, r6, r6);
+    break;
+case 760:
+    OP_SLOAD(r3, r6, r7);
+    break;
+case 761:
+    OP_SLOAD(r3, r7, r0);
+    break;
+case 762:
+    OP_SLOAD(r3, r7, r1);
+    break;
+case 763:
+    OP_SLOAD(r3, r7, r2);
+    break;
+case 764:
+    OP_SLOAD(r3, r7, r3);
+    break;
+case 765:
+    OP_SLOAD(r3, r7, r4);
+    break;
+case 766:
+    OP_SLOAD(r3, r7, r5);
+    break;
+case 767:
+    OP_SLOAD(r3, r7, r6);
+    break;
+case 768:
+    OP_SLOAD(r3, r7, r7);
+    break;
+case 769:
+    OP_SLOAD(r4, r0, r0);
+    break;
+case 770:
+    OP_SLOAD(r4, r0, r1);
+    break;
+case 771:
+    OP_SLOAD(r4, r0, r2);
+    break;
+case 772:
+    OP_SLOAD(r4, r0, r3);
+    break;
+case 773:
+    OP_SLOAD(r4, r0, r4);
+    break;
+case 774:
+    OP_SLOAD(r4, r0, r5);
+    break;
+case 775:
+    OP_SLOAD(r4, r0, r6);
+    break;
+case 776:
+    OP_SLOAD(r4, r0, r7);
+    break;
+case 777:
+    OP_SLOAD(r4, r1, r0);
+    break;
+case 778:
+    OP_SLOAD(r4, r1, r1);
+    break;
+case 779:
+    OP_SLOAD(r4, r1, r2);
+    break;
+case 780:
+    OP_SLOAD(r4, r1, r3);
+    break;
+case 781:
+    OP_SLOAD(r4, r1, r4);
+    break;
+case 782:
+    OP_SLOAD(r4, r1, r5);
+    break;
+case 783:
+    OP_SLOAD(r4, r1, r6);
+    break;
+case 784:
+    OP_SLOAD(r4, r1, r7);
+    break;
+case 785:
+    OP_SLOAD(r4, r2, r0);
+    break;
+case 786:
+    OP_SLOAD(r4, r2, r1);
+    break;
+case 787:
+    OP_SLOAD(r4, r2, r2);
+    break;
+case 788:
+    OP_SLOAD(r4, r2, r3);
+    break;
+case 789:
+    OP_SLOAD(r4, r2, r4);
+    break;
+case 790:
+    OP_SLOAD(r4, r2, r5);
+    break;
+case 791:
+    OP_SLOAD(r4, r2, r6);
+    break;
+case 792:
+    OP_SLOAD(r4, r2, r7);
+    break;
+case 793:
+    OP_SLOAD(r4, r3, r0);
+    break;
+case 794:
+    OP_SLOAD(r4, r3, r1);
+    break;
+case 795:
+    OP_SLOAD(r4, r3, r2);
+    break;
+case 796:
+    OP_SLOAD(r4, r3, r3);
+    break;
+case 797:
+    OP_SLOAD(r4, r3, r4);
+    break;
+case 798:
+    OP_SLOAD(r4, r3, r5);
+    break;
+case 799:
+    OP_SLOAD(r4, r3, r6);
+    break;
+case 800:
+    OP_SLOAD(r4, r3, r7);
+    break;
+case 801:
+    OP_SLOAD(r4, r4, r0);
+    break;
+case 802:
+    OP_SLOAD(r4, r4, r1);
+    break;
+case 803:
+    OP_SLOAD(r4, r4, r2);
+    break;
+case 804:
+    OP_SLOAD(r4, r4, r3);
+    break;
+case 805:
+    OP_SLOAD(r4, r4, r4);
+    break;
+case 806:
+    OP_SLOAD(r4, r4, r5);
+    break;
+case 807:
+    OP_SLOAD(r4, r4, r6);
+    break;
+case 808:
+    OP_SLOAD(r4, r4, r7);
+    break;
+case 809:
+    OP_SLOAD(r4, r5, r0);
+    break;
+case 810:
+    OP_SLOAD(r4, r5, r1);
+    break;
+case 811:
+    OP_SLOAD(r4, r5, r2);
+    break;
+case 812:
+    OP_SLOAD(r4, r5, r3);
+    break;
+case 813:
+    OP_SLOAD(r4, r5, r4);
+    break;
+case 814:
+    OP_SLOAD(r4, r5, r5);
+    break;
+case 815:
+    OP_SLOAD(r4, r5, r6);
+    break;
+case 816:
+    OP_SLOAD(r4, r5, r7);
+    break;
+case 817:
+    OP_SLOAD(r4, r6, r0);
+    break;
+case 818:
+    OP_SLOAD(r4, r6, r1);
+    break;
+case 819:
+    OP_SLOAD(r4, r6, r2);
+    break;
+case 820:
+    OP_SLOAD(r4, r6, r3);
+    break;
+case 821:
+    OP_SLOAD(r4, r6, r4);
+    break;
+case 822:
+    OP_SLOAD(r4, r6, r5);
+    break;
+case 823:
+    OP_SLOAD(r4, r6, r6);
+    break;
+case 824:
+    OP_SLOAD(r4, r6, r7);
+    break;
+case 825:
+    OP_SLOAD(r4, r7, r0);
+    break;
+case 826:
+    OP_SLOAD(r4, r7, r1);
+    break;
+case 827:
+    OP_SLOAD(r4, r7, r2);
+    break;
+case 828:
+    OP_SLOAD(r4, r7, r3);
+    break;
+case 829:
+    OP_SLOAD(r4, r7, r4);
+    break;
+case 830:
+    OP_SLOAD(r4, r7, r5);
+    break;
+case 831:
+    OP_SLOAD(r4, r7, r6);
+    break;
+case 832:
+    OP_SLOAD(r4, r7, r7);
+    break;
+case 833:
+    OP_SLOAD(r5, r0, r0);
+    break;
+case 834:
+    OP_SLOAD(r5, r0, r1);
+    break;
+case 835:
+    OP_SLOAD(r5, r0, r2);
+    break;
+case 836:
+    OP_SLOAD(r5, r0, r3);
+    break;
+case 837:
+    OP_SLOAD(r5, r0, r4);
+    break;
+case 838:
+    OP_SLOAD(r5, r0, r5);
+    break;
+case 839:
+    OP_SLOAD(r5, r0, r6);
+    break;
+case 840:
+    OP_SLOAD(r5, r0, r7);
+    break;
+case 841:
+    OP_SLOAD(r5, r1, r0);
+    break;
+case 842:
+    OP_SLOAD(r5, r1, r1);
+    break;
+case 843:
+    OP_SLOAD(r5, r1, r2);
+    break;
+case 844:
+    OP_SLOAD(r5, r1, r3);
+    break;
+case 845:
+    OP_SLOAD(r5, r1, r4);
+    break;
+case 846:
+    OP_SLOAD(r5, r1, r5);
+    break;
+case 847:
+    OP_SLOAD(r5, r1, r6);
+    break;
+case 848:
+    OP_SLOAD(r5, r1, r7);
+    break;
+case 849:
+    OP_SLOAD(r5, r2, r0);
+    break;
+case 850:
+    OP_SLOAD(r5, r2, r1);
+    break;
+case 851:
+    OP_SLOAD(r5, r2, r2);
+    break;
+case 852:
+    OP_SLOAD(r5, r2, r3);
+    break;
+case 853:
+    OP_SLOAD(r5, r2, r4);
+    break;
+case 854:
+    OP_SLOAD(r5, r2, r5);
+    break;
+case 855:
+    OP_SLOAD(r5, r2, r6);
+    break;
+case 856:
+    OP_SLOAD(r5, r2, r7);
+    break;
+case 857:
+    OP_SLOAD(r5, r3, r0);
+    break;
+case 858:
+    OP_SLOAD(r5, r3, r1);
+    break;
+case 859:
+    OP_SLOAD(r5, r3, r2);
+    break;
+case 860:
+    OP_SLOAD(r5, r3, r3);
+    break;
+case 861:
+    OP_SLOAD(r5, r3, r4);
+    break;
+case 862:
+    OP_SLOAD(r5, r3, r5);
+    break;
+case 863:
+    OP_SLOAD(r5, r3, r6);
+    break;
+case 864:
+    OP_SLOAD(r5, r3, r7);
+    break;
+case 865:
+    OP_SLOAD(r5, r4, r0);
+    break;
+case 866:
+    OP_SLOAD(r5, r4, r1);
+    break;
+case 867:
+    OP_SLOAD(r5, r4, r2);
+    break;
+case 868:
+    OP_SLOAD(r5, r4, r3);
+    break;
+case 869:
+    OP_SLOAD(r5, r4, r4);
+    break;
+case 870:
+    OP_SLOAD(r5, r4, r5);
+    break;
+case 871:
+    OP_SLOAD(r5, r4, r6);
+    break;
+case 872:
+    OP_SLOAD(r5, r4, r7);
+    break;
+case 873:
+    OP_SLOAD(r5, r5, r0);
+    break;
+case 874:
+    OP_SLOAD(r5, r5, r1);
+    break;
+case 875:
+    OP_SLOAD(r5, r5, r2);
+    break;
+case 876:
+    OP_SLOAD(r5, r5, r3);
+    break;
+case 877:
+    OP_SLOAD(r5, r5, r4);
+    break;
+case 878:
+    OP_SLOAD(r5, r5, r5);
+    break;
+case 879:
+    OP_SLOAD(r5, r5, r6);
+    break;
+case 880:
+    OP_SLOAD(r5, r5, r7);
+    break;
+case 881:
+    OP_SLOAD(r5, r6, r0);
+    break;
+case 882:
+    OP_SLOAD(r5, r6, r1);
+    break;
+case 883:
+    OP_SLOAD(r5, r6, r2);
+    break;
+case 884:
+    OP_SLOAD(r5, r6, r3);
+    break;
+case 885:
+    OP_SLOAD(r5, r6, r4);
+    break;
+case 886:
+    OP_SLOAD(r5, r6, r5);
+    break;
+case 887:
+    OP_SLOAD(r5, r6, r6);
+    break;
+case 888:
+    OP_SLOAD(r5, r6, r7);
+    break;
+case 889:
+    OP_SLOAD(r5, r7, r0);
+    break;
+case 890:
+    OP_SLOAD(r5, r7, r1);
+    break;
+case 891:
+    OP_SLOAD(r5, r7, r2);
+    break;
+case 892:
+    OP_SLOAD(r5, r7, r3);
+    break;
+case 893:
+    OP_SLOAD(r5, r7, r4);
+    break;
+case 894:
+    OP_SLOAD(r5, r7, r5);
+    break;
+case 895:
+    OP_SLOAD(r5, r7, r6);
+    break;
+case 896:
+    OP_SLOAD(r5, r7, r7);
+    break;
+case 897:
+    OP_SLOAD(r6, r0, r0);
+    break;
+case 898:
+    OP_SLOAD(r6, r0, r1);
+    break;
+case 899:
+    OP_SLOAD(r6, r0, r2);
+    break;
+case 900:
+    OP_SLOAD(r6, r0, r3);
+    break;
+case 901:
+    OP_SLOAD(r6, r0, r4);
+    break;
+case 902:
+    OP_SLOAD(r6, r0, r5);
+    break;
+case 903:
+    OP_SLOAD(r6, r0, r6);
+    break;
+case 904:
+    OP_SLOAD(r6, r0, r7);
+    break;
+case 905:
+    OP_SLOAD(r6, r1, r0);
+    break;
+case 906:
+    OP_SLOAD(r6, r1, r1);
+    break;
+case 907:
+    OP_SLOAD(r6, r1, r2);
+    break;
+case 908:
+    OP_SLOAD(r6, r1, r3);
+    break;
+case 909:
+    OP_SLOAD(r6, r1, r4);
+    break;
+case 910:
+    OP_SLOAD(r6, r1, r5);
+    break;
+case 911:
+    OP_SLOAD(r6, r1, r6);
+    break;
+case 912:
+    OP_SLOAD(r6, r1, r7);
+    break;
+case 913:
+    OP_SLOAD(r6, r2, r0);
+    break;
+case 914:
+    OP_SLOAD(r6, r2, r1);
+    break;
+case 915:
+    OP_SLOAD(r6, r2, r2);
+    break;
+case 916:
+    OP_SLOAD(r6, r2, r3);
+    break;
+case 917:
+    OP_SLOAD(r6, r2, r4);
+    break;
+case 918:
+    OP_SLOAD(r6, r2, r5);
+    break;
+case 919:
+    OP_SLOAD(r6, r2, r6);
+    break;
+case 920:
+    OP_SLOAD(r6, r2, r7);
+    break;
+case 921:
+    OP_SLOAD(r6, r3, r0);
+    break;
+case 922:
+    OP_SLOAD(r6, r3, r1);
+    break;
+case 923:
+    OP_SLOAD(r6, r3, r2);
+    break;
+case 924:
+    OP_SLOAD(r6, r3, r3);
+    break;
+case 925:
+    OP_SLOAD(r6, r3, r4);
+    break;
+case 926:
+    OP_SLOAD(r6, r3, r5);
+    break;
+case 927:
+    OP_SLOAD(r6, r3, r6);
+    break;
+case 928:
+    OP_SLOAD(r6, r3, r7);
+    break;
+case 929:
+    OP_SLOAD(r6, r4, r0);
+    break;
+case 930:
+    OP_SLOAD(r6, r4, r1);
+    break;
+case 931:
+    OP_SLOAD(r6, r4, r2);
+    break;
+case 932:
+    OP_SLOAD(r6, r4, r3);
+    break;
+case 933:
+    OP_SLOAD(r6, r4, r4);
+    break;
+case 934:
+    OP_SLOAD(r6, r4, r5);
+    break;
+case 935:
+    OP_SLOAD(r6, r4, r6);
+    break;
+case 936:
+    OP_SLOAD(r6, r4, r7);
+    break;
+case 937:
+    OP_SLOAD(r6, r5, r0);
+    break;
+case 938:
+    OP_SLOAD(r6, r5, r1);
+    break;
+case 939:
+    OP_SLOAD(r6, r5, r2);
+    break;
+case 940:
+    OP_SLOAD(r6, r5, r3);
+    break;
+case 941:
+    OP_SLOAD(r6, r5, r4);
+    break;
+case 942:
+    OP_SLOAD(r6, r5, r5);
+    break;
+case 943:
+    OP_SLOAD(r6, r5, r6);
+    break;
+case 944:
+    OP_SLOAD(r6, r5, r7);
+    break;
+case 945:
+    OP_SLOAD(r6, r6, r0);
+    break;
+case 946:
+    OP_SLOAD(r6, r6, r1);
+    break;
+case 947:
+    OP_SLOAD(r6, r6, r2);
+    break;
+case 948:
+    OP_SLOAD(r6, r6, r3);
+    break;
+case 949:
+    OP_SLOAD(r6, r6, r4);
+    break;
+case 950:
+    OP_SLOAD(r6, r6, r5);
+    break;
+case 951:
+    OP_SLOAD(r6, r6, r6);
+    break;
+case 952:
+    OP_SLOAD(r6, r6, r7);
+    break;
+case 953:
+    OP_SLOAD(r6, r7, r0);
+    break;
+case 954:
+    OP_SLOAD(r6, r7, r1);
+    break;
+case 955:
+    OP_SLOAD(r6, r7, r2);
+    break;
+case 956:
+    OP_SLOAD(r6, r7, r3);
+    break;
+case 957:
+    OP_SLOAD(r6, r7, r4);
+    break;
+case 958:
+    OP_SLOAD(r6, r7, r5);
+    break;
+case 959:
+    OP_SLOAD(r6, r7, r6);
+    break;
+case 960:
+    OP_SLOAD(r6, r7, r7);
+    break;
+case 961:
+    OP_SLOAD(r7, r0, r0);
+    break;
+case 962:
+    OP_SLOAD(r7, r0, r1);
+    break;
+case 963:
+    OP_SLOAD(r7, r0, r2);
+    break;
+case 964:
+    OP_SLOAD(r7, r0, r3);
+    break;
+case 965:
+    OP_SLOAD(r7, r0, r4);
+    break;
+case 966:
+    OP_SLOAD(r7, r0, r5);
+    break;
+case 967:
+    OP_SLOAD(r7, r0, r6);
+    break;
+case 968:
+    OP_SLOAD(r7, r0, r7);
+    break;
+case 969:
+    OP_SLOAD(r7, r1, r0);
+    break;
+case 970:
+    OP_SLOAD(r7, r1, r1);
+    break;
+case 971:
+    OP_SLOAD(r7, r1, r2);
+    break;
+case 972:
+    OP_SLOAD(r7, r1, r3);
+    break;
+case 973:
+    OP_SLOAD(r7, r1, r4);
+    break;
+case 974:
+    OP_SLOAD(r7, r1, r5);
+    break;
+case 975:
+    OP_SLOAD(r7, r1, r6);
+    break;
+case 976:
+    OP_SLOAD(r7, r1, r7);
+    break;
+case 977:
+    OP_SLOAD(r7, r2, r0);
+    break;
+case 978:
+    OP_SLOAD(r7, r2, r1);
+    break;
+case 979:
+    OP_SLOAD(r7, r2, r2);
+    break;
+case 980:
+    OP_SLOAD(r7, r2, r3);
+    break;
+case 981:
+    OP_SLOAD(r7, r2, r4);
+    break;
+case 982:
+    OP_SLOAD(r7, r2, r5);
+    break;
+case 983:
+    OP_SLOAD(r7, r2, r6);
+    break;
+case 984:
+    OP_SLOAD(r7, r2, r7);
+    break;
+case 985:
+    OP_SLOAD(r7, r3, r0);
+    break;
+case 986:
+    OP_SLOAD(r7, r3, r1);
+    break;
+case 987:
+    OP_SLOAD(r7, r3, r2);
+    break;
+case 988:
+    OP_SLOAD(r7, r3, r3);
+    break;
+case 989:
+    OP_SLOAD(r7, r3, r4);
+    break;
+case 990:
+    OP_SLOAD(r7, r3, r5);
+    break;
+case 991:
+    OP_SLOAD(r7, r3, r6);
+    break;
+case 992:
+    OP_SLOAD(r7, r3, r7);
+    break;
+case 993:
+    OP_SLOAD(r7, r4, r0);
+    break;
+case 994:
+    OP_SLOAD(r7, r4, r1);
+    break;
+case 995:
+    OP_SLOAD(r7, r4, r2);
+    break;
+case 996:
+    OP_SLOAD(r7, r4, r3);
+    break;
+case 997:
+    OP_SLOAD(r7, r4, r4);
+    break;
+case 998:
+    OP_SLOAD(r7, r4, r5);
+    break;
+case 999:
+    OP_SLOAD(r7, r4, r6);
+    break;
+case 1000:
+    OP_SLOAD(r7, r4, r7);
+    break;
+case 1001:
+    OP_SLOAD(r7, r5, r0);
+    break;
+case 1002:
+    OP_SLOAD(r7, r5, r1);
+    break;
+case 1003:
+    OP_SLOAD(r7, r5, r2);
+    break;
+case 1004:
+    OP_SLOAD(r7, r5, r3);
+    break;
+case 1005:
+    OP_SLOAD(r7, r5, r4);
+    break;
+case 1006:
+    OP_SLOAD(r7, r5, r5);
+    break;
+case 1007:
+    OP_SLOAD(r7, r5, r6);
+    break;
+case 1008:
+    OP_SLOAD(r7, r5, r7);
+    break;
+case 1009:
+    OP_SLOAD(r7, r6, r0);
+    break;
+case 1010:
+    OP_SLOAD(r7, r6, r1);
+    break;
+case 1011:
+    OP_SLOAD(r7, r6, r2);
+    break;
+case 1012:
+    OP_SLOAD(r7, r6, r3);
+    break;
+case 1013:
+    OP_SLOAD(r7, r6, r4);
+    break;
+case 1014:
+    OP_SLOAD(r7, r6, r5);
+    break;
+case 1015:
+    OP_SLOAD(r7, r6, r6);
+    break;
+case 1016:
+    OP_SLOAD(r7, r6, r7);
+    break;
+case 1017:
+    OP_SLOAD(r7, r7, r0);
+    break;
+case 1018:
+    OP_SLOAD(r7, r7, r1);
+    break;
+case 1019:
+    OP_SLOAD(r7, r7, r2);
+    break;
+case 1020:
+    OP_SLOAD(r7, r7, r3);
+    break;
+case 1021:
+    OP_SLOAD(r7, r7, r4);
+    break;
+case 1022:
+    OP_SLOAD(r7, r7, r5);
+    break;
+case 1023:
+    OP_SLOAD(r7, r7, r6);
+    break;
+case 1024:
+    OP_SLOAD(r7, r7, r7);
+    break;
+case 1025:
+    OP_SSTORE(r0, r0, r0);
+    break;
+case 1026:
+    OP_SSTORE(r0, r0, r1);
+    break;
+case 1027:
+    OP_SSTORE(r0, r0, r2);
+    break;
+case 1028:
+    OP_SSTORE(r0, r0, r3);
+    break;
+case 1029:
+    OP_SSTORE(r0, r0, r4);
+    break;
+case 1030:
+    OP_SSTORE(r0, r0, r5);
+    break;
+case 1031:
+    OP_SSTORE(r0, r0, r6);
+    break;
+case 1032:
+    OP_SSTORE(r0, r0, r7);
+    break;
+case 1033:
+    OP_SSTORE(r0, r1, r0);
+    break;
+case 1034:
+    OP_SSTORE(r0, r1, r1);
+    break;
+case 1035:
+    OP_SSTORE(r0, r1, r2);
+    break;
+case 1036:
+    OP_SSTORE(r0, r1, r3);
+    break;
+case 1037:
+    OP_SSTORE(r0, r1, r4);
+    break;
+case 1038:
+    OP_SSTORE(r0, r1, r5);
+    break;
+case 1039:
+    OP_SSTORE(r0, r1, r6);
+    break;
+case 1040:
+    OP_SSTORE(r0, r1, r7);
+    break;
+case 1041:
+    OP_SSTORE(r0, r2, r0);
+    break;
+case 1042:
+    OP_SSTORE(r0, r2, r1);
+    break;
+case 1043:
+    OP_SSTORE(r0, r2, r2);
+    break;
+case 1044:
+    OP_SSTORE(r0, r2, r3);
+    break;
+case 1045:
+    OP_SSTORE(r0, r2, r4);
+    break;
+case 1046:
+    OP_SSTORE(r0, r2, r5);
+    break;
+case 1047:
+    OP_SSTORE(r0, r2, r6);
+    break;
+case 1048:
+    OP_SSTORE(r0, r2, r7);
+    break;
+case 1049:
+    OP_SSTORE(r0, r3, r0);
+    break;
+case 1050:
+    OP_SSTORE(r0, r3, r1);
+    break;
+case 1051:
+    OP_SSTORE(r0, r3, r2);
+    break;
+case 1052:
+    OP_SSTORE(r0, r3, r3);
+    break;
+case 1053:
+    OP_SSTORE(r0, r3, r4);
+    break;
+case 1054:
+    OP_SSTORE(r0, r3, r5);
+    break;
+case 1055:
+    OP_SSTORE(r0, r3, r6);
+    break;
+case 1056:
+    OP_SSTORE(r0, r3, r7);
+    break;
+case 1057:
+    OP_SSTORE(r0, r4, r0);
+    break;
+case 1058:
+    OP_SSTORE(r0, r4, r1);
+    break;
+case 1059:
+    OP_SSTORE(r0, r4, r2);
+    break;
+case 1060:
+    OP_SSTORE(r0, r4, r3);
+    break;
+case 1061:
+    OP_SSTORE(r0, r4, r4);
+    break;
+case 1062:
+    OP_SSTORE(r0, r4, r5);
+    break;
+case 1063:
+    OP_SSTORE(r0, r4, r6);
+    break;
+case 1064:
+    OP_SSTORE(r0, r4, r7);
+    break;
+case 1065:
+    OP_SSTORE(r0, r5, r0);
+    break;
+case 1066:
+    OP_SSTORE(r0, r5, r1);
+    break;
+case 1067:
+    OP_SSTORE(r0, r5, r2);
+    break;
+case 1068:
+    OP_SSTORE(r0, r5, r3);
+    break;
+case 1069:
+    OP_SSTORE(r0, r5, r4);
+    break;
+case 1070:
+    OP_SSTORE(r0, r5, r5);
+    break;
+case 1071:
+    OP_SSTORE(r0, r5, r6);
+    break;
+case 1072:
+    OP_SSTORE(r0, r5, r7);
+    break;
+case 1073:
+    OP_SSTORE(r0, r6, r0);
+    break;
+case 1074:
+    OP_SSTORE(r0, r6, r1);
+    break;
+case 1075:
+    OP_SSTORE(r0, r6, r2);
+    break;
+case 1076:
+    OP_SSTORE(r0, r6, r3);
+    break;
+case 1077:
+    OP_SSTORE(r0, r6, r4);
+    break;
+case 1078:
+    OP_SSTORE(r0, r6, r5);
+    break;
+case 1079:
+    OP_SSTORE(r0, r6, r6);
+    break;
+case 1080:
+    OP_SSTORE(r0, r6, r7);
+    break;
+case 1081:
+    OP_SSTORE(r0, r7, r0);
+    break;
+case 1082:
+    OP_SSTORE(r0, r7, r1);
+    break;
+case 1083:
+    OP_SSTORE(r0, r7, r2);
+    break;
+case 1084:
+    OP_SSTORE(r0, r7, r3);
+    break;
+case 1085:
+    OP_SSTORE(r0, r7, r4);
+    break;
+case 1086:
+    OP_SSTORE(r0, r7, r5);
+    break;
+case 1087:
+    OP_SSTORE(r0, r7, r6);
+    break;
+case 1088:
+    OP_SSTORE(r0, r7, r7);
+    break;
+case 1089:
+    OP_SSTORE(r1, r0, r0);
+    break;
+case 1090:
+    OP_SSTORE(r1, r0, r1);
+    break;
+case 1091:
+    OP_SSTORE(r1, r0, r2);
+    break;
+case 1092:
+    OP_SSTORE(r1, r0, r3);
+    break;
+case 1093:
+    OP_SSTORE(r1, r0, r4);
+    break;
+case 1094:
+    OP_SSTORE(r1, r0, r5);
+    break;
+case 1095:
+    OP_SSTORE(r1, r0, r6);
+    break;
+case 1096:
+    OP_SSTORE(r1, r0, r7);
+    break;
+case 1097:
+    OP_SSTORE(r1, r1, r0);
+    break;
+case 1098:
+    OP_SSTORE(r1, r1, r1);
+    break;
+case 1099:
+    OP_SSTORE(r1, r1, r2);
+    break;
+case 1100:
+    OP_SSTORE(r1, r1, r3);
+    break;
+case 1101:
+    OP_SSTORE(r1, r1, r4);
+    break;
+case 1102:
+    OP_SSTORE(r1, r1, r5);
+    break;
+case 1103:
+    OP_SSTORE(r1, r1, r6);
+    break;
+case 1104:
+    OP_SSTORE(r1, r1, r7);
+    break;
+case 1105:
+    OP_SSTORE(r1, r2, r0);
+    break;
+case 1106:
+    OP_SSTORE(r1, r2, r1);
+    break;
+case 1107:
+    OP_SSTORE(r1, r2, r2);
+    break;
+case 1108:
+    OP_SSTORE(r1, r2, r3);
+    break;
+case 1109:
+    OP_SSTORE(r1, r2, r4);
+    break;
+case 1110:
+    OP_SSTORE(r1, r2, r5);
+    break;
+case 1111:
+    OP_SSTORE(r1, r2, r6);
+    break;
+case 1112:
+    OP_SSTORE(r1, r2, r7);
+    break;
+case 1113:
+    OP_SSTORE(r1, r3, r0);
+    break;
+case 1114:
+    OP_SSTORE(r1, r3, r1);
+    break;
+case 1115:
+    OP_SSTORE(r1, r3, r2);
+    break;
+case 1116:
+    OP_SSTORE(r1, r3, r3);
+    break;
+case 1117:
+    OP_SSTORE(r1, r3, r4);
+    break;
+case 1118:
+    OP_SSTORE(r1, r3, r5);
+    break;
+case 1119:
+    OP_SSTORE(r1, r3, r6);
+    break;
+case 1120:
+    OP_SSTORE(r1, r3, r7);
+    break;
+case 1121:
+    OP_SSTORE(r1, r4, r0);
+    break;
+case 1122:
+    OP_SSTORE(r1, r4, r1);
+    break;
+case 1123:
+    OP_SSTORE(r1, r4, r2);
+    break;
+case 1124:
+    OP_SSTORE(r1, r4, r3);
+    break;
+case 1125:
+    OP_SSTORE(r1, r4, r4);
+    break;
+case 1126:
+    OP_SSTORE(r1, r4, r5);
+    break;
+case 1127:
+    OP_SSTORE(r1, r4, r6);
+    break;
+case 1128:
+    OP_SSTORE(r1, r4, r7);
+    break;
+case 1129:
+    OP_SSTORE(r1, r5, r0);
+    break;
+case 1130:
+    OP_SSTORE(r1, r5, r1);
+    break;
+case 1131:
+    OP_SSTORE(r1, r5, r2);
+    break;
+case 1132:
+    OP_SSTORE(r1, r5, r3);
+    break;
+case 1133:
+    OP_SSTORE(r1, r5, r4);
+    break;
+case 1134:
+    OP_SSTORE(r1, r5, r5);
+    break;
+case 1135:
+    OP_SSTORE(r1, r5, r6);
+    break;
+case 1136:
+    OP_SSTORE(r1, r5, r7);
+    break;
+case 1137:
+    OP_SSTORE(r1, r6, r0);
+    break;
+case 1138:
+    OP_SSTORE(r1, r6, r1);
+    break;
+case 1139:
+    OP_SSTORE(r1, r6, r2);
+    break;
+case 1140:
+    OP_SSTORE(r1, r6, r3);
+    break;
+case 1141:
+    OP_SSTORE(r1, r6, r4);
+    break;
+case 1142:
+    OP_SSTORE(r1, r6, r5);
+    break;
+case 1143:
+    OP_SSTORE(r1, r6, r6);
+    break;
+case 1144:
+    OP_SSTORE(r1, r6, r7);
+    break;
+case 1145:
+    OP_SSTORE(r1, r7, r0);
+    break;
+case 1146:
+    OP_SSTORE(r1, r7, r1);
+    break;
+case 1147:
+    OP_SSTORE(r1, r7, r2);
+    break;
+case 1148:
+    OP_SSTORE(r1, r7, r3);
+    break;
+case 1149:
+    OP_SSTORE(r1, r7, r4);
+    break;
+case 1150:
+    OP_SSTORE(r1, r7, r5);
+    break;
+case 1151:
+    OP_SSTORE(r1, r7, r6);
+    break;
+case 1152:
+    OP_SSTORE(r1, r7, r7);
+    break;
+case 1153:
+    OP_SSTORE(r2, r0, r0);
+    break;
+case 1154:
+    OP_SSTORE(r2, r0, r1);
+    break;
+case 1155:
+    OP_SSTORE(r2, r0, r2);
+    break;
+case 1156:
+    OP_SSTORE(r2, r0, r3);
+    break;
+case 1157:
+    OP_SSTORE(r2, r0, r4);
+    break;
+case 1158:
+    OP_SSTORE(r2, r0, r5);
+    break;
+case 1159:
+    OP_SSTORE(r2, r0, r6);
+    break;
+case 1160:
+    OP_SSTORE(r2, r0, r7);
+    break;
+case 1161:
+    OP_SSTORE(r2, r1, r0);
+    break;
+case 1162:
+    OP_SSTORE(r2, r1, r1);
+    break;
+case 1163:
+    OP_SSTORE(r2, r1, r2);
+    break;
+case 1164:
+    OP_SSTORE(r2, r1, r3);
+    break;
+case 1165:
+    OP_SSTORE(r2, r1, r4);
+    break;
+case 1166:
+    OP_SSTORE(r2, r1, r5);
+    break;
+case 1167:
+    OP_SSTORE(r2, r1, r6);
+    break;
+case 1168:
+    OP_SSTORE(r2, r1, r7);
+    break;
+case 1169:
+    OP_SSTORE(r2, r2, r0);
+    break;
+case 1170:
+    OP_SSTORE(r2, r2, r1);
+    break;
+case 1171:
+    OP_SSTORE(r2, r2, r2);
+    break;
+case 1172:
+    OP_SSTORE(r2, r2, r3);
+    break;
+case 1173:
+    OP_SSTORE(r2, r2, r4);
+    break;
+case 1174:
+    OP_SSTORE(r2, r2, r5);
+    break;
+case 1175:
+    OP_SSTORE(r2, r2, r6);
+    break;
+case 1176:
+    OP_SSTORE(r2, r2, r7);
+    break;
+case 1177:
+    OP_SSTORE(r2, r3, r0);
+    break;
+case 1178:
+    OP_SSTORE(r2, r3, r1);
+    break;
+case 1179:
+    OP_SSTORE(r2, r3, r2);
+    break;
+case 1180:
+    OP_SSTORE(r2, r3, r3);
+    break;
+case 1181:
+    OP_SSTORE(r2, r3, r4);
+    break;
+case 1182:
+    OP_SSTORE(r2, r3, r5);
+    break;
+case 1183:
+    OP_SSTORE(r2, r3, r6);
+    break;
+case 1184:
+    OP_SSTORE(r2, r3, r7);
+    break;
+case 1185:
+    OP_SSTORE(r2, r4, r0);
+    break;
+case 1186:
+    OP_SSTORE(r2, r4, r1);
+    break;
+case 1187:
+    OP_SSTORE(r2, r4, r2);
+    break;
+case 1188:
+    OP_SSTORE(r2, r4, r3);
+    break;
+case 1189:
+    OP_SSTORE(r2, r4, r4);
+    break;
+case 1190:
+    OP_SSTORE(r2, r4, r5);
+    break;
+case 1191:
+    OP_SSTORE(r2, r4, r6);
+    break;
+case 1192:
+    OP_SSTORE(r2, r4, r7);
+    break;
+case 1193:
+    OP_SSTORE(r2, r5, r0);
+    break;
+case 1194:
+    OP_SSTORE(r2, r5, r1);
+    break;
+case 1195:
+    OP_SSTORE(r2, r5, r2);
+    break;
+case 1196:
+    OP_SSTORE(r2, r5, r3);
+    break;
+case 1197:
+    OP_SSTORE(r2, r5, r4);
+    break;
+case 1198:
+    OP_SSTORE(r2, r5, r5);
+    break;
+case 1199:
+    OP_SSTORE(r2, r5, r6);
+    break;
+case 1200:
+    OP_SSTORE(r2, r5, r7);
+    break;
+case 1201:
+    OP_SSTORE(r2, r6, r0);
+    break;
+case 1202:
+    OP_SSTORE(r2, r6, r1);
+    break;
+case 1203:
+    OP_SSTORE(r2, r6, r2);
+    break;
+case 1204:
+    OP_SSTORE(r2, r6, r3);
+    break;
+case 1205:
+    OP_SSTORE(r2, r6, r4);
+    break;
+case 1206:
+    OP_SSTORE(r2, r6, r5);
+    break;
+case 1207:
+    OP_SSTORE(r2, r6, r6);
+    break;
+case 1208:
+    OP_SSTORE(r2, r6, r7);
+    break;
+case 1209:
+    OP_SSTORE(r2, r7, r0);
+    break;
+case 1210:
+    OP_SSTORE(r2, r7, r1);
+    break;
+case 1211:
+    OP_SSTORE(r2, r7, r2);
+    break;
+case 1212:
+    OP_SSTORE(r2, r7, r3);
+    break;
+case 1213:
+    OP_SSTORE(r2, r7, r4);
+    break;
+case 1214:
+    OP_SSTORE(r2, r7, r5);
+    break;
+case 1215:
+    OP_SSTORE(r2, r7, r6);
+    break;
+case 1216:
+    OP_SSTORE(r2, r7, r7);
+    break;
+case 1217:
+    OP_SSTORE(r3, r0, r0);
+    break;
+case 1218:
+    OP_SSTORE(r3, r0, r1);
+    break;
+case 1219:
+    OP_SSTORE(r3, r0, r2);
+    break;
+case 1220:
+    OP_SSTORE(r3, r0, r3);
+    break;
+case 1221:
+    OP_SSTORE(r3, r0, r4);
+    break;
+case 1222:
+    OP_SSTORE(r3, r0, r5);
+    break;
+case 1223:
+    OP_SSTORE(r3, r0, r6);
+    break;
+case 1224:
+    OP_SSTORE(r3, r0, r7);
+    break;
+case 1225:
+    OP_SSTORE(r3, r1, r0);
+    break;
+case 1226:
+    OP_SSTORE(r3, r1, r1);
+    break;
+case 1227:
+    OP_SSTORE(r3, r1, r2);
+    break;
+case 1228:
+    OP_SSTORE(r3, r1, r3);
+    break;
+case 1229:
+    OP_SSTORE(r3, r1, r4);
+    break;
+case 1230:
+    OP_SSTORE(r3, r1, r5);
+    break;
+case 1231:
+    OP_SSTORE(r3, r1, r6);
+    break;
+case 1232:
+    OP_SSTORE(r3, r1, r7);
+    break;
+case 1233:
+    OP_SSTORE(r3, r2, r0);
+    break;
+case 1234:
+    OP_SSTORE(r3, r2, r1);
+    break;
+case 1235:
+    OP_SSTORE(r3, r2, r2);
+    break;
+case 1236:
+    OP_SSTORE(r3, r2, r3);
+    break;
+case 1237:
+    OP_SSTORE(r3, r2, r4);
+    break;
+case 1238:
+    OP_SSTORE(r3, r2, r5);
+    break;
+case 1239:
+    OP_SSTORE(r3, r2, r6);
+    break;
+case 1240:
+    OP_SSTORE(r3, r2, r7);
+    break;
+case 1241:
+    OP_SSTORE(r3, r3, r0);
+    break;
+case 1242:
+    OP_SSTORE(r3, r3, r1);
+    break;
+case 1243:
+    OP_SSTORE(r3, r3, r2);
+    break;
+case 1244:
+    OP_SSTORE(r3, r3, r3);
+    break;
+case 1245:
+    OP_SSTORE(r3, r3, r4);
+    break;
+case 1246:
+    OP_SSTORE(r3, r3, r5);
+    break;
+case 1247:
+    OP_SSTORE(r3, r3, r6);
+    break;
+case 1248:
+    OP_SSTORE(r3, r3, r7);
+    break;
+case 1249:
+    OP_SSTORE(r3, r4, r0);
+    break;
+case 1250:
+    OP_SSTORE(r3, r4, r1);
+    break;
+case 1251:
+    OP_SSTORE(r3, r4, r2);
+    break;
+case 1252:
+    OP_SSTORE(r3, r4, r3);
+    break;
+case 1253:
+    OP_SSTORE(r3, r4, r4);
+    break;
+case 1254:
+    OP_SSTORE(r3, r4, r5);
+    break;
+case 1255:
+    OP_SSTORE(r3, r4, r6);
+    break;
+case 1256:
+    OP_SSTORE(r3, r4, r7);
+    break;
+case 1257:
+    OP_SSTORE(r3, r5, r0);
+    break;
+case 1258:
+    OP_SSTORE(r3, r5, r1);
+    break;
+case 1259:
+    OP_SSTORE(r3, r5, r2);
+    break;
+case 1260:
+    OP_SSTORE(r3, r5, r3);
+    break;
+case 1261:
+    OP_SSTORE(r3, r5, r4);
+    break;
+case 1262:
+    OP_SSTORE(r3, r5, r5);
+    break;
+case 1263:
+    OP_SSTORE(r3, r5, r6);
+    break;
+case 1264:
+    OP_SSTORE(r3, r5, r7);
+    break;
+case 1265:
+    OP_SSTORE(r3, r6, r0);
+    break;
+case 1266:
+    OP_SSTORE(r3, r6, r1);
+    break;
+case 1267:
+    OP_SSTORE(r3, r6, r2);
+    break;
+case 1268:
+    OP_SSTORE(r3, r6, r3);
+    break;
+case 1269:
+    OP_SSTORE(r3, r6, r4);
+    break;
+case 1270:
+    OP_SSTORE(r3, r6, r5);
+    break;
+case 1271:
+    OP_SSTORE(r3, r6, r6);
+    break;
+case 1272:
+    OP_SSTORE(r3, r6, r7);
+    break;
+case 1273:
+    OP_SSTORE(r3, r7, r0);
+    break;
+case 1274:
+    OP_SSTORE(r3, r7, r1);
+    break;
+case 1275:
+    OP_SSTORE(r3, r7, r2);
+    break;
+case 1276:
+    OP_SSTORE(r3, r7, r3);
+    break;
+case 1277:
+    OP_SSTORE(r3, r7, r4);
+    break;
+case 1278:
+    OP_SSTORE(r3, r7, r5);
+    break;
+case 1279:
+    OP_SSTORE(r3, r7, r6);
+    break;
+case 1280:
+    OP_SSTORE(r3, r7, r7);
+    break;
+case 1281:
+    OP_SSTORE(r4, r0, r0);
+    break;
+case 1282:
+    OP_SSTORE(r4, r0, r1);
+    break;
+case 1283:
+    OP_SSTORE(r4, r0, r2);
+    break;
+case 1284:
+    OP_SSTORE(r4, r0, r3);
+    break;
+case 1285:
+    OP_SSTORE(r4, r0, r4);
+    break;
+case 1286:
+    OP_SSTORE(r4, r0, r5);
+    break;
+case 1287:
+    OP_SSTORE(r4, r0, r6);
+    break;
+case 1288:
+    OP_SSTORE(r4, r0, r7);
+    break;
+case 1289:
+    OP_SSTORE(r4, r1, r0);
+    break;
+case 1290:
+    OP_SSTORE(r4, r1, r1);
+    break;
+case 1291:
+    OP_SSTORE(r4, r1, r2);
+    break;
+case 1292:
+    OP_SSTORE(r4, r1, r3);
+    break;
+case 1293:
+    OP_SSTORE(r4, r1, r4);
+    break;
+case 1294:
+    OP_SSTORE(r4, r1, r5);
+    break;
+case 1295:
+    OP_SSTORE(r4, r1, r6);
+    break;
+case 1296:
+    OP_SSTORE(r4, r1, r7);
+    break;
+case 1297:
+    OP_SSTORE(r4, r2, r0);
+    break;
+case 1298:
+    OP_SSTORE(r4, r2, r1);
+    break;
+case 1299:
+    OP_SSTORE(r4, r2, r2);
+    break;
+case 1300:
+    OP_SSTORE(r4, r2, r3);
+    break;
+case 1301:
+    OP_SSTORE(r4, r2, r4);
+    break;
+case 1302:
+    OP_SSTORE(r4, r2, r5);
+    break;
+case 1303:
+    OP_SSTORE(r4, r2, r6);
+    break;
+case 1304:
+    OP_SSTORE(r4, r2, r7);
+    break;
+case 1305:
+    OP_SSTORE(r4, r3, r0);
+    break;
+case 1306:
+    OP_SSTORE(r4, r3, r1);
+    break;
+case 1307:
+    OP_SSTORE(r4, r3, r2);
+    break;
+case 1308:
+    OP_SSTORE(r4, r3, r3);
+    break;
+case 1309:
+    OP_SSTORE(r4, r3, r4);
+    break;
+case 1310:
+    OP_SSTORE(r4, r3, r5);
+    break;
+case 1311:
+    OP_SSTORE(r4, r3, r6);
+    break;
+case 1312:
+    OP_SSTORE(r4, r3, r7);
+    break;
+case 1313:
+    OP_SSTORE(r4, r4, r0);
+    break;
+case 1314:
+    OP_SSTORE(r4, r4, r1);
+    break;
+case 1315:
+    OP_SSTORE(r4, r4, r2);
+    break;
+case 1316:
+    OP_SSTORE(r4, r4, r3);
+    break;
+case 1317:
+    OP_SSTORE(r4, r4, r4);
+    break;
+case 1318:
+    OP_SSTORE(r4, r4, r5);
+    break;
+case 1319:
+    OP_SSTORE(r4, r4, r6);
+    break;
+case 1320:
+    OP_SSTORE(r4, r4, r7);
+    break;
+case 1321:
+    OP_SSTORE(r4, r5, r0);
+    break;
+case 1322:
+    OP_SSTORE(r4, r5, r1);
+    break;
+case 1323:
+    OP_SSTORE(r4, r5, r2);
+    break;
+case 1324:
+    OP_SSTORE(r4, r5, r3);
+    break;
+case 1325:
+    OP_SSTORE(r4, r5, r4);
+    break;
+case 1326:
+    OP_SSTORE(r4, r5, r5);
+    break;
+case 1327:
+    OP_SSTORE(r4, r5, r6);
+    break;
+case 1328:
+    OP_SSTORE(r4, r5, r7);
+    break;
+case 1329:
+    OP_SSTORE(r4, r6, r0);
+    break;
+case 1330:
+    OP_SSTORE(r4, r6, r1);
+    break;
+case 1331:
+    OP_SSTORE(r4, r6, r2);
+    break;
+case 1332:
+    OP_SSTORE(r4, r6, r3);
+    break;
+case 1333:
+    OP_SSTORE(r4, r6, r4);
+    break;
+case 1334:
+    OP_SSTORE(r4, r6, r5);
+    break;
+case 1335:
+    OP_SSTORE(r4, r6, r6);
+    break;
+case 1336:
+    OP_SSTORE(r4, r6, r7);
+    break;
+case 1337:
+    OP_SSTORE(r4, r7, r0);
+    break;
+case 1338:
+    OP_SSTORE(r4, r7, r1);
+    break;
+case 1339:
+    OP_SSTORE(r4, r7, r2);
+    break;
+case 1340:
+    OP_SSTORE(r4, r7, r3);
+    break;
+case 1341:
+    OP_SSTORE(r4, r7, r4);
+    break;
+case 1342:
+    OP_SSTORE(r4, r7, r5);
+    break;
+case 1343:
+    OP_SSTORE(r4, r7, r6);
+    break;
+case 1344:
+    OP_SSTORE(r4, r7, r7);
+    break;
+case 1345:
+    OP_SSTORE(r5, r0, r0);
+    break;
+case 1346:
+    OP_SSTORE(r5, r0, r1);
+    break;
+case 1347:
+    OP_SSTORE(r5, r0, r2);
+    break;
+case 1348:
+    OP_SSTORE(r5, r0, r3);
+    break;
+case 1349:
+    OP_SSTORE(r5, r0, r4);
+    break;
+case 1350:
+    OP_SSTORE(r5, r0, r5);
+    break;
+case 1351:
+    OP_SSTORE(r5, r0, r6);
+    break;
+case 1352:
+    OP_SSTORE(r5, r0, r7);
+    break;
+case 1353:
+    OP_SSTORE(r5, r1, r0);
+    break;
+case 1354:
+    OP_SSTORE(r5, r1, r1);
+    break;
+case 1355:
+    OP_SSTORE(r5, r1, r2);
+    break;
+case 1356:
+    OP_SSTORE(r5, r1, r3);
+    break;
+case 1357:
+    OP_SSTORE(r5, r1, r4);
+    break;
+case 1358:
+    OP_SSTORE(r5, r1, r5);
+    break;
+case 1359:
+    OP_SSTORE(r5, r1, r6);
+    break;
+case 1360:
+    OP_SSTORE(r5, r1, r7);
+    break;
+case 1361:
+    OP_SSTORE(r5, r2, r0);
+    break;
+case 1362:
+    OP_SSTORE(r5, r2, r1);
+    break;
+case 1363:
+    OP_SSTORE(r5, r2, r2);
+    break;
+case 1364:
+    OP_SSTORE(r5, r2, r3);
+    break;
+case 1365:
+    OP_SSTORE(r5, r2, r4);
+    break;
+case 1366:
+    OP_SSTORE(r5, r2, r5);
+    break;
+case 1367:
+    OP_SSTORE(r5, r2, r6);
+    break;
+case 1368:
+    OP_SSTORE(r5, r2, r7);
+    break;
+case 1369:
+    OP_SSTORE(r5, r3, r0);
+    break;
+case 1370:
+    OP_SSTORE(r5, r3, r1);
+    break;
+case 1371:
+    OP_SSTORE(r5, r3, r2);
+    break;
+case 1372:
+    OP_SSTORE(r5, r3, r3);
+    break;
+case 1373:
+    OP_SSTORE(r5, r3, r4);
+    break;
+case 1374:
+    OP_SSTORE(r5, r3, r5);
+    break;
+case 1375:
+    OP_SSTORE(r5, r3, r6);
+    break;
+case 1376:
+    OP_SSTORE(r5, r3, r7);
+    break;
+case 1377:
+    OP_SSTORE(r5, r4, r0);
+    break;
+case 1378:
+    OP_SSTORE(r5, r4, r1);
+    break;
+case 1379:
+    OP_SSTORE(r5, r4, r2);
+    break;
+case 1380:
+    OP_SSTORE(r5, r4, r3);
+    break;
+case 1381:
+    OP_SSTORE(r5, r4, r4);
+    break;
+case 1382:
+    OP_SSTORE(r5, r4, r5);
+    break;
+case 1383:
+    OP_SSTORE(r5, r4, r6);
+    break;
+case 1384:
+    OP_SSTORE(r5, r4, r7);
+    break;
+case 1385:
+    OP_SSTORE(r5, r5, r0);
+    break;
+case 1386:
+    OP_SSTORE(r5, r5, r1);
+    break;
+case 1387:
+    OP_SSTORE(r5, r5, r2);
+    break;
+case 1388:
+    OP_SSTORE(r5, r5, r3);
+    break;
+case 1389:
+    OP_SSTORE(r5, r5, r4);
+    break;
+case 1390:
+    OP_SSTORE(r5, r5, r5);
+    break;
+case 1391:
+    OP_SSTORE(r5, r5, r6);
+    break;
+case 1392:
+    OP_SSTORE(r5, r5, r7);
+    break;
+case 1393:
+    OP_SSTORE(r5, r6, r0);
+    break;
+case 1394:
+    OP_SSTORE(r5, r6, r1);
+    break;
+case 1395:
+    OP_SSTORE(r5, r6, r2);
+    break;
+case 1396:
+    OP_SSTORE(r5, r6, r3);
+    break;
+case 1397:
+    OP_SSTORE(r5, r6, r4);
+    break;
+case 1398:
+    OP_SSTORE(r5, r6, r5);
+    break;
+case 1399:
+    OP_SSTORE(r5, r6, r6);
+    break;
+case 1400:
+    OP_SSTORE(r5, r6, r7);
+    break;
+case 1401:
+    OP_SSTORE(r5, r7, r0);
+    break;
+case 1402:
+    OP_SSTORE(r5, r7, r1);
+    break;
+case 1403:
+    OP_SSTORE(r5, r7, r2);
+    break;
+case 1404:
+    OP_SSTORE(r5, r7, r3);
+    break;
+case 1405:
+    OP_SSTORE(r5, r7, r4);
+    break;
+case 1406:
+    OP_SSTORE(r5, r7, r5);
+    break;
+case 1407:
+    OP_SSTORE(r5, r7, r6);
+    break;
+case 1408:
+    OP_SSTORE(r5, r7, r7);
+    break;
+case 1409:
+    OP_SSTORE(r6, r0, r0);
+    break;
+case 1410:
+    OP_SSTORE(r6, r0, r1);
+    break;
+case 1411:
+    OP_SSTORE(r6, r0, r2);
+    break;
+case 1412:
+    OP_SSTORE(r6, r0, r3);
+    break;
+case 1413:
+    OP_SSTORE(r6, r0, r4);
+    break;
+case 1414:
+    OP_SSTORE(r6, r0, r5);
+    break;
+case 1415:
+    OP_SSTORE(r6, r0, r6);
+    break;
+case 1416:
+    OP_SSTORE(r6, r0, r7);
+    break;
+case 1417:
+    OP_SSTORE(r6, r1, r0);
+    break;
+case 1418:
+    OP_SSTORE(r6, r1, r1);
+    break;
+case 1419:
+    OP_SSTORE(r6, r1, r2);
+    break;
+case 1420:
+    OP_SSTORE(r6, r1, r3);
+    break;
+case 1421:
+    OP_SSTORE(r6, r1, r4);
+    break;
+case 1422:
+    OP_SSTORE(r6, r1, r5);
+    break;
+case 1423:
+    OP_SSTORE(r6, r1, r6);
+    break;
+case 1424:
+    OP_SSTORE(r6, r1, r7);
+    break;
+case 1425:
+    OP_SSTORE(r6, r2, r0);
+    break;
+case 1426:
+    OP_SSTORE(r6, r2, r1);
+    break;
+case 1427:
+    OP_SSTORE(r6, r2, r2);
+    break;
+case 1428:
+    OP_SSTORE(r6, r2, r3);
+    break;
+case 1429:
+    OP_SSTORE(r6, r2, r4);
+    break;
+case 1430:
+    OP_SSTORE(r6, r2, r5);
+    break;
+case 1431:
+    OP_SSTORE(r6, r2, r6);
+    break;
+case 1432:
+    OP_SSTORE(r6, r2, r7);
+    break;
+case 1433:
+    OP_SSTORE(r6, r3, r0);
+    break;
+case 1434:
+    OP_SSTORE(r6, r3, r1);
+    break;
+case 1435:
+    OP_SSTORE(r6, r3, r2);
+    break;
+case 1436:
+    OP_SSTORE(r6, r3, r3);
+    break;
+case 1437:
+    OP_SSTORE(r6, r3, r4);
+    break;
+case 1438:
+    OP_SSTORE(r6, r3, r5);
+    break;
+case 1439:
+    OP_SSTORE(r6, r3, r6);
+    break;
+case 1440:
+    OP_SSTORE(r6, r3, r7);
+    break;
+case 1441:
+    OP_SSTORE(r6, r4, r0);
+    break;
+case 1442:
+    OP_SSTORE(r6, r4, r1);
+    break;
+case 1443:
+    OP_SSTORE(r6, r4, r2);
+    break;
+case 1444:
+    OP_SSTORE(r6, r4, r3);
+    break;
+case 1445:
+    OP_SSTORE(r6, r4, r4);
+    break;
+case 1446:
+    OP_SSTORE(r6, r4, r5);
+    break;
+case 1447:
+    OP_SSTORE(r6, r4, r6);
+    break;
+case 1448:
+    OP_SSTORE(r6, r4, r7);
+    break;
+case 1449:
+    OP_SSTORE(r6, r5, r0);
+    break;
+case 1450:
+    OP_SSTORE(r6, r5, r1);
+    break;
+case 1451:
+    OP_SSTORE(r6, r5, r2);
+    break;
+case 1452:
+    OP_SSTORE(r6, r5, r3);
+    break;
+case 1453:
+    OP_SSTORE(r6, r5, r4);
+    break;
+case 1454:
+    OP_SSTORE(r6, r5, r5);
+    break;
+case 1455:
+    OP_SSTORE(r6, r5, r6);
+    break;
+case 1456:
+    OP_SSTORE(r6, r5, r7);
+    break;
+case 1457:
+    OP_SSTORE(r6, r6, r0);
+    break;
+case 1458:
+    OP_SSTORE(r6, r6, r1);
+    break;
+case 1459:
+    OP_SSTORE(r6, r6, r2);
+    break;
+case 1460:
+    OP_SSTORE(r6, r6, r3);
+    break;
+case 1461:
+    OP_SSTORE(r6, r6, r4);
+    break;
+case 1462:
+    OP_SSTORE(r6, r6, r5);
+    break;
+case 1463:
+    OP_SSTORE(r6, r6, r6);
+    break;
+case 1464:
+    OP_SSTORE(r6, r6, r7);
+    break;
+case 1465:
+    OP_SSTORE(r6, r7, r0);
+    break;
+case 1466:
+    OP_SSTORE(r6, r7, r1);
+    break;
+case 1467:
+    OP_SSTORE(r6, r7, r2);
+    break;
+case 1468:
+    OP_SSTORE(r6, r7, r3);
+    break;
+case 1469:
+    OP_SSTORE(r6, r7, r4);
+    break;
+case 1470:
+    OP_SSTORE(r6, r7, r5);
+    break;
+case 1471:
+    OP_SSTORE(r6, r7, r6);
+    break;
+case 1472:
+    OP_SSTORE(r6, r7, r7);
+    break;
+case 1473:
+    OP_SSTORE(r7, r0, r0);
+    break;
+case 1474:
+    OP_SSTORE(r7, r0, r1);
+    break;
+case 1475:
+    OP_SSTORE(r7, r0, r2);
+    break;
+case 1476:
+    OP_SSTORE(r7, r0, r3);
+    break;
+case 1477:
+    OP_SSTORE(r7, r0, r4);
+    break;
+case 1478:
+    OP_SSTORE(r7, r0, r5);
+    break;
+case 1479:
+    OP_SSTORE(r7, r0, r6);
+    break;
+case 1480:
+    OP_SSTORE(r7, r0, r7);
+    break;
+case 1481:
+    OP_SSTORE(r7, r1, r0);
+    break;
+case 1482:
+    OP_SSTORE(r7, r1, r1);
+    break;
+case 1483:
+    OP_SSTORE(r7, r1, r2);
+    break;
+case 1484:
+    OP_SSTORE(r7, r1, r3);
+    break;
+case 1485:
+    OP_SSTORE(r7, r1, r4);
+    break;
+case 1486:
+    OP_SSTORE(r7, r1, r5);
+    break;
+case 1487:
+    OP_SSTORE(r7, r1, r6);
+    break;
+case 1488:
+    OP_SSTORE(r7, r1, r7);
+    break;
+case 1489:
+    OP_SSTORE(r7, r2, r0);
+    break;
+case 1490:
+    OP_SSTORE(r7, r2, r1);
+    break;
+case 1491:
+    OP_SSTORE(r7, r2, r2);
+    break;
+case 1492:
+    OP_SSTORE(r7, r2, r3);
+    break;
+case 1493:
+    OP_SSTORE(r7, r2, r4);
+    break;
+case 1494:
+    OP_SSTORE(r7, r2, r5);
+    break;
+case 1495:
+    OP_SSTORE(r7, r2, r6);
+    break;
+case 1496:
+    OP_SSTORE(r7, r2, r7);
+    break;
+case 1497:
+    OP_SSTORE(r7, r3, r0);
+    break;
+case 1498:
+    OP_SSTORE(r7, r3, r1);
+    break;
+case 1499:
+    OP_SSTORE(r7, r3, r2);
+    break;
+case 1500:
+    OP_SSTORE(r7, r3, r3);
+    break;
+case 1501:
+    OP_SSTORE(r7, r3, r4);
+    break;
+case 1502:
+    OP_SSTORE(r7, r3, r5);
+    break;
+case 1503:
+    OP_SSTORE(r7, r3, r6);
+    break;
+case 1504:
+    OP_SSTORE(r7, r3, r7);
+    break;
+case 1505:
+    OP_SSTORE(r7, r4, r0);
+    break;
+case 1506:
+    OP_SSTORE(r7, r4, r1);
+    break;
+case 1507:
+    OP_SSTORE(r7, r4, r2);
+    break;
+case 1508:
+    OP_SSTORE(r7, r4, r3);
+    break;
+case 1509:
+    OP_SSTORE(r7, r4, r4);
+    break;
+case 1510:
+    OP_SSTORE(r7, r4, r5);
+    break;
+case 1511:
+    OP_SSTORE(r7, r4, r6);
+    break;
+case 1512:
+    OP_SSTORE(r7, r4, r7);
+    break;
+case 1513:
+    OP_SSTORE(r7, r5, r0);
+    break;
+case 1514:
+    OP_SSTORE(r7, r5, r1);
+    break;
+case 1515:
+    OP_SSTORE(r7, r5, r2);
+    break;
+case 1516:
+    OP_SSTORE(r7, r5, r3);
+    break;
+case 1517:
+    OP_SSTORE(r7, r5, r4);
+    break;
+case 1518:
+    OP_SSTORE(r7, r5, r5);
+    break;
+case 1519:
+    OP_SSTORE(r7, r5, r6);
+    break;
+case 1520:
+    OP_SSTORE(r7, r5, r7);
+    break;
+case 1521:
+    OP_SSTORE(r7, r6, r0);
+    break;
+case 1522:
+    OP_SSTORE(r7, r6, r1);
+    break;
+case 1523:
+    OP_SSTORE(r7, r6, r2);
+    break;
+case 1524:
+    OP_SSTORE(r7, r6, r3);
+    break;
+case 1525:
+    OP_SSTORE(r7, r6, r4);
+    break;
+case 1526:
+    OP_SSTORE(r7, r6, r5);
+    break;
+case 1527:
+    OP_SSTORE(r7, r6, r6);
+    break;
+case 1528:
+    OP_SSTORE(r7, r6, r7);
+    break;
+case 1529:
+    OP_SSTORE(r7, r7, r0);
+    break;
+case 1530:
+    OP_SSTORE(r7, r7, r1);
+    break;
+case 1531:
+    OP_SSTORE(r7, r7, r2);
+    break;
+case 1532:
+    OP_SSTORE(r7, r7, r3);
+    break;
+case 1533:
+    OP_SSTORE(r7, r7, r4);
+    break;
+case 1534:
+    OP_SSTORE(r7, r7, r5);
+    break;
+case 1535:
+    OP_SSTORE(r7, r7, r6);
+    break;
+case 1536:
+    OP_SSTORE(r7, r7, r7);
+    break;
+case 1537:
+    OP_ADD(r0, r0, r0);
+    break;
+case 1538:
+    OP_ADD(r0, r0, r1);
+    break;
+case 1539:
+    OP_ADD(r0, r0, r2);
+    break;
+case 1540:
+    OP_ADD(r0, r0, r3);
+    break;
+case 1541:
+    OP_ADD(r0, r0, r4);
+    break;
+case 1542:
+    OP_ADD(r0, r0, r5);
+    break;
+case 1543:
+    OP_ADD(r0, r0, r6);
+    break;
+case 1544:
+    OP_ADD(r0, r0, r7);
+    break;
+case 1545:
+    OP_ADD(r0, r1, r0);
+    break;
+case 1546:
+    OP_ADD(r0, r1, r1);
+    break;
+case 1547:
+    OP_ADD(r0, r1, r2);
+    break;
+case 1548:
+    OP_ADD(r0, r1, r3);
+    break;
+case 1549:
+    OP_ADD(r0, r1, r4);
+    break;
+case 1550:
+    OP_ADD(r0, r1, r5);
+    break;
+case 1551:
+    OP_ADD(r0, r1, r6);
+    break;
+case 1552:
+    OP_ADD(r0, r1, r7);
+    break;
+case 1553:
+    OP_ADD(r0, r2, r0);
+    break;
+case 1554:
+    OP_ADD(r0, r2, r1);
+    break;
+case 1555:
+    OP_ADD(r0, r2, r2);
+    break;
+case 1556:
+    OP_ADD(r0, r2, r3);
+    break;
+case 1557:
+    OP_ADD(r0, r2, r4);
+    break;
+case 1558:
+    OP_ADD(r0, r2, r5);
+    break;
+case 1559:
+    OP_ADD(r0, r2, r6);
+    break;
+case 1560:
+    OP_ADD(r0, r2, r7);
+    break;
+case 1561:
+    OP_ADD(r0, r3, r0);
+    break;
+case 1562:
+    OP_ADD(r0, r3, r1);
+    break;
+case 1563:
+    OP_ADD(r0, r3, r2);
+    break;
+case 1564:
+    OP_ADD(r0, r3, r3);
+    break;
+case 1565:
+    OP_ADD(r0, r3, r4);
+    break;
+case 1566:
+    OP_ADD(r0, r3, r5);
+    break;
+case 1567:
+    OP_ADD(r0, r3, r6);
+    break;
+case 1568:
+    OP_ADD(r0, r3, r7);
+    break;
+case 1569:
+    OP_ADD(r0, r4, r0);
+    break;
+case 1570:
+    OP_ADD(r0, r4, r1);
+    break;
+case 1571:
+    OP_ADD(r0, r4, r2);
+    break;
+case 1572:
+    OP_ADD(r0, r4, r3);
+    break;
+case 1573:
+    OP_ADD(r0, r4, r4);
+    break;
+case 1574:
+    OP_ADD(r0, r4, r5);
+    break;
+case 1575:
+    OP_ADD(r0, r4, r6);
+    break;
+case 1576:
+    OP_ADD(r0, r4, r7);
+    break;
+case 1577:
+    OP_ADD(r0, r5, r0);
+    break;
+case 1578:
+    OP_ADD(r0, r5, r1);
+    break;
+case 1579:
+    OP_ADD(r0, r5, r2);
+    break;
+case 1580:
+    OP_ADD(r0, r5, r3);
+    break;
+case 1581:
+    OP_ADD(r0, r5, r4);
+    break;
+case 1582:
+    OP_ADD(r0, r5, r5);
+    break;
+case 1583:
+    OP_ADD(r0, r5, r6);
+    break;
+case 1584:
+    OP_ADD(r0, r5, r7);
+    break;
+case 1585:
+    OP_ADD(r0, r6, r0);
+    break;
+case 1586:
+    OP_ADD(r0, r6, r1);
+    break;
+case 1587:
+    OP_ADD(r0, r6, r2);
+    break;
+case 1588:
+    OP_ADD(r0, r6, r3);
+    break;
+case 1589:
+    OP_ADD(r0, r6, r4);
+    break;
+case 1590:
+    OP_ADD(r0, r6, r5);
+    break;
+case 1591:
+    OP_ADD(r0, r6, r6);
+    break;
+case 1592:
+    OP_ADD(r0, r6, r7);
+    break;
+case 1593:
+    OP_ADD(r0, r7, r0);
+    break;
+case 1594:
+    OP_ADD(r0, r7, r1);
+    break;
+case 1595:
+    OP_ADD(r0, r7, r2);
+    break;
+case 1596:
+    OP_ADD(r0, r7, r3);
+    break;
+case 1597:
+    OP_ADD(r0, r7, r4);
+    break;
+case 1598:
+    OP_ADD(r0, r7, r5);
+    break;
+case 1599:
+    OP_ADD(r0, r7, r6);
+    break;
+case 1600:
+    OP_ADD(r0, r7, r7);
+    break;
+case 1601:
+    OP_ADD(r1, r0, r0);
+    break;
+case 1602:
+    OP_ADD(r1, r0, r1);
+    break;
+case 1603:
+    OP_ADD(r1, r0, r2);
+    break;
+case 1604:
+    OP_ADD(r1, r0, r3);
+    break;
+case 1605:
+    OP_ADD(r1, r0, r4);
+    break;
+case 1606:
+    OP_ADD(r1, r0, r5);
+    break;
+case 1607:
+    OP_ADD(r1, r0, r6);
+    break;
+case 1608:
+    OP_ADD(r1, r0, r7);
+    break;
+case 1609:
+    OP_ADD(r1, r1, r0);
+    break;
+case 1610:
+    OP_ADD(r1, r1, r1);
+    break;
+case 1611:
+    OP_ADD(r1, r1, r2);
+    break;
+case 1612:
+    OP_ADD(r1, r1, r3);
+    break;
+case 1613:
+    OP_ADD(r1, r1, r4);
+    break;
+case 1614:
+    OP_ADD(r1, r1, r5);
+    break;
+case 1615:
+    OP_ADD(r1, r1, r6);
+    break;
+case 1616:
+    OP_ADD(r1, r1, r7);
+    break;
+case 1617:
+    OP_ADD(r1, r2, r0);
+    break;
+case 1618:
+    OP_ADD(r1, r2, r1);
+    break;
+case 1619:
+    OP_ADD(r1, r2, r2);
+    break;
+case 1620:
+    OP_ADD(r1, r2, r3);
+    break;
+case 1621:
+    OP_ADD(r1, r2, r4);
+    break;
+case 1622:
+    OP_ADD(r1, r2, r5);
+    break;
+case 1623:
+    OP_ADD(r1, r2, r6);
+    break;
+case 1624:
+    OP_ADD(r1, r2, r7);
+    break;
+case 1625:
+    OP_ADD(r1, r3, r0);
+    break;
+case 1626:
+    OP_ADD(r1, r3, r1);
+    break;
+case 1627:
+    OP_ADD(r1, r3, r2);
+    break;
+case 1628:
+    OP_ADD(r1, r3, r3);
+    break;
+case 1629:
+    OP_ADD(r1, r3, r4);
+    break;
+case 1630:
+    OP_ADD(r1, r3, r5);
+    break;
+case 1631:
+    OP_ADD(r1, r3, r6);
+    break;
+case 1632:
+    OP_ADD(r1, r3, r7);
+    break;
+case 1633:
+    OP_ADD(r1, r4, r0);
+    break;
+case 1634:
+    OP_ADD(r1, r4, r1);
+    break;
+case 1635:
+    OP_ADD(r1, r4, r2);
+    break;
+case 1636:
+    OP_ADD(r1, r4, r3);
+    break;
+case 1637:
+    OP_ADD(r1, r4, r4);
+    break;
+case 1638:
+    OP_ADD(r1, r4, r5);
+    break;
+case 1639:
+    OP_ADD(r1, r4, r6);
+    break;
+case 1640:
+    OP_ADD(r1, r4, r7);
+    break;
+case 1641:
+    OP_ADD(r1, r5, r0);
+    break;
+case 1642:
+    OP_ADD(r1, r5, r1);
+    break;
+case 1643:
+    OP_ADD(r1, r5, r2);
+    break;
+case 1644:
+    OP_ADD(r1, r5, r3);
+    break;
+case 1645:
+    OP_ADD(r1, r5, r4);
+    break;
+case 1646:
+    OP_ADD(r1, r5, r5);
+    break;
+case 1647:
+    OP_ADD(r1, r5, r6);
+    break;
+case 1648:
+    OP_ADD(r1, r5, r7);
+    break;
+case 1649:
+    OP_ADD(r1, r6, r0);
+    break;
+case 1650:
+    OP_ADD(r1, r6, r1);
+    break;
+case 1651:
+    OP_ADD(r1, r6, r2);
+    break;
+case 1652:
+    OP_ADD(r1, r6, r3);
+    break;
+case 1653:
+    OP_ADD(r1, r6, r4);
+    break;
+case 1654:
+    OP_ADD(r1, r6, r5);
+    break;
+case 1655:
+    OP_ADD(r1, r6, r6);
+    break;
+case 1656:
+    OP_ADD(r1, r6, r7);
+    break;
+case 1657:
+    OP_ADD(r1, r7, r0);
+    break;
+case 1658:
+    OP_ADD(r1, r7, r1);
+    break;
+case 1659:
+    OP_ADD(r1, r7, r2);
+    break;
+case 1660:
+    OP_ADD(r1, r7, r3);
+    break;
+case 1661:
+    OP_ADD(r1, r7, r4);
+    break;
+case 1662:
+    OP_ADD(r1, r7, r5);
+    break;
+case 1663:
+    OP_ADD(r1, r7, r6);
+    break;
+case 1664:
+    OP_ADD(r1, r7, r7);
+    break;
+case 1665:
+    OP_ADD(r2, r0, r0);
+    break;
+case 1666:
+    OP_ADD(r2, r0, r1);
+    break;
+case 1667:
+    OP_ADD(r2, r0, r2);
+    break;
+case 1668:
+    OP_ADD(r2, r0, r3);
+    break;
+case 1669:
+    OP_ADD(r2, r0, r4);
+    break;
+case 1670:
+    OP_ADD(r2, r0, r5);
+    break;
+case 1671:
+    OP_ADD(r2, r0, r6);
+    break;
+case 1672:
+    OP_ADD(r2, r0, r7);
+    break;
+case 1673:
+    OP_ADD(r2, r1, r0);
+    break;
+case 1674:
+    OP_ADD(r2, r1, r1);
+    break;
+case 1675:
+    OP_ADD(r2, r1, r2);
+    break;
+case 1676:
+    OP_ADD(r2, r1, r3);
+    break;
+case 1677:
+    OP_ADD(r2, r1, r4);
+    break;
+case 1678:
+    OP_ADD(r2, r1, r5);
+    break;
+case 1679:
+    OP_ADD(r2, r1, r6);
+    break;
+case 1680:
+    OP_ADD(r2, r1, r7);
+    break;
+case 1681:
+    OP_ADD(r2, r2, r0);
+    break;
+case 1682:
+    OP_ADD(r2, r2, r1);
+    break;
+case 1683:
+    OP_ADD(r2, r2, r2);
+    break;
+case 1684:
+    OP_ADD(r2, r2, r3);
+    break;
+case 1685:
+    OP_ADD(r2, r2, r4);
+    break;
+case 1686:
+    OP_ADD(r2, r2, r5);
+    break;
+case 1687:
+    OP_ADD(r2, r2, r6);
+    break;
+case 1688:
+    OP_ADD(r2, r2, r7);
+    break;
+case 1689:
+    OP_ADD(r2, r3, r0);
+    break;
+case 1690:
+    OP_ADD(r2, r3, r1);
+    break;
+case 1691:
+    OP_ADD(r2, r3, r2);
+    break;
+case 1692:
+    OP_ADD(r2, r3, r3);
+    break;
+case 1693:
+    OP_ADD(r2, r3, r4);
+    break;
+case 1694:
+    OP_ADD(r2, r3, r5);
+    break;
+case 1695:
+    OP_ADD(r2, r3, r6);
+    break;
+case 1696:
+    OP_ADD(r2, r3, r7);
+    break;
+case 1697:
+    OP_ADD(r2, r4, r0);
+    break;
+case 1698:
+    OP_ADD(r2, r4, r1);
+    break;
+case 1699:
+    OP_ADD(r2, r4, r2);
+    break;
+case 1700:
+    OP_ADD(r2, r4, r3);
+    break;
+case 1701:
+    OP_ADD(r2, r4, r4);
+    break;
+case 1702:
+    OP_ADD(r2, r4, r5);
+    break;
+case 1703:
+    OP_ADD(r2, r4, r6);
+    break;
+case 1704:
+    OP_ADD(r2, r4, r7);
+    break;
+case 1705:
+    OP_ADD(r2, r5, r0);
+    break;
+case 1706:
+    OP_ADD(r2, r5, r1);
+    break;
+case 1707:
+    OP_ADD(r2, r5, r2);
+    break;
+case 1708:
+    OP_ADD(r2, r5, r3);
+    break;
+case 1709:
+    OP_ADD(r2, r5, r4);
+    break;
+case 1710:
+    OP_ADD(r2, r5, r5);
+    break;
+case 1711:
+    OP_ADD(r2, r5, r6);
+    break;
+case 1712:
+    OP_ADD(r2, r5, r7);
+    break;
+case 1713:
+    OP_ADD(r2, r6, r0);
+    break;
+case 1714:
+    OP_ADD(r2, r6, r1);
+    break;
+case 1715:
+    OP_ADD(r2, r6, r2);
+    break;
+case 1716:
+    OP_ADD(r2, r6, r3);
+    break;
+case 1717:
+    OP_ADD(r2, r6, r4);
+    break;
+case 1718:
+    OP_ADD(r2, r6, r5);
+    break;
+case 1719:
+    OP_ADD(r2, r6, r6);
+    break;
+case 1720:
+    OP_ADD(r2, r6, r7);
+    break;
+case 1721:
+    OP_ADD(r2, r7, r0);
+    break;
+case 1722:
+    OP_ADD(r2, r7, r1);
+    break;
+case 1723:
+    OP_ADD(r2, r7, r2);
+    break;
+case 1724:
+    OP_ADD(r2, r7, r3);
+    break;
+case 1725:
+    OP_ADD(r2, r7, r4);
+    break;
+case 1726:
+    OP_ADD(r2, r7, r5);
+    break;
+case 1727:
+    OP_ADD(r2, r7, r6);
+    break;
+case 1728:
+    OP_ADD(r2, r7, r7);
+    break;
+case 1729:
+    OP_ADD(r3, r0, r0);
+    break;
+case 1730:
+    OP_ADD(r3, r0, r1);
+    break;
+case 1731:
+    OP_ADD(r3, r0, r2);
+    break;
+case 1732:
+    OP_ADD(r3, r0, r3);
+    break;
+case 1733:
+    OP_ADD(r3, r0, r4);
+    break;
+case 1734:
+    OP_ADD(r3, r0, r5);
+    break;
+case 1735:
+    OP_ADD(r3, r0, r6);
+    break;
+case 1736:
+    OP_ADD(r3, r0, r7);
+    break;
+case 1737:
+    OP_ADD(r3, r1, r0);
+    break;
+case 1738:
+    OP_ADD(r3, r1, r1);
+    break;
+case 1739:
+    OP_ADD(r3, r1, r2);
+    break;
+case 1740:
+    OP_ADD(r3, r1, r3);
+    break;
+case 1741:
+    OP_ADD(r3, r1, r4);
+    break;
+case 1742:
+    OP_ADD(r3, r1, r5);
+    break;
+case 1743:
+    OP_ADD(r3, r1, r6);
+    break;
+case 1744:
+    OP_ADD(r3, r1, r7);
+    break;
+case 1745:
+    OP_ADD(r3, r2, r0);
+    break;
+case 1746:
+    OP_ADD(r3, r2, r1);
+    break;
+case 1747:
+    OP_ADD(r3, r2, r2);
+    break;
+case 1748:
+    OP_ADD(r3, r2, r3);
+    break;
+case 1749:
+    OP_ADD(r3, r2, r4);
+    break;
+case 1750:
+    OP_ADD(r3, r2, r5);
+    break;
+case 1751:
+    OP_ADD(r3, r2, r6);
+    break;
+case 1752:
+    OP_ADD(r3, r2, r7);
+    break;
+case 1753:
+    OP_ADD(r3, r3, r0);
+    break;
+case 1754:
+    OP_ADD(r3, r3, r1);
+    break;
+case 1755:
+    OP_ADD(r3, r3, r2);
+    break;
+case 1756:
+    OP_ADD(r3, r3, r3);
+    break;
+case 1757:
+    OP_ADD(r3, r3, r4);
+    break;
+case 1758:
+    OP_ADD(r3, r3, r5);
+    break;
+case 1759:
+    OP_ADD(r3, r3, r6);
+    break;
+case 1760:
+    OP_ADD(r3, r3, r7);
+    break;
+case 1761:
+    OP_ADD(r3, r4, r0);
+    break;
+case 1762:
+    OP_ADD(r3, r4, r1);
+    break;
+case 1763:
+    OP_ADD(r3, r4, r2);
+    break;
+case 1764:
+    OP_ADD(r3, r4, r3);
+    break;
+case 1765:
+    OP_ADD(r3, r4, r4);
+    break;
+case 1766:
+    OP_ADD(r3, r4, r5);
+    break;
+case 1767:
+    OP_ADD(r3, r4, r6);
+    break;
+case 1768:
+    OP_ADD(r3, r4, r7);
+    break;
+case 1769:
+    OP_ADD(r3, r5, r0);
+    break;
+case 1770:
+    OP_ADD(r3, r5, r1);
+    break;
+case 1771:
+    OP_ADD(r3, r5, r2);
+    break;
+case 1772:
+    OP_ADD(r3, r5, r3);
+    break;
+case 1773:
+    OP_ADD(r3, r5, r4);
+    break;
+case 1774:
+    OP_ADD(r3, r5, r5);
+    break;
+case 1775:
+    OP_ADD(r3, r5, r6);
+    break;
+case 1776:
+    OP_ADD(r3, r5, r7);
+    break;
+case 1777:
+    OP_ADD(r3, r6, r0);
+    break;
+case 1778:
+    OP_ADD(r3, r6, r1);
+    break;
+case 1779:
+    OP_ADD(r3, r6, r2);
+    break;
+case 1780:
+    OP_ADD(r3, r6, r3);
+    break;
+case 1781:
+    OP_ADD(r3, r6, r4);
+    break;
+case 1782:
+    OP_ADD(r3, r6, r5);
+    break;
+case 1783:
+    OP_ADD(r3, r6, r6);
+    break;
+case 1784:
+    OP_ADD(r3, r6, r7);
+    break;
+case 1785:
+    OP_ADD(r3, r7, r0);
+    break;
+case 1786:
+    OP_ADD(r3, r7, r1);
+    break;
+case 1787:
+    OP_ADD(r3, r7, r2);
+    break;
+case 1788:
+    OP_ADD(r3, r7, r3);
+    break;
+case 1789:
+    OP_ADD(r3, r7, r4);
+    break;
+case 1790:
+    OP_ADD(r3, r7, r5);
+    break;
+case 1791:
+    OP_ADD(r3, r7, r6);
+    break;
+case 1792:
+    OP_ADD(r3, r7, r7);
+    break;
+case 1793:
+    OP_ADD(r4, r0, r0);
+    break;
+case 1794:
+    OP_ADD(r4, r0, r1);
+    break;
+case 1795:
+    OP_ADD(r4, r0, r2);
+    break;
+case 1796:
+    OP_ADD(r4, r0, r3);
+    break;
+case 1797:
+    OP_ADD(r4, r0, r4);
+    break;
+case 1798:
+    OP_ADD(r4, r0, r5);
+    break;
+case 1799:
+    OP_ADD(r4, r0, r6);
+    break;
+case 1800:
+    OP_ADD(r4, r0, r7);
+    break;
+case 1801:
+    OP_ADD(r4, r1, r0);
+    break;
+case 1802:
+    OP_ADD(r4, r1, r1);
+    break;
+case 1803:
+    OP_ADD(r4, r1, r2);
+    break;
+case 1804:
+    OP_ADD(r4, r1, r3);
+    break;
+case 1805:
+    OP_ADD(r4, r1, r4);
+    break;
+case 1806:
+    OP_ADD(r4, r1, r5);
+    break;
+case 1807:
+    OP_ADD(r4, r1, r6);
+    break;
+case 1808:
+    OP_ADD(r4, r1, r7);
+    break;
+case 1809:
+    OP_ADD(r4, r2, r0);
+    break;
+case 1810:
+    OP_ADD(r4, r2, r1);
+    break;
+case 1811:
+    OP_ADD(r4, r2, r2);
+    break;
+case 1812:
+    OP_ADD(r4, r2, r3);
+    break;
+case 1813:
+    OP_ADD(r4, r2, r4);
+    break;
+case 1814:
+    OP_ADD(r4, r2, r5);
+    break;
+case 1815:
+    OP_ADD(r4, r2, r6);
+    break;
+case 1816:
+    OP_ADD(r4, r2, r7);
+    break;
+case 1817:
+    OP_ADD(r4, r3, r0);
+    break;
+case 1818:
+    OP_ADD(r4, r3, r1);
+    break;
+case 1819:
+    OP_ADD(r4, r3, r2);
+    break;
+case 1820:
+    OP_ADD(r4, r3, r3);
+    break;
+case 1821:
+    OP_ADD(r4, r3, r4);
+    break;
+case 1822:
+    OP_ADD(r4, r3, r5);
+    break;
+case 1823:
+    OP_ADD(r4, r3, r6);
+    break;
+case 1824:
+    OP_ADD(r4, r3, r7);
+    break;
+case 1825:
+    OP_ADD(r4, r4, r0);
+    break;
+case 1826:
+    OP_ADD(r4, r4, r1);
+    break;
+case 1827:
+    OP_ADD(r4, r4, r2);
+    break;
+case 1828:
+    OP_ADD(r4, r4, r3);
+    break;
+case 1829:
+    OP_ADD(r4, r4, r4);
+    break;
+case 1830:
+    OP_ADD(r4, r4, r5);
+    break;
+case 1831:
+    OP_ADD(r4, r4, r6);
+    break;
+case 1832:
+    OP_ADD(r4, r4, r7);
+    break;
+case 1833:
+    OP_ADD(r4, r5, r0);
+    break;
+case 1834:
+    OP_ADD(r4, r5, r1);
+    break;
+case 1835:
+    OP_ADD(r4, r5, r2);
+    break;
+case 1836:
+    OP_ADD(r4, r5, r3);
+    break;
+case 1837:
+    OP_ADD(r4, r5, r4);
+    break;
+case 1838:
+    OP_ADD(r4, r5, r5);
+    break;
+case 1839:
+    OP_ADD(r4, r5, r6);
+    break;
+case 1840:
+    OP_ADD(r4, r5, r7);
+    break;
+case 1841:
+    OP_ADD(r4, r6, r0);
+    break;
+case 1842:
+    OP_ADD(r4, r6, r1);
+    break;
+case 1843:
+    OP_ADD(r4, r6, r2);
+    break;
+case 1844:
+    OP_ADD(r4, r6, r3);
+    break;
+case 1845:
+    OP_ADD(r4, r6, r4);
+    break;
+case 1846:
+    OP_ADD(r4, r6, r5);
+    break;
+case 1847:
+    OP_ADD(r4, r6, r6);
+    break;
+case 1848:
+    OP_ADD(r4, r6, r7);
+    break;
+case 1849:
+    OP_ADD(r4, r7, r0);
+    break;
+case 1850:
+    OP_ADD(r4, r7, r1);
+    break;
+case 1851:
+    OP_ADD(r4, r7, r2);
+    break;
+case 1852:
+    OP_ADD(r4, r7, r3);
+    break;
+case 1853:
+    OP_ADD(r4, r7, r4);
+    break;
+case 1854:
+    OP_ADD(r4, r7, r5);
+    break;
+case 1855:
+    OP_ADD(r4, r7, r6);
+    break;
+case 1856:
+    OP_ADD(r4, r7, r7);
+    break;
+case 1857:
+    OP_ADD(r5, r0, r0);
+    break;
+case 1858:
+    OP_ADD(r5, r0, r1);
+    break;
+case 1859:
+    OP_ADD(r5, r0, r2);
+    break;
+case 1860:
+    OP_ADD(r5, r0, r3);
+    break;
+case 1861:
+    OP_ADD(r5, r0, r4);
+    break;
+case 1862:
+    OP_ADD(r5, r0, r5);
+    break;
+case 1863:
+    OP_ADD(r5, r0, r6);
+    break;
+case 1864:
+    OP_ADD(r5, r0, r7);
+    break;
+case 1865:
+    OP_ADD(r5, r1, r0);
+    break;
+case 1866:
+    OP_ADD(r5, r1, r1);
+    break;
+case 1867:
+    OP_ADD(r5, r1, r2);
+    break;
+case 1868:
+    OP_ADD(r5, r1, r3);
+    break;
+case 1869:
+    OP_ADD(r5, r1, r4);
+    break;
+case 1870:
+    OP_ADD(r5, r1, r5);
+    break;
+case 1871:
+    OP_ADD(r5, r1, r6);
+    break;
+case 1872:
+    OP_ADD(r5, r1, r7);
+    break;
+case 1873:
+    OP_ADD(r5, r2, r0);
+    break;
+case 1874:
+    OP_ADD(r5, r2, r1);
+    break;
+case 1875:
+    OP_ADD(r5, r2, r2);
+    break;
+case 1876:
+    OP_ADD(r5, r2, r3);
+    break;
+case 1877:
+    OP_ADD(r5, r2, r4);
+    break;
+case 1878:
+    OP_ADD(r5, r2, r5);
+    break;
+case 1879:
+    OP_ADD(r5, r2, r6);
+    break;
+case 1880:
+    OP_ADD(r5, r2, r7);
+    break;
+case 1881:
+    OP_ADD(r5, r3, r0);
+    break;
+case 1882:
+    OP_ADD(r5, r3, r1);
+    break;
+case 1883:
+    OP_ADD(r5, r3, r2);
+    break;
+case 1884:
+    OP_ADD(r5, r3, r3);
+    break;
+case 1885:
+    OP_ADD(r5, r3, r4);
+    break;
+case 1886:
+    OP_ADD(r5, r3, r5);
+    break;
+case 1887:
+    OP_ADD(r5, r3, r6);
+    break;
+case 1888:
+    OP_ADD(r5, r3, r7);
+    break;
+case 1889:
+    OP_ADD(r5, r4, r0);
+    break;
+case 1890:
+    OP_ADD(r5, r4, r1);
+    break;
+case 1891:
+    OP_ADD(r5, r4, r2);
+    break;
+case 1892:
+    OP_ADD(r5, r4, r3);
+    break;
+case 1893:
+    OP_ADD(r5, r4, r4);
+    break;
+case 1894:
+    OP_ADD(r5, r4, r5);
+    break;
+case 1895:
+    OP_ADD(r5, r4, r6);
+    break;
+case 1896:
+    OP_ADD(r5, r4, r7);
+    break;
+case 1897:
+    OP_ADD(r5, r5, r0);
+    break;
+case 1898:
+    OP_ADD(r5, r5, r1);
+    break;
+case 1899:
+    OP_ADD(r5, r5, r2);
+    break;
+case 1900:
+    OP_ADD(r5, r5, r3);
+    break;
+case 1901:
+    OP_ADD(r5, r5, r4);
+    break;
+case 1902:
+    OP_ADD(r5, r5, r5);
+    break;
+case 1903:
+    OP_ADD(r5, r5, r6);
+    break;
+case 1904:
+    OP_ADD(r5, r5, r7);
+    break;
+case 1905:
+    OP_ADD(r5, r6, r0);
+    break;
+case 1906:
+    OP_ADD(r5, r6, r1);
+    break;
+case 1907:
+    OP_ADD(r5, r6, r2);
+    break;
+case 1908:
+    OP_ADD(r5, r6, r3);
+    break;
+case 1909:
+    OP_ADD(r5, r6, r4);
+    break;
+case 1910:
+    OP_ADD(r5, r6, r5);
+    break;
+case 1911:
+    OP_ADD(r5, r6, r6);
+    break;
+case 1912:
+    OP_ADD(r5, r6, r7);
+    break;
+case 1913:
+    OP_ADD(r5, r7, r0);
+    break;
+case 1914:
+    OP_ADD(r5, r7, r1);
+    break;
+case 1915:
+    OP_ADD(r5, r7, r2);
+    break;
+case 1916:
+    OP_ADD(r5, r7, r3);
+    break;
+case 1917:
+    OP_ADD(r5, r7, r4);
+    break;
+case 1918:
+    OP_ADD(r5, r7, r5);
+    break;
+case 1919:
+    OP_ADD(r5, r7, r6);
+    break;
+case 1920:
+    OP_ADD(r5, r7, r7);
+    break;
+case 1921:
+    OP_ADD(r6, r0, r0);
+    break;
+case 1922:
+    OP_ADD(r6, r0, r1);
+    break;
+case 1923:
+    OP_ADD(r6, r0, r2);
+    break;
+case 1924:
+    OP_ADD(r6, r0, r3);
+    break;
+case 1925:
+    OP_ADD(r6, r0, r4);
+    break;
+case 1926:
+    OP_ADD(r6, r0, r5);
+    break;
+case 1927:
+    OP_ADD(r6, r0, r6);
+    break;
+case 1928:
+    OP_ADD(r6, r0, r7);
+    break;
+case 1929:
+    OP_ADD(r6, r1, r0);
+    break;
+case 1930:
+    OP_ADD(r6, r1, r1);
+    break;
+case 1931:
+    OP_ADD(r6, r1, r2);
+    break;
+case 1932:
+    OP_ADD(r6, r1, r3);
+    break;
+case 1933:
+    OP_ADD(r6, r1, r4);
+    break;
+case 1934:
+    OP_ADD(r6, r1, r5);
+    break;
+case 1935:
+    OP_ADD(r6, r1, r6);
+    break;
+case 1936:
+    OP_ADD(r6, r1, r7);
+    break;
+case 1937:
+    OP_ADD(r6, r2, r0);
+    break;
+case 1938:
+    OP_ADD(r6, r2, r1);
+    break;
+case 1939:
+    OP_ADD(r6, r2, r2);
+    break;
+case 1940:
+    OP_ADD(r6, r2, r3);
+    break;
+case 1941:
+    OP_ADD(r6, r2, r4);
+    break;
+case 1942:
+    OP_ADD(r6, r2, r5);
+    break;
+case 1943:
+    OP_ADD(r6, r2, r6);
+    break;
+case 1944:
+    OP_ADD(r6, r2, r7);
+    break;
+case 1945:
+    OP_ADD(r6, r3, r0);
+    break;
+case 1946:
+    OP_ADD(r6, r3, r1);
+    break;
+case 1947:
+    OP_ADD(r6, r3, r2);
+    break;
+case 1948:
+    OP_ADD(r6, r3, r3);
+    break;
+case 1949:
+    OP_ADD(r6, r3, r4);
+    break;
+case 1950:
+    OP_ADD(r6, r3, r5);
+    break;
+case 1951:
+    OP_ADD(r6, r3, r6);
+    break;
+case 1952:
+    OP_ADD(r6, r3, r7);
+    break;
+case 1953:
+    OP_ADD(r6, r4, r0);
+    break;
+case 1954:
+    OP_ADD(r6, r4, r1);
+    break;
+case 1955:
+    OP_ADD(r6, r4, r2);
+    break;
+case 1956:
+    OP_ADD(r6, r4, r3);
+    break;
+case 1957:
+    OP_ADD(r6, r4, r4);
+    break;
+case 1958:
+    OP_ADD(r6, r4, r5);
+    break;
+case 1959:
+    OP_ADD(r6, r4, r6);
+    break;
+case 1960:
+    OP_ADD(r6, r4, r7);
+    break;
+case 1961:
+    OP_ADD(r6, r5, r0);
+    break;
+case 1962:
+    OP_ADD(r6, r5, r1);
+    break;
+case 1963:
+    OP_ADD(r6, r5, r2);
+    break;
+case 1964:
+    OP_ADD(r6, r5, r3);
+    break;
+case 1965:
+    OP_ADD(r6, r5, r4);
+    break;
+case 1966:
+    OP_ADD(r6, r5, r5);
+    break;
+case 1967:
+    OP_ADD(r6, r5, r6);
+    break;
+case 1968:
+    OP_ADD(r6, r5, r7);
+    break;
+case 1969:
+    OP_ADD(r6, r6, r0);
+    break;
+case 1970:
+    OP_ADD(r6, r6, r1);
+    break;
+case 1971:
+    OP_ADD(r6, r6, r2);
+    break;
+case 1972:
+    OP_ADD(r6, r6, r3);
+    break;
+case 1973:
+    OP_ADD(r6, r6, r4);
+    break;
+case 1974:
+    OP_ADD(r6, r6, r5);
+    break;
+case 1975:
+    OP_ADD(r6, r6, r6);
+    break;
+case 1976:
+    OP_ADD(r6, r6, r7);
+    break;
+case 1977:
+    OP_ADD(r6, r7, r0);
+    break;
+case 1978:
+    OP_ADD(r6, r7, r1);
+    break;
+case 1979:
+    OP_ADD(r6, r7, r2);
+    break;
+case 1980:
+    OP_ADD(r6, r7, r3);
+    break;
+case 1981:
+    OP_ADD(r6, r7, r4);
+    break;
+case 1982:
+    OP_ADD(r6, r7, r5);
+    break;
+case 1983:
+    OP_ADD(r6, r7, r6);
+    break;
+case 1984:
+    OP_ADD(r6, r7, r7);
+    break;
+case 1985:
+    OP_ADD(r7, r0, r0);
+    break;
+case 1986:
+    OP_ADD(r7, r0, r1);
+    break;
+case 1987:
+    OP_ADD(r7, r0, r2);
+    break;
+case 1988:
+    OP_ADD(r7, r0, r3);
+    break;
+case 1989:
+    OP_ADD(r7, r0, r4);
+    break;
+case 1990:
+    OP_ADD(r7, r0, r5);
+    break;
+case 1991:
+    OP_ADD(r7, r0, r6);
+    break;
+case 1992:
+    OP_ADD(r7, r0, r7);
+    break;
+case 1993:
+    OP_ADD(r7, r1, r0);
+    break;
+case 1994:
+    OP_ADD(r7, r1, r1);
+    break;
+case 1995:
+    OP_ADD(r7, r1, r2);
+    break;
+case 1996:
+    OP_ADD(r7, r1, r3);
+    break;
+case 1997:
+    OP_ADD(r7, r1, r4);
+    break;
+case 1998:
+    OP_ADD(r7, r1, r5);
+    break;
+case 1999:
+    OP_ADD(r7, r1, r6);
+    break;
+case 2000:
+    OP_ADD(r7, r1, r7);
+    break;
+case 2001:
+    OP_ADD(r7, r2, r0);
+    break;
+case 2002:
+    OP_ADD(r7, r2, r1);
+    break;
+case 2003:
+    OP_ADD(r7, r2, r2);
+    break;
+case 2004:
+    OP_ADD(r7, r2, r3);
+    break;
+case 2005:
+    OP_ADD(r7, r2, r4);
+    break;
+case 2006:
+    OP_ADD(r7, r2, r5);
+    break;
+case 2007:
+    OP_ADD(r7, r2, r6);
+    break;
+case 2008:
+    OP_ADD(r7, r2, r7);
+    break;
+case 2009:
+    OP_ADD(r7, r3, r0);
+    break;
+case 2010:
+    OP_ADD(r7, r3, r1);
+    break;
+case 2011:
+    OP_ADD(r7, r3, r2);
+    break;
+case 2012:
+    OP_ADD(r7, r3, r3);
+    break;
+case 2013:
+    OP_ADD(r7, r3, r4);
+    break;
+case 2014:
+    OP_ADD(r7, r3, r5);
+    break;
+case 2015:
+    OP_ADD(r7, r3, r6);
+    break;
+case 2016:
+    OP_ADD(r7, r3, r7);
+    break;
+case 2017:
+    OP_ADD(r7, r4, r0);
+    break;
+case 2018:
+    OP_ADD(r7, r4, r1);
+    break;
+case 2019:
+    OP_ADD(r7, r4, r2);
+    break;
+case 2020:
+    OP_ADD(r7, r4, r3);
+    break;
+case 2021:
+    OP_ADD(r7, r4, r4);
+    break;
+case 2022:
+    OP_ADD(r7, r4, r5);
+    break;
+case 2023:
+    OP_ADD(r7, r4, r6);
+    break;
+case 2024:
+    OP_ADD(r7, r4, r7);
+    break;
+case 2025:
+    OP_ADD(r7, r5, r0);
+    break;
+case 2026:
+    OP_ADD(r7, r5, r1);
+    break;
+case 2027:
+    OP_ADD(r7, r5, r2);
+    break;
+case 2028:
+    OP_ADD(r7, r5, r3);
+    break;
+case 2029:
+    OP_ADD(r7, r5, r4);
+    break;
+case 2030:
+    OP_ADD(r7, r5, r5);
+    break;
+case 2031:
+    OP_ADD(r7, r5, r6);
+    break;
+case 2032:
+    OP_ADD(r7, r5, r7);
+    break;
+case 2033:
+    OP_ADD(r7, r6, r0);
+    break;
+case 2034:
+    OP_ADD(r7, r6, r1);
+    break;
+case 2035:
+    OP_ADD(r7, r6, r2);
+    break;
+case 2036:
+    OP_ADD(r7, r6, r3);
+    break;
+case 2037:
+    OP_ADD(r7, r6, r4);
+    break;
+case 2038:
+    OP_ADD(r7, r6, r5);
+    break;
+case 2039:
+    OP_ADD(r7, r6, r6);
+    break;
+case 2040:
+    OP_ADD(r7, r6, r7);
+    break;
+case 2041:
+    OP_ADD(r7, r7, r0);
+    break;
+case 2042:
+    OP_ADD(r7, r7, r1);
+    break;
+case 2043:
+    OP_ADD(r7, r7, r2);
+    break;
+case 2044:
+    OP_ADD(r7, r7, r3);
+    break;
+case 2045:
+    OP_ADD(r7, r7, r4);
+    break;
+case 2046:
+    OP_ADD(r7, r7, r5);
+    break;
+case 2047:
+    OP_ADD(r7, r7, r6);
+    break;
+case 2048:
+    OP_ADD(r7, r7, r7);
+    break;
+case 2049:
+    OP_MUL(r0, r0, r0);
+    break;
+case 2050:
+    OP_MUL(r0, r0, r1);
+    break;
+case 2051:
+    OP_MUL(r0, r0, r2);
+    break;
+case 2052:
+    OP_MUL(r0, r0, r3);
+    break;
+case 2053:
+    OP_MUL(r0, r0, r4);
+    break;
+case 2054:
+    OP_MUL(r0, r0, r5);
+    break;
+case 2055:
+    OP_MUL(r0, r0, r6);
+    break;
+case 2056:
+    OP_MUL(r0, r0, r7);
+    break;
+case 2057:
+    OP_MUL(r0, r1, r0);
+    break;
+case 2058:
+    OP_MUL(r0, r1, r1);
+    break;
+case 2059:
+    OP_MUL(r0, r1, r2);
+    break;
+case 2060:
+    OP_MUL(r0, r1, r3);
+    break;
+case 2061:
+    OP_MUL(r0, r1, r4);
+    break;
+case 2062:
+    OP_MUL(r0, r1, r5);
+    break;
+case 2063:
+    OP_MUL(r0, r1, r6);
+    break;
+case 2064:
+    OP_MUL(r0, r1, r7);
+    break;
+case 2065:
+    OP_MUL(r0, r2, r0);
+    break;
+case 2066:
+    OP_MUL(r0, r2, r1);
+    break;
+case 2067:
+    OP_MUL(r0, r2, r2);
+    break;
+case 2068:
+    OP_MUL(r0, r2, r3);
+    break;
+case 2069:
+    OP_MUL(r0, r2, r4);
+    break;
+case 2070:
+    OP_MUL(r0, r2, r5);
+    break;
+case 2071:
+    OP_MUL(r0, r2, r6);
+    break;
+case 2072:
+    OP_MUL(r0, r2, r7);
+    break;
+case 2073:
+    OP_MUL(r0, r3, r0);
+    break;
+case 2074:
+    OP_MUL(r0, r3, r1);
+    break;
+case 2075:
+    OP_MUL(r0, r3, r2);
+    break;
+case 2076:
+    OP_MUL(r0, r3, r3);
+    break;
+case 2077:
+    OP_MUL(r0, r3, r4);
+    break;
+case 2078:
+    OP_MUL(r0, r3, r5);
+    break;
+case 2079:
+    OP_MUL(r0, r3, r6);
+    break;
+case 2080:
+    OP_MUL(r0, r3, r7);
+    break;
+case 2081:
+    OP_MUL(r0, r4, r0);
+    break;
+case 2082:
+    OP_MUL(r0, r4, r1);
+    break;
+case 2083:
+    OP_MUL(r0, r4, r2);
+    break;
+case 2084:
+    OP_MUL(r0, r4, r3);
+    break;
+case 2085:
+    OP_MUL(r0, r4, r4);
+    break;
+case 2086:
+    OP_MUL(r0, r4, r5);
+    break;
+case 2087:
+    OP_MUL(r0, r4, r6);
+    break;
+case 2088:
+    OP_MUL(r0, r4, r7);
+    break;
+case 2089:
+    OP_MUL(r0, r5, r0);
+    break;
+case 2090:
+    OP_MUL(r0, r5, r1);
+    break;
+case 2091:
+    OP_MUL(r0, r5, r2);
+    break;
+case 2092:
+    OP_MUL(r0, r5, r3);
+    break;
+case 2093:
+    OP_MUL(r0, r5, r4);
+    break;
+case 2094:
+    OP_MUL(r0, r5, r5);
+    break;
+case 2095:
+    OP_MUL(r0, r5, r6);
+    break;
+case 2096:
+    OP_MUL(r0, r5, r7);
+    break;
+case 2097:
+    OP_MUL(r0, r6, r0);
+    break;
+case 2098:
+    OP_MUL(r0, r6, r1);
+    break;
+case 2099:
+    OP_MUL(r0, r6, r2);
+    break;
+case 2100:
+    OP_MUL(r0, r6, r3);
+    break;
+case 2101:
+    OP_MUL(r0, r6, r4);
+    break;
+case 2102:
+    OP_MUL(r0, r6, r5);
+    break;
+case 2103:
+    OP_MUL(r0, r6, r6);
+    break;
+case 2104:
+    OP_MUL(r0, r6, r7);
+    break;
+case 2105:
+    OP_MUL(r0, r7, r0);
+    break;
+case 2106:
+    OP_MUL(r0, r7, r1);
+    break;
+case 2107:
+    OP_MUL(r0, r7, r2);
+    break;
+case 2108:
+    OP_MUL(r0, r7, r3);
+    break;
+case 2109:
+    OP_MUL(r0, r7, r4);
+    break;
+case 2110:
+    OP_MUL(r0, r7, r5);
+    break;
+case 2111:
+    OP_MUL(r0, r7, r6);
+    break;
+case 2112:
+    OP_MUL(r0, r7, r7);
+    break;
+case 2113:
+    OP_MUL(r1, r0, r0);
+    break;
+case 2114:
+    OP_MUL(r1, r0, r1);
+    break;
+case 2115:
+    OP_MUL(r1, r0, r2);
+    break;
+case 2116:
+    OP_MUL(r1, r0, r3);
+    break;
+case 2117:
+    OP_MUL(r1, r0, r4);
+    break;
+case 2118:
+    OP_MUL(r1, r0, r5);
+    break;
+case 2119:
+    OP_MUL(r1, r0, r6);
+    break;
+case 2120:
+    OP_MUL(r1, r0, r7);
+    break;
+case 2121:
+    OP_MUL(r1, r1, r0);
+    break;
+case 2122:
+    OP_MUL(r1, r1, r1);
+    break;
+case 2123:
+    OP_MUL(r1, r1, r2);
+    break;
+case 2124:
+    OP_MUL(r1, r1, r3);
+    break;
+case 2125:
+    OP_MUL(r1, r1, r4);
+    break;
+case 2126:
+    OP_MUL(r1, r1, r5);
+    break;
+case 2127:
+    OP_MUL(r1, r1, r6);
+    break;
+case 2128:
+    OP_MUL(r1, r1, r7);
+    break;
+case 2129:
+    OP_MUL(r1, r2, r0);
+    break;
+case 2130:
+    OP_MUL(r1, r2, r1);
+    break;
+case 2131:
+    OP_MUL(r1, r2, r2);
+    break;
+case 2132:
+    OP_MUL(r1, r2, r3);
+    break;
+case 2133:
+    OP_MUL(r1, r2, r4);
+    break;
+case 2134:
+    OP_MUL(r1, r2, r5);
+    break;
+case 2135:
+    OP_MUL(r1, r2, r6);
+    break;
+case 2136:
+    OP_MUL(r1, r2, r7);
+    break;
+case 2137:
+    OP_MUL(r1, r3, r0);
+    break;
+case 2138:
+    OP_MUL(r1, r3, r1);
+    break;
+case 2139:
+    OP_MUL(r1, r3, r2);
+    break;
+case 2140:
+    OP_MUL(r1, r3, r3);
+    break;
+case 2141:
+    OP_MUL(r1, r3, r4);
+    break;
+case 2142:
+    OP_MUL(r1, r3, r5);
+    break;
+case 2143:
+    OP_MUL(r1, r3, r6);
+    break;
+case 2144:
+    OP_MUL(r1, r3, r7);
+    break;
+case 2145:
+    OP_MUL(r1, r4, r0);
+    break;
+case 2146:
+    OP_MUL(r1, r4, r1);
+    break;
+case 2147:
+    OP_MUL(r1, r4, r2);
+    break;
+case 2148:
+    OP_MUL(r1, r4, r3);
+    break;
+case 2149:
+    OP_MUL(r1, r4, r4);
+    break;
+case 2150:
+    OP_MUL(r1, r4, r5);
+    break;
+case 2151:
+    OP_MUL(r1, r4, r6);
+    break;
+case 2152:
+    OP_MUL(r1, r4, r7);
+    break;
+case 2153:
+    OP_MUL(r1, r5, r0);
+    break;
+case 2154:
+    OP_MUL(r1, r5, r1);
+    break;
+case 2155:
+    OP_MUL(r1, r5, r2);
+    break;
+case 2156:
+    OP_MUL(r1, r5, r3);
+    break;
+case 2157:
+    OP_MUL(r1, r5, r4);
+    break;
+case 2158:
+    OP_MUL(r1, r5, r5);
+    break;
+case 2159:
+    OP_MUL(r1, r5, r6);
+    break;
+case 2160:
+    OP_MUL(r1, r5, r7);
+    break;
+case 2161:
+    OP_MUL(r1, r6, r0);
+    break;
+case 2162:
+    OP_MUL(r1, r6, r1);
+    break;
+case 2163:
+    OP_MUL(r1, r6, r2);
+    break;
+case 2164:
+    OP_MUL(r1, r6, r3);
+    break;
+case 2165:
+    OP_MUL(r1, r6, r4);
+    break;
+case 2166:
+    OP_MUL(r1, r6, r5);
+    break;
+case 2167:
+    OP_MUL(r1, r6, r6);
+    break;
+case 2168:
+    OP_MUL(r1, r6, r7);
+    break;
+case 2169:
+    OP_MUL(r1, r7, r0);
+    break;
+case 2170:
+    OP_MUL(r1, r7, r1);
+    break;
+case 2171:
+    OP_MUL(r1, r7, r2);
+    break;
+case 2172:
+    OP_MUL(r1, r7, r3);
+    break;
+case 2173:
+    OP_MUL(r1, r7, r4);
+    break;
+case 2174:
+    OP_MUL(r1, r7, r5);
+    break;
+case 2175:
+    OP_MUL(r1, r7, r6);
+    break;
+case 2176:
+    OP_MUL(r1, r7, r7);
+    break;
+case 2177:
+    OP_MUL(r2, r0, r0);
+    break;
+case 2178:
+    OP_MUL(r2, r0, r1);
+    break;
+case 2179:
+    OP_MUL(r2, r0, r2);
+    break;
+case 2180:
+    OP_MUL(r2, r0, r3);
+    break;
+case 2181:
+    OP_MUL(r2, r0, r4);
+    break;
+case 2182:
+    OP_MUL(r2, r0, r5);
+    break;
+case 2183:
+    OP_MUL(r2, r0, r6);
+    break;
+case 2184:
+    OP_MUL(r2, r0, r7);
+    break;
+case 2185:
+    OP_MUL(r2, r1, r0);
+    break;
+case 2186:
+    OP_MUL(r2, r1, r1);
+    break;
+case 2187:
+    OP_MUL(r2, r1, r2);
+    break;
+case 2188:
+    OP_MUL(r2, r1, r3);
+    break;
+case 2189:
+    OP_MUL(r2, r1, r4);
+    break;
+case 2190:
+    OP_MUL(r2, r1, r5);
+    break;
+case 2191:
+    OP_MUL(r2, r1, r6);
+    break;
+case 2192:
+    OP_MUL(r2, r1, r7);
+    break;
+case 2193:
+    OP_MUL(r2, r2, r0);
+    break;
+case 2194:
+    OP_MUL(r2, r2, r1);
+    break;
+case 2195:
+    OP_MUL(r2, r2, r2);
+    break;
+case 2196:
+    OP_MUL(r2, r2, r3);
+    break;
+case 2197:
+    OP_MUL(r2, r2, r4);
+    break;
+case 2198:
+    OP_MUL(r2, r2, r5);
+    break;
+case 2199:
+    OP_MUL(r2, r2, r6);
+    break;
+case 2200:
+    OP_MUL(r2, r2, r7);
+    break;
+case 2201:
+    OP_MUL(r2, r3, r0);
+    break;
+case 2202:
+    OP_MUL(r2, r3, r1);
+    break;
+case 2203:
+    OP_MUL(r2, r3, r2);
+    break;
+case 2204:
+    OP_MUL(r2, r3, r3);
+    break;
+case 2205:
+    OP_MUL(r2, r3, r4);
+    break;
+case 2206:
+    OP_MUL(r2, r3, r5);
+    break;
+case 2207:
+    OP_MUL(r2, r3, r6);
+    break;
+case 2208:
+    OP_MUL(r2, r3, r7);
+    break;
+case 2209:
+    OP_MUL(r2, r4, r0);
+    break;
+case 2210:
+    OP_MUL(r2, r4, r1);
+    break;
+case 2211:
+    OP_MUL(r2, r4, r2);
+    break;
+case 2212:
+    OP_MUL(r2, r4, r3);
+    break;
+case 2213:
+    OP_MUL(r2, r4, r4);
+    break;
+case 2214:
+    OP_MUL(r2, r4, r5);
+    break;
+case 2215:
+    OP_MUL(r2, r4, r6);
+    break;
+case 2216:
+    OP_MUL(r2, r4, r7);
+    break;
+case 2217:
+    OP_MUL(r2, r5, r0);
+    break;
+case 2218:
+    OP_MUL(r2, r5, r1);
+    break;
+case 2219:
+    OP_MUL(r2, r5, r2);
+    break;
+case 2220:
+    OP_MUL(r2, r5, r3);
+    break;
+case 2221:
+    OP_MUL(r2, r5, r4);
+    break;
+case 2222:
+    OP_MUL(r2, r5, r5);
+    break;
+case 2223:
+    OP_MUL(r2, r5, r6);
+    break;
+case 2224:
+    OP_MUL(r2, r5, r7);
+    break;
+case 2225:
+    OP_MUL(r2, r6, r0);
+    break;
+case 2226:
+    OP_MUL(r2, r6, r1);
+    break;
+case 2227:
+    OP_MUL(r2, r6, r2);
+    break;
+case 2228:
+    OP_MUL(r2, r6, r3);
+    break;
+case 2229:
+    OP_MUL(r2, r6, r4);
+    break;
+case 2230:
+    OP_MUL(r2, r6, r5);
+    break;
+case 2231:
+    OP_MUL(r2, r6, r6);
+    break;
+case 2232:
+    OP_MUL(r2, r6, r7);
+    break;
+case 2233:
+    OP_MUL(r2, r7, r0);
+    break;
+case 2234:
+    OP_MUL(r2, r7, r1);
+    break;
+case 2235:
+    OP_MUL(r2, r7, r2);
+    break;
+case 2236:
+    OP_MUL(r2, r7, r3);
+    break;
+case 2237:
+    OP_MUL(r2, r7, r4);
+    break;
+case 2238:
+    OP_MUL(r2, r7, r5);
+    break;
+case 2239:
+    OP_MUL(r2, r7, r6);
+    break;
+case 2240:
+    OP_MUL(r2, r7, r7);
+    break;
+case 2241:
+    OP_MUL(r3, r0, r0);
+    break;
+case 2242:
+    OP_MUL(r3, r0, r1);
+    break;
+case 2243:
+    OP_MUL(r3, r0, r2);
+    break;
+case 2244:
+    OP_MUL(r3, r0, r3);
+    break;
+case 2245:
+    OP_MUL(r3, r0, r4);
+    break;
+case 2246:
+    OP_MUL(r3, r0, r5);
+    break;
+case 2247:
+    OP_MUL(r3, r0, r6);
+    break;
+case 2248:
+    OP_MUL(r3, r0, r7);
+    break;
+case 2249:
+    OP_MUL(r3, r1, r0);
+    break;
+case 2250:
+    OP_MUL(r3, r1, r1);
+    break;
+case 2251:
+    OP_MUL(r3, r1, r2);
+    break;
+case 2252:
+    OP_MUL(r3, r1, r3);
+    break;
+case 2253:
+    OP_MUL(r3, r1, r4);
+    break;
+case 2254:
+    OP_MUL(r3, r1, r5);
+    break;
+case 2255:
+    OP_MUL(r3, r1, r6);
+    break;
+case 2256:
+    OP_MUL(r3, r1, r7);
+    break;
+case 2257:
+    OP_MUL(r3, r2, r0);
+    break;
+case 2258:
+    OP_MUL(r3, r2, r1);
+    break;
+case 2259:
+    OP_MUL(r3, r2, r2);
+    break;
+case 2260:
+    OP_MUL(r3, r2, r3);
+    break;
+case 2261:
+    OP_MUL(r3, r2, r4);
+    break;
+case 2262:
+    OP_MUL(r3, r2, r5);
+    break;
+case 2263:
+    OP_MUL(r3, r2, r6);
+    break;
+case 2264:
+    OP_MUL(r3, r2, r7);
+    break;
+case 2265:
+    OP_MUL(r3, r3, r0);
+    break;
+case 2266:
+    OP_MUL(r3, r3, r1);
+    break;
+case 2267:
+    OP_MUL(r3, r3, r2);
+    break;
+case 2268:
+    OP_MUL(r3, r3, r3);
+    break;
+case 2269:
+    OP_MUL(r3, r3, r4);
+    break;
+case 2270:
+    OP_MUL(r3, r3, r5);
+    break;
+case 2271:
+    OP_MUL(r3, r3, r6);
+    break;
+case 2272:
+    OP_MUL(r3, r3, r7);
+    break;
+case 2273:
+    OP_MUL(r3, r4, r0);
+    break;
+case 2274:
+    OP_MUL(r3, r4, r1);
+    break;
+case 2275:
+    OP_MUL(r3, r4, r2);
+    break;
+case 2276:
+    OP_MUL(r3, r4, r3);
+    break;
+case 2277:
+    OP_MUL(r3, r4, r4);
+    break;
+case 2278:
+    OP_MUL(r3, r4, r5);
+    break;
+case 2279:
+    OP_MUL(r3, r4, r6);
+    break;
+case 2280:
+    OP_MUL(r3, r4, r7);
+    break;
+case 2281:
+    OP_MUL(r3, r5, r0);
+    break;
+case 2282:
+    OP_MUL(r3, r5, r1);
+    break;
+case 2283:
+    OP_MUL(r3, r5, r2);
+    break;
+case 2284:
+    OP_MUL(r3, r5, r3);
+    break;
+case 2285:
+    OP_MUL(r3, r5, r4);
+    break;
+case 2286:
+    OP_MUL(r3, r5, r5);
+    break;
+case 2287:
+    OP_MUL(r3, r5, r6);
+    break;
+case 2288:
+    OP_MUL(r3, r5, r7);
+    break;
+case 2289:
+    OP_MUL(r3, r6, r0);
+    break;
+case 2290:
+    OP_MUL(r3, r6, r1);
+    break;
+case 2291:
+    OP_MUL(r3, r6, r2);
+    break;
+case 2292:
+    OP_MUL(r3, r6, r3);
+    break;
+case 2293:
+    OP_MUL(r3, r6, r4);
+    break;
+case 2294:
+    OP_MUL(r3, r6, r5);
+    break;
+case 2295:
+    OP_MUL(r3, r6, r6);
+    break;
+case 2296:
+    OP_MUL(r3, r6, r7);
+    break;
+case 2297:
+    OP_MUL(r3, r7, r0);
+    break;
+case 2298:
+    OP_MUL(r3, r7, r1);
+    break;
+case 2299:
+    OP_MUL(r3, r7, r2);
+    break;
+case 2300:
+    OP_MUL(r3, r7, r3);
+    break;
+case 2301:
+    OP_MUL(r3, r7, r4);
+    break;
+case 2302:
+    OP_MUL(r3, r7, r5);
+    break;
+case 2303:
+    OP_MUL(r3, r7, r6);
+    break;
+case 2304:
+    OP_MUL(r3, r7, r7);
+    break;
+case 2305:
+    OP_MUL(r4, r0, r0);
+    break;
+case 2306:
+    OP_MUL(r4, r0, r1);
+    break;
+case 2307:
+    OP_MUL(r4, r0, r2);
+    break;
+case 2308:
+    OP_MUL(r4, r0, r3);
+    break;
+case 2309:
+    OP_MUL(r4, r0, r4);
+    break;
+case 2310:
+    OP_MUL(r4, r0, r5);
+    break;
+case 2311:
+    OP_MUL(r4, r0, r6);
+    break;
+case 2312:
+    OP_MUL(r4, r0, r7);
+    break;
+case 2313:
+    OP_MUL(r4, r1, r0);
+    break;
+case 2314:
+    OP_MUL(r4, r1, r1);
+    break;
+case 2315:
+    OP_MUL(r4, r1, r2);
+    break;
+case 2316:
+    OP_MUL(r4, r1, r3);
+    break;
+case 2317:
+    OP_MUL(r4, r1, r4);
+    break;
+case 2318:
+    OP_MUL(r4, r1, r5);
+    break;
+case 2319:
+    OP_MUL(r4, r1, r6);
+    break;
+case 2320:
+    OP_MUL(r4, r1, r7);
+    break;
+case 2321:
+    OP_MUL(r4, r2, r0);
+    break;
+case 2322:
+    OP_MUL(r4, r2, r1);
+    break;
+case 2323:
+    OP_MUL(r4, r2, r2);
+    break;
+case 2324:
+    OP_MUL(r4, r2, r3);
+    break;
+case 2325:
+    OP_MUL(r4, r2, r4);
+    break;
+case 2326:
+    OP_MUL(r4, r2, r5);
+    break;
+case 2327:
+    OP_MUL(r4, r2, r6);
+    break;
+case 2328:
+    OP_MUL(r4, r2, r7);
+    break;
+case 2329:
+    OP_MUL(r4, r3, r0);
+    break;
+case 2330:
+    OP_MUL(r4, r3, r1);
+    break;
+case 2331:
+    OP_MUL(r4, r3, r2);
+    break;
+case 2332:
+    OP_MUL(r4, r3, r3);
+    break;
+case 2333:
+    OP_MUL(r4, r3, r4);
+    break;
+case 2334:
+    OP_MUL(r4, r3, r5);
+    break;
+case 2335:
+    OP_MUL(r4, r3, r6);
+    break;
+case 2336:
+    OP_MUL(r4, r3, r7);
+    break;
+case 2337:
+    OP_MUL(r4, r4, r0);
+    break;
+case 2338:
+    OP_MUL(r4, r4, r1);
+    break;
+case 2339:
+    OP_MUL(r4, r4, r2);
+    break;
+case 2340:
+    OP_MUL(r4, r4, r3);
+    break;
+case 2341:
+    OP_MUL(r4, r4, r4);
+    break;
+case 2342:
+    OP_MUL(r4, r4, r5);
+    break;
+case 2343:
+    OP_MUL(r4, r4, r6);
+    break;
+case 2344:
+    OP_MUL(r4, r4, r7);
+    break;
+case 2345:
+    OP_MUL(r4, r5, r0);
+    break;
+case 2346:
+    OP_MUL(r4, r5, r1);
+    break;
+case 2347:
+    OP_MUL(r4, r5, r2);
+    break;
+case 2348:
+    OP_MUL(r4, r5, r3);
+    break;
+case 2349:
+    OP_MUL(r4, r5, r4);
+    break;
+case 2350:
+    OP_MUL(r4, r5, r5);
+    break;
+case 2351:
+    OP_MUL(r4, r5, r6);
+    break;
+case 2352:
+    OP_MUL(r4, r5, r7);
+    break;
+case 2353:
+    OP_MUL(r4, r6, r0);
+    break;
+case 2354:
+    OP_MUL(r4, r6, r1);
+    break;
+case 2355:
+    OP_MUL(r4, r6, r2);
+    break;
+case 2356:
+    OP_MUL(r4, r6, r3);
+    break;
+case 2357:
+    OP_MUL(r4, r6, r4);
+    break;
+case 2358:
+    OP_MUL(r4, r6, r5);
+    break;
+case 2359:
+    OP_MUL(r4, r6, r6);
+    break;
+case 2360:
+    OP_MUL(r4, r6, r7);
+    break;
+case 2361:
+    OP_MUL(r4, r7, r0);
+    break;
+case 2362:
+    OP_MUL(r4, r7, r1);
+    break;
+case 2363:
+    OP_MUL(r4, r7, r2);
+    break;
+case 2364:
+    OP_MUL(r4, r7, r3);
+    break;
+case 2365:
+    OP_MUL(r4, r7, r4);
+    break;
+case 2366:
+    OP_MUL(r4, r7, r5);
+    break;
+case 2367:
+    OP_MUL(r4, r7, r6);
+    break;
+case 2368:
+    OP_MUL(r4, r7, r7);
+    break;
+case 2369:
+    OP_MUL(r5, r0, r0);
+    break;
+case 2370:
+    OP_MUL(r5, r0, r1);
+    break;
+case 2371:
+    OP_MUL(r5, r0, r2);
+    break;
+case 2372:
+    OP_MUL(r5, r0, r3);
+    break;
+case 2373:
+    OP_MUL(r5, r0, r4);
+    break;
+case 2374:
+    OP_MUL(r5, r0, r5);
+    break;
+case 2375:
+    OP_MUL(r5, r0, r6);
+    break;
+case 2376:
+    OP_MUL(r5, r0, r7);
+    break;
+case 2377:
+    OP_MUL(r5, r1, r0);
+    break;
+case 2378:
+    OP_MUL(r5, r1, r1);
+    break;
+case 2379:
+    OP_MUL(r5, r1, r2);
+    break;
+case 2380:
+    OP_MUL(r5, r1, r3);
+    break;
+case 2381:
+    OP_MUL(r5, r1, r4);
+    break;
+case 2382:
+    OP_MUL(r5, r1, r5);
+    break;
+case 2383:
+    OP_MUL(r5, r1, r6);
+    break;
+case 2384:
+    OP_MUL(r5, r1, r7);
+    break;
+case 2385:
+    OP_MUL(r5, r2, r0);
+    break;
+case 2386:
+    OP_MUL(r5, r2, r1);
+    break;
+case 2387:
+    OP_MUL(r5, r2, r2);
+    break;
+case 2388:
+    OP_MUL(r5, r2, r3);
+    break;
+case 2389:
+    OP_MUL(r5, r2, r4);
+    break;
+case 2390:
+    OP_MUL(r5, r2, r5);
+    break;
+case 2391:
+    OP_MUL(r5, r2, r6);
+    break;
+case 2392:
+    OP_MUL(r5, r2, r7);
+    break;
+case 2393:
+    OP_MUL(r5, r3, r0);
+    break;
+case 2394:
+    OP_MUL(r5, r3, r1);
+    break;
+case 2395:
+    OP_MUL(r5, r3, r2);
+    break;
+case 2396:
+    OP_MUL(r5, r3, r3);
+    break;
+case 2397:
+    OP_MUL(r5, r3, r4);
+    break;
+case 2398:
+    OP_MUL(r5, r3, r5);
+    break;
+case 2399:
+    OP_MUL(r5, r3, r6);
+    break;
+case 2400:
+    OP_MUL(r5, r3, r7);
+    break;
+case 2401:
+    OP_MUL(r5, r4, r0);
+    break;
+case 2402:
+    OP_MUL(r5, r4, r1);
+    break;
+case 2403:
+    OP_MUL(r5, r4, r2);
+    break;
+case 2404:
+    OP_MUL(r5, r4, r3);
+    break;
+case 2405:
+    OP_MUL(r5, r4, r4);
+    break;
+case 2406:
+    OP_MUL(r5, r4, r5);
+    break;
+case 2407:
+    OP_MUL(r5, r4, r6);
+    break;
+case 2408:
+    OP_MUL(r5, r4, r7);
+    break;
+case 2409:
+    OP_MUL(r5, r5, r0);
+    break;
+case 2410:
+    OP_MUL(r5, r5, r1);
+    break;
+case 2411:
+    OP_MUL(r5, r5, r2);
+    break;
+case 2412:
+    OP_MUL(r5, r5, r3);
+    break;
+case 2413:
+    OP_MUL(r5, r5, r4);
+    break;
+case 2414:
+    OP_MUL(r5, r5, r5);
+    break;
+case 2415:
+    OP_MUL(r5, r5, r6);
+    break;
+case 2416:
+    OP_MUL(r5, r5, r7);
+    break;
+case 2417:
+    OP_MUL(r5, r6, r0);
+    break;
+case 2418:
+    OP_MUL(r5, r6, r1);
+    break;
+case 2419:
+    OP_MUL(r5, r6, r2);
+    break;
+case 2420:
+    OP_MUL(r5, r6, r3);
+    break;
+case 2421:
+    OP_MUL(r5, r6, r4);
+    break;
+case 2422:
+    OP_MUL(r5, r6, r5);
+    break;
+case 2423:
+    OP_MUL(r5, r6, r6);
+    break;
+case 2424:
+    OP_MUL(r5, r6, r7);
+    break;
+case 2425:
+    OP_MUL(r5, r7, r0);
+    break;
+case 2426:
+    OP_MUL(r5, r7, r1);
+    break;
+case 2427:
+    OP_MUL(r5, r7, r2);
+    break;
+case 2428:
+    OP_MUL(r5, r7, r3);
+    break;
+case 2429:
+    OP_MUL(r5, r7, r4);
+    break;
+case 2430:
+    OP_MUL(r5, r7, r5);
+    break;
+case 2431:
+    OP_MUL(r5, r7, r6);
+    break;
+case 2432:
+    OP_MUL(r5, r7, r7);
+    break;
+case 2433:
+    OP_MUL(r6, r0, r0);
+    break;
+case 2434:
+    OP_MUL(r6, r0, r1);
+    break;
+case 2435:
+    OP_MUL(r6, r0, r2);
+    break;
+case 2436:
+    OP_MUL(r6, r0, r3);
+    break;
+case 2437:
+    OP_MUL(r6, r0, r4);
+    break;
+case 2438:
+    OP_MUL(r6, r0, r5);
+    break;
+case 2439:
+    OP_MUL(r6, r0, r6);
+    break;
+case 2440:
+    OP_MUL(r6, r0, r7);
+    break;
+case 2441:
+    OP_MUL(r6, r1, r0);
+    break;
+case 2442:
+    OP_MUL(r6, r1, r1);
+    break;
+case 2443:
+    OP_MUL(r6, r1, r2);
+    break;
+case 2444:
+    OP_MUL(r6, r1, r3);
+    break;
+case 2445:
+    OP_MUL(r6, r1, r4);
+    break;
+case 2446:
+    OP_MUL(r6, r1, r5);
+    break;
+case 2447:
+    OP_MUL(r6, r1, r6);
+    break;
+case 2448:
+    OP_MUL(r6, r1, r7);
+    break;
+case 2449:
+    OP_MUL(r6, r2, r0);
+    break;
+case 2450:
+    OP_MUL(r6, r2, r1);
+    break;
+case 2451:
+    OP_MUL(r6, r2, r2);
+    break;
+case 2452:
+    OP_MUL(r6, r2, r3);
+    break;
+case 2453:
+    OP_MUL(r6, r2, r4);
+    break;
+case 2454:
+    OP_MUL(r6, r2, r5);
+    break;
+case 2455:
+    OP_MUL(r6, r2, r6);
+    break;
+case 2456:
+    OP_MUL(r6, r2, r7);
+    break;
+case 2457:
+    OP_MUL(r6, r3, r0);
+    break;
+case 2458:
+    OP_MUL(r6, r3, r1);
+    break;
+case 2459:
+    OP_MUL(r6, r3, r2);
+    break;
+case 2460:
+    OP_MUL(r6, r3, r3);
+    break;
+case 2461:
+    OP_MUL(r6, r3, r4);
+    break;
+case 2462:
+    OP_MUL(r6, r3, r5);
+    break;
+case 2463:
+    OP_MUL(r6, r3, r6);
+    break;
+case 2464:
+    OP_MUL(r6, r3, r7);
+    break;
+case 2465:
+    OP_MUL(r6, r4, r0);
+    break;
+case 2466:
+    OP_MUL(r6, r4, r1);
+    break;
+case 2467:
+    OP_MUL(r6, r4, r2);
+    break;
+case 2468:
+    OP_MUL(r6, r4, r3);
+    break;
+case 2469:
+    OP_MUL(r6, r4, r4);
+    break;
+case 2470:
+    OP_MUL(r6, r4, r5);
+    break;
+case 2471:
+    OP_MUL(r6, r4, r6);
+    break;
+case 2472:
+    OP_MUL(r6, r4, r7);
+    break;
+case 2473:
+    OP_MUL(r6, r5, r0);
+    break;
+case 2474:
+    OP_MUL(r6, r5, r1);
+    break;
+case 2475:
+    OP_MUL(r6, r5, r2);
+    break;
+case 2476:
+    OP_MUL(r6, r5, r3);
+    break;
+case 2477:
+    OP_MUL(r6, r5, r4);
+    break;
+case 2478:
+    OP_MUL(r6, r5, r5);
+    break;
+case 2479:
+    OP_MUL(r6, r5, r6);
+    break;
+case 2480:
+    OP_MUL(r6, r5, r7);
+    break;
+case 2481:
+    OP_MUL(r6, r6, r0);
+    break;
+case 2482:
+    OP_MUL(r6, r6, r1);
+    break;
+case 2483:
+    OP_MUL(r6, r6, r2);
+    break;
+case 2484:
+    OP_MUL(r6, r6, r3);
+    break;
+case 2485:
+    OP_MUL(r6, r6, r4);
+    break;
+case 2486:
+    OP_MUL(r6, r6, r5);
+    break;
+case 2487:
+    OP_MUL(r6, r6, r6);
+    break;
+case 2488:
+    OP_MUL(r6, r6, r7);
+    break;
+case 2489:
+    OP_MUL(r6, r7, r0);
+    break;
+case 2490:
+    OP_MUL(r6, r7, r1);
+    break;
+case 2491:
+    OP_MUL(r6, r7, r2);
+    break;
+case 2492:
+    OP_MUL(r6, r7, r3);
+    break;
+case 2493:
+    OP_MUL(r6, r7, r4);
+    break;
+case 2494:
+    OP_MUL(r6, r7, r5);
+    break;
+case 2495:
+    OP_MUL(r6, r7, r6);
+    break;
+case 2496:
+    OP_MUL(r6, r7, r7);
+    break;
+case 2497:
+    OP_MUL(r7, r0, r0);
+    break;
+case 2498:
+    OP_MUL(r7, r0, r1);
+    break;
+case 2499:
+    OP_MUL(r7, r0, r2);
+    break;
+case 2500:
+    OP_MUL(r7, r0, r3);
+    break;
+case 2501:
+    OP_MUL(r7, r0, r4);
+    break;
+case 2502:
+    OP_MUL(r7, r0, r5);
+    break;
+case 2503:
+    OP_MUL(r7, r0, r6);
+    break;
+case 2504:
+    OP_MUL(r7, r0, r7);
+    break;
+case 2505:
+    OP_MUL(r7, r1, r0);
+    break;
+case 2506:
+    OP_MUL(r7, r1, r1);
+    break;
+case 2507:
+    OP_MUL(r7, r1, r2);
+    break;
+case 2508:
+    OP_MUL(r7, r1, r3);
+    break;
+case 2509:
+    OP_MUL(r7, r1, r4);
+    break;
+case 2510:
+    OP_MUL(r7, r1, r5);
+    break;
+case 2511:
+    OP_MUL(r7, r1, r6);
+    break;
+case 2512:
+    OP_MUL(r7, r1, r7);
+    break;
+case 2513:
+    OP_MUL(r7, r2, r0);
+    break;
+case 2514:
+    OP_MUL(r7, r2, r1);
+    break;
+case 2515:
+    OP_MUL(r7, r2, r2);
+    break;
+case 2516:
+    OP_MUL(r7, r2, r3);
+    break;
+case 2517:
+    OP_MUL(r7, r2, r4);
+    break;
+case 2518:
+    OP_MUL(r7, r2, r5);
+    break;
+case 2519:
+    OP_MUL(r7, r2, r6);
+    break;
+case 2520:
+    OP_MUL(r7, r2, r7);
+    break;
+case 2521:
+    OP_MUL(r7, r3, r0);
+    break;
+case 2522:
+    OP_MUL(r7, r3, r1);
+    break;
+case 2523:
+    OP_MUL(r7, r3, r2);
+    break;
+case 2524:
+    OP_MUL(r7, r3, r3);
+    break;
+case 2525:
+    OP_MUL(r7, r3, r4);
+    break;
+case 2526:
+    OP_MUL(r7, r3, r5);
+    break;
+case 2527:
+    OP_MUL(r7, r3, r6);
+    break;
+case 2528:
+    OP_MUL(r7, r3, r7);
+    break;
+case 2529:
+    OP_MUL(r7, r4, r0);
+    break;
+case 2530:
+    OP_MUL(r7, r4, r1);
+    break;
+case 2531:
+    OP_MUL(r7, r4, r2);
+    break;
+case 2532:
+    OP_MUL(r7, r4, r3);
+    break;
+case 2533:
+    OP_MUL(r7, r4, r4);
+    break;
+case 2534:
+    OP_MUL(r7, r4, r5);
+    break;
+case 2535:
+    OP_MUL(r7, r4, r6);
+    break;
+case 2536:
+    OP_MUL(r7, r4, r7);
+    break;
+case 2537:
+    OP_MUL(r7, r5, r0);
+    break;
+case 2538:
+    OP_MUL(r7, r5, r1);
+    break;
+case 2539:
+    OP_MUL(r7, r5, r2);
+    break;
+case 2540:
+    OP_MUL(r7, r5, r3);
+    break;
+case 2541:
+    OP_MUL(r7, r5, r4);
+    break;
+case 2542:
+    OP_MUL(r7, r5, r5);
+    break;
+case 2543:
+    OP_MUL(r7, r5, r6);
+    break;
+case 2544:
+    OP_MUL(r7, r5, r7);
+    break;
+case 2545:
+    OP_MUL(r7, r6, r0);
+    break;
+case 2546:
+    OP_MUL(r7, r6, r1);
+    break;
+case 2547:
+    OP_MUL(r7, r6, r2);
+    break;
+case 2548:
+    OP_MUL(r7, r6, r3);
+    break;
+case 2549:
+    OP_MUL(r7, r6, r4);
+    break;
+case 2550:
+    OP_MUL(r7, r6, r5);
+    break;
+case 2551:
+    OP_MUL(r7, r6, r6);
+    break;
+case 2552:
+    OP_MUL(r7, r6, r7);
+    break;
+case 2553:
+    OP_MUL(r7, r7, r0);
+    break;
+case 2554:
+    OP_MUL(r7, r7, r1);
+    break;
+case 2555:
+    OP_MUL(r7, r7, r2);
+    break;
+case 2556:
+    OP_MUL(r7, r7, r3);
+    break;
+case 2557:
+    OP_MUL(r7, r7, r4);
+    break;
+case 2558:
+    OP_MUL(r7, r7, r5);
+    break;
+case 2559:
+    OP_MUL(r7, r7, r6);
+    break;
+case 2560:
+    OP_MUL(r7, r7, r7);
+    break;
+case 2561:
+    OP_DIV(r0, r0, r0);
+    break;
+case 2562:
+    OP_DIV(r0, r0, r1);
+    break;
+case 2563:
+    OP_DIV(r0, r0, r2);
+    break;
+case 2564:
+    OP_DIV(r0, r0, r3);
+    break;
+case 2565:
+    OP_DIV(r0, r0, r4);
+    break;
+case 2566:
+    OP_DIV(r0, r0, r5);
+    break;
+case 2567:
+    OP_DIV(r0, r0, r6);
+    break;
+case 2568:
+    OP_DIV(r0, r0, r7);
+    break;
+case 2569:
+    OP_DIV(r0, r1, r0);
+    break;
+case 2570:
+    OP_DIV(r0, r1, r1);
+    break;
+case 2571:
+    OP_DIV(r0, r1, r2);
+    break;
+case 2572:
+    OP_DIV(r0, r1, r3);
+    break;
+case 2573:
+    OP_DIV(r0, r1, r4);
+    break;
+case 2574:
+    OP_DIV(r0, r1, r5);
+    break;
+case 2575:
+    OP_DIV(r0, r1, r6);
+    break;
+case 2576:
+    OP_DIV(r0, r1, r7);
+    break;
+case 2577:
+    OP_DIV(r0, r2, r0);
+    break;
+case 2578:
+    OP_DIV(r0, r2, r1);
+    break;
+case 2579:
+    OP_DIV(r0, r2, r2);
+    break;
+case 2580:
+    OP_DIV(r0, r2, r3);
+    break;
+case 2581:
+    OP_DIV(r0, r2, r4);
+    break;
+case 2582:
+    OP_DIV(r0, r2, r5);
+    break;
+case 2583:
+    OP_DIV(r0, r2, r6);
+    break;
+case 2584:
+    OP_DIV(r0, r2, r7);
+    break;
+case 2585:
+    OP_DIV(r0, r3, r0);
+    break;
+case 2586:
+    OP_DIV(r0, r3, r1);
+    break;
+case 2587:
+    OP_DIV(r0, r3, r2);
+    break;
+case 2588:
+    OP_DIV(r0, r3, r3);
+    break;
+case 2589:
+    OP_DIV(r0, r3, r4);
+    break;
+case 2590:
+    OP_DIV(r0, r3, r5);
+    break;
+case 2591:
+    OP_DIV(r0, r3, r6);
+    break;
+case 2592:
+    OP_DIV(r0, r3, r7);
+    break;
+case 2593:
+    OP_DIV(r0, r4, r0);
+    break;
+case 2594:
+    OP_DIV(r0, r4, r1);
+    break;
+case 2595:
+    OP_DIV(r0, r4, r2);
+    break;
+case 2596:
+    OP_DIV(r0, r4, r3);
+    break;
+case 2597:
+    OP_DIV(r0, r4, r4);
+    break;
+case 2598:
+    OP_DIV(r0, r4, r5);
+    break;
+case 2599:
+    OP_DIV(r0, r4, r6);
+    break;
+case 2600:
+    OP_DIV(r0, r4, r7);
+    break;
+case 2601:
+    OP_DIV(r0, r5, r0);
+    break;
+case 2602:
+    OP_DIV(r0, r5, r1);
+    break;
+case 2603:
+    OP_DIV(r0, r5, r2);
+    break;
+case 2604:
+    OP_DIV(r0, r5, r3);
+    break;
+case 2605:
+    OP_DIV(r0, r5, r4);
+    break;
+case 2606:
+    OP_DIV(r0, r5, r5);
+    break;
+case 2607:
+    OP_DIV(r0, r5, r6);
+    break;
+case 2608:
+    OP_DIV(r0, r5, r7);
+    break;
+case 2609:
+    OP_DIV(r0, r6, r0);
+    break;
+case 2610:
+    OP_DIV(r0, r6, r1);
+    break;
+case 2611:
+    OP_DIV(r0, r6, r2);
+    break;
+case 2612:
+    OP_DIV(r0, r6, r3);
+    break;
+case 2613:
+    OP_DIV(r0, r6, r4);
+    break;
+case 2614:
+    OP_DIV(r0, r6, r5);
+    break;
+case 2615:
+    OP_DIV(r0, r6, r6);
+    break;
+case 2616:
+    OP_DIV(r0, r6, r7);
+    break;
+case 2617:
+    OP_DIV(r0, r7, r0);
+    break;
+case 2618:
+    OP_DIV(r0, r7, r1);
+    break;
+case 2619:
+    OP_DIV(r0, r7, r2);
+    break;
+case 2620:
+    OP_DIV(r0, r7, r3);
+    break;
+case 2621:
+    OP_DIV(r0, r7, r4);
+    break;
+case 2622:
+    OP_DIV(r0, r7, r5);
+    break;
+case 2623:
+    OP_DIV(r0, r7, r6);
+    break;
+case 2624:
+    OP_DIV(r0, r7, r7);
+    break;
+case 2625:
+    OP_DIV(r1, r0, r0);
+    break;
+case 2626:
+    OP_DIV(r1, r0, r1);
+    break;
+case 2627:
+    OP_DIV(r1, r0, r2);
+    break;
+case 2628:
+    OP_DIV(r1, r0, r3);
+    break;
+case 2629:
+    OP_DIV(r1, r0, r4);
+    break;
+case 2630:
+    OP_DIV(r1, r0, r5);
+    break;
+case 2631:
+    OP_DIV(r1, r0, r6);
+    break;
+case 2632:
+    OP_DIV(r1, r0, r7);
+    break;
+case 2633:
+    OP_DIV(r1, r1, r0);
+    break;
+case 2634:
+    OP_DIV(r1, r1, r1);
+    break;
+case 2635:
+    OP_DIV(r1, r1, r2);
+    break;
+case 2636:
+    OP_DIV(r1, r1, r3);
+    break;
+case 2637:
+    OP_DIV(r1, r1, r4);
+    break;
+case 2638:
+    OP_DIV(r1, r1, r5);
+    break;
+case 2639:
+    OP_DIV(r1, r1, r6);
+    break;
+case 2640:
+    OP_DIV(r1, r1, r7);
+    break;
+case 2641:
+    OP_DIV(r1, r2, r0);
+    break;
+case 2642:
+    OP_DIV(r1, r2, r1);
+    break;
+case 2643:
+    OP_DIV(r1, r2, r2);
+    break;
+case 2644:
+    OP_DIV(r1, r2, r3);
+    break;
+case 2645:
+    OP_DIV(r1, r2, r4);
+    break;
+case 2646:
+    OP_DIV(r1, r2, r5);
+    break;
+case 2647:
+    OP_DIV(r1, r2, r6);
+    break;
+case 2648:
+    OP_DIV(r1, r2, r7);
+    break;
+case 2649:
+    OP_DIV(r1, r3, r0);
+    break;
+case 2650:
+    OP_DIV(r1, r3, r1);
+    break;
+case 2651:
+    OP_DIV(r1, r3, r2);
+    break;
+case 2652:
+    OP_DIV(r1, r3, r3);
+    break;
+case 2653:
+    OP_DIV(r1, r3, r4);
+    break;
+case 2654:
+    OP_DIV(r1, r3, r5);
+    break;
+case 2655:
+    OP_DIV(r1, r3, r6);
+    break;
+case 2656:
+    OP_DIV(r1, r3, r7);
+    break;
+case 2657:
+    OP_DIV(r1, r4, r0);
+    break;
+case 2658:
+    OP_DIV(r1, r4, r1);
+    break;
+case 2659:
+    OP_DIV(r1, r4, r2);
+    break;
+case 2660:
+    OP_DIV(r1, r4, r3);
+    break;
+case 2661:
+    OP_DIV(r1, r4, r4);
+    break;
+case 2662:
+    OP_DIV(r1, r4, r5);
+    break;
+case 2663:
+    OP_DIV(r1, r4, r6);
+    break;
+case 2664:
+    OP_DIV(r1, r4, r7);
+    break;
+case 2665:
+    OP_DIV(r1, r5, r0);
+    break;
+case 2666:
+    OP_DIV(r1, r5, r1);
+    break;
+case 2667:
+    OP_DIV(r1, r5, r2);
+    break;
+case 2668:
+    OP_DIV(r1, r5, r3);
+    break;
+case 2669:
+    OP_DIV(r1, r5, r4);
+    break;
+case 2670:
+    OP_DIV(r1, r5, r5);
+    break;
+case 2671:
+    OP_DIV(r1, r5, r6);
+    break;
+case 2672:
+    OP_DIV(r1, r5, r7);
+    break;
+case 2673:
+    OP_DIV(r1, r6, r0);
+    break;
+case 2674:
+    OP_DIV(r1, r6, r1);
+    break;
+case 2675:
+    OP_DIV(r1, r6, r2);
+    break;
+case 2676:
+    OP_DIV(r1, r6, r3);
+    break;
+case 2677:
+    OP_DIV(r1, r6, r4);
+    break;
+case 2678:
+    OP_DIV(r1, r6, r5);
+    break;
+case 2679:
+    OP_DIV(r1, r6, r6);
+    break;
+case 2680:
+    OP_DIV(r1, r6, r7);
+    break;
+case 2681:
+    OP_DIV(r1, r7, r0);
+    break;
+case 2682:
+    OP_DIV(r1, r7, r1);
+    break;
+case 2683:
+    OP_DIV(r1, r7, r2);
+    break;
+case 2684:
+    OP_DIV(r1, r7, r3);
+    break;
+case 2685:
+    OP_DIV(r1, r7, r4);
+    break;
+case 2686:
+    OP_DIV(r1, r7, r5);
+    break;
+case 2687:
+    OP_DIV(r1, r7, r6);
+    break;
+case 2688:
+    OP_DIV(r1, r7, r7);
+    break;
+case 2689:
+    OP_DIV(r2, r0, r0);
+    break;
+case 2690:
+    OP_DIV(r2, r0, r1);
+    break;
+case 2691:
+    OP_DIV(r2, r0, r2);
+    break;
+case 2692:
+    OP_DIV(r2, r0, r3);
+    break;
+case 2693:
+    OP_DIV(r2, r0, r4);
+    break;
+case 2694:
+    OP_DIV(r2, r0, r5);
+    break;
+case 2695:
+    OP_DIV(r2, r0, r6);
+    break;
+case 2696:
+    OP_DIV(r2, r0, r7);
+    break;
+case 2697:
+    OP_DIV(r2, r1, r0);
+    break;
+case 2698:
+    OP_DIV(r2, r1, r1);
+    break;
+case 2699:
+    OP_DIV(r2, r1, r2);
+    break;
+case 2700:
+    OP_DIV(r2, r1, r3);
+    break;
+case 2701:
+    OP_DIV(r2, r1, r4);
+    break;
+case 2702:
+    OP_DIV(r2, r1, r5);
+    break;
+case 2703:
+    OP_DIV(r2, r1, r6);
+    break;
+case 2704:
+    OP_DIV(r2, r1, r7);
+    break;
+case 2705:
+    OP_DIV(r2, r2, r0);
+    break;
+case 2706:
+    OP_DIV(r2, r2, r1);
+    break;
+case 2707:
+    OP_DIV(r2, r2, r2);
+    break;
+case 2708:
+    OP_DIV(r2, r2, r3);
+    break;
+case 2709:
+    OP_DIV(r2, r2, r4);
+    break;
+case 2710:
+    OP_DIV(r2, r2, r5);
+    break;
+case 2711:
+    OP_DIV(r2, r2, r6);
+    break;
+case 2712:
+    OP_DIV(r2, r2, r7);
+    break;
+case 2713:
+    OP_DIV(r2, r3, r0);
+    break;
+case 2714:
+    OP_DIV(r2, r3, r1);
+    break;
+case 2715:
+    OP_DIV(r2, r3, r2);
+    break;
+case 2716:
+    OP_DIV(r2, r3, r3);
+    break;
+case 2717:
+    OP_DIV(r2, r3, r4);
+    break;
+case 2718:
+    OP_DIV(r2, r3, r5);
+    break;
+case 2719:
+    OP_DIV(r2, r3, r6);
+    break;
+case 2720:
+    OP_DIV(r2, r3, r7);
+    break;
+case 2721:
+    OP_DIV(r2, r4, r0);
+    break;
+case 2722:
+    OP_DIV(r2, r4, r1);
+    break;
+case 2723:
+    OP_DIV(r2, r4, r2);
+    break;
+case 2724:
+    OP_DIV(r2, r4, r3);
+    break;
+case 2725:
+    OP_DIV(r2, r4, r4);
+    break;
+case 2726:
+    OP_DIV(r2, r4, r5);
+    break;
+case 2727:
+    OP_DIV(r2, r4, r6);
+    break;
+case 2728:
+    OP_DIV(r2, r4, r7);
+    break;
+case 2729:
+    OP_DIV(r2, r5, r0);
+    break;
+case 2730:
+    OP_DIV(r2, r5, r1);
+    break;
+case 2731:
+    OP_DIV(r2, r5, r2);
+    break;
+case 2732:
+    OP_DIV(r2, r5, r3);
+    break;
+case 2733:
+    OP_DIV(r2, r5, r4);
+    break;
+case 2734:
+    OP_DIV(r2, r5, r5);
+    break;
+case 2735:
+    OP_DIV(r2, r5, r6);
+    break;
+case 2736:
+    OP_DIV(r2, r5, r7);
+    break;
+case 2737:
+    OP_DIV(r2, r6, r0);
+    break;
+case 2738:
+    OP_DIV(r2, r6, r1);
+    break;
+case 2739:
+    OP_DIV(r2, r6, r2);
+    break;
+case 2740:
+    OP_DIV(r2, r6, r3);
+    break;
+case 2741:
+    OP_DIV(r2, r6, r4);
+    break;
+case 2742:
+    OP_DIV(r2, r6, r5);
+    break;
+case 2743:
+    OP_DIV(r2, r6, r6);
+    break;
+case 2744:
+    OP_DIV(r2, r6, r7);
+    break;
+case 2745:
+    OP_DIV(r2, r7, r0);
+    break;
+case 2746:
+    OP_DIV(r2, r7, r1);
+    break;
+case 2747:
+    OP_DIV(r2, r7, r2);
+    break;
+case 2748:
+    OP_DIV(r2, r7, r3);
+    break;
+case 2749:
+    OP_DIV(r2, r7, r4);
+    break;
+case 2750:
+    OP_DIV(r2, r7, r5);
+    break;
+case 2751:
+    OP_DIV(r2, r7, r6);
+    break;
+case 2752:
+    OP_DIV(r2, r7, r7);
+    break;
+case 2753:
+    OP_DIV(r3, r0, r0);
+    break;
+case 2754:
+    OP_DIV(r3, r0, r1);
+    break;
+case 2755:
+    OP_DIV(r3, r0, r2);
+    break;
+case 2756:
+    OP_DIV(r3, r0, r3);
+    break;
+case 2757:
+    OP_DIV(r3, r0, r4);
+    break;
+case 2758:
+    OP_DIV(r3, r0, r5);
+    break;
+case 2759:
+    OP_DIV(r3, r0, r6);
+    break;
+case 2760:
+    OP_DIV(r3, r0, r7);
+    break;
+case 2761:
+    OP_DIV(r3, r1, r0);
+    break;
+case 2762:
+    OP_DIV(r3, r1, r1);
+    break;
+case 2763:
+    OP_DIV(r3, r1, r2);
+    break;
+case 2764:
+    OP_DIV(r3, r1, r3);
+    break;
+case 2765:
+    OP_DIV(r3, r1, r4);
+    break;
+case 2766:
+    OP_DIV(r3, r1, r5);
+    break;
+case 2767:
+    OP_DIV(r3, r1, r6);
+    break;
+case 2768:
+    OP_DIV(r3, r1, r7);
+    break;
+case 2769:
+    OP_DIV(r3, r2, r0);
+    break;
+case 2770:
+    OP_DIV(r3, r2, r1);
+    break;
+case 2771:
+    OP_DIV(r3, r2, r2);
+    break;
+case 2772:
+    OP_DIV(r3, r2, r3);
+    break;
+case 2773:
+    OP_DIV(r3, r2, r4);
+    break;
+case 2774:
+    OP_DIV(r3, r2, r5);
+    break;
+case 2775:
+    OP_DIV(r3, r2, r6);
+    break;
+case 2776:
+    OP_DIV(r3, r2, r7);
+    break;
+case 2777:
+    OP_DIV(r3, r3, r0);
+    break;
+case 2778:
+    OP_DIV(r3, r3, r1);
+    break;
+case 2779:
+    OP_DIV(r3, r3, r2);
+    break;
+case 2780:
+    OP_DIV(r3, r3, r3);
+    break;
+case 2781:
+    OP_DIV(r3, r3, r4);
+    break;
+case 2782:
+    OP_DIV(r3, r3, r5);
+    break;
+case 2783:
+    OP_DIV(r3, r3, r6);
+    break;
+case 2784:
+    OP_DIV(r3, r3, r7);
+    break;
+case 2785:
+    OP_DIV(r3, r4, r0);
+    break;
+case 2786:
+    OP_DIV(r3, r4, r1);
+    break;
+case 2787:
+    OP_DIV(r3, r4, r2);
+    break;
+case 2788:
+    OP_DIV(r3, r4, r3);
+    break;
+case 2789:
+    OP_DIV(r3, r4, r4);
+    break;
+case 2790:
+    OP_DIV(r3, r4, r5);
+    break;
+case 2791:
+    OP_DIV(r3, r4, r6);
+    break;
+case 2792:
+    OP_DIV(r3, r4, r7);
+    break;
+case 2793:
+    OP_DIV(r3, r5, r0);
+    break;
+case 2794:
+    OP_DIV(r3, r5, r1);
+    break;
+case 2795:
+    OP_DIV(r3, r5, r2);
+    break;
+case 2796:
+    OP_DIV(r3, r5, r3);
+    break;
+case 2797:
+    OP_DIV(r3, r5, r4);
+    break;
+case 2798:
+    OP_DIV(r3, r5, r5);
+    break;
+case 2799:
+    OP_DIV(r3, r5, r6);
+    break;
+case 2800:
+    OP_DIV(r3, r5, r7);
+    break;
+case 2801:
+    OP_DIV(r3, r6, r0);
+    break;
+case 2802:
+    OP_DIV(r3, r6, r1);
+    break;
+case 2803:
+    OP_DIV(r3, r6, r2);
+    break;
+case 2804:
+    OP_DIV(r3, r6, r3);
+    break;
+case 2805:
+    OP_DIV(r3, r6, r4);
+    break;
+case 2806:
+    OP_DIV(r3, r6, r5);
+    break;
+case 2807:
+    OP_DIV(r3, r6, r6);
+    break;
+case 2808:
+    OP_DIV(r3, r6, r7);
+    break;
+case 2809:
+    OP_DIV(r3, r7, r0);
+    break;
+case 2810:
+    OP_DIV(r3, r7, r1);
+    break;
+case 2811:
+    OP_DIV(r3, r7, r2);
+    break;
+case 2812:
+    OP_DIV(r3, r7, r3);
+    break;
+case 2813:
+    OP_DIV(r3, r7, r4);
+    break;
+case 2814:
+    OP_DIV(r3, r7, r5);
+    break;
+case 2815:
+    OP_DIV(r3, r7, r6);
+    break;
+case 2816:
+    OP_DIV(r3, r7, r7);
+    break;
+case 2817:
+    OP_DIV(r4, r0, r0);
+    break;
+case 2818:
+    OP_DIV(r4, r0, r1);
+    break;
+case 2819:
+    OP_DIV(r4, r0, r2);
+    break;
+case 2820:
+    OP_DIV(r4, r0, r3);
+    break;
+case 2821:
+    OP_DIV(r4, r0, r4);
+    break;
+case 2822:
+    OP_DIV(r4, r0, r5);
+    break;
+case 2823:
+    OP_DIV(r4, r0, r6);
+    break;
+case 2824:
+    OP_DIV(r4, r0, r7);
+    break;
+case 2825:
+    OP_DIV(r4, r1, r0);
+    break;
+case 2826:
+    OP_DIV(r4, r1, r1);
+    break;
+case 2827:
+    OP_DIV(r4, r1, r2);
+    break;
+case 2828:
+    OP_DIV(r4, r1, r3);
+    break;
+case 2829:
+    OP_DIV(r4, r1, r4);
+    break;
+case 2830:
+    OP_DIV(r4, r1, r5);
+    break;
+case 2831:
+    OP_DIV(r4, r1, r6);
+    break;
+case 2832:
+    OP_DIV(r4, r1, r7);
+    break;
+case 2833:
+    OP_DIV(r4, r2, r0);
+    break;
+case 2834:
+    OP_DIV(r4, r2, r1);
+    break;
+case 2835:
+    OP_DIV(r4, r2, r2);
+    break;
+case 2836:
+    OP_DIV(r4, r2, r3);
+    break;
+case 2837:
+    OP_DIV(r4, r2, r4);
+    break;
+case 2838:
+    OP_DIV(r4, r2, r5);
+    break;
+case 2839:
+    OP_DIV(r4, r2, r6);
+    break;
+case 2840:
+    OP_DIV(r4, r2, r7);
+    break;
+case 2841:
+    OP_DIV(r4, r3, r0);
+    break;
+case 2842:
+    OP_DIV(r4, r3, r1);
+    break;
+case 2843:
+    OP_DIV(r4, r3, r2);
+    break;
+case 2844:
+    OP_DIV(r4, r3, r3);
+    break;
+case 2845:
+    OP_DIV(r4, r3, r4);
+    break;
+case 2846:
+    OP_DIV(r4, r3, r5);
+    break;
+case 2847:
+    OP_DIV(r4, r3, r6);
+    break;
+case 2848:
+    OP_DIV(r4, r3, r7);
+    break;
+case 2849:
+    OP_DIV(r4, r4, r0);
+    break;
+case 2850:
+    OP_DIV(r4, r4, r1);
+    break;
+case 2851:
+    OP_DIV(r4, r4, r2);
+    break;
+case 2852:
+    OP_DIV(r4, r4, r3);
+    break;
+case 2853:
+    OP_DIV(r4, r4, r4);
+    break;
+case 2854:
+    OP_DIV(r4, r4, r5);
+    break;
+case 2855:
+    OP_DIV(r4, r4, r6);
+    break;
+case 2856:
+    OP_DIV(r4, r4, r7);
+    break;
+case 2857:
+    OP_DIV(r4, r5, r0);
+    break;
+case 2858:
+    OP_DIV(r4, r5, r1);
+    break;
+case 2859:
+    OP_DIV(r4, r5, r2);
+    break;
+case 2860:
+    OP_DIV(r4, r5, r3);
+    break;
+case 2861:
+    OP_DIV(r4, r5, r4);
+    break;
+case 2862:
+    OP_DIV(r4, r5, r5);
+    break;
+case 2863:
+    OP_DIV(r4, r5, r6);
+    break;
+case 2864:
+    OP_DIV(r4, r5, r7);
+    break;
+case 2865:
+    OP_DIV(r4, r6, r0);
+    break;
+case 2866:
+    OP_DIV(r4, r6, r1);
+    break;
+case 2867:
+    OP_DIV(r4, r6, r2);
+    break;
+case 2868:
+    OP_DIV(r4, r6, r3);
+    break;
+case 2869:
+    OP_DIV(r4, r6, r4);
+    break;
+case 2870:
+    OP_DIV(r4, r6, r5);
+    break;
+case 2871:
+    OP_DIV(r4, r6, r6);
+    break;
+case 2872:
+    OP_DIV(r4, r6, r7);
+    break;
+case 2873:
+    OP_DIV(r4, r7, r0);
+    break;
+case 2874:
+    OP_DIV(r4, r7, r1);
+    break;
+case 2875:
+    OP_DIV(r4, r7, r2);
+    break;
+case 2876:
+    OP_DIV(r4, r7, r3);
+    break;
+case 2877:
+    OP_DIV(r4, r7, r4);
+    break;
+case 2878:
+    OP_DIV(r4, r7, r5);
+    break;
+case 2879:
+    OP_DIV(r4, r7, r6);
+    break;
+case 2880:
+    OP_DIV(r4, r7, r7);
+    break;
+case 2881:
+    OP_DIV(r5, r0, r0);
+    break;
+case 2882:
+    OP_DIV(r5, r0, r1);
+    break;
+case 2883:
+    OP_DIV(r5, r0, r2);
+    break;
+case 2884:
+    OP_DIV(r5, r0, r3);
+    break;
+case 2885:
+    OP_DIV(r5, r0, r4);
+    break;
+case 2886:
+    OP_DIV(r5, r0, r5);
+    break;
+case 2887:
+    OP_DIV(r5, r0, r6);
+    break;
+case 2888:
+    OP_DIV(r5, r0, r7);
+    break;
+case 2889:
+    OP_DIV(r5, r1, r0);
+    break;
+case 2890:
+    OP_DIV(r5, r1, r1);
+    break;
+case 2891:
+    OP_DIV(r5, r1, r2);
+    break;
+case 2892:
+    OP_DIV(r5, r1, r3);
+    break;
+case 2893:
+    OP_DIV(r5, r1, r4);
+    break;
+case 2894:
+    OP_DIV(r5, r1, r5);
+    break;
+case 2895:
+    OP_DIV(r5, r1, r6);
+    break;
+case 2896:
+    OP_DIV(r5, r1, r7);
+    break;
+case 2897:
+    OP_DIV(r5, r2, r0);
+    break;
+case 2898:
+    OP_DIV(r5, r2, r1);
+    break;
+case 2899:
+    OP_DIV(r5, r2, r2);
+    break;
+case 2900:
+    OP_DIV(r5, r2, r3);
+    break;
+case 2901:
+    OP_DIV(r5, r2, r4);
+    break;
+case 2902:
+    OP_DIV(r5, r2, r5);
+    break;
+case 2903:
+    OP_DIV(r5, r2, r6);
+    break;
+case 2904:
+    OP_DIV(r5, r2, r7);
+    break;
+case 2905:
+    OP_DIV(r5, r3, r0);
+    break;
+case 2906:
+    OP_DIV(r5, r3, r1);
+    break;
+case 2907:
+    OP_DIV(r5, r3, r2);
+    break;
+case 2908:
+    OP_DIV(r5, r3, r3);
+    break;
+case 2909:
+    OP_DIV(r5, r3, r4);
+    break;
+case 2910:
+    OP_DIV(r5, r3, r5);
+    break;
+case 2911:
+    OP_DIV(r5, r3, r6);
+    break;
+case 2912:
+    OP_DIV(r5, r3, r7);
+    break;
+case 2913:
+    OP_DIV(r5, r4, r0);
+    break;
+case 2914:
+    OP_DIV(r5, r4, r1);
+    break;
+case 2915:
+    OP_DIV(r5, r4, r2);
+    break;
+case 2916:
+    OP_DIV(r5, r4, r3);
+    break;
+case 2917:
+    OP_DIV(r5, r4, r4);
+    break;
+case 2918:
+    OP_DIV(r5, r4, r5);
+    break;
+case 2919:
+    OP_DIV(r5, r4, r6);
+    break;
+case 2920:
+    OP_DIV(r5, r4, r7);
+    break;
+case 2921:
+    OP_DIV(r5, r5, r0);
+    break;
+case 2922:
+    OP_DIV(r5, r5, r1);
+    break;
+case 2923:
+    OP_DIV(r5, r5, r2);
+    break;
+case 2924:
+    OP_DIV(r5, r5, r3);
+    break;
+case 2925:
+    OP_DIV(r5, r5, r4);
+    break;
+case 2926:
+    OP_DIV(r5, r5, r5);
+    break;
+case 2927:
+    OP_DIV(r5, r5, r6);
+    break;
+case 2928:
+    OP_DIV(r5, r5, r7);
+    break;
+case 2929:
+    OP_DIV(r5, r6, r0);
+    break;
+case 2930:
+    OP_DIV(r5, r6, r1);
+    break;
+case 2931:
+    OP_DIV(r5, r6, r2);
+    break;
+case 2932:
+    OP_DIV(r5, r6, r3);
+    break;
+case 2933:
+    OP_DIV(r5, r6, r4);
+    break;
+case 2934:
+    OP_DIV(r5, r6, r5);
+    break;
+case 2935:
+    OP_DIV(r5, r6, r6);
+    break;
+case 2936:
+    OP_DIV(r5, r6, r7);
+    break;
+case 2937:
+    OP_DIV(r5, r7, r0);
+    break;
+case 2938:
+    OP_DIV(r5, r7, r1);
+    break;
+case 2939:
+    OP_DIV(r5, r7, r2);
+    break;
+case 2940:
+    OP_DIV(r5, r7, r3);
+    break;
+case 2941:
+    OP_DIV(r5, r7, r4);
+    break;
+case 2942:
+    OP_DIV(r5, r7, r5);
+    break;
+case 2943:
+    OP_DIV(r5, r7, r6);
+    break;
+case 2944:
+    OP_DIV(r5, r7, r7);
+    break;
+case 2945:
+    OP_DIV(r6, r0, r0);
+    break;
+case 2946:
+    OP_DIV(r6, r0, r1);
+    break;
+case 2947:
+    OP_DIV(r6, r0, r2);
+    break;
+case 2948:
+    OP_DIV(r6, r0, r3);
+    break;
+case 2949:
+    OP_DIV(r6, r0, r4);
+    break;
+case 2950:
+    OP_DIV(r6, r0, r5);
+    break;
+case 2951:
+    OP_DIV(r6, r0, r6);
+    break;
+case 2952:
+    OP_DIV(r6, r0, r7);
+    break;
+case 2953:
+    OP_DIV(r6, r1, r0);
+    break;
+case 2954:
+    OP_DIV(r6, r1, r1);
+    break;
+case 2955:
+    OP_DIV(r6, r1, r2);
+    break;
+case 2956:
+    OP_DIV(r6, r1, r3);
+    break;
+case 2957:
+    OP_DIV(r6, r1, r4);
+    break;
+case 2958:
+    OP_DIV(r6, r1, r5);
+    break;
+case 2959:
+    OP_DIV(r6, r1, r6);
+    break;
+case 2960:
+    OP_DIV(r6, r1, r7);
+    break;
+case 2961:
+    OP_DIV(r6, r2, r0);
+    break;
+case 2962:
+    OP_DIV(r6, r2, r1);
+    break;
+case 2963:
+    OP_DIV(r6, r2, r2);
+    break;
+case 2964:
+    OP_DIV(r6, r2, r3);
+    break;
+case 2965:
+    OP_DIV(r6, r2, r4);
+    break;
+case 2966:
+    OP_DIV(r6, r2, r5);
+    break;
+case 2967:
+    OP_DIV(r6, r2, r6);
+    break;
+case 2968:
+    OP_DIV(r6, r2, r7);
+    break;
+case 2969:
+    OP_DIV(r6, r3, r0);
+    break;
+case 2970:
+    OP_DIV(r6, r3, r1);
+    break;
+case 2971:
+    OP_DIV(r6, r3, r2);
+    break;
+case 2972:
+    OP_DIV(r6, r3, r3);
+    break;
+case 2973:
+    OP_DIV(r6, r3, r4);
+    break;
+case 2974:
+    OP_DIV(r6, r3, r5);
+    break;
+case 2975:
+    OP_DIV(r6, r3, r6);
+    break;
+case 2976:
+    OP_DIV(r6, r3, r7);
+    break;
+case 2977:
+    OP_DIV(r6, r4, r0);
+    break;
+case 2978:
+    OP_DIV(r6, r4, r1);
+    break;
+case 2979:
+    OP_DIV(r6, r4, r2);
+    break;
+case 2980:
+    OP_DIV(r6, r4, r3);
+    break;
+case 2981:
+    OP_DIV(r6, r4, r4);
+    break;
+case 2982:
+    OP_DIV(r6, r4, r5);
+    break;
+case 2983:
+    OP_DIV(r6, r4, r6);
+    break;
+case 2984:
+    OP_DIV(r6, r4, r7);
+    break;
+case 2985:
+    OP_DIV(r6, r5, r0);
+    break;
+case 2986:
+    OP_DIV(r6, r5, r1);
+    break;
+case 2987:
+    OP_DIV(r6, r5, r2);
+    break;
+case 2988:
+    OP_DIV(r6, r5, r3);
+    break;
+case 2989:
+    OP_DIV(r6, r5, r4);
+    break;
+case 2990:
+    OP_DIV(r6, r5, r5);
+    break;
+case 2991:
+    OP_DIV(r6, r5, r6);
+    break;
+case 2992:
+    OP_DIV(r6, r5, r7);
+    break;
+case 2993:
+    OP_DIV(r6, r6, r0);
+    break;
+case 2994:
+    OP_DIV(r6, r6, r1);
+    break;
+case 2995:
+    OP_DIV(r6, r6, r2);
+    break;
+case 2996:
+    OP_DIV(r6, r6, r3);
+    break;
+case 2997:
+    OP_DIV(r6, r6, r4);
+    break;
+case 2998:
+    OP_DIV(r6, r6, r5);
+    break;
+case 2999:
+    OP_DIV(r6, r6, r6);
+    break;
+case 3000:
+    OP_DIV(r6, r6, r7);
+    break;
+case 3001:
+    OP_DIV(r6, r7, r0);
+    break;
+case 3002:
+    OP_DIV(r6, r7, r1);
+    break;
+case 3003:
+    OP_DIV(r6, r7, r2);
+    break;
+case 3004:
+    OP_DIV(r6, r7, r3);
+    break;
+case 3005:
+    OP_DIV(r6, r7, r4);
+    break;
+case 3006:
+    OP_DIV(r6, r7, r5);
+    break;
+case 3007:
+    OP_DIV(r6, r7, r6);
+    break;
+case 3008:
+    OP_DIV(r6, r7, r7);
+    break;
+case 3009:
+    OP_DIV(r7, r0, r0);
+    break;
+case 3010:
+    OP_DIV(r7, r0, r1);
+    break;
+case 3011:
+    OP_DIV(r7, r0, r2);
+    break;
+case 3012:
+    OP_DIV(r7, r0, r3);
+    break;
+case 3013:
+    OP_DIV(r7, r0, r4);
+    break;
+case 3014:
+    OP_DIV(r7, r0, r5);
+    break;
+case 3015:
+    OP_DIV(r7, r0, r6);
+    break;
+case 3016:
+    OP_DIV(r7, r0, r7);
+    break;
+case 3017:
+    OP_DIV(r7, r1, r0);
+    break;
+case 3018:
+    OP_DIV(r7, r1, r1);
+    break;
+case 3019:
+    OP_DIV(r7, r1, r2);
+    break;
+case 3020:
+    OP_DIV(r7, r1, r3);
+    break;
+case 3021:
+    OP_DIV(r7, r1, r4);
+    break;
+case 3022:
+    OP_DIV(r7, r1, r5);
+    break;
+case 3023:
+    OP_DIV(r7, r1, r6);
+    break;
+case 3024:
+    OP_DIV(r7, r1, r7);
+    break;
+case 3025:
+    OP_DIV(r7, r2, r0);
+    break;
+case 3026:
+    OP_DIV(r7, r2, r1);
+    break;
+case 3027:
+    OP_DIV(r7, r2, r2);
+    break;
+case 3028:
+    OP_DIV(r7, r2, r3);
+    break;
+case 3029:
+    OP_DIV(r7, r2, r4);
+    break;
+case 3030:
+    OP_DIV(r7, r2, r5);
+    break;
+case 3031:
+    OP_DIV(r7, r2, r6);
+    break;
+case 3032:
+    OP_DIV(r7, r2, r7);
+    break;
+case 3033:
+    OP_DIV(r7, r3, r0);
+    break;
+case 3034:
+    OP_DIV(r7, r3, r1);
+    break;
+case 3035:
+    OP_DIV(r7, r3, r2);
+    break;
+case 3036:
+    OP_DIV(r7, r3, r3);
+    break;
+case 3037:
+    OP_DIV(r7, r3, r4);
+    break;
+case 3038:
+    OP_DIV(r7, r3, r5);
+    break;
+case 3039:
+    OP_DIV(r7, r3, r6);
+    break;
+case 3040:
+    OP_DIV(r7, r3, r7);
+    break;
+case 3041:
+    OP_DIV(r7, r4, r0);
+    break;
+case 3042:
+    OP_DIV(r7, r4, r1);
+    break;
+case 3043:
+    OP_DIV(r7, r4, r2);
+    break;
+case 3044:
+    OP_DIV(r7, r4, r3);
+    break;
+case 3045:
+    OP_DIV(r7, r4, r4);
+    break;
+case 3046:
+    OP_DIV(r7, r4, r5);
+    break;
+case 3047:
+    OP_DIV(r7, r4, r6);
+    break;
+case 3048:
+    OP_DIV(r7, r4, r7);
+    break;
+case 3049:
+    OP_DIV(r7, r5, r0);
+    break;
+case 3050:
+    OP_DIV(r7, r5, r1);
+    break;
+case 3051:
+    OP_DIV(r7, r5, r2);
+    break;
+case 3052:
+    OP_DIV(r7, r5, r3);
+    break;
+case 3053:
+    OP_DIV(r7, r5, r4);
+    break;
+case 3054:
+    OP_DIV(r7, r5, r5);
+    break;
+case 3055:
+    OP_DIV(r7, r5, r6);
+    break;
+case 3056:
+    OP_DIV(r7, r5, r7);
+    break;
+case 3057:
+    OP_DIV(r7, r6, r0);
+    break;
+case 3058:
+    OP_DIV(r7, r6, r1);
+    break;
+case 3059:
+    OP_DIV(r7, r6, r2);
+    break;
+case 3060:
+    OP_DIV(r7, r6, r3);
+    break;
+case 3061:
+    OP_DIV(r7, r6, r4);
+    break;
+case 3062:
+    OP_DIV(r7, r6, r5);
+    break;
+case 3063:
+    OP_DIV(r7, r6, r6);
+    break;
+case 3064:
+    OP_DIV(r7, r6, r7);
+    break;
+case 3065:
+    OP_DIV(r7, r7, r0);
+    break;
+case 3066:
+    OP_DIV(r7, r7, r1);
+    break;
+case 3067:
+    OP_DIV(r7, r7, r2);
+    break;
+case 3068:
+    OP_DIV(r7, r7, r3);
+    break;
+case 3069:
+    OP_DIV(r7, r7, r4);
+    break;
+case 3070:
+    OP_DIV(r7, r7, r5);
+    break;
+case 3071:
+    OP_DIV(r7, r7, r6);
+    break;
+case 3072:
+    OP_DIV(r7, r7, r7);
+    break;
+case 3073:
+    OP_NAND(r0, r0, r0);
+    break;
+case 3074:
+    OP_NAND(r0, r0, r1);
+    break;
+case 3075:
+    OP_NAND(r0, r0, r2);
+    break;
+case 3076:
+    OP_NAND(r0, r0, r3);
+    break;
+case 3077:
+    OP_NAND(r0, r0, r4);
+    break;
+case 3078:
+    OP_NAND(r0, r0, r5);
+    break;
+case 3079:
+    OP_NAND(r0, r0, r6);
+    break;
+case 3080:
+    OP_NAND(r0, r0, r7);
+    break;
+case 3081:
+    OP_NAND(r0, r1, r0);
+    break;
+case 3082:
+    OP_NAND(r0, r1, r1);
+    break;
+case 3083:
+    OP_NAND(r0, r1, r2);
+    break;
+case 3084:
+    OP_NAND(r0, r1, r3);
+    break;
+case 3085:
+    OP_NAND(r0, r1, r4);
+    break;
+case 3086:
+    OP_NAND(r0, r1, r5);
+    break;
+case 3087:
+    OP_NAND(r0, r1, r6);
+    break;
+case 3088:
+    OP_NAND(r0, r1, r7);
+    break;
+case 3089:
+    OP_NAND(r0, r2, r0);
+    break;
+case 3090:
+    OP_NAND(r0, r2, r1);
+    break;
+case 3091:
+    OP_NAND(r0, r2, r2);
+    break;
+case 3092:
+    OP_NAND(r0, r2, r3);
+    break;
+case 3093:
+    OP_NAND(r0, r2, r4);
+    break;
+case 3094:
+    OP_NAND(r0, r2, r5);
+    break;
+case 3095:
+    OP_NAND(r0, r2, r6);
+    break;
+case 3096:
+    OP_NAND(r0, r2, r7);
+    break;
+case 3097:
+    OP_NAND(r0, r3, r0);
+    break;
+case 3098:
+    OP_NAND(r0, r3, r1);
+    break;
+case 3099:
+    OP_NAND(r0, r3, r2);
+    break;
+case 3100:
+    OP_NAND(r0, r3, r3);
+    break;
+case 3101:
+    OP_NAND(r0, r3, r4);
+    break;
+case 3102:
+    OP_NAND(r0, r3, r5);
+    break;
+case 3103:
+    OP_NAND(r0, r3, r6);
+    break;
+case 3104:
+    OP_NAND(r0, r3, r7);
+    break;
+case 3105:
+    OP_NAND(r0, r4, r0);
+    break;
+case 3106:
+    OP_NAND(r0, r4, r1);
+    break;
+case 3107:
+    OP_NAND(r0, r4, r2);
+    break;
+case 3108:
+    OP_NAND(r0, r4, r3);
+    break;
+case 3109:
+    OP_NAND(r0, r4, r4);
+    break;
+case 3110:
+    OP_NAND(r0, r4, r5);
+    break;
+case 3111:
+    OP_NAND(r0, r4, r6);
+    break;
+case 3112:
+    OP_NAND(r0, r4, r7);
+    break;
+case 3113:
+    OP_NAND(r0, r5, r0);
+    break;
+case 3114:
+    OP_NAND(r0, r5, r1);
+    break;
+case 3115:
+    OP_NAND(r0, r5, r2);
+    break;
+case 3116:
+    OP_NAND(r0, r5, r3);
+    break;
+case 3117:
+    OP_NAND(r0, r5, r4);
+    break;
+case 3118:
+    OP_NAND(r0, r5, r5);
+    break;
+case 3119:
+    OP_NAND(r0, r5, r6);
+    break;
+case 3120:
+    OP_NAND(r0, r5, r7);
+    break;
+case 3121:
+    OP_NAND(r0, r6, r0);
+    break;
+case 3122:
+    OP_NAND(r0, r6, r1);
+    break;
+case 3123:
+    OP_NAND(r0, r6, r2);
+    break;
+case 3124:
+    OP_NAND(r0, r6, r3);
+    break;
+case 3125:
+    OP_NAND(r0, r6, r4);
+    break;
+case 3126:
+    OP_NAND(r0, r6, r5);
+    break;
+case 3127:
+    OP_NAND(r0, r6, r6);
+    break;
+case 3128:
+    OP_NAND(r0, r6, r7);
+    break;
+case 3129:
+    OP_NAND(r0, r7, r0);
+    break;
+case 3130:
+    OP_NAND(r0, r7, r1);
+    break;
+case 3131:
+    OP_NAND(r0, r7, r2);
+    break;
+case 3132:
+    OP_NAND(r0, r7, r3);
+    break;
+case 3133:
+    OP_NAND(r0, r7, r4);
+    break;
+case 3134:
+    OP_NAND(r0, r7, r5);
+    break;
+case 3135:
+    OP_NAND(r0, r7, r6);
+    break;
+case 3136:
+    OP_NAND(r0, r7, r7);
+    break;
+case 3137:
+    OP_NAND(r1, r0, r0);
+    break;
+case 3138:
+    OP_NAND(r1, r0, r1);
+    break;
+case 3139:
+    OP_NAND(r1, r0, r2);
+    break;
+case 3140:
+    OP_NAND(r1, r0, r3);
+    break;
+case 3141:
+    OP_NAND(r1, r0, r4);
+    break;
+case 3142:
+    OP_NAND(r1, r0, r5);
+    break;
+case 3143:
+    OP_NAND(r1, r0, r6);
+    break;
+case 3144:
+    OP_NAND(r1, r0, r7);
+    break;
+case 3145:
+    OP_NAND(r1, r1, r0);
+    break;
+case 3146:
+    OP_NAND(r1, r1, r1);
+    break;
+case 3147:
+    OP_NAND(r1, r1, r2);
+    break;
+case 3148:
+    OP_NAND(r1, r1, r3);
+    break;
+case 3149:
+    OP_NAND(r1, r1, r4);
+    break;
+case 3150:
+    OP_NAND(r1, r1, r5);
+    break;
+case 3151:
+    OP_NAND(r1, r1, r6);
+    break;
+case 3152:
+    OP_NAND(r1, r1, r7);
+    break;
+case 3153:
+    OP_NAND(r1, r2, r0);
+    break;
+case 3154:
+    OP_NAND(r1, r2, r1);
+    break;
+case 3155:
+    OP_NAND(r1, r2, r2);
+    break;
+case 3156:
+    OP_NAND(r1, r2, r3);
+    break;
+case 3157:
+    OP_NAND(r1, r2, r4);
+    break;
+case 3158:
+    OP_NAND(r1, r2, r5);
+    break;
+case 3159:
+    OP_NAND(r1, r2, r6);
+    break;
+case 3160:
+    OP_NAND(r1, r2, r7);
+    break;
+case 3161:
+    OP_NAND(r1, r3, r0);
+    break;
+case 3162:
+    OP_NAND(r1, r3, r1);
+    break;
+case 3163:
+    OP_NAND(r1, r3, r2);
+    break;
+case 3164:
+    OP_NAND(r1, r3, r3);
+    break;
+case 3165:
+    OP_NAND(r1, r3, r4);
+    break;
+case 3166:
+    OP_NAND(r1, r3, r5);
+    break;
+case 3167:
+    OP_NAND(r1, r3, r6);
+    break;
+case 3168:
+    OP_NAND(r1, r3, r7);
+    break;
+case 3169:
+    OP_NAND(r1, r4, r0);
+    break;
+case 3170:
+    OP_NAND(r1, r4, r1);
+    break;
+case 3171:
+    OP_NAND(r1, r4, r2);
+    break;
+case 3172:
+    OP_NAND(r1, r4, r3);
+    break;
+case 3173:
+    OP_NAND(r1, r4, r4);
+    break;
+case 3174:
+    OP_NAND(r1, r4, r5);
+    break;
+case 3175:
+    OP_NAND(r1, r4, r6);
+    break;
+case 3176:
+    OP_NAND(r1, r4, r7);
+    break;
+case 3177:
+    OP_NAND(r1, r5, r0);
+    break;
+case 3178:
+    OP_NAND(r1, r5, r1);
+    break;
+case 3179:
+    OP_NAND(r1, r5, r2);
+    break;
+case 3180:
+    OP_NAND(r1, r5, r3);
+    break;
+case 3181:
+    OP_NAND(r1, r5, r4);
+    break;
+case 3182:
+    OP_NAND(r1, r5, r5);
+    break;
+case 3183:
+    OP_NAND(r1, r5, r6);
+    break;
+case 3184:
+    OP_NAND(r1, r5, r7);
+    break;
+case 3185:
+    OP_NAND(r1, r6, r0);
+    break;
+case 3186:
+    OP_NAND(r1, r6, r1);
+    break;
+case 3187:
+    OP_NAND(r1, r6, r2);
+    break;
+case 3188:
+    OP_NAND(r1, r6, r3);
+    break;
+case 3189:
+    OP_NAND(r1, r6, r4);
+    break;
+case 3190:
+    OP_NAND(r1, r6, r5);
+    break;
+case 3191:
+    OP_NAND(r1, r6, r6);
+    break;
+case 3192:
+    OP_NAND(r1, r6, r7);
+    break;
+case 3193:
+    OP_NAND(r1, r7, r0);
+    break;
+case 3194:
+    OP_NAND(r1, r7, r1);
+    break;
+case 3195:
+    OP_NAND(r1, r7, r2);
+    break;
+case 3196:
+    OP_NAND(r1, r7, r3);
+    break;
+case 3197:
+    OP_NAND(r1, r7, r4);
+    break;
+case 3198:
+    OP_NAND(r1, r7, r5);
+    break;
+case 3199:
+    OP_NAND(r1, r7, r6);
+    break;
+case 3200:
+    OP_NAND(r1, r7, r7);
+    break;
+case 3201:
+    OP_NAND(r2, r0, r0);
+    break;
+case 3202:
+    OP_NAND(r2, r0, r1);
+    break;
+case 3203:
+    OP_NAND(r2, r0, r2);
+    break;
+case 3204:
+    OP_NAND(r2, r0, r3);
+    break;
+case 3205:
+    OP_NAND(r2, r0, r4);
+    break;
+case 3206:
+    OP_NAND(r2, r0, r5);
+    break;
+case 3207:
+    OP_NAND(r2, r0, r6);
+    break;
+case 3208:
+    OP_NAND(r2, r0, r7);
+    break;
+case 3209:
+    OP_NAND(r2, r1, r0);
+    break;
+case 3210:
+    OP_NAND(r2, r1, r1);
+    break;
+case 3211:
+    OP_NAND(r2, r1, r2);
+    break;
+case 3212:
+    OP_NAND(r2, r1, r3);
+    break;
+case 3213:
+    OP_NAND(r2, r1, r4);
+    break;
+case 3214:
+    OP_NAND(r2, r1, r5);
+    break;
+case 3215:
+    OP_NAND(r2, r1, r6);
+    break;
+case 3216:
+    OP_NAND(r2, r1, r7);
+    break;
+case 3217:
+    OP_NAND(r2, r2, r0);
+    break;
+case 3218:
+    OP_NAND(r2, r2, r1);
+    break;
+case 3219:
+    OP_NAND(r2, r2, r2);
+    break;
+case 3220:
+    OP_NAND(r2, r2, r3);
+    break;
+case 3221:
+    OP_NAND(r2, r2, r4);
+    break;
+case 3222:
+    OP_NAND(r2, r2, r5);
+    break;
+case 3223:
+    OP_NAND(r2, r2, r6);
+    break;
+case 3224:
+    OP_NAND(r2, r2, r7);
+    break;
+case 3225:
+    OP_NAND(r2, r3, r0);
+    break;
+case 3226:
+    OP_NAND(r2, r3, r1);
+    break;
+case 3227:
+    OP_NAND(r2, r3, r2);
+    break;
+case 3228:
+    OP_NAND(r2, r3, r3);
+    break;
+case 3229:
+    OP_NAND(r2, r3, r4);
+    break;
+case 3230:
+    OP_NAND(r2, r3, r5);
+    break;
+case 3231:
+    OP_NAND(r2, r3, r6);
+    break;
+case 3232:
+    OP_NAND(r2, r3, r7);
+    break;
+case 3233:
+    OP_NAND(r2, r4, r0);
+    break;
+case 3234:
+    OP_NAND(r2, r4, r1);
+    break;
+case 3235:
+    OP_NAND(r2, r4, r2);
+    break;
+case 3236:
+    OP_NAND(r2, r4, r3);
+    break;
+case 3237:
+    OP_NAND(r2, r4, r4);
+    break;
+case 3238:
+    OP_NAND(r2, r4, r5);
+    break;
+case 3239:
+    OP_NAND(r2, r4, r6);
+    break;
+case 3240:
+    OP_NAND(r2, r4, r7);
+    break;
+case 3241:
+    OP_NAND(r2, r5, r0);
+    break;
+case 3242:
+    OP_NAND(r2, r5, r1);
+    break;
+case 3243:
+    OP_NAND(r2, r5, r2);
+    break;
+case 3244:
+    OP_NAND(r2, r5, r3);
+    break;
+case 3245:
+    OP_NAND(r2, r5, r4);
+    break;
+case 3246:
+    OP_NAND(r2, r5, r5);
+    break;
+case 3247:
+    OP_NAND(r2, r5, r6);
+    break;
+case 3248:
+    OP_NAND(r2, r5, r7);
+    break;
+case 3249:
+    OP_NAND(r2, r6, r0);
+    break;
+case 3250:
+    OP_NAND(r2, r6, r1);
+    break;
+case 3251:
+    OP_NAND(r2, r6, r2);
+    break;
+case 3252:
+    OP_NAND(r2, r6, r3);
+    break;
+case 3253:
+    OP_NAND(r2, r6, r4);
+    break;
+case 3254:
+    OP_NAND(r2, r6, r5);
+    break;
+case 3255:
+    OP_NAND(r2, r6, r6);
+    break;
+case 3256:
+    OP_NAND(r2, r6, r7);
+    break;
+case 3257:
+    OP_NAND(r2, r7, r0);
+    break;
+case 3258:
+    OP_NAND(r2, r7, r1);
+    break;
+case 3259:
+    OP_NAND(r2, r7, r2);
+    break;
+case 3260:
+    OP_NAND(r2, r7, r3);
+    break;
+case 3261:
+    OP_NAND(r2, r7, r4);
+    break;
+case 3262:
+    OP_NAND(r2, r7, r5);
+    break;
+case 3263:
+    OP_NAND(r2, r7, r6);
+    break;
+case 3264:
+    OP_NAND(r2, r7, r7);
+    break;
+case 3265:
+    OP_NAND(r3, r0, r0);
+    break;
+case 3266:
+    OP_NAND(r3, r0, r1);
+    break;
+case 3267:
+    OP_NAND(r3, r0, r2);
+    break;
+case 3268:
+    OP_NAND(r3, r0, r3);
+    break;
+case 3269:
+    OP_NAND(r3, r0, r4);
+    break;
+case 3270:
+    OP_NAND(r3, r0, r5);
+    break;
+case 3271:
+    OP_NAND(r3, r0, r6);
+    break;
+case 3272:
+    OP_NAND(r3, r0, r7);
+    break;
+case 3273:
+    OP_NAND(r3, r1, r0);
+    break;
+case 3274:
+    OP_NAND(r3, r1, r1);
+    break;
+case 3275:
+    OP_NAND(r3, r1, r2);
+    break;
+case 3276:
+    OP_NAND(r3, r1, r3);
+    break;
+case 3277:
+    OP_NAND(r3, r1, r4);
+    break;
+case 3278:
+    OP_NAND(r3, r1, r5);
+    break;
+case 3279:
+    OP_NAND(r3, r1, r6);
+    break;
+case 3280:
+    OP_NAND(r3, r1, r7);
+    break;
+case 3281:
+    OP_NAND(r3, r2, r0);
+    break;
+case 3282:
+    OP_NAND(r3, r2, r1);
+    break;
+case 3283:
+    OP_NAND(r3, r2, r2);
+    break;
+case 3284:
+    OP_NAND(r3, r2, r3);
+    break;
+case 3285:
+    OP_NAND(r3, r2, r4);
+    break;
+case 3286:
+    OP_NAND(r3, r2, r5);
+    break;
+case 3287:
+    OP_NAND(r3, r2, r6);
+    break;
+case 3288:
+    OP_NAND(r3, r2, r7);
+    break;
+case 3289:
+    OP_NAND(r3, r3, r0);
+    break;
+case 3290:
+    OP_NAND(r3, r3, r1);
+    break;
+case 3291:
+    OP_NAND(r3, r3, r2);
+    break;
+case 3292:
+    OP_NAND(r3, r3, r3);
+    break;
+case 3293:
+    OP_NAND(r3, r3, r4);
+    break;
+case 3294:
+    OP_NAND(r3, r3, r5);
+    break;
+case 3295:
+    OP_NAND(r3, r3, r6);
+    break;
+case 3296:
+    OP_NAND(r3, r3, r7);
+    break;
+case 3297:
+    OP_NAND(r3, r4, r0);
+    break;
+case 3298:
+    OP_NAND(r3, r4, r1);
+    break;
+case 3299:
+    OP_NAND(r3, r4, r2);
+    break;
+case 3300:
+    OP_NAND(r3, r4, r3);
+    break;
+case 3301:
+    OP_NAND(r3, r4, r4);
+    break;
+case 3302:
+    OP_NAND(r3, r4, r5);
+    break;
+case 3303:
+    OP_NAND(r3, r4, r6);
+    break;
+case 3304:
+    OP_NAND(r3, r4, r7);
+    break;
+case 3305:
+    OP_NAND(r3, r5, r0);
+    break;
+case 3306:
+    OP_NAND(r3, r5, r1);
+    break;
+case 3307:
+    OP_NAND(r3, r5, r2);
+    break;
+case 3308:
+    OP_NAND(r3, r5, r3);
+    break;
+case 3309:
+    OP_NAND(r3, r5, r4);
+    break;
+case 3310:
+    OP_NAND(r3, r5, r5);
+    break;
+case 3311:
+    OP_NAND(r3, r5, r6);
+    break;
+case 3312:
+    OP_NAND(r3, r5, r7);
+    break;
+case 3313:
+    OP_NAND(r3, r6, r0);
+    break;
+case 3314:
+    OP_NAND(r3, r6, r1);
+    break;
+case 3315:
+    OP_NAND(r3, r6, r2);
+    break;
+case 3316:
+    OP_NAND(r3, r6, r3);
+    break;
+case 3317:
+    OP_NAND(r3, r6, r4);
+    break;
+case 3318:
+    OP_NAND(r3, r6, r5);
+    break;
+case 3319:
+    OP_NAND(r3, r6, r6);
+    break;
+case 3320:
+    OP_NAND(r3, r6, r7);
+    break;
+case 3321:
+    OP_NAND(r3, r7, r0);
+    break;
+case 3322:
+    OP_NAND(r3, r7, r1);
+    break;
+case 3323:
+    OP_NAND(r3, r7, r2);
+    break;
+case 3324:
+    OP_NAND(r3, r7, r3);
+    break;
+case 3325:
+    OP_NAND(r3, r7, r4);
+    break;
+case 3326:
+    OP_NAND(r3, r7, r5);
+    break;
+case 3327:
+    OP_NAND(r3, r7, r6);
+    break;
+case 3328:
+    OP_NAND(r3, r7, r7);
+    break;
+case 3329:
+    OP_NAND(r4, r0, r0);
+    break;
+case 3330:
+    OP_NAND(r4, r0, r1);
+    break;
+case 3331:
+    OP_NAND(r4, r0, r2);
+    break;
+case 3332:
+    OP_NAND(r4, r0, r3);
+    break;
+case 3333:
+    OP_NAND(r4, r0, r4);
+    break;
+case 3334:
+    OP_NAND(r4, r0, r5);
+    break;
+case 3335:
+    OP_NAND(r4, r0, r6);
+    break;
+case 3336:
+    OP_NAND(r4, r0, r7);
+    break;
+case 3337:
+    OP_NAND(r4, r1, r0);
+    break;
+case 3338:
+    OP_NAND(r4, r1, r1);
+    break;
+case 3339:
+    OP_NAND(r4, r1, r2);
+    break;
+case 3340:
+    OP_NAND(r4, r1, r3);
+    break;
+case 3341:
+    OP_NAND(r4, r1, r4);
+    break;
+case 3342:
+    OP_NAND(r4, r1, r5);
+    break;
+case 3343:
+    OP_NAND(r4, r1, r6);
+    break;
+case 3344:
+    OP_NAND(r4, r1, r7);
+    break;
+case 3345:
+    OP_NAND(r4, r2, r0);
+    break;
+case 3346:
+    OP_NAND(r4, r2, r1);
+    break;
+case 3347:
+    OP_NAND(r4, r2, r2);
+    break;
+case 3348:
+    OP_NAND(r4, r2, r3);
+    break;
+case 3349:
+    OP_NAND(r4, r2, r4);
+    break;
+case 3350:
+    OP_NAND(r4, r2, r5);
+    break;
+case 3351:
+    OP_NAND(r4, r2, r6);
+    break;
+case 3352:
+    OP_NAND(r4, r2, r7);
+    break;
+case 3353:
+    OP_NAND(r4, r3, r0);
+    break;
+case 3354:
+    OP_NAND(r4, r3, r1);
+    break;
+case 3355:
+    OP_NAND(r4, r3, r2);
+    break;
+case 3356:
+    OP_NAND(r4, r3, r3);
+    break;
+case 3357:
+    OP_NAND(r4, r3, r4);
+    break;
+case 3358:
+    OP_NAND(r4, r3, r5);
+    break;
+case 3359:
+    OP_NAND(r4, r3, r6);
+    break;
+case 3360:
+    OP_NAND(r4, r3, r7);
+    break;
+case 3361:
+    OP_NAND(r4, r4, r0);
+    break;
+case 3362:
+    OP_NAND(r4, r4, r1);
+    break;
+case 3363:
+    OP_NAND(r4, r4, r2);
+    break;
+case 3364:
+    OP_NAND(r4, r4, r3);
+    break;
+case 3365:
+    OP_NAND(r4, r4, r4);
+    break;
+case 3366:
+    OP_NAND(r4, r4, r5);
+    break;
+case 3367:
+    OP_NAND(r4, r4, r6);
+    break;
+case 3368:
+    OP_NAND(r4, r4, r7);
+    break;
+case 3369:
+    OP_NAND(r4, r5, r0);
+    break;
+case 3370:
+    OP_NAND(r4, r5, r1);
+    break;
+case 3371:
+    OP_NAND(r4, r5, r2);
+    break;
+case 3372:
+    OP_NAND(r4, r5, r3);
+    break;
+case 3373:
+    OP_NAND(r4, r5, r4);
+    break;
+case 3374:
+    OP_NAND(r4, r5, r5);
+    break;
+case 3375:
+    OP_NAND(r4, r5, r6);
+    break;
+case 3376:
+    OP_NAND(r4, r5, r7);
+    break;
+case 3377:
+    OP_NAND(r4, r6, r0);
+    break;
+case 3378:
+    OP_NAND(r4, r6, r1);
+    break;
+case 3379:
+    OP_NAND(r4, r6, r2);
+    break;
+case 3380:
+    OP_NAND(r4, r6, r3);
+    break;
+case 3381:
+    OP_NAND(r4, r6, r4);
+    break;
+case 3382:
+    OP_NAND(r4, r6, r5);
+    break;
+case 3383:
+    OP_NAND(r4, r6, r6);
+    break;
+case 3384:
+    OP_NAND(r4, r6, r7);
+    break;
+case 3385:
+    OP_NAND(r4, r7, r0);
+    break;
+case 3386:
+    OP_NAND(r4, r7, r1);
+    break;
+case 3387:
+    OP_NAND(r4, r7, r2);
+    break;
+case 3388:
+    OP_NAND(r4, r7, r3);
+    break;
+case 3389:
+    OP_NAND(r4, r7, r4);
+    break;
+case 3390:
+    OP_NAND(r4, r7, r5);
+    break;
+case 3391:
+    OP_NAND(r4, r7, r6);
+    break;
+case 3392:
+    OP_NAND(r4, r7, r7);
+    break;
+case 3393:
+    OP_NAND(r5, r0, r0);
+    break;
+case 3394:
+    OP_NAND(r5, r0, r1);
+    break;
+case 3395:
+    OP_NAND(r5, r0, r2);
+    break;
+case 3396:
+    OP_NAND(r5, r0, r3);
+    break;
+case 3397:
+    OP_NAND(r5, r0, r4);
+    break;
+case 3398:
+    OP_NAND(r5, r0, r5);
+    break;
+case 3399:
+    OP_NAND(r5, r0, r6);
+    break;
+case 3400:
+    OP_NAND(r5, r0, r7);
+    break;
+case 3401:
+    OP_NAND(r5, r1, r0);
+    break;
+case 3402:
+    OP_NAND(r5, r1, r1);
+    break;
+case 3403:
+    OP_NAND(r5, r1, r2);
+    break;
+case 3404:
+    OP_NAND(r5, r1, r3);
+    break;
+case 3405:
+    OP_NAND(r5, r1, r4);
+    break;
+case 3406:
+    OP_NAND(r5, r1, r5);
+    break;
+case 3407:
+    OP_NAND(r5, r1, r6);
+    break;
+case 3408:
+    OP_NAND(r5, r1, r7);
+    break;
+case 3409:
+    OP_NAND(r5, r2, r0);
+    break;
+case 3410:
+    OP_NAND(r5, r2, r1);
+    break;
+case 3411:
+    OP_NAND(r5, r2, r2);
+    break;
+case 3412:
+    OP_NAND(r5, r2, r3);
+    break;
+case 3413:
+    OP_NAND(r5, r2, r4);
+    break;
+case 3414:
+    OP_NAND(r5, r2, r5);
+    break;
+case 3415:
+    OP_NAND(r5, r2, r6);
+    break;
+case 3416:
+    OP_NAND(r5, r2, r7);
+    break;
+case 3417:
+    OP_NAND(r5, r3, r0);
+    break;
+case 3418:
+    OP_NAND(r5, r3, r1);
+    break;
+case 3419:
+    OP_NAND(r5, r3, r2);
+    break;
+case 3420:
+    OP_NAND(r5, r3, r3);
+    break;
+case 3421:
+    OP_NAND(r5, r3, r4);
+    break;
+case 3422:
+    OP_NAND(r5, r3, r5);
+    break;
+case 3423:
+    OP_NAND(r5, r3, r6);
+    break;
+case 3424:
+    OP_NAND(r5, r3, r7);
+    break;
+case 3425:
+    OP_NAND(r5, r4, r0);
+    break;
+case 3426:
+    OP_NAND(r5, r4, r1);
+    break;
+case 3427:
+    OP_NAND(r5, r4, r2);
+    break;
+case 3428:
+    OP_NAND(r5, r4, r3);
+    break;
+case 3429:
+    OP_NAND(r5, r4, r4);
+    break;
+case 3430:
+    OP_NAND(r5, r4, r5);
+    break;
+case 3431:
+    OP_NAND(r5, r4, r6);
+    break;
+case 3432:
+    OP_NAND(r5, r4, r7);
+    break;
+case 3433:
+    OP_NAND(r5, r5, r0);
+    break;
+case 3434:
+    OP_NAND(r5, r5, r1);
+    break;
+case 3435:
+    OP_NAND(r5, r5, r2);
+    break;
+case 3436:
+    OP_NAND(r5, r5, r3);
+    break;
+case 3437:
+    OP_NAND(r5, r5, r4);
+    break;
+case 3438:
+    OP_NAND(r5, r5, r5);
+    break;
+case 3439:
+    OP_NAND(r5, r5, r6);
+    break;
+case 3440:
+    OP_NAND(r5, r5, r7);
+    break;
+case 3441:
+    OP_NAND(r5, r6, r0);
+    break;
+case 3442:
+    OP_NAND(r5, r6, r1);
+    break;
+case 3443:
+    OP_NAND(r5, r6, r2);
+    break;
+case 3444:
+    OP_NAND(r5, r6, r3);
+    break;
+case 3445:
+    OP_NAND(r5, r6, r4);
+    break;
+case 3446:
+    OP_NAND(r5, r6, r5);
+    break;
+case 3447:
+    OP_NAND(r5, r6, r6);
+    break;
+case 3448:
+    OP_NAND(r5, r6, r7);
+    break;
+case 3449:
+    OP_NAND(r5, r7, r0);
+    break;
+case 3450:
+    OP_NAND(r5, r7, r1);
+    break;
+case 3451:
+    OP_NAND(r5, r7, r2);
+    break;
+case 3452:
+    OP_NAND(r5, r7, r3);
+    break;
+case 3453:
+    OP_NAND(r5, r7, r4);
+    break;
+case 3454:
+    OP_NAND(r5, r7, r5);
+    break;
+case 3455:
+    OP_NAND(r5, r7, r6);
+    break;
+case 3456:
+    OP_NAND(r5, r7, r7);
+    break;
+case 3457:
+    OP_NAND(r6, r0, r0);
+    break;
+case 3458:
+    OP_NAND(r6, r0, r1);
+    break;
+case 3459:
+    OP_NAND(r6, r0, r2);
+    break;
+case 3460:
+    OP_NAND(r6, r0, r3);
+    break;
+case 3461:
+    OP_NAND(r6, r0, r4);
+    break;
+case 3462:
+    OP_NAND(r6, r0, r5);
+    break;
+case 3463:
+    OP_NAND(r6, r0, r6);
+    break;
+case 3464:
+    OP_NAND(r6, r0, r7);
+    break;
+case 3465:
+    OP_NAND(r6, r1, r0);
+    break;
+case 3466:
+    OP_NAND(r6, r1, r1);
+    break;
+case 3467:
+    OP_NAND(r6, r1, r2);
+    break;
+case 3468:
+    OP_NAND(r6, r1, r3);
+    break;
+case 3469:
+    OP_NAND(r6, r1, r4);
+    break;
+case 3470:
+    OP_NAND(r6, r1, r5);
+    break;
+case 3471:
+    OP_NAND(r6, r1, r6);
+    break;
+case 3472:
+    OP_NAND(r6, r1, r7);
+    break;
+case 3473:
+    OP_NAND(r6, r2, r0);
+    break;
+case 3474:
+    OP_NAND(r6, r2, r1);
+    break;
+case 3475:
+    OP_NAND(r6, r2, r2);
+    break;
+case 3476:
+    OP_NAND(r6, r2, r3);
+    break;
+case 3477:
+    OP_NAND(r6, r2, r4);
+    break;
+case 3478:
+    OP_NAND(r6, r2, r5);
+    break;
+case 3479:
+    OP_NAND(r6, r2, r6);
+    break;
+case 3480:
+    OP_NAND(r6, r2, r7);
+    break;
+case 3481:
+    OP_NAND(r6, r3, r0);
+    break;
+case 3482:
+    OP_NAND(r6, r3, r1);
+    break;
+case 3483:
+    OP_NAND(r6, r3, r2);
+    break;
+case 3484:
+    OP_NAND(r6, r3, r3);
+    break;
+case 3485:
+    OP_NAND(r6, r3, r4);
+    break;
+case 3486:
+    OP_NAND(r6, r3, r5);
+    break;
+case 3487:
+    OP_NAND(r6, r3, r6);
+    break;
+case 3488:
+    OP_NAND(r6, r3, r7);
+    break;
+case 3489:
+    OP_NAND(r6, r4, r0);
+    break;
+case 3490:
+    OP_NAND(r6, r4, r1);
+    break;
+case 3491:
+    OP_NAND(r6, r4, r2);
+    break;
+case 3492:
+    OP_NAND(r6, r4, r3);
+    break;
+case 3493:
+    OP_NAND(r6, r4, r4);
+    break;
+case 3494:
+    OP_NAND(r6, r4, r5);
+    break;
+case 3495:
+    OP_NAND(r6, r4, r6);
+    break;
+case 3496:
+    OP_NAND(r6, r4, r7);
+    break;
+case 3497:
+    OP_NAND(r6, r5, r0);
+    break;
+case 3498:
+    OP_NAND(r6, r5, r1);
+    break;
+case 3499:
+    OP_NAND(r6, r5, r2);
+    break;
+case 3500:
+    OP_NAND(r6, r5, r3);
+    break;
+case 3501:
+    OP_NAND(r6, r5, r4);
+    break;
+case 3502:
+    OP_NAND(r6, r5, r5);
+    break;
+case 3503:
+    OP_NAND(r6, r5, r6);
+    break;
+case 3504:
+    OP_NAND(r6, r5, r7);
+    break;
+case 3505:
+    OP_NAND(r6, r6, r0);
+    break;
+case 3506:
+    OP_NAND(r6, r6, r1);
+    break;
+case 3507:
+    OP_NAND(r6, r6, r2);
+    break;
+case 3508:
+    OP_NAND(r6, r6, r3);
+    break;
+case 3509:
+    OP_NAND(r6, r6, r4);
+    break;
+case 3510:
+    OP_NAND(r6, r6, r5);
+    break;
+case 3511:
+    OP_NAND(r6, r6, r6);
+    break;
+case 3512:
+    OP_NAND(r6, r6, r7);
+    break;
+case 3513:
+    OP_NAND(r6, r7, r0);
+    break;
+case 3514:
+    OP_NAND(r6, r7, r1);
+    break;
+case 3515:
+    OP_NAND(r6, r7, r2);
+    break;
+case 3516:
+    OP_NAND(r6, r7, r3);
+    break;
+case 3517:
+    OP_NAND(r6, r7, r4);
+    break;
+case 3518:
+    OP_NAND(r6, r7, r5);
+    break;
+case 3519:
+    OP_NAND(r6, r7, r6);
+    break;
+case 3520:
+    OP_NAND(r6, r7, r7);
+    break;
+case 3521:
+    OP_NAND(r7, r0, r0);
+    break;
+case 3522:
+    OP_NAND(r7, r0, r1);
+    break;
+case 3523:
+    OP_NAND(r7, r0, r2);
+    break;
+case 3524:
+    OP_NAND(r7, r0, r3);
+    break;
+case 3525:
+    OP_NAND(r7, r0, r4);
+    break;
+case 3526:
+    OP_NAND(r7, r0, r5);
+    break;
+case 3527:
+    OP_NAND(r7, r0, r6);
+    break;
+case 3528:
+    OP_NAND(r7, r0, r7);
+    break;
+case 3529:
+    OP_NAND(r7, r1, r0);
+    break;
+case 3530:
+    OP_NAND(r7, r1, r1);
+    break;
+case 3531:
+    OP_NAND(r7, r1, r2);
+    break;
+case 3532:
+    OP_NAND(r7, r1, r3);
+    break;
+case 3533:
+    OP_NAND(r7, r1, r4);
+    break;
+case 3534:
+    OP_NAND(r7, r1, r5);
+    break;
+case 3535:
+    OP_NAND(r7, r1, r6);
+    break;
+case 3536:
+    OP_NAND(r7, r1, r7);
+    break;
+case 3537:
+    OP_NAND(r7, r2, r0);
+    break;
+case 3538:
+    OP_NAND(r7, r2, r1);
+    break;
+case 3539:
+    OP_NAND(r7, r2, r2);
+    break;
+case 3540:
+    OP_NAND(r7, r2, r3);
+    break;
+case 3541:
+    OP_NAND(r7, r2, r4);
+    break;
+case 3542:
+    OP_NAND(r7, r2, r5);
+    break;
+case 3543:
+    OP_NAND(r7, r2, r6);
+    break;
+case 3544:
+    OP_NAND(r7, r2, r7);
+    break;
+case 3545:
+    OP_NAND(r7, r3, r0);
+    break;
+case 3546:
+    OP_NAND(r7, r3, r1);
+    break;
+case 3547:
+    OP_NAND(r7, r3, r2);
+    break;
+case 3548:
+    OP_NAND(r7, r3, r3);
+    break;
+case 3549:
+    OP_NAND(r7, r3, r4);
+    break;
+case 3550:
+    OP_NAND(r7, r3, r5);
+    break;
+case 3551:
+    OP_NAND(r7, r3, r6);
+    break;
+case 3552:
+    OP_NAND(r7, r3, r7);
+    break;
+case 3553:
+    OP_NAND(r7, r4, r0);
+    break;
+case 3554:
+    OP_NAND(r7, r4, r1);
+    break;
+case 3555:
+    OP_NAND(r7, r4, r2);
+    break;
+case 3556:
+    OP_NAND(r7, r4, r3);
+    break;
+case 3557:
+    OP_NAND(r7, r4, r4);
+    break;
+case 3558:
+    OP_NAND(r7, r4, r5);
+    break;
+case 3559:
+    OP_NAND(r7, r4, r6);
+    break;
+case 3560:
+    OP_NAND(r7, r4, r7);
+    break;
+case 3561:
+    OP_NAND(r7, r5, r0);
+    break;
+case 3562:
+    OP_NAND(r7, r5, r1);
+    break;
+case 3563:
+    OP_NAND(r7, r5, r2);
+    break;
+case 3564:
+    OP_NAND(r7, r5, r3);
+    break;
+case 3565:
+    OP_NAND(r7, r5, r4);
+    break;
+case 3566:
+    OP_NAND(r7, r5, r5);
+    break;
+case 3567:
+    OP_NAND(r7, r5, r6);
+    break;
+case 3568:
+    OP_NAND(r7, r5, r7);
+    break;
+case 3569:
+    OP_NAND(r7, r6, r0);
+    break;
+case 3570:
+    OP_NAND(r7, r6, r1);
+    break;
+case 3571:
+    OP_NAND(r7, r6, r2);
+    break;
+case 3572:
+    OP_NAND(r7, r6, r3);
+    break;
+case 3573:
+    OP_NAND(r7, r6, r4);
+    break;
+case 3574:
+    OP_NAND(r7, r6, r5);
+    break;
+case 3575:
+    OP_NAND(r7, r6, r6);
+    break;
+case 3576:
+    OP_NAND(r7, r6, r7);
+    break;
+case 3577:
+    OP_NAND(r7, r7, r0);
+    break;
+case 3578:
+    OP_NAND(r7, r7, r1);
+    break;
+case 3579:
+    OP_NAND(r7, r7, r2);
+    break;
+case 3580:
+    OP_NAND(r7, r7, r3);
+    break;
+case 3581:
+    OP_NAND(r7, r7, r4);
+    break;
+case 3582:
+    OP_NAND(r7, r7, r5);
+    break;
+case 3583:
+    OP_NAND(r7, r7, r6);
+    break;
+case 3584:
+    OP_NAND(r7, r7, r7);
+    break;
+case 3585:
+    DISPATCH_GENERIC(OP_HALT);
+    break;
+case 3586:
+    DISPATCH_GENERIC(OP_ACTIVATE);
+    break;
+case 3587:
+    DISPATCH_GENERIC(OP_INACTIVATE);
+    break;
+case 3588:
+    DISPATCH_GENERIC(OP_OUT);
+    break;
+case 3589:
+    DISPATCH_GENERIC(OP_IN);
+    break;
+case 3590:
+    OP_LOADP(r0, r0, r0);
+    break;
+case 3591:
+    OP_LOADP(r0, r0, r1);
+    break;
+case 3592:
+    OP_LOADP(r0, r0, r2);
+    break;
+case 3593:
+    OP_LOADP(r0, r0, r3);
+    break;
+case 3594:
+    OP_LOADP(r0, r0, r4);
+    break;
+case 3595:
+    OP_LOADP(r0, r0, r5);
+    break;
+case 3596:
+    OP_LOADP(r0, r0, r6);
+    break;
+case 3597:
+    OP_LOADP(r0, r0, r7);
+    break;
+case 3598:
+    OP_LOADP(r0, r1, r0);
+    break;
+case 3599:
+    OP_LOADP(r0, r1, r1);
+    break;
+case 3600:
+    OP_LOADP(r0, r1, r2);
+    break;
+case 3601:
+    OP_LOADP(r0, r1, r3);
+    break;
+case 3602:
+    OP_LOADP(r0, r1, r4);
+    break;
+case 3603:
+    OP_LOADP(r0, r1, r5);
+    break;
+case 3604:
+    OP_LOADP(r0, r1, r6);
+    break;
+case 3605:
+    OP_LOADP(r0, r1, r7);
+    break;
+case 3606:
+    OP_LOADP(r0, r2, r0);
+    break;
+case 3607:
+    OP_LOADP(r0, r2, r1);
+    break;
+case 3608:
+    OP_LOADP(r0, r2, r2);
+    break;
+case 3609:
+    OP_LOADP(r0, r2, r3);
+    break;
+case 3610:
+    OP_LOADP(r0, r2, r4);
+    break;
+case 3611:
+    OP_LOADP(r0, r2, r5);
+    break;
+case 3612:
+    OP_LOADP(r0, r2, r6);
+    break;
+case 3613:
+    OP_LOADP(r0, r2, r7);
+    break;
+case 3614:
+    OP_LOADP(r0, r3, r0);
+    break;
+case 3615:
+    OP_LOADP(r0, r3, r1);
+    break;
+case 3616:
+    OP_LOADP(r0, r3, r2);
+    break;
+case 3617:
+    OP_LOADP(r0, r3, r3);
+    break;
+case 3618:
+    OP_LOADP(r0, r3, r4);
+    break;
+case 3619:
+    OP_LOADP(r0, r3, r5);
+    break;
+case 3620:
+    OP_LOADP(r0, r3, r6);
+    break;
+case 3621:
+    OP_LOADP(r0, r3, r7);
+    break;
+case 3622:
+    OP_LOADP(r0, r4, r0);
+    break;
+case 3623:
+    OP_LOADP(r0, r4, r1);
+    break;
+case 3624:
+    OP_LOADP(r0, r4, r2);
+    break;
+case 3625:
+    OP_LOADP(r0, r4, r3);
+    break;
+case 3626:
+    OP_LOADP(r0, r4, r4);
+    break;
+case 3627:
+    OP_LOADP(r0, r4, r5);
+    break;
+case 3628:
+    OP_LOADP(r0, r4, r6);
+    break;
+case 3629:
+    OP_LOADP(r0, r4, r7);
+    break;
+case 3630:
+    OP_LOADP(r0, r5, r0);
+    break;
+case 3631:
+    OP_LOADP(r0, r5, r1);
+    break;
+case 3632:
+    OP_LOADP(r0, r5, r2);
+    break;
+case 3633:
+    OP_LOADP(r0, r5, r3);
+    break;
+case 3634:
+    OP_LOADP(r0, r5, r4);
+    break;
+case 3635:
+    OP_LOADP(r0, r5, r5);
+    break;
+case 3636:
+    OP_LOADP(r0, r5, r6);
+    break;
+case 3637:
+    OP_LOADP(r0, r5, r7);
+    break;
+case 3638:
+    OP_LOADP(r0, r6, r0);
+    break;
+case 3639:
+    OP_LOADP(r0, r6, r1);
+    break;
+case 3640:
+    OP_LOADP(r0, r6, r2);
+    break;
+case 3641:
+    OP_LOADP(r0, r6, r3);
+    break;
+case 3642:
+    OP_LOADP(r0, r6, r4);
+    break;
+case 3643:
+    OP_LOADP(r0, r6, r5);
+    break;
+case 3644:
+    OP_LOADP(r0, r6, r6);
+    break;
+case 3645:
+    OP_LOADP(r0, r6, r7);
+    break;
+case 3646:
+    OP_LOADP(r0, r7, r0);
+    break;
+case 3647:
+    OP_LOADP(r0, r7, r1);
+    break;
+case 3648:
+    OP_LOADP(r0, r7, r2);
+    break;
+case 3649:
+    OP_LOADP(r0, r7, r3);
+    break;
+case 3650:
+    OP_LOADP(r0, r7, r4);
+    break;
+case 3651:
+    OP_LOADP(r0, r7, r5);
+    break;
+case 3652:
+    OP_LOADP(r0, r7, r6);
+    break;
+case 3653:
+    OP_LOADP(r0, r7, r7);
+    break;
+case 3654:
+    OP_LOADP(r1, r0, r0);
+    break;
+case 3655:
+    OP_LOADP(r1, r0, r1);
+    break;
+case 3656:
+    OP_LOADP(r1, r0, r2);
+    break;
+case 3657:
+    OP_LOADP(r1, r0, r3);
+    break;
+case 3658:
+    OP_LOADP(r1, r0, r4);
+    break;
+case 3659:
+    OP_LOADP(r1, r0, r5);
+    break;
+case 3660:
+    OP_LOADP(r1, r0, r6);
+    break;
+case 3661:
+    OP_LOADP(r1, r0, r7);
+    break;
+case 3662:
+    OP_LOADP(r1, r1, r0);
+    break;
+case 3663:
+    OP_LOADP(r1, r1, r1);
+    break;
+case 3664:
+    OP_LOADP(r1, r1, r2);
+    break;
+case 3665:
+    OP_LOADP(r1, r1, r3);
+    break;
+case 3666:
+    OP_LOADP(r1, r1, r4);
+    break;
+case 3667:
+    OP_LOADP(r1, r1, r5);
+    break;
+case 3668:
+    OP_LOADP(r1, r1, r6);
+    break;
+case 3669:
+    OP_LOADP(r1, r1, r7);
+    break;
+case 3670:
+    OP_LOADP(r1, r2, r0);
+    break;
+case 3671:
+    OP_LOADP(r1, r2, r1);
+    break;
+case 3672:
+    OP_LOADP(r1, r2, r2);
+    break;
+case 3673:
+    OP_LOADP(r1, r2, r3);
+    break;
+case 3674:
+    OP_LOADP(r1, r2, r4);
+    break;
+case 3675:
+    OP_LOADP(r1, r2, r5);
+    break;
+case 3676:
+    OP_LOADP(r1, r2, r6);
+    break;
+case 3677:
+    OP_LOADP(r1, r2, r7);
+    break;
+case 3678:
+    OP_LOADP(r1, r3, r0);
+    break;
+case 3679:
+    OP_LOADP(r1, r3, r1);
+    break;
+case 3680:
+    OP_LOADP(r1, r3, r2);
+    break;
+case 3681:
+    OP_LOADP(r1, r3, r3);
+    break;
+case 3682:
+    OP_LOADP(r1, r3, r4);
+    break;
+case 3683:
+    OP_LOADP(r1, r3, r5);
+    break;
+case 3684:
+    OP_LOADP(r1, r3, r6);
+    break;
+case 3685:
+    OP_LOADP(r1, r3, r7);
+    break;
+case 3686:
+    OP_LOADP(r1, r4, r0);
+    break;
+case 3687:
+    OP_LOADP(r1, r4, r1);
+    break;
+case 3688:
+    OP_LOADP(r1, r4, r2);
+    break;
+case 3689:
+    OP_LOADP(r1, r4, r3);
+    break;
+case 3690:
+    OP_LOADP(r1, r4, r4);
+    break;
+case 3691:
+    OP_LOADP(r1, r4, r5);
+    break;
+case 3692:
+    OP_LOADP(r1, r4, r6);
+    break;
+case 3693:
+    OP_LOADP(r1, r4, r7);
+    break;
+case 3694:
+    OP_LOADP(r1, r5, r0);
+    break;
+case 3695:
+    OP_LOADP(r1, r5, r1);
+    break;
+case 3696:
+    OP_LOADP(r1, r5, r2);
+    break;
+case 3697:
+    OP_LOADP(r1, r5, r3);
+    break;
+case 3698:
+    OP_LOADP(r1, r5, r4);
+    break;
+case 3699:
+    OP_LOADP(r1, r5, r5);
+    break;
+case 3700:
+    OP_LOADP(r1, r5, r6);
+    break;
+case 3701:
+    OP_LOADP(r1, r5, r7);
+    break;
+case 3702:
+    OP_LOADP(r1, r6, r0);
+    break;
+case 3703:
+    OP_LOADP(r1, r6, r1);
+    break;
+case 3704:
+    OP_LOADP(r1, r6, r2);
+    break;
+case 3705:
+    OP_LOADP(r1, r6, r3);
+    break;
+case 3706:
+    OP_LOADP(r1, r6, r4);
+    break;
+case 3707:
+    OP_LOADP(r1, r6, r5);
+    break;
+case 3708:
+    OP_LOADP(r1, r6, r6);
+    break;
+case 3709:
+    OP_LOADP(r1, r6, r7);
+    break;
+case 3710:
+    OP_LOADP(r1, r7, r0);
+    break;
+case 3711:
+    OP_LOADP(r1, r7, r1);
+    break;
+case 3712:
+    OP_LOADP(r1, r7, r2);
+    break;
+case 3713:
+    OP_LOADP(r1, r7, r3);
+    break;
+case 3714:
+    OP_LOADP(r1, r7, r4);
+    break;
+case 3715:
+    OP_LOADP(r1, r7, r5);
+    break;
+case 3716:
+    OP_LOADP(r1, r7, r6);
+    break;
+case 3717:
+    OP_LOADP(r1, r7, r7);
+    break;
+case 3718:
+    OP_LOADP(r2, r0, r0);
+    break;
+case 3719:
+    OP_LOADP(r2, r0, r1);
+    break;
+case 3720:
+    OP_LOADP(r2, r0, r2);
+    break;
+case 3721:
+    OP_LOADP(r2, r0, r3);
+    break;
+case 3722:
+    OP_LOADP(r2, r0, r4);
+    break;
+case 3723:
+    OP_LOADP(r2, r0, r5);
+    break;
+case 3724:
+    OP_LOADP(r2, r0, r6);
+    break;
+case 3725:
+    OP_LOADP(r2, r0, r7);
+    break;
+case 3726:
+    OP_LOADP(r2, r1, r0);
+    break;
+case 3727:
+    OP_LOADP(r2, r1, r1);
+    break;
+case 3728:
+    OP_LOADP(r2, r1, r2);
+    break;
+case 3729:
+    OP_LOADP(r2, r1, r3);
+    break;
+case 3730:
+    OP_LOADP(r2, r1, r4);
+    break;
+case 3731:
+    OP_LOADP(r2, r1, r5);
+    break;
+case 3732:
+    OP_LOADP(r2, r1, r6);
+    break;
+case 3733:
+    OP_LOADP(r2, r1, r7);
+    break;
+case 3734:
+    OP_LOADP(r2, r2, r0);
+    break;
+case 3735:
+    OP_LOADP(r2, r2, r1);
+    break;
+case 3736:
+    OP_LOADP(r2, r2, r2);
+    break;
+case 3737:
+    OP_LOADP(r2, r2, r3);
+    break;
+case 3738:
+    OP_LOADP(r2, r2, r4);
+    break;
+case 3739:
+    OP_LOADP(r2, r2, r5);
+    break;
+case 3740:
+    OP_LOADP(r2, r2, r6);
+    break;
+case 3741:
+    OP_LOADP(r2, r2, r7);
+    break;
+case 3742:
+    OP_LOADP(r2, r3, r0);
+    break;
+case 3743:
+    OP_LOADP(r2, r3, r1);
+    break;
+case 3744:
+    OP_LOADP(r2, r3, r2);
+    break;
+case 3745:
+    OP_LOADP(r2, r3, r3);
+    break;
+case 3746:
+    OP_LOADP(r2, r3, r4);
+    break;
+case 3747:
+    OP_LOADP(r2, r3, r5);
+    break;
+case 3748:
+    OP_LOADP(r2, r3, r6);
+    break;
+case 3749:
+    OP_LOADP(r2, r3, r7);
+    break;
+case 3750:
+    OP_LOADP(r2, r4, r0);
+    break;
+case 3751:
+    OP_LOADP(r2, r4, r1);
+    break;
+case 3752:
+    OP_LOADP(r2, r4, r2);
+    break;
+case 3753:
+    OP_LOADP(r2, r4, r3);
+    break;
+case 3754:
+    OP_LOADP(r2, r4, r4);
+    break;
+case 3755:
+    OP_LOADP(r2, r4, r5);
+    break;
+case 3756:
+    OP_LOADP(r2, r4, r6);
+    break;
+case 3757:
+    OP_LOADP(r2, r4, r7);
+    break;
+case 3758:
+    OP_LOADP(r2, r5, r0);
+    break;
+case 3759:
+    OP_LOADP(r2, r5, r1);
+    break;
+case 3760:
+    OP_LOADP(r2, r5, r2);
+    break;
+case 3761:
+    OP_LOADP(r2, r5, r3);
+    break;
+case 3762:
+    OP_LOADP(r2, r5, r4);
+    break;
+case 3763:
+    OP_LOADP(r2, r5, r5);
+    break;
+case 3764:
+    OP_LOADP(r2, r5, r6);
+    break;
+case 3765:
+    OP_LOADP(r2, r5, r7);
+    break;
+case 3766:
+    OP_LOADP(r2, r6, r0);
+    break;
+case 3767:
+    OP_LOADP(r2, r6, r1);
+    break;
+case 3768:
+    OP_LOADP(r2, r6, r2);
+    break;
+case 3769:
+    OP_LOADP(r2, r6, r3);
+    break;
+case 3770:
+    OP_LOADP(r2, r6, r4);
+    break;
+case 3771:
+    OP_LOADP(r2, r6, r5);
+    break;
+case 3772:
+    OP_LOADP(r2, r6, r6);
+    break;
+case 3773:
+    OP_LOADP(r2, r6, r7);
+    break;
+case 3774:
+    OP_LOADP(r2, r7, r0);
+    break;
+case 3775:
+    OP_LOADP(r2, r7, r1);
+    break;
+case 3776:
+    OP_LOADP(r2, r7, r2);
+    break;
+case 3777:
+    OP_LOADP(r2, r7, r3);
+    break;
+case 3778:
+    OP_LOADP(r2, r7, r4);
+    break;
+case 3779:
+    OP_LOADP(r2, r7, r5);
+    break;
+case 3780:
+    OP_LOADP(r2, r7, r6);
+    break;
+case 3781:
+    OP_LOADP(r2, r7, r7);
+    break;
+case 3782:
+    OP_LOADP(r3, r0, r0);
+    break;
+case 3783:
+    OP_LOADP(r3, r0, r1);
+    break;
+case 3784:
+    OP_LOADP(r3, r0, r2);
+    break;
+case 3785:
+    OP_LOADP(r3, r0, r3);
+    break;
+case 3786:
+    OP_LOADP(r3, r0, r4);
+    break;
+case 3787:
+    OP_LOADP(r3, r0, r5);
+    break;
+case 3788:
+    OP_LOADP(r3, r0, r6);
+    break;
+case 3789:
+    OP_LOADP(r3, r0, r7);
+    break;
+case 3790:
+    OP_LOADP(r3, r1, r0);
+    break;
+case 3791:
+    OP_LOADP(r3, r1, r1);
+    break;
+case 3792:
+    OP_LOADP(r3, r1, r2);
+    break;
+case 3793:
+    OP_LOADP(r3, r1, r3);
+    break;
+case 3794:
+    OP_LOADP(r3, r1, r4);
+    break;
+case 3795:
+    OP_LOADP(r3, r1, r5);
+    break;
+case 3796:
+    OP_LOADP(r3, r1, r6);
+    break;
+case 3797:
+    OP_LOADP(r3, r1, r7);
+    break;
+case 3798:
+    OP_LOADP(r3, r2, r0);
+    break;
+case 3799:
+    OP_LOADP(r3, r2, r1);
+    break;
+case 3800:
+    OP_LOADP(r3, r2, r2);
+    break;
+case 3801:
+    OP_LOADP(r3, r2, r3);
+    break;
+case 3802:
+    OP_LOADP(r3, r2, r4);
+    break;
+case 3803:
+    OP_LOADP(r3, r2, r5);
+    break;
+case 3804:
+    OP_LOADP(r3, r2, r6);
+    break;
+case 3805:
+    OP_LOADP(r3, r2, r7);
+    break;
+case 3806:
+    OP_LOADP(r3, r3, r0);
+    break;
+case 3807:
+    OP_LOADP(r3, r3, r1);
+    break;
+case 3808:
+    OP_LOADP(r3, r3, r2);
+    break;
+case 3809:
+    OP_LOADP(r3, r3, r3);
+    break;
+case 3810:
+    OP_LOADP(r3, r3, r4);
+    break;
+case 3811:
+    OP_LOADP(r3, r3, r5);
+    break;
+case 3812:
+    OP_LOADP(r3, r3, r6);
+    break;
+case 3813:
+    OP_LOADP(r3, r3, r7);
+    break;
+case 3814:
+    OP_LOADP(r3, r4, r0);
+    break;
+case 3815:
+    OP_LOADP(r3, r4, r1);
+    break;
+case 3816:
+    OP_LOADP(r3, r4, r2);
+    break;
+case 3817:
+    OP_LOADP(r3, r4, r3);
+    break;
+case 3818:
+    OP_LOADP(r3, r4, r4);
+    break;
+case 3819:
+    OP_LOADP(r3, r4, r5);
+    break;
+case 3820:
+    OP_LOADP(r3, r4, r6);
+    break;
+case 3821:
+    OP_LOADP(r3, r4, r7);
+    break;
+case 3822:
+    OP_LOADP(r3, r5, r0);
+    break;
+case 3823:
+    OP_LOADP(r3, r5, r1);
+    break;
+case 3824:
+    OP_LOADP(r3, r5, r2);
+    break;
+case 3825:
+    OP_LOADP(r3, r5, r3);
+    break;
+case 3826:
+    OP_LOADP(r3, r5, r4);
+    break;
+case 3827:
+    OP_LOADP(r3, r5, r5);
+    break;
+case 3828:
+    OP_LOADP(r3, r5, r6);
+    break;
+case 3829:
+    OP_LOADP(r3, r5, r7);
+    break;
+case 3830:
+    OP_LOADP(r3, r6, r0);
+    break;
+case 3831:
+    OP_LOADP(r3, r6, r1);
+    break;
+case 3832:
+    OP_LOADP(r3, r6, r2);
+    break;
+case 3833:
+    OP_LOADP(r3, r6, r3);
+    break;
+case 3834:
+    OP_LOADP(r3, r6, r4);
+    break;
+case 3835:
+    OP_LOADP(r3, r6, r5);
+    break;
+case 3836:
+    OP_LOADP(r3, r6, r6);
+    break;
+case 3837:
+    OP_LOADP(r3, r6, r7);
+    break;
+case 3838:
+    OP_LOADP(r3, r7, r0);
+    break;
+case 3839:
+    OP_LOADP(r3, r7, r1);
+    break;
+case 3840:
+    OP_LOADP(r3, r7, r2);
+    break;
+case 3841:
+    OP_LOADP(r3, r7, r3);
+    break;
+case 3842:
+    OP_LOADP(r3, r7, r4);
+    break;
+case 3843:
+    OP_LOADP(r3, r7, r5);
+    break;
+case 3844:
+    OP_LOADP(r3, r7, r6);
+    break;
+case 3845:
+    OP_LOADP(r3, r7, r7);
+    break;
+case 3846:
+    OP_LOADP(r4, r0, r0);
+    break;
+case 3847:
+    OP_LOADP(r4, r0, r1);
+    break;
+case 3848:
+    OP_LOADP(r4, r0, r2);
+    break;
+case 3849:
+    OP_LOADP(r4, r0, r3);
+    break;
+case 3850:
+    OP_LOADP(r4, r0, r4);
+    break;
+case 3851:
+    OP_LOADP(r4, r0, r5);
+    break;
+case 3852:
+    OP_LOADP(r4, r0, r6);
+    break;
+case 3853:
+    OP_LOADP(r4, r0, r7);
+    break;
+case 3854:
+    OP_LOADP(r4, r1, r0);
+    break;
+case 3855:
+    OP_LOADP(r4, r1, r1);
+    break;
+case 3856:
+    OP_LOADP(r4, r1, r2);
+    break;
+case 3857:
+    OP_LOADP(r4, r1, r3);
+    break;
+case 3858:
+    OP_LOADP(r4, r1, r4);
+    break;
+case 3859:
+    OP_LOADP(r4, r1, r5);
+    break;
+case 3860:
+    OP_LOADP(r4, r1, r6);
+    break;
+case 3861:
+    OP_LOADP(r4, r1, r7);
+    break;
+case 3862:
+    OP_LOADP(r4, r2, r0);
+    break;
+case 3863:
+    OP_LOADP(r4, r2, r1);
+    break;
+case 3864:
+    OP_LOADP(r4, r2, r2);
+    break;
+case 3865:
+    OP_LOADP(r4, r2, r3);
+    break;
+case 3866:
+    OP_LOADP(r4, r2, r4);
+    break;
+case 3867:
+    OP_LOADP(r4, r2, r5);
+    break;
+case 3868:
+    OP_LOADP(r4, r2, r6);
+    break;
+case 3869:
+    OP_LOADP(r4, r2, r7);
+    break;
+case 3870:
+    OP_LOADP(r4, r3, r0);
+    break;
+case 3871:
+    OP_LOADP(r4, r3, r1);
+    break;
+case 3872:
+    OP_LOADP(r4, r3, r2);
+    break;
+case 3873:
+    OP_LOADP(r4, r3, r3);
+    break;
+case 3874:
+    OP_LOADP(r4, r3, r4);
+    break;
+case 3875:
+    OP_LOADP(r4, r3, r5);
+    break;
+case 3876:
+    OP_LOADP(r4, r3, r6);
+    break;
+case 3877:
+    OP_LOADP(r4, r3, r7);
+    break;
+case 3878:
+    OP_LOADP(r4, r4, r0);
+    break;
+case 3879:
+    OP_LOADP(r4, r4, r1);
+    break;
+case 3880:
+    OP_LOADP(r4, r4, r2);
+    break;
+case 3881:
+    OP_LOADP(r4, r4, r3);
+    break;
+case 3882:
+    OP_LOADP(r4, r4, r4);
+    break;
+case 3883:
+    OP_LOADP(r4, r4, r5);
+    break;
+case 3884:
+    OP_LOADP(r4, r4, r6);
+    break;
+case 3885:
+    OP_LOADP(r4, r4, r7);
+    break;
+case 3886:
+    OP_LOADP(r4, r5, r0);
+    break;
+case 3887:
+    OP_LOADP(r4, r5, r1);
+    break;
+case 3888:
+    OP_LOADP(r4, r5, r2);
+    break;
+case 3889:
+    OP_LOADP(r4, r5, r3);
+    break;
+case 3890:
+    OP_LOADP(r4, r5, r4);
+    break;
+case 3891:
+    OP_LOADP(r4, r5, r5);
+    break;
+case 3892:
+    OP_LOADP(r4, r5, r6);
+    break;
+case 3893:
+    OP_LOADP(r4, r5, r7);
+    break;
+case 3894:
+    OP_LOADP(r4, r6, r0);
+    break;
+case 3895:
+    OP_LOADP(r4, r6, r1);
+    break;
+case 3896:
+    OP_LOADP(r4, r6, r2);
+    break;
+case 3897:
+    OP_LOADP(r4, r6, r3);
+    break;
+case 3898:
+    OP_LOADP(r4, r6, r4);
+    break;
+case 3899:
+    OP_LOADP(r4, r6, r5);
+    break;
+case 3900:
+    OP_LOADP(r4, r6, r6);
+    break;
+case 3901:
+    OP_LOADP(r4, r6, r7);
+    break;
+case 3902:
+    OP_LOADP(r4, r7, r0);
+    break;
+case 3903:
+    OP_LOADP(r4, r7, r1);
+    break;
+case 3904:
+    OP_LOADP(r4, r7, r2);
+    break;
+case 3905:
+    OP_LOADP(r4, r7, r3);
+    break;
+case 3906:
+    OP_LOADP(r4, r7, r4);
+    break;
+case 3907:
+    OP_LOADP(r4, r7, r5);
+    break;
+case 3908:
+    OP_LOADP(r4, r7, r6);
+    break;
+case 3909:
+    OP_LOADP(r4, r7, r7);
+    break;
+case 3910:
+    OP_LOADP(r5, r0, r0);
+    break;
+case 3911:
+    OP_LOADP(r5, r0, r1);
+    break;
+case 3912:
+    OP_LOADP(r5, r0, r2);
+    break;
+case 3913:
+    OP_LOADP(r5, r0, r3);
+    break;
+case 3914:
+    OP_LOADP(r5, r0, r4);
+    break;
+case 3915:
+    OP_LOADP(r5, r0, r5);
+    break;
+case 3916:
+    OP_LOADP(r5, r0, r6);
+    break;
+case 3917:
+    OP_LOADP(r5, r0, r7);
+    break;
+case 3918:
+    OP_LOADP(r5, r1, r0);
+    break;
+case 3919:
+    OP_LOADP(r5, r1, r1);
+    break;
+case 3920:
+    OP_LOADP(r5, r1, r2);
+    break;
+case 3921:
+    OP_LOADP(r5, r1, r3);
+    break;
+case 3922:
+    OP_LOADP(r5, r1, r4);
+    break;
+case 3923:
+    OP_LOADP(r5, r1, r5);
+    break;
+case 3924:
+    OP_LOADP(r5, r1, r6);
+    break;
+case 3925:
+    OP_LOADP(r5, r1, r7);
+    break;
+case 3926:
+    OP_LOADP(r5, r2, r0);
+    break;
+case 3927:
+    OP_LOADP(r5, r2, r1);
+    break;
+case 3928:
+    OP_LOADP(r5, r2, r2);
+    break;
+case 3929:
+    OP_LOADP(r5, r2, r3);
+    break;
+case 3930:
+    OP_LOADP(r5, r2, r4);
+    break;
+case 3931:
+    OP_LOADP(r5, r2, r5);
+    break;
+case 3932:
+    OP_LOADP(r5, r2, r6);
+    break;
+case 3933:
+    OP_LOADP(r5, r2, r7);
+    break;
+case 3934:
+    OP_LOADP(r5, r3, r0);
+    break;
+case 3935:
+    OP_LOADP(r5, r3, r1);
+    break;
+case 3936:
+    OP_LOADP(r5, r3, r2);
+    break;
+case 3937:
+    OP_LOADP(r5, r3, r3);
+    break;
+case 3938:
+    OP_LOADP(r5, r3, r4);
+    break;
+case 3939:
+    OP_LOADP(r5, r3, r5);
+    break;
+case 3940:
+    OP_LOADP(r5, r3, r6);
+    break;
+case 3941:
+    OP_LOADP(r5, r3, r7);
+    break;
+case 3942:
+    OP_LOADP(r5, r4, r0);
+    break;
+case 3943:
+    OP_LOADP(r5, r4, r1);
+    break;
+case 3944:
+    OP_LOADP(r5, r4, r2);
+    break;
+case 3945:
+    OP_LOADP(r5, r4, r3);
+    break;
+case 3946:
+    OP_LOADP(r5, r4, r4);
+    break;
+case 3947:
+    OP_LOADP(r5, r4, r5);
+    break;
+case 3948:
+    OP_LOADP(r5, r4, r6);
+    break;
+case 3949:
+    OP_LOADP(r5, r4, r7);
+    break;
+case 3950:
+    OP_LOADP(r5, r5, r0);
+    break;
+case 3951:
+    OP_LOADP(r5, r5, r1);
+    break;
+case 3952:
+    OP_LOADP(r5, r5, r2);
+    break;
+case 3953:
+    OP_LOADP(r5, r5, r3);
+    break;
+case 3954:
+    OP_LOADP(r5, r5, r4);
+    break;
+case 3955:
+    OP_LOADP(r5, r5, r5);
+    break;
+case 3956:
+    OP_LOADP(r5, r5, r6);
+    break;
+case 3957:
+    OP_LOADP(r5, r5, r7);
+    break;
+case 3958:
+    OP_LOADP(r5, r6, r0);
+    break;
+case 3959:
+    OP_LOADP(r5, r6, r1);
+    break;
+case 3960:
+    OP_LOADP(r5, r6, r2);
+    break;
+case 3961:
+    OP_LOADP(r5, r6, r3);
+    break;
+case 3962:
+    OP_LOADP(r5, r6, r4);
+    break;
+case 3963:
+    OP_LOADP(r5, r6, r5);
+    break;
+case 3964:
+    OP_LOADP(r5, r6, r6);
+    break;
+case 3965:
+    OP_LOADP(r5, r6, r7);
+    break;
+case 3966:
+    OP_LOADP(r5, r7, r0);
+    break;
+case 3967:
+    OP_LOADP(r5, r7, r1);
+    break;
+case 3968:
+    OP_LOADP(r5, r7, r2);
+    break;
+case 3969:
+    OP_LOADP(r5, r7, r3);
+    break;
+case 3970:
+    OP_LOADP(r5, r7, r4);
+    break;
+case 3971:
+    OP_LOADP(r5, r7, r5);
+    break;
+case 3972:
+    OP_LOADP(r5, r7, r6);
+    break;
+case 3973:
+    OP_LOADP(r5, r7, r7);
+    break;
+case 3974:
+    OP_LOADP(r6, r0, r0);
+    break;
+case 3975:
+    OP_LOADP(r6, r0, r1);
+    break;
+case 3976:
+    OP_LOADP(r6, r0, r2);
+    break;
+case 3977:
+    OP_LOADP(r6, r0, r3);
+    break;
+case 3978:
+    OP_LOADP(r6, r0, r4);
+    break;
+case 3979:
+    OP_LOADP(r6, r0, r5);
+    break;
+case 3980:
+    OP_LOADP(r6, r0, r6);
+    break;
+case 3981:
+    OP_LOADP(r6, r0, r7);
+    break;
+case 3982:
+    OP_LOADP(r6, r1, r0);
+    break;
+case 3983:
+    OP_LOADP(r6, r1, r1);
+    break;
+case 3984:
+    OP_LOADP(r6, r1, r2);
+    break;
+case 3985:
+    OP_LOADP(r6, r1, r3);
+    break;
+case 3986:
+    OP_LOADP(r6, r1, r4);
+    break;
+case 3987:
+    OP_LOADP(r6, r1, r5);
+    break;
+case 3988:
+    OP_LOADP(r6, r1, r6);
+    break;
+case 3989:
+    OP_LOADP(r6, r1, r7);
+    break;
+case 3990:
+    OP_LOADP(r6, r2, r0);
+    break;
+case 3991:
+    OP_LOADP(r6, r2, r1);
+    break;
+case 3992:
+    OP_LOADP(r6, r2, r2);
+    break;
+case 3993:
+    OP_LOADP(r6, r2, r3);
+    break;
+case 3994:
+    OP_LOADP(r6, r2, r4);
+    break;
+case 3995:
+    OP_LOADP(r6, r2, r5);
+    break;
+case 3996:
+    OP_LOADP(r6, r2, r6);
+    break;
+case 3997:
+    OP_LOADP(r6, r2, r7);
+    break;
+case 3998:
+    OP_LOADP(r6, r3, r0);
+    break;
+case 3999:
+    OP_LOADP(r6, r3, r1);
+    break;
+case 4000:
+    OP_LOADP(r6, r3, r2);
+    break;
+case 4001:
+    OP_LOADP(r6, r3, r3);
+    break;
+case 4002:
+    OP_LOADP(r6, r3, r4);
+    break;
+case 4003:
+    OP_LOADP(r6, r3, r5);
+    break;
+case 4004:
+    OP_LOADP(r6, r3, r6);
+    break;
+case 4005:
+    OP_LOADP(r6, r3, r7);
+    break;
+case 4006:
+    OP_LOADP(r6, r4, r0);
+    break;
+case 4007:
+    OP_LOADP(r6, r4, r1);
+    break;
+case 4008:
+    OP_LOADP(r6, r4, r2);
+    break;
+case 4009:
+    OP_LOADP(r6, r4, r3);
+    break;
+case 4010:
+    OP_LOADP(r6, r4, r4);
+    break;
+case 4011:
+    OP_LOADP(r6, r4, r5);
+    break;
+case 4012:
+    OP_LOADP(r6, r4, r6);
+    break;
+case 4013:
+    OP_LOADP(r6, r4, r7);
+    break;
+case 4014:
+    OP_LOADP(r6, r5, r0);
+    break;
+case 4015:
+    OP_LOADP(r6, r5, r1);
+    break;
+case 4016:
+    OP_LOADP(r6, r5, r2);
+    break;
+case 4017:
+    OP_LOADP(r6, r5, r3);
+    break;
+case 4018:
+    OP_LOADP(r6, r5, r4);
+    break;
+case 4019:
+    OP_LOADP(r6, r5, r5);
+    break;
+case 4020:
+    OP_LOADP(r6, r5, r6);
+    break;
+case 4021:
+    OP_LOADP(r6, r5, r7);
+    break;
+case 4022:
+    OP_LOADP(r6, r6, r0);
+    break;
+case 4023:
+    OP_LOADP(r6, r6, r1);
+    break;
+case 4024:
+    OP_LOADP(r6, r6, r2);
+    break;
+case 4025:
+    OP_LOADP(r6, r6, r3);
+    break;
+case 4026:
+    OP_LOADP(r6, r6, r4);
+    break;
+case 4027:
+    OP_LOADP(r6, r6, r5);
+    break;
+case 4028:
+    OP_LOADP(r6, r6, r6);
+    break;
+case 4029:
+    OP_LOADP(r6, r6, r7);
+    break;
+case 4030:
+    OP_LOADP(r6, r7, r0);
+    break;
+case 4031:
+    OP_LOADP(r6, r7, r1);
+    break;
+case 4032:
+    OP_LOADP(r6, r7, r2);
+    break;
+case 4033:
+    OP_LOADP(r6, r7, r3);
+    break;
+case 4034:
+    OP_LOADP(r6, r7, r4);
+    break;
+case 4035:
+    OP_LOADP(r6, r7, r5);
+    break;
+case 4036:
+    OP_LOADP(r6, r7, r6);
+    break;
+case 4037:
+    OP_LOADP(r6, r7, r7);
+    break;
+case 4038:
+    OP_LOADP(r7, r0, r0);
+    break;
+case 4039:
+    OP_LOADP(r7, r0, r1);
+    break;
+case 4040:
+    OP_LOADP(r7, r0, r2);
+    break;
+case 4041:
+    OP_LOADP(r7, r0, r3);
+    break;
+case 4042:
+    OP_LOADP(r7, r0, r4);
+    break;
+case 4043:
+    OP_LOADP(r7, r0, r5);
+    break;
+case 4044:
+    OP_LOADP(r7, r0, r6);
+    break;
+case 4045:
+    OP_LOADP(r7, r0, r7);
+    break;
+case 4046:
+    OP_LOADP(r7, r1, r0);
+    break;
+case 4047:
+    OP_LOADP(r7, r1, r1);
+    break;
+case 4048:
+    OP_LOADP(r7, r1, r2);
+    break;
+case 4049:
+    OP_LOADP(r7, r1, r3);
+    break;
+case 4050:
+    OP_LOADP(r7, r1, r4);
+    break;
+case 4051:
+    OP_LOADP(r7, r1, r5);
+    break;
+case 4052:
+    OP_LOADP(r7, r1, r6);
+    break;
+case 4053:
+    OP_LOADP(r7, r1, r7);
+    break;
+case 4054:
+    OP_LOADP(r7, r2, r0);
+    break;
+case 4055:
+    OP_LOADP(r7, r2, r1);
+    break;
+case 4056:
+    OP_LOADP(r7, r2, r2);
+    break;
+case 4057:
+    OP_LOADP(r7, r2, r3);
+    break;
+case 4058:
+    OP_LOADP(r7, r2, r4);
+    break;
+case 4059:
+    OP_LOADP(r7, r2, r5);
+    break;
+case 4060:
+    OP_LOADP(r7, r2, r6);
+    break;
+case 4061:
+    OP_LOADP(r7, r2, r7);
+    break;
+case 4062:
+    OP_LOADP(r7, r3, r0);
+    break;
+case 4063:
+    OP_LOADP(r7, r3, r1);
+    break;
+case 4064:
+    OP_LOADP(r7, r3, r2);
+    break;
+case 4065:
+    OP_LOADP(r7, r3, r3);
+    break;
+case 4066:
+    OP_LOADP(r7, r3, r4);
+    break;
+case 4067:
+    OP_LOADP(r7, r3, r5);
+    break;
+case 4068:
+    OP_LOADP(r7, r3, r6);
+    break;
+case 4069:
+    OP_LOADP(r7, r3, r7);
+    break;
+case 4070:
+    OP_LOADP(r7, r4, r0);
+    break;
+case 4071:
+    OP_LOADP(r7, r4, r1);
+    break;
+case 4072:
+    OP_LOADP(r7, r4, r2);
+    break;
+case 4073:
+    OP_LOADP(r7, r4, r3);
+    break;
+case 4074:
+    OP_LOADP(r7, r4, r4);
+    break;
+case 4075:
+    OP_LOADP(r7, r4, r5);
+    break;
+case 4076:
+    OP_LOADP(r7, r4, r6);
+    break;
+case 4077:
+    OP_LOADP(r7, r4, r7);
+    break;
+case 4078:
+    OP_LOADP(r7, r5, r0);
+    break;
+case 4079:
+    OP_LOADP(r7, r5, r1);
+    break;
+case 4080:
+    OP_LOADP(r7, r5, r2);
+    break;
+case 4081:
+    OP_LOADP(r7, r5, r3);
+    break;
+case 4082:
+    OP_LOADP(r7, r5, r4);
+    break;
+case 4083:
+    OP_LOADP(r7, r5, r5);
+    break;
+case 4084:
+    OP_LOADP(r7, r5, r6);
+    break;
+case 4085:
+    OP_LOADP(r7, r5, r7);
+    break;
+case 4086:
+    OP_LOADP(r7, r6, r0);
+    break;
+case 4087:
+    OP_LOADP(r7, r6, r1);
+    break;
+case 4088:
+    OP_LOADP(r7, r6, r2);
+    break;
+case 4089:
+    OP_LOADP(r7, r6, r3);
+    break;
+case 4090:
+    OP_LOADP(r7, r6, r4);
+    break;
+case 4091:
+    OP_LOADP(r7, r6, r5);
+    break;
+case 4092:
+    OP_LOADP(r7, r6, r6);
+    break;
+case 4093:
+    OP_LOADP(r7, r6, r7);
+    break;
+case 4094:
+    OP_LOADP(r7, r7, r0);
+    break;
+case 4095:
+    OP_LOADP(r7, r7, r1);
+    break;
+case 4096:
+    OP_LOADP(r7, r7, r2);
+    break;
+case 4097:
+    OP_LOADP(r7, r7, r3);
+    break;
+case 4098:
+    OP_LOADP(r7, r7, r4);
+    break;
+case 4099:
+    OP_LOADP(r7, r7, r5);
+    break;
+case 4100:
+    OP_LOADP(r7, r7, r6);
+    break;
+case 4101:
+    OP_LOADP(r7, r7, r7);
+    break;
+case 4102:
+    OP_LV(r0, 0, 0);
+    break;
+case 4103:
+    OP_LV(r1, 0, 0);
+    break;
+case 4104:
+    OP_LV(r2, 0, 0);
+    break;
+case 4105:
+    OP_LV(r3, 0, 0);
+    break;
+case 4106:
+    OP_LV(r4, 0, 0);
+    break;
+case 4107:
+    OP_LV(r5, 0, 0);
+    break;
+case 4108:
+    OP_LV(r6, 0, 0);
+    break;
+case 4109:
+    OP_LV(r7, 0, 0);
+    break;
+case 4110:
+    DISPATCH_GENERIC(OP_SPAWN);
+    break;
+case 4111:
+    DISPATCH_GENERIC(OP_EXTEND);
+    break;
+case 4112:
+    OP_AND(r0, r0, r0, 3073);
+    break;
+case 4113:
+    OP_AND(r0, r0, r1, 3073);
+    break;
+case 4114:
+    OP_AND(r0, r0, r2, 3073);
+    break;
+case 4115:
+    OP_AND(r0, r0, r3, 3073);
+    break;
+case 4116:
+    OP_AND(r0, r0, r4, 3073);
+    break;
+case 4117:
+    OP_AND(r0, r0, r5, 3073);
+    break;
+case 4118:
+    OP_AND(r0, r0, r6, 3073);
+    break;
+case 4119:
+    OP_AND(r0, r0, r7, 3073);
+    break;
+case 4120:
+    OP_AND(r0, r1, r0, 3073);
+    break;
+case 4121:
+    OP_AND(r0, r1, r1, 3073);
+    break;
+case 4122:
+    OP_AND(r0, r1, r2, 3073);
+    break;
+case 4123:
+    OP_AND(r0, r1, r3, 3073);
+    break;
+case 4124:
+    OP_AND(r0, r1, r4, 3073);
+    break;
+case 4125:
+    OP_AND(r0, r1, r5, 3073);
+    break;
+case 4126:
+    OP_AND(r0, r1, r6, 3073);
+    break;
+case 4127:
+    OP_AND(r0, r1, r7, 3073);
+    break;
+case 4128:
+    OP_AND(r0, r2, r0, 3073);
+    break;
+case 4129:
+    OP_AND(r0, r2, r1, 3073);
+    break;
+case 4130:
+    OP_AND(r0, r2, r2, 3073);
+    break;
+case 4131:
+    OP_AND(r0, r2, r3, 3073);
+    break;
+case 4132:
+    OP_AND(r0, r2, r4, 3073);
+    break;
+case 4133:
+    OP_AND(r0, r2, r5, 3073);
+    break;
+case 4134:
+    OP_AND(r0, r2, r6, 3073);
+    break;
+case 4135:
+    OP_AND(r0, r2, r7, 3073);
+    break;
+case 4136:
+    OP_AND(r0, r3, r0, 3073);
+    break;
+case 4137:
+    OP_AND(r0, r3, r1, 3073);
+    break;
+case 4138:
+    OP_AND(r0, r3, r2, 3073);
+    break;
+case 4139:
+    OP_AND(r0, r3, r3, 3073);
+    break;
+case 4140:
+    OP_AND(r0, r3, r4, 3073);
+    break;
+case 4141:
+    OP_AND(r0, r3, r5, 3073);
+    break;
+case 4142:
+    OP_AND(r0, r3, r6, 3073);
+    break;
+case 4143:
+    OP_AND(r0, r3, r7, 3073);
+    break;
+case 4144:
+    OP_AND(r0, r4, r0, 3073);
+    break;
+case 4145:
+    OP_AND(r0, r4, r1, 3073);
+    break;
+case 4146:
+    OP_AND(r0, r4, r2, 3073);
+    break;
+case 4147:
+    OP_AND(r0, r4, r3, 3073);
+    break;
+case 4148:
+    OP_AND(r0, r4, r4, 3073);
+    break;
+case 4149:
+    OP_AND(r0, r4, r5, 3073);
+    break;
+case 4150:
+    OP_AND(r0, r4, r6, 3073);
+    break;
+case 4151:
+    OP_AND(r0, r4, r7, 3073);
+    break;
+case 4152:
+    OP_AND(r0, r5, r0, 3073);
+    break;
+case 4153:
+    OP_AND(r0, r5, r1, 3073);
+    break;
+case 4154:
+    OP_AND(r0, r5, r2, 3073);
+    break;
+case 4155:
+    OP_AND(r0, r5, r3, 3073);
+    break;
+case 4156:
+    OP_AND(r0, r5, r4, 3073);
+    break;
+case 4157:
+    OP_AND(r0, r5, r5, 3073);
+    break;
+case 4158:
+    OP_AND(r0, r5, r6, 3073);
+    break;
+case 4159:
+    OP_AND(r0, r5, r7, 3073);
+    break;
+case 4160:
+    OP_AND(r0, r6, r0, 3073);
+    break;
+case 4161:
+    OP_AND(r0, r6, r1, 3073);
+    break;
+case 4162:
+    OP_AND(r0, r6, r2, 3073);
+    break;
+case 4163:
+    OP_AND(r0, r6, r3, 3073);
+    break;
+case 4164:
+    OP_AND(r0, r6, r4, 3073);
+    break;
+case 4165:
+    OP_AND(r0, r6, r5, 3073);
+    break;
+case 4166:
+    OP_AND(r0, r6, r6, 3073);
+    break;
+case 4167:
+    OP_AND(r0, r6, r7, 3073);
+    break;
+case 4168:
+    OP_AND(r0, r7, r0, 3073);
+    break;
+case 4169:
+    OP_AND(r0, r7, r1, 3073);
+    break;
+case 4170:
+    OP_AND(r0, r7, r2, 3073);
+    break;
+case 4171:
+    OP_AND(r0, r7, r3, 3073);
+    break;
+case 4172:
+    OP_AND(r0, r7, r4, 3073);
+    break;
+case 4173:
+    OP_AND(r0, r7, r5, 3073);
+    break;
+case 4174:
+    OP_AND(r0, r7, r6, 3073);
+    break;
+case 4175:
+    OP_AND(r0, r7, r7, 3073);
+    break;
+case 4176:
+    OP_AND(r1, r0, r0, 3146);
+    break;
+case 4177:
+    OP_AND(r1, r0, r1, 3146);
+    break;
+case 4178:
+    OP_AND(r1, r0, r2, 3146);
+    break;
+case 4179:
+    OP_AND(r1, r0, r3, 3146);
+    break;
+case 4180:
+    OP_AND(r1, r0, r4, 3146);
+    break;
+case 4181:
+    OP_AND(r1, r0, r5, 3146);
+    break;
+case 4182:
+    OP_AND(r1, r0, r6, 3146);
+    break;
+case 4183:
+    OP_AND(r1, r0, r7, 3146);
+    break;
+case 4184:
+    OP_AND(r1, r1, r0, 3146);
+    break;
+case 4185:
+    OP_AND(r1, r1, r1, 3146);
+    break;
+case 4186:
+    OP_AND(r1, r1, r2, 3146);
+    break;
+case 4187:
+    OP_AND(r1, r1, r3, 3146);
+    break;
+case 4188:
+    OP_AND(r1, r1, r4, 3146);
+    break;
+case 4189:
+    OP_AND(r1, r1, r5, 3146);
+    break;
+case 4190:
+    OP_AND(r1, r1, r6, 3146);
+    break;
+case 4191:
+    OP_AND(r1, r1, r7, 3146);
+    break;
+case 4192:
+    OP_AND(r1, r2, r0, 3146);
+    break;
+case 4193:
+    OP_AND(r1, r2, r1, 3146);
+    break;
+case 4194:
+    OP_AND(r1, r2, r2, 3146);
+    break;
+case 4195:
+    OP_AND(r1, r2, r3, 3146);
+    break;
+case 4196:
+    OP_AND(r1, r2, r4, 3146);
+    break;
+case 4197:
+    OP_AND(r1, r2, r5, 3146);
+    break;
+case 4198:
+    OP_AND(r1, r2, r6, 3146);
+    break;
+case 4199:
+    OP_AND(r1, r2, r7, 3146);
+    break;
+case 4200:
+    OP_AND(r1, r3, r0, 3146);
+    break;
+case 4201:
+    OP_AND(r1, r3, r1, 3146);
+    break;
+case 4202:
+    OP_AND(r1, r3, r2, 3146);
+    break;
+case 4203:
+    OP_AND(r1, r3, r3, 3146);
+    break;
+case 4204:
+    OP_AND(r1, r3, r4, 3146);
+    break;
+case 4205:
+    OP_AND(r1, r3, r5, 3146);
+    break;
+case 4206:
+    OP_AND(r1, r3, r6, 3146);
+    break;
+case 4207:
+    OP_AND(r1, r3, r7, 3146);
+    break;
+case 4208:
+    OP_AND(r1, r4, r0, 3146);
+    break;
+case 4209:
+    OP_AND(r1, r4, r1, 3146);
+    break;
+case 4210:
+    OP_AND(r1, r4, r2, 3146);
+    break;
+case 4211:
+    OP_AND(r1, r4, r3, 3146);
+    break;
+case 4212:
+    OP_AND(r1, r4, r4, 3146);
+    break;
+case 4213:
+    OP_AND(r1, r4, r5, 3146);
+    break;
+case 4214:
+    OP_AND(r1, r4, r6, 3146);
+    break;
+case 4215:
+    OP_AND(r1, r4, r7, 3146);
+    break;
+case 4216:
+    OP_AND(r1, r5, r0, 3146);
+    break;
+case 4217:
+    OP_AND(r1, r5, r1, 3146);
+    break;
+case 4218:
+    OP_AND(r1, r5, r2, 3146);
+    break;
+case 4219:
+    OP_AND(r1, r5, r3, 3146);
+    break;
+case 4220:
+    OP_AND(r1, r5, r4, 3146);
+    break;
+case 4221:
+    OP_AND(r1, r5, r5, 3146);
+    break;
+case 4222:
+    OP_AND(r1, r5, r6, 3146);
+    break;
+case 4223:
+    OP_AND(r1, r5, r7, 3146);
+    break;
+case 4224:
+    OP_AND(r1, r6, r0, 3146);
+    break;
+case 4225:
+    OP_AND(r1, r6, r1, 3146);
+    break;
+case 4226:
+    OP_AND(r1, r6, r2, 3146);
+    break;
+case 4227:
+    OP_AND(r1, r6, r3, 3146);
+    break;
+case 4228:
+    OP_AND(r1, r6, r4, 3146);
+    break;
+case 4229:
+    OP_AND(r1, r6, r5, 3146);
+    break;
+case 4230:
+    OP_AND(r1, r6, r6, 3146);
+    break;
+case 4231:
+    OP_AND(r1, r6, r7, 3146);
+    break;
+case 4232:
+    OP_AND(r1, r7, r0, 3146);
+    break;
+case 4233:
+    OP_AND(r1, r7, r1, 3146);
+    break;
+case 4234:
+    OP_AND(r1, r7, r2, 3146);
+    break;
+case 4235:
+    OP_AND(r1, r7, r3, 3146);
+    break;
+case 4236:
+    OP_AND(r1, r7, r4, 3146);
+    break;
+case 4237:
+    OP_AND(r1, r7, r5, 3146);
+    break;
+case 4238:
+    OP_AND(r1, r7, r6, 3146);
+    break;
+case 4239:
+    OP_AND(r1, r7, r7, 3146);
+    break;
+case 4240:
+    OP_AND(r2, r0, r0, 3219);
+    break;
+case 4241:
+    OP_AND(r2, r0, r1, 3219);
+    break;
+case 4242:
+    OP_AND(r2, r0, r2, 3219);
+    break;
+case 4243:
+    OP_AND(r2, r0, r3, 3219);
+    break;
+case 4244:
+    OP_AND(r2, r0, r4, 3219);
+    break;
+case 4245:
+    OP_AND(r2, r0, r5, 3219);
+    break;
+case 4246:
+    OP_AND(r2, r0, r6, 3219);
+    break;
+case 4247:
+    OP_AND(r2, r0, r7, 3219);
+    break;
+case 4248:
+    OP_AND(r2, r1, r0, 3219);
+    break;
+case 4249:
+    OP_AND(r2, r1, r1, 3219);
+    break;
+case 4250:
+    OP_AND(r2, r1, r2, 3219);
+    break;
+case 4251:
+    OP_AND(r2, r1, r3, 3219);
+    break;
+case 4252:
+    OP_AND(r2, r1, r4, 3219);
+    break;
+case 4253:
+    OP_AND(r2, r1, r5, 3219);
+    break;
+case 4254:
+    OP_AND(r2, r1, r6, 3219);
+    break;
+case 4255:
+    OP_AND(r2, r1, r7, 3219);
+    break;
+case 4256:
+    OP_AND(r2, r2, r0, 3219);
+    break;
+case 4257:
+    OP_AND(r2, r2, r1, 3219);
+    break;
+case 4258:
+    OP_AND(r2, r2, r2, 3219);
+    break;
+case 4259:
+    OP_AND(r2, r2, r3, 3219);
+    break;
+case 4260:
+    OP_AND(r2, r2, r4, 3219);
+    break;
+case 4261:
+    OP_AND(r2, r2, r5, 3219);
+    break;
+case 4262:
+    OP_AND(r2, r2, r6, 3219);
+    break;
+case 4263:
+    OP_AND(r2, r2, r7, 3219);
+    break;
+case 4264:
+    OP_AND(r2, r3, r0, 3219);
+    break;
+case 4265:
+    OP_AND(r2, r3, r1, 3219);
+    break;
+case 4266:
+    OP_AND(r2, r3, r2, 3219);
+    break;
+case 4267:
+    OP_AND(r2, r3, r3, 3219);
+    break;
+case 4268:
+    OP_AND(r2, r3, r4, 3219);
+    break;
+case 4269:
+    OP_AND(r2, r3, r5, 3219);
+    break;
+case 4270:
+    OP_AND(r2, r3, r6, 3219);
+    break;
+case 4271:
+    OP_AND(r2, r3, r7, 3219);
+    break;
+case 4272:
+    OP_AND(r2, r4, r0, 3219);
+    break;
+case 4273:
+    OP_AND(r2, r4, r1, 3219);
+    break;
+case 4274:
+    OP_AND(r2, r4, r2, 3219);
+    break;
+case 4275:
+    OP_AND(r2, r4, r3, 3219);
+    break;
+case 4276:
+    OP_AND(r2, r4, r4, 3219);
+    break;
+case 4277:
+    OP_AND(r2, r4, r5, 3219);
+    break;
+case 4278:
+    OP_AND(r2, r4, r6, 3219);
+    break;
+case 4279:
+    OP_AND(r2, r4, r7, 3219);
+    break;
+case 4280:
+    OP_AND(r2, r5, r0, 3219);
+    break;
+case 4281:
+    OP_AND(r2, r5, r1, 3219);
+    break;
+case 4282:
+    OP_AND(r2, r5, r2, 3219);
+    break;
+case 4283:
+    OP_AND(r2, r5, r3, 3219);
+    break;
+case 4284:
+    OP_AND(r2, r5, r4, 3219);
+    break;
+case 4285:
+    OP_AND(r2, r5, r5, 3219);
+    break;
+case 4286:
+    OP_AND(r2, r5, r6, 3219);
+    break;
+case 4287:
+    OP_AND(r2, r5, r7, 3219);
+    break;
+case 4288:
+    OP_AND(r2, r6, r0, 3219);
+    break;
+case 4289:
+    OP_AND(r2, r6, r1, 3219);
+    break;
+case 4290:
+    OP_AND(r2, r6, r2, 3219);
+    break;
+case 4291:
+    OP_AND(r2, r6, r3, 3219);
+    break;
+case 4292:
+    OP_AND(r2, r6, r4, 3219);
+    break;
+case 4293:
+    OP_AND(r2, r6, r5, 3219);
+    break;
+case 4294:
+    OP_AND(r2, r6, r6, 3219);
+    break;
+case 4295:
+    OP_AND(r2, r6, r7, 3219);
+    break;
+case 4296:
+    OP_AND(r2, r7, r0, 3219);
+    break;
+case 4297:
+    OP_AND(r2, r7, r1, 3219);
+    break;
+case 4298:
+    OP_AND(r2, r7, r2, 3219);
+    break;
+case 4299:
+    OP_AND(r2, r7, r3, 3219);
+    break;
+case 4300:
+    OP_AND(r2, r7, r4, 3219);
+    break;
+case 4301:
+    OP_AND(r2, r7, r5, 3219);
+    break;
+case 4302:
+    OP_AND(r2, r7, r6, 3219);
+    break;
+case 4303:
+    OP_AND(r2, r7, r7, 3219);
+    break;
+case 4304:
+    OP_AND(r3, r0, r0, 3292);
+    break;
+case 4305:
+    OP_AND(r3, r0, r1, 3292);
+    break;
+case 4306:
+    OP_AND(r3, r0, r2, 3292);
+    break;
+case 4307:
+    OP_AND(r3, r0, r3, 3292);
+    break;
+case 4308:
+    OP_AND(r3, r0, r4, 3292);
+    break;
+case 4309:
+    OP_AND(r3, r0, r5, 3292);
+    break;
+case 4310:
+    OP_AND(r3, r0, r6, 3292);
+    break;
+case 4311:
+    OP_AND(r3, r0, r7, 3292);
+    break;
+case 4312:
+    OP_AND(r3, r1, r0, 3292);
+    break;
+case 4313:
+    OP_AND(r3, r1, r1, 3292);
+    break;
+case 4314:
+    OP_AND(r3, r1, r2, 3292);
+    break;
+case 4315:
+    OP_AND(r3, r1, r3, 3292);
+    break;
+case 4316:
+    OP_AND(r3, r1, r4, 3292);
+    break;
+case 4317:
+    OP_AND(r3, r1, r5, 3292);
+    break;
+case 4318:
+    OP_AND(r3, r1, r6, 3292);
+    break;
+case 4319:
+    OP_AND(r3, r1, r7, 3292);
+    break;
+case 4320:
+    OP_AND(r3, r2, r0, 3292);
+    break;
+case 4321:
+    OP_AND(r3, r2, r1, 3292);
+    break;
+case 4322:
+    OP_AND(r3, r2, r2, 3292);
+    break;
+case 4323:
+    OP_AND(r3, r2, r3, 3292);
+    break;
+case 4324:
+    OP_AND(r3, r2, r4, 3292);
+    break;
+case 4325:
+    OP_AND(r3, r2, r5, 3292);
+    break;
+case 4326:
+    OP_AND(r3, r2, r6, 3292);
+    break;
+case 4327:
+    OP_AND(r3, r2, r7, 3292);
+    break;
+case 4328:
+    OP_AND(r3, r3, r0, 3292);
+    break;
+case 4329:
+    OP_AND(r3, r3, r1, 3292);
+    break;
+case 4330:
+    OP_AND(r3, r3, r2, 3292);
+    break;
+case 4331:
+    OP_AND(r3, r3, r3, 3292);
+    break;
+case 4332:
+    OP_AND(r3, r3, r4, 3292);
+    break;
+case 4333:
+    OP_AND(r3, r3, r5, 3292);
+    break;
+case 4334:
+    OP_AND(r3, r3, r6, 3292);
+    break;
+case 4335:
+    OP_AND(r3, r3, r7, 3292);
+    break;
+case 4336:
+    OP_AND(r3, r4, r0, 3292);
+    break;
+case 4337:
+    OP_AND(r3, r4, r1, 3292);
+    break;
+case 4338:
+    OP_AND(r3, r4, r2, 3292);
+    break;
+case 4339:
+    OP_AND(r3, r4, r3, 3292);
+    break;
+case 4340:
+    OP_AND(r3, r4, r4, 3292);
+    break;
+case 4341:
+    OP_AND(r3, r4, r5, 3292);
+    break;
+case 4342:
+    OP_AND(r3, r4, r6, 3292);
+    break;
+case 4343:
+    OP_AND(r3, r4, r7, 3292);
+    break;
+case 4344:
+    OP_AND(r3, r5, r0, 3292);
+    break;
+case 4345:
+    OP_AND(r3, r5, r1, 3292);
+    break;
+case 4346:
+    OP_AND(r3, r5, r2, 3292);
+    break;
+case 4347:
+    OP_AND(r3, r5, r3, 3292);
+    break;
+case 4348:
+    OP_AND(r3, r5, r4, 3292);
+    break;
+case 4349:
+    OP_AND(r3, r5, r5, 3292);
+    break;
+case 4350:
+    OP_AND(r3, r5, r6, 3292);
+    break;
+case 4351:
+    OP_AND(r3, r5, r7, 3292);
+    break;
+case 4352:
+    OP_AND(r3, r6, r0, 3292);
+    break;
+case 4353:
+    OP_AND(r3, r6, r1, 3292);
+    break;
+case 4354:
+    OP_AND(r3, r6, r2, 3292);
+    break;
+case 4355:
+    OP_AND(r3, r6, r3, 3292);
+    break;
+case 4356:
+    OP_AND(r3, r6, r4, 3292);
+    break;
+case 4357:
+    OP_AND(r3, r6, r5, 3292);
+    break;
+case 4358:
+    OP_AND(r3, r6, r6, 3292);
+    break;
+case 4359:
+    OP_AND(r3, r6, r7, 3292);
+    break;
+case 4360:
+    OP_AND(r3, r7, r0, 3292);
+    break;
+case 4361:
+    OP_AND(r3, r7, r1, 3292);
+    break;
+case 4362:
+    OP_AND(r3, r7, r2, 3292);
+    break;
+case 4363:
+    OP_AND(r3, r7, r3, 3292);
+    break;
+case 4364:
+    OP_AND(r3, r7, r4, 3292);
+    break;
+case 4365:
+    OP_AND(r3, r7, r5, 3292);
+    break;
+case 4366:
+    OP_AND(r3, r7, r6, 3292);
+    break;
+case 4367:
+    OP_AND(r3, r7, r7, 3292);
+    break;
+case 4368:
+    OP_AND(r4, r0, r0, 3365);
+    break;
+case 4369:
+    OP_AND(r4, r0, r1, 3365);
+    break;
+case 4370:
+    OP_AND(r4, r0, r2, 3365);
+    break;
+case 4371:
+    OP_AND(r4, r0, r3, 3365);
+    break;
+case 4372:
+    OP_AND(r4, r0, r4, 3365);
+    break;
+case 4373:
+    OP_AND(r4, r0, r5, 3365);
+    break;
+case 4374:
+    OP_AND(r4, r0, r6, 3365);
+    break;
+case 4375:
+    OP_AND(r4, r0, r7, 3365);
+    break;
+case 4376:
+    OP_AND(r4, r1, r0, 3365);
+    break;
+case 4377:
+    OP_AND(r4, r1, r1, 3365);
+    break;
+case 4378:
+    OP_AND(r4, r1, r2, 3365);
+    break;
+case 4379:
+    OP_AND(r4, r1, r3, 3365);
+    break;
+case 4380:
+    OP_AND(r4, r1, r4, 3365);
+    break;
+case 4381:
+    OP_AND(r4, r1, r5, 3365);
+    break;
+case 4382:
+    OP_AND(r4, r1, r6, 3365);
+    break;
+case 4383:
+    OP_AND(r4, r1, r7, 3365);
+    break;
+case 4384:
+    OP_AND(r4, r2, r0, 3365);
+    break;
+case 4385:
+    OP_AND(r4, r2, r1, 3365);
+    break;
+case 4386:
+    OP_AND(r4, r2, r2, 3365);
+    break;
+case 4387:
+    OP_AND(r4, r2, r3, 3365);
+    break;
+case 4388:
+    OP_AND(r4, r2, r4, 3365);
+    break;
+case 4389:
+    OP_AND(r4, r2, r5, 3365);
+    break;
+case 4390:
+    OP_AND(r4, r2, r6, 3365);
+    break;
+case 4391:
+    OP_AND(r4, r2, r7, 3365);
+    break;
+case 4392:
+    OP_AND(r4, r3, r0, 3365);
+    break;
+case 4393:
+    OP_AND(r4, r3, r1, 3365);
+    break;
+case 4394:
+    OP_AND(r4, r3, r2, 3365);
+    break;
+case 4395:
+    OP_AND(r4, r3, r3, 3365);
+    break;
+case 4396:
+    OP_AND(r4, r3, r4, 3365);
+    break;
+case 4397:
+    OP_AND(r4, r3, r5, 3365);
+    break;
+case 4398:
+    OP_AND(r4, r3, r6, 3365);
+    break;
+case 4399:
+    OP_AND(r4, r3, r7, 3365);
+    break;
+case 4400:
+    OP_AND(r4, r4, r0, 3365);
+    break;
+case 4401:
+    OP_AND(r4, r4, r1, 3365);
+    break;
+case 4402:
+    OP_AND(r4, r4, r2, 3365);
+    break;
+case 4403:
+    OP_AND(r4, r4, r3, 3365);
+    break;
+case 4404:
+    OP_AND(r4, r4, r4, 3365);
+    break;
+case 4405:
+    OP_AND(r4, r4, r5, 3365);
+    break;
+case 4406:
+    OP_AND(r4, r4, r6, 3365);
+    break;
+case 4407:
+    OP_AND(r4, r4, r7, 3365);
+    break;
+case 4408:
+    OP_AND(r4, r5, r0, 3365);
+    break;
+case 4409:
+    OP_AND(r4, r5, r1, 3365);
+    break;
+case 4410:
+    OP_AND(r4, r5, r2, 3365);
+    break;
+case 4411:
+    OP_AND(r4, r5, r3, 3365);
+    break;
+case 4412:
+    OP_AND(r4, r5, r4, 3365);
+    break;
+case 4413:
+    OP_AND(r4, r5, r5, 3365);
+    break;
+case 4414:
+    OP_AND(r4, r5, r6, 3365);
+    break;
+case 4415:
+    OP_AND(r4, r5, r7, 3365);
+    break;
+case 4416:
+    OP_AND(r4, r6, r0, 3365);
+    break;
+case 4417:
+    OP_AND(r4, r6, r1, 3365);
+    break;
+case 4418:
+    OP_AND(r4, r6, r2, 3365);
+    break;
+case 4419:
+    OP_AND(r4, r6, r3, 3365);
+    break;
+case 4420:
+    OP_AND(r4, r6, r4, 3365);
+    break;
+case 4421:
+    OP_AND(r4, r6, r5, 3365);
+    break;
+case 4422:
+    OP_AND(r4, r6, r6, 3365);
+    break;
+case 4423:
+    OP_AND(r4, r6, r7, 3365);
+    break;
+case 4424:
+    OP_AND(r4, r7, r0, 3365);
+    break;
+case 4425:
+    OP_AND(r4, r7, r1, 3365);
+    break;
+case 4426:
+    OP_AND(r4, r7, r2, 3365);
+    break;
+case 4427:
+    OP_AND(r4, r7, r3, 3365);
+    break;
+case 4428:
+    OP_AND(r4, r7, r4, 3365);
+    break;
+case 4429:
+    OP_AND(r4, r7, r5, 3365);
+    break;
+case 4430:
+    OP_AND(r4, r7, r6, 3365);
+    break;
+case 4431:
+    OP_AND(r4, r7, r7, 3365);
+    break;
+case 4432:
+    OP_AND(r5, r0, r0, 3438);
+    break;
+case 4433:
+    OP_AND(r5, r0, r1, 3438);
+    break;
+case 4434:
+    OP_AND(r5, r0, r2, 3438);
+    break;
+case 4435:
+    OP_AND(r5, r0, r3, 3438);
+    break;
+case 4436:
+    OP_AND(r5, r0, r4, 3438);
+    break;
+case 4437:
+    OP_AND(r5, r0, r5, 3438);
+    break;
+case 4438:
+    OP_AND(r5, r0, r6, 3438);
+    break;
+case 4439:
+    OP_AND(r5, r0, r7, 3438);
+    break;
+case 4440:
+    OP_AND(r5, r1, r0, 3438);
+    break;
+case 4441:
+    OP_AND(r5, r1, r1, 3438);
+    break;
+case 4442:
+    OP_AND(r5, r1, r2, 3438);
+    break;
+case 4443:
+    OP_AND(r5, r1, r3, 3438);
+    break;
+case 4444:
+    OP_AND(r5, r1, r4, 3438);
+    break;
+case 4445:
+    OP_AND(r5, r1, r5, 3438);
+    break;
+case 4446:
+    OP_AND(r5, r1, r6, 3438);
+    break;
+case 4447:
+    OP_AND(r5, r1, r7, 3438);
+    break;
+case 4448:
+    OP_AND(r5, r2, r0, 3438);
+    break;
+case 4449:
+    OP_AND(r5, r2, r1, 3438);
+    break;
+case 4450:
+    OP_AND(r5, r2, r2, 3438);
+    break;
+case 4451:
+    OP_AND(r5, r2, r3, 3438);
+    break;
+case 4452:
+    OP_AND(r5, r2, r4, 3438);
+    break;
+case 4453:
+    OP_AND(r5, r2, r5, 3438);
+    break;
+case 4454:
+    OP_AND(r5, r2, r6, 3438);
+    break;
+case 4455:
+    OP_AND(r5, r2, r7, 3438);
+    break;
+case 4456:
+    OP_AND(r5, r3, r0, 3438);
+    break;
+case 4457:
+    OP_AND(r5, r3, r1, 3438);
+    break;
+case 4458:
+    OP_AND(r5, r3, r2, 3438);
+    break;
+case 4459:
+    OP_AND(r5, r3, r3, 3438);
+    break;
+case 4460:
+    OP_AND(r5, r3, r4, 3438);
+    break;
+case 4461:
+    OP_AND(r5, r3, r5, 3438);
+    break;
+case 4462:
+    OP_AND(r5, r3, r6, 3438);
+    break;
+case 4463:
+    OP_AND(r5, r3, r7, 3438);
+    break;
+case 4464:
+    OP_AND(r5, r4, r0, 3438);
+    break;
+case 4465:
+    OP_AND(r5, r4, r1, 3438);
+    break;
+case 4466:
+    OP_AND(r5, r4, r2, 3438);
+    break;
+case 4467:
+    OP_AND(r5, r4, r3, 3438);
+    break;
+case 4468:
+    OP_AND(r5, r4, r4, 3438);
+    break;
+case 4469:
+    OP_AND(r5, r4, r5, 3438);
+    break;
+case 4470:
+    OP_AND(r5, r4, r6, 3438);
+    break;
+case 4471:
+    OP_AND(r5, r4, r7, 3438);
+    break;
+case 4472:
+    OP_AND(r5, r5, r0, 3438);
+    break;
+case 4473:
+    OP_AND(r5, r5, r1, 3438);
+    break;
+case 4474:
+    OP_AND(r5, r5, r2, 3438);
+    break;
+case 4475:
+    OP_AND(r5, r5, r3, 3438);
+    break;
+case 4476:
+    OP_AND(r5, r5, r4, 3438);
+    break;
+case 4477:
+    OP_AND(r5, r5, r5, 3438);
+    break;
+case 4478:
+    OP_AND(r5, r5, r6, 3438);
+    break;
+case 4479:
+    OP_AND(r5, r5, r7, 3438);
+    break;
+case 4480:
+    OP_AND(r5, r6, r0, 3438);
+    break;
+case 4481:
+    OP_AND(r5, r6, r1, 3438);
+    break;
+case 4482:
+    OP_AND(r5, r6, r2, 3438);
+    break;
+case 4483:
+    OP_AND(r5, r6, r3, 3438);
+    break;
+case 4484:
+    OP_AND(r5, r6, r4, 3438);
+    break;
+case 4485:
+    OP_AND(r5, r6, r5, 3438);
+    break;
+case 4486:
+    OP_AND(r5, r6, r6, 3438);
+    break;
+case 4487:
+    OP_AND(r5, r6, r7, 3438);
+    break;
+case 4488:
+    OP_AND(r5, r7, r0, 3438);
+    break;
+case 4489:
+    OP_AND(r5, r7, r1, 3438);
+    break;
+case 4490:
+    OP_AND(r5, r7, r2, 3438);
+    break;
+case 4491:
+    OP_AND(r5, r7, r3, 3438);
+    break;
+case 4492:
+    OP_AND(r5, r7, r4, 3438);
+    break;
+case 4493:
+    OP_AND(r5, r7, r5, 3438);
+    break;
+case 4494:
+    OP_AND(r5, r7, r6, 3438);
+    break;
+case 4495:
+    OP_AND(r5, r7, r7, 3438);
+    break;
+case 4496:
+    OP_AND(r6, r0, r0, 3511);
+    break;
+case 4497:
+    OP_AND(r6, r0, r1, 3511);
+    break;
+case 4498:
+    OP_AND(r6, r0, r2, 3511);
+    break;
+case 4499:
+    OP_AND(r6, r0, r3, 3511);
+    break;
+case 4500:
+    OP_AND(r6, r0, r4, 3511);
+    break;
+case 4501:
+    OP_AND(r6, r0, r5, 3511);
+    break;
+case 4502:
+    OP_AND(r6, r0, r6, 3511);
+    break;
+case 4503:
+    OP_AND(r6, r0, r7, 3511);
+    break;
+case 4504:
+    OP_AND(r6, r1, r0, 3511);
+    break;
+case 4505:
+    OP_AND(r6, r1, r1, 3511);
+    break;
+case 4506:
+    OP_AND(r6, r1, r2, 3511);
+    break;
+case 4507:
+    OP_AND(r6, r1, r3, 3511);
+    break;
+case 4508:
+    OP_AND(r6, r1, r4, 3511);
+    break;
+case 4509:
+    OP_AND(r6, r1, r5, 3511);
+    break;
+case 4510:
+    OP_AND(r6, r1, r6, 3511);
+    break;
+case 4511:
+    OP_AND(r6, r1, r7, 3511);
+    break;
+case 4512:
+    OP_AND(r6, r2, r0, 3511);
+    break;
+case 4513:
+    OP_AND(r6, r2, r1, 3511);
+    break;
+case 4514:
+    OP_AND(r6, r2, r2, 3511);
+    break;
+case 4515:
+    OP_AND(r6, r2, r3, 3511);
+    break;
+case 4516:
+    OP_AND(r6, r2, r4, 3511);
+    break;
+case 4517:
+    OP_AND(r6, r2, r5, 3511);
+    break;
+case 4518:
+    OP_AND(r6, r2, r6, 3511);
+    break;
+case 4519:
+    OP_AND(r6, r2, r7, 3511);
+    break;
+case 4520:
+    OP_AND(r6, r3, r0, 3511);
+    break;
+case 4521:
+    OP_AND(r6, r3, r1, 3511);
+    break;
+case 4522:
+    OP_AND(r6, r3, r2, 3511);
+    break;
+case 4523:
+    OP_AND(r6, r3, r3, 3511);
+    break;
+case 4524:
+    OP_AND(r6, r3, r4, 3511);
+    break;
+case 4525:
+    OP_AND(r6, r3, r5, 3511);
+    break;
+case 4526:
+    OP_AND(r6, r3, r6, 3511);
+    break;
+case 4527:
+    OP_AND(r6, r3, r7, 3511);
+    break;
+case 4528:
+    OP_AND(r6, r4, r0, 3511);
+    break;
+case 4529:
+    OP_AND(r6, r4, r1, 3511);
+    break;
+case 4530:
+    OP_AND(r6, r4, r2, 3511);
+    break;
+case 4531:
+    OP_AND(r6, r4, r3, 3511);
+    break;
+case 4532:
+    OP_AND(r6, r4, r4, 3511);
+    break;
+case 4533:
+    OP_AND(r6, r4, r5, 3511);
+    break;
+case 4534:
+    OP_AND(r6, r4, r6, 3511);
+    break;
+case 4535:
+    OP_AND(r6, r4, r7, 3511);
+    break;
+case 4536:
+    OP_AND(r6, r5, r0, 3511);
+    break;
+case 4537:
+    OP_AND(r6, r5, r1, 3511);
+    break;
+case 4538:
+    OP_AND(r6, r5, r2, 3511);
+    break;
+case 4539:
+    OP_AND(r6, r5, r3, 3511);
+    break;
+case 4540:
+    OP_AND(r6, r5, r4, 3511);
+    break;
+case 4541:
+    OP_AND(r6, r5, r5, 3511);
+    break;
+case 4542:
+    OP_AND(r6, r5, r6, 3511);
+    break;
+case 4543:
+    OP_AND(r6, r5, r7, 3511);
+    break;
+case 4544:
+    OP_AND(r6, r6, r0, 3511);
+    break;
+case 4545:
+    OP_AND(r6, r6, r1, 3511);
+    break;
+case 4546:
+    OP_AND(r6, r6, r2, 3511);
+    break;
+case 4547:
+    OP_AND(r6, r6, r3, 3511);
+    break;
+case 4548:
+    OP_AND(r6, r6, r4, 3511);
+    break;
+case 4549:
+    OP_AND(r6, r6, r5, 3511);
+    break;
+case 4550:
+    OP_AND(r6, r6, r6, 3511);
+    break;
+case 4551:
+    OP_AND(r6, r6, r7, 3511);
+    break;
+case 4552:
+    OP_AND(r6, r7, r0, 3511);
+    break;
+case 4553:
+    OP_AND(r6, r7, r1, 3511);
+    break;
+case 4554:
+    OP_AND(r6, r7, r2, 3511);
+    break;
+case 4555:
+    OP_AND(r6, r7, r3, 3511);
+    break;
+case 4556:
+    OP_AND(r6, r7, r4, 3511);
+    break;
+case 4557:
+    OP_AND(r6, r7, r5, 3511);
+    break;
+case 4558:
+    OP_AND(r6, r7, r6, 3511);
+    break;
+case 4559:
+    OP_AND(r6, r7, r7, 3511);
+    break;
+case 4560:
+    OP_AND(r7, r0, r0, 3584);
+    break;
+case 4561:
+    OP_AND(r7, r0, r1, 3584);
+    break;
+case 4562:
+    OP_AND(r7, r0, r2, 3584);
+    break;
+case 4563:
+    OP_AND(r7, r0, r3, 3584);
+    break;
+case 4564:
+    OP_AND(r7, r0, r4, 3584);
+    break;
+case 4565:
+    OP_AND(r7, r0, r5, 3584);
+    break;
+case 4566:
+    OP_AND(r7, r0, r6, 3584);
+    break;
+case 4567:
+    OP_AND(r7, r0, r7, 3584);
+    break;
+case 4568:
+    OP_AND(r7, r1, r0, 3584);
+    break;
+case 4569:
+    OP_AND(r7, r1, r1, 3584);
+    break;
+case 4570:
+    OP_AND(r7, r1, r2, 3584);
+    break;
+case 4571:
+    OP_AND(r7, r1, r3, 3584);
+    break;
+case 4572:
+    OP_AND(r7, r1, r4, 3584);
+    break;
+case 4573:
+    OP_AND(r7, r1, r5, 3584);
+    break;
+case 4574:
+    OP_AND(r7, r1, r6, 3584);
+    break;
+case 4575:
+    OP_AND(r7, r1, r7, 3584);
+    break;
+case 4576:
+    OP_AND(r7, r2, r0, 3584);
+    break;
+case 4577:
+    OP_AND(r7, r2, r1, 3584);
+    break;
+case 4578:
+    OP_AND(r7, r2, r2, 3584);
+    break;
+case 4579:
+    OP_AND(r7, r2, r3, 3584);
+    break;
+case 4580:
+    OP_AND(r7, r2, r4, 3584);
+    break;
+case 4581:
+    OP_AND(r7, r2, r5, 3584);
+    break;
+case 4582:
+    OP_AND(r7, r2, r6, 3584);
+    break;
+case 4583:
+    OP_AND(r7, r2, r7, 3584);
+    break;
+case 4584:
+    OP_AND(r7, r3, r0, 3584);
+    break;
+case 4585:
+    OP_AND(r7, r3, r1, 3584);
+    break;
+case 4586:
+    OP_AND(r7, r3, r2, 3584);
+    break;
+case 4587:
+    OP_AND(r7, r3, r3, 3584);
+    break;
+case 4588:
+    OP_AND(r7, r3, r4, 3584);
+    break;
+case 4589:
+    OP_AND(r7, r3, r5, 3584);
+    break;
+case 4590:
+    OP_AND(r7, r3, r6, 3584);
+    break;
+case 4591:
+    OP_AND(r7, r3, r7, 3584);
+    break;
+case 4592:
+    OP_AND(r7, r4, r0, 3584);
+    break;
+case 4593:
+    OP_AND(r7, r4, r1, 3584);
+    break;
+case 4594:
+    OP_AND(r7, r4, r2, 3584);
+    break;
+case 4595:
+    OP_AND(r7, r4, r3, 3584);
+    break;
+case 4596:
+    OP_AND(r7, r4, r4, 3584);
+    break;
+case 4597:
+    OP_AND(r7, r4, r5, 3584);
+    break;
+case 4598:
+    OP_AND(r7, r4, r6, 3584);
+    break;
+case 4599:
+    OP_AND(r7, r4, r7, 3584);
+    break;
+case 4600:
+    OP_AND(r7, r5, r0, 3584);
+    break;
+case 4601:
+    OP_AND(r7, r5, r1, 3584);
+    break;
+case 4602:
+    OP_AND(r7, r5, r2, 3584);
+    break;
+case 4603:
+    OP_AND(r7, r5, r3, 3584);
+    break;
+case 4604:
+    OP_AND(r7, r5, r4, 3584);
+    break;
+case 4605:
+    OP_AND(r7, r5, r5, 3584);
+    break;
+case 4606:
+    OP_AND(r7, r5, r6, 3584);
+    break;
+case 4607:
+    OP_AND(r7, r5, r7, 3584);
+    break;
+case 4608:
+    OP_AND(r7, r6, r0, 3584);
+    break;
+case 4609:
+    OP_AND(r7, r6, r1, 3584);
+    break;
+case 4610:
+    OP_AND(r7, r6, r2, 3584);
+    break;
+case 4611:
+    OP_AND(r7, r6, r3, 3584);
+    break;
+case 4612:
+    OP_AND(r7, r6, r4, 3584);
+    break;
+case 4613:
+    OP_AND(r7, r6, r5, 3584);
+    break;
+case 4614:
+    OP_AND(r7, r6, r6, 3584);
+    break;
+case 4615:
+    OP_AND(r7, r6, r7, 3584);
+    break;
+case 4616:
+    OP_AND(r7, r7, r0, 3584);
+    break;
+case 4617:
+    OP_AND(r7, r7, r1, 3584);
+    break;
+case 4618:
+    OP_AND(r7, r7, r2, 3584);
+    break;
+case 4619:
+    OP_AND(r7, r7, r3, 3584);
+    break;
+case 4620:
+    OP_AND(r7, r7, r4, 3584);
+    break;
+case 4621:
+    OP_AND(r7, r7, r5, 3584);
+    break;
+case 4622:
+    OP_AND(r7, r7, r6, 3584);
+    break;
+case 4623:
+    OP_AND(r7, r7, r7, 3584);
+    break;
+case 4624:
+    OP_ADDNOT(r0, r0, r0, 1537);
+    break;
+case 4625:
+    OP_ADDNOT(r0, r0, r1, 1538);
+    break;
+case 4626:
+    OP_ADDNOT(r0, r0, r2, 1539);
+    break;
+case 4627:
+    OP_ADDNOT(r0, r0, r3, 1540);
+    break;
+case 4628:
+    OP_ADDNOT(r0, r0, r4, 1541);
+    break;
+case 4629:
+    OP_ADDNOT(r0, r0, r5, 1542);
+    break;
+case 4630:
+    OP_ADDNOT(r0, r0, r6, 1543);
+    break;
+case 4631:
+    OP_ADDNOT(r0, r0, r7, 1544);
+    break;
+case 4632:
+    OP_ADDNOT(r0, r1, r0, 1537);
+    break;
+case 4633:
+    OP_ADDNOT(r0, r1, r1, 1538);
+    break;
+case 4634:
+    OP_ADDNOT(r0, r1, r2, 1539);
+    break;
+case 4635:
+    OP_ADDNOT(r0, r1, r3, 1540);
+    break;
+case 4636:
+    OP_ADDNOT(r0, r1, r4, 1541);
+    break;
+case 4637:
+    OP_ADDNOT(r0, r1, r5, 1542);
+    break;
+case 4638:
+    OP_ADDNOT(r0, r1, r6, 1543);
+    break;
+case 4639:
+    OP_ADDNOT(r0, r1, r7, 1544);
+    break;
+case 4640:
+    OP_ADDNOT(r0, r2, r0, 1537);
+    break;
+case 4641:
+    OP_ADDNOT(r0, r2, r1, 1538);
+    break;
+case 4642:
+    OP_ADDNOT(r0, r2, r2, 1539);
+    break;
+case 4643:
+    OP_ADDNOT(r0, r2, r3, 1540);
+    break;
+case 4644:
+    OP_ADDNOT(r0, r2, r4, 1541);
+    break;
+case 4645:
+    OP_ADDNOT(r0, r2, r5, 1542);
+    break;
+case 4646:
+    OP_ADDNOT(r0, r2, r6, 1543);
+    break;
+case 4647:
+    OP_ADDNOT(r0, r2, r7, 1544);
+    break;
+case 4648:
+    OP_ADDNOT(r0, r3, r0, 1537);
+    break;
+case 4649:
+    OP_ADDNOT(r0, r3, r1, 1538);
+    break;
+case 4650:
+    OP_ADDNOT(r0, r3, r2, 1539);
+    break;
+case 4651:
+    OP_ADDNOT(r0, r3, r3, 1540);
+    break;
+case 4652:
+    OP_ADDNOT(r0, r3, r4, 1541);
+    break;
+case 4653:
+    OP_ADDNOT(r0, r3, r5, 1542);
+    break;
+case 4654:
+    OP_ADDNOT(r0, r3, r6, 1543);
+    break;
+case 4655:
+    OP_ADDNOT(r0, r3, r7, 1544);
+    break;
+case 4656:
+    OP_ADDNOT(r0, r4, r0, 1537);
+    break;
+case 4657:
+    OP_ADDNOT(r0, r4, r1, 1538);
+    break;
+case 4658:
+    OP_ADDNOT(r0, r4, r2, 1539);
+    break;
+case 4659:
+    OP_ADDNOT(r0, r4, r3, 1540);
+    break;
+case 4660:
+    OP_ADDNOT(r0, r4, r4, 1541);
+    break;
+case 4661:
+    OP_ADDNOT(r0, r4, r5, 1542);
+    break;
+case 4662:
+    OP_ADDNOT(r0, r4, r6, 1543);
+    break;
+case 4663:
+    OP_ADDNOT(r0, r4, r7, 1544);
+    break;
+case 4664:
+    OP_ADDNOT(r0, r5, r0, 1537);
+    break;
+case 4665:
+    OP_ADDNOT(r0, r5, r1, 1538);
+    break;
+case 4666:
+    OP_ADDNOT(r0, r5, r2, 1539);
+    break;
+case 4667:
+    OP_ADDNOT(r0, r5, r3, 1540);
+    break;
+case 4668:
+    OP_ADDNOT(r0, r5, r4, 1541);
+    break;
+case 4669:
+    OP_ADDNOT(r0, r5, r5, 1542);
+    break;
+case 4670:
+    OP_ADDNOT(r0, r5, r6, 1543);
+    break;
+case 4671:
+    OP_ADDNOT(r0, r5, r7, 1544);
+    break;
+case 4672:
+    OP_ADDNOT(r0, r6, r0, 1537);
+    break;
+case 4673:
+    OP_ADDNOT(r0, r6, r1, 1538);
+    break;
+case 4674:
+    OP_ADDNOT(r0, r6, r2, 1539);
+    break;
+case 4675:
+    OP_ADDNOT(r0, r6, r3, 1540);
+    break;
+case 4676:
+    OP_ADDNOT(r0, r6, r4, 1541);
+    break;
+case 4677:
+    OP_ADDNOT(r0, r6, r5, 1542);
+    break;
+case 4678:
+    OP_ADDNOT(r0, r6, r6, 1543);
+    break;
+case 4679:
+    OP_ADDNOT(r0, r6, r7, 1544);
+    break;
+case 4680:
+    OP_ADDNOT(r0, r7, r0, 1537);
+    break;
+case 4681:
+    OP_ADDNOT(r0, r7, r1, 1538);
+    break;
+case 4682:
+    OP_ADDNOT(r0, r7, r2, 1539);
+    break;
+case 4683:
+    OP_ADDNOT(r0, r7, r3, 1540);
+    break;
+case 4684:
+    OP_ADDNOT(r0, r7, r4, 1541);
+    break;
+case 4685:
+    OP_ADDNOT(r0, r7, r5, 1542);
+    break;
+case 4686:
+    OP_ADDNOT(r0, r7, r6, 1543);
+    break;
+case 4687:
+    OP_ADDNOT(r0, r7, r7, 1544);
+    break;
+case 4688:
+    OP_ADDNOT(r1, r0, r0, 1609);
+    break;
+case 4689:
+    OP_ADDNOT(r1, r0, r1, 1610);
+    break;
+case 4690:
+    OP_ADDNOT(r1, r0, r2, 1611);
+    break;
+case 4691:
+    OP_ADDNOT(r1, r0, r3, 1612);
+    break;
+case 4692:
+    OP_ADDNOT(r1, r0, r4, 1613);
+    break;
+case 4693:
+    OP_ADDNOT(r1, r0, r5, 1614);
+    break;
+case 4694:
+    OP_ADDNOT(r1, r0, r6, 1615);
+    break;
+case 4695:
+    OP_ADDNOT(r1, r0, r7, 1616);
+    break;
+case 4696:
+    OP_ADDNOT(r1, r1, r0, 1609);
+    break;
+case 4697:
+    OP_ADDNOT(r1, r1, r1, 1610);
+    break;
+case 4698:
+    OP_ADDNOT(r1, r1, r2, 1611);
+    break;
+case 4699:
+    OP_ADDNOT(r1, r1, r3, 1612);
+    break;
+case 4700:
+    OP_ADDNOT(r1, r1, r4, 1613);
+    break;
+case 4701:
+    OP_ADDNOT(r1, r1, r5, 1614);
+    break;
+case 4702:
+    OP_ADDNOT(r1, r1, r6, 1615);
+    break;
+case 4703:
+    OP_ADDNOT(r1, r1, r7, 1616);
+    break;
+case 4704:
+    OP_ADDNOT(r1, r2, r0, 1609);
+    break;
+case 4705:
+    OP_ADDNOT(r1, r2, r1, 1610);
+    break;
+case 4706:
+    OP_ADDNOT(r1, r2, r2, 1611);
+    break;
+case 4707:
+    OP_ADDNOT(r1, r2, r3, 1612);
+    break;
+case 4708:
+    OP_ADDNOT(r1, r2, r4, 1613);
+    break;
+case 4709:
+    OP_ADDNOT(r1, r2, r5, 1614);
+    break;
+case 4710:
+    OP_ADDNOT(r1, r2, r6, 1615);
+    break;
+case 4711:
+    OP_ADDNOT(r1, r2, r7, 1616);
+    break;
+case 4712:
+    OP_ADDNOT(r1, r3, r0, 1609);
+    break;
+case 4713:
+    OP_ADDNOT(r1, r3, r1, 1610);
+    break;
+case 4714:
+    OP_ADDNOT(r1, r3, r2, 1611);
+    break;
+case 4715:
+    OP_ADDNOT(r1, r3, r3, 1612);
+    break;
+case 4716:
+    OP_ADDNOT(r1, r3, r4, 1613);
+    break;
+case 4717:
+    OP_ADDNOT(r1, r3, r5, 1614);
+    break;
+case 4718:
+    OP_ADDNOT(r1, r3, r6, 1615);
+    break;
+case 4719:
+    OP_ADDNOT(r1, r3, r7, 1616);
+    break;
+case 4720:
+    OP_ADDNOT(r1, r4, r0, 1609);
+    break;
+case 4721:
+    OP_ADDNOT(r1, r4, r1, 1610);
+    break;
+case 4722:
+    OP_ADDNOT(r1, r4, r2, 1611);
+    break;
+case 4723:
+    OP_ADDNOT(r1, r4, r3, 1612);
+    break;
+case 4724:
+    OP_ADDNOT(r1, r4, r4, 1613);
+    break;
+case 4725:
+    OP_ADDNOT(r1, r4, r5, 1614);
+    break;
+case 4726:
+    OP_ADDNOT(r1, r4, r6, 1615);
+    break;
+case 4727:
+    OP_ADDNOT(r1, r4, r7, 1616);
+    break;
+case 4728:
+    OP_ADDNOT(r1, r5, r0, 1609);
+    break;
+case 4729:
+    OP_ADDNOT(r1, r5, r1, 1610);
+    break;
+case 4730:
+    OP_ADDNOT(r1, r5, r2, 1611);
+    break;
+case 4731:
+    OP_ADDNOT(r1, r5, r3, 1612);
+    break;
+case 4732:
+    OP_ADDNOT(r1, r5, r4, 1613);
+    break;
+case 4733:
+    OP_ADDNOT(r1, r5, r5, 1614);
+    break;
+case 4734:
+    OP_ADDNOT(r1, r5, r6, 1615);
+    break;
+case 4735:
+    OP_ADDNOT(r1, r5, r7, 1616);
+    break;
+case 4736:
+    OP_ADDNOT(r1, r6, r0, 1609);
+    break;
+case 4737:
+    OP_ADDNOT(r1, r6, r1, 1610);
+    break;
+case 4738:
+    OP_ADDNOT(r1, r6, r2, 1611);
+    break;
+case 4739:
+    OP_ADDNOT(r1, r6, r3, 1612);
+    break;
+case 4740:
+    OP_ADDNOT(r1, r6, r4, 1613);
+    break;
+case 4741:
+    OP_ADDNOT(r1, r6, r5, 1614);
+    break;
+case 4742:
+    OP_ADDNOT(r1, r6, r6, 1615);
+    break;
+case 4743:
+    OP_ADDNOT(r1, r6, r7, 1616);
+    break;
+case 4744:
+    OP_ADDNOT(r1, r7, r0, 1609);
+    break;
+case 4745:
+    OP_ADDNOT(r1, r7, r1, 1610);
+    break;
+case 4746:
+    OP_ADDNOT(r1, r7, r2, 1611);
+    break;
+case 4747:
+    OP_ADDNOT(r1, r7, r3, 1612);
+    break;
+case 4748:
+    OP_ADDNOT(r1, r7, r4, 1613);
+    break;
+case 4749:
+    OP_ADDNOT(r1, r7, r5, 1614);
+    break;
+case 4750:
+    OP_ADDNOT(r1, r7, r6, 1615);
+    break;
+case 4751:
+    OP_ADDNOT(r1, r7, r7, 1616);
+    break;
+case 4752:
+    OP_ADDNOT(r2, r0, r0, 1681);
+    break;
+case 4753:
+    OP_ADDNOT(r2, r0, r1, 1682);
+    break;
+case 4754:
+    OP_ADDNOT(r2, r0, r2, 1683);
+    break;
+case 4755:
+    OP_ADDNOT(r2, r0, r3, 1684);
+    break;
+case 4756:
+    OP_ADDNOT(r2, r0, r4, 1685);
+    break;
+case 4757:
+    OP_ADDNOT(r2, r0, r5, 1686);
+    break;
+case 4758:
+    OP_ADDNOT(r2, r0, r6, 1687);
+    break;
+case 4759:
+    OP_ADDNOT(r2, r0, r7, 1688);
+    break;
+case 4760:
+    OP_ADDNOT(r2, r1, r0, 1681);
+    break;
+case 4761:
+    OP_ADDNOT(r2, r1, r1, 1682);
+    break;
+case 4762:
+    OP_ADDNOT(r2, r1, r2, 1683);
+    break;
+case 4763:
+    OP_ADDNOT(r2, r1, r3, 1684);
+    break;
+case 4764:
+    OP_ADDNOT(r2, r1, r4, 1685);
+    break;
+case 4765:
+    OP_ADDNOT(r2, r1, r5, 1686);
+    break;
+case 4766:
+    OP_ADDNOT(r2, r1, r6, 1687);
+    break;
+case 4767:
+    OP_ADDNOT(r2, r1, r7, 1688);
+    break;
+case 4768:
+    OP_ADDNOT(r2, r2, r0, 1681);
+    break;
+case 4769:
+    OP_ADDNOT(r2, r2, r1, 1682);
+    break;
+case 4770:
+    OP_ADDNOT(r2, r2, r2, 1683);
+    break;
+case 4771:
+    OP_ADDNOT(r2, r2, r3, 1684);
+    break;
+case 4772:
+    OP_ADDNOT(r2, r2, r4, 1685);
+    break;
+case 4773:
+    OP_ADDNOT(r2, r2, r5, 1686);
+    break;
+case 4774:
+    OP_ADDNOT(r2, r2, r6, 1687);
+    break;
+case 4775:
+    OP_ADDNOT(r2, r2, r7, 1688);
+    break;
+case 4776:
+    OP_ADDNOT(r2, r3, r0, 1681);
+    break;
+case 4777:
+    OP_ADDNOT(r2, r3, r1, 1682);
+    break;
+case 4778:
+    OP_ADDNOT(r2, r3, r2, 1683);
+    break;
+case 4779:
+    OP_ADDNOT(r2, r3, r3, 1684);
+    break;
+case 4780:
+    OP_ADDNOT(r2, r3, r4, 1685);
+    break;
+case 4781:
+    OP_ADDNOT(r2, r3, r5, 1686);
+    break;
+case 4782:
+    OP_ADDNOT(r2, r3, r6, 1687);
+    break;
+case 4783:
+    OP_ADDNOT(r2, r3, r7, 1688);
+    break;
+case 4784:
+    OP_ADDNOT(r2, r4, r0, 1681);
+    break;
+case 4785:
+    OP_ADDNOT(r2, r4, r1, 1682);
+    break;
+case 4786:
+    OP_ADDNOT(r2, r4, r2, 1683);
+    break;
+case 4787:
+    OP_ADDNOT(r2, r4, r3, 1684);
+    break;
+case 4788:
+    OP_ADDNOT(r2, r4, r4, 1685);
+    break;
+case 4789:
+    OP_ADDNOT(r2, r4, r5, 1686);
+    break;
+case 4790:
+    OP_ADDNOT(r2, r4, r6, 1687);
+    break;
+case 4791:
+    OP_ADDNOT(r2, r4, r7, 1688);
+    break;
+case 4792:
+    OP_ADDNOT(r2, r5, r0, 1681);
+    break;
+case 4793:
+    OP_ADDNOT(r2, r5, r1, 1682);
+    break;
+case 4794:
+    OP_ADDNOT(r2, r5, r2, 1683);
+    break;
+case 4795:
+    OP_ADDNOT(r2, r5, r3, 1684);
+    break;
+case 4796:
+    OP_ADDNOT(r2, r5, r4, 1685);
+    break;
+case 4797:
+    OP_ADDNOT(r2, r5, r5, 1686);
+    break;
+case 4798:
+    OP_ADDNOT(r2, r5, r6, 1687);
+    break;
+case 4799:
+    OP_ADDNOT(r2, r5, r7, 1688);
+    break;
+case 4800:
+    OP_ADDNOT(r2, r6, r0, 1681);
+    break;
+case 4801:
+    OP_ADDNOT(r2, r6, r1, 1682);
+    break;
+case 4802:
+    OP_ADDNOT(r2, r6, r2, 1683);
+    break;
+case 4803:
+    OP_ADDNOT(r2, r6, r3, 1684);
+    break;
+case 4804:
+    OP_ADDNOT(r2, r6, r4, 1685);
+    break;
+case 4805:
+    OP_ADDNOT(r2, r6, r5, 1686);
+    break;
+case 4806:
+    OP_ADDNOT(r2, r6, r6, 1687);
+    break;
+case 4807:
+    OP_ADDNOT(r2, r6, r7, 1688);
+    break;
+case 4808:
+    OP_ADDNOT(r2, r7, r0, 1681);
+    break;
+case 4809:
+    OP_ADDNOT(r2, r7, r1, 1682);
+    break;
+case 4810:
+    OP_ADDNOT(r2, r7, r2, 1683);
+    break;
+case 4811:
+    OP_ADDNOT(r2, r7, r3, 1684);
+    break;
+case 4812:
+    OP_ADDNOT(r2, r7, r4, 1685);
+    break;
+case 4813:
+    OP_ADDNOT(r2, r7, r5, 1686);
+    break;
+case 4814:
+    OP_ADDNOT(r2, r7, r6, 1687);
+    break;
+case 4815:
+    OP_ADDNOT(r2, r7, r7, 1688);
+    break;
+case 4816:
+    OP_ADDNOT(r3, r0, r0, 1753);
+    break;
+case 4817:
+    OP_ADDNOT(r3, r0, r1, 1754);
+    break;
+case 4818:
+    OP_ADDNOT(r3, r0, r2, 1755);
+    break;
+case 4819:
+    OP_ADDNOT(r3, r0, r3, 1756);
+    break;
+case 4820:
+    OP_ADDNOT(r3, r0, r4, 1757);
+    break;
+case 4821:
+    OP_ADDNOT(r3, r0, r5, 1758);
+    break;
+case 4822:
+    OP_ADDNOT(r3, r0, r6, 1759);
+    break;
+case 4823:
+    OP_ADDNOT(r3, r0, r7, 1760);
+    break;
+case 4824:
+    OP_ADDNOT(r3, r1, r0, 1753);
+    break;
+case 4825:
+    OP_ADDNOT(r3, r1, r1, 1754);
+    break;
+case 4826:
+    OP_ADDNOT(r3, r1, r2, 1755);
+    break;
+case 4827:
+    OP_ADDNOT(r3, r1, r3, 1756);
+    break;
+case 4828:
+    OP_ADDNOT(r3, r1, r4, 1757);
+    break;
+case 4829:
+    OP_ADDNOT(r3, r1, r5, 1758);
+    break;
+case 4830:
+    OP_ADDNOT(r3, r1, r6, 1759);
+    break;
+case 4831:
+    OP_ADDNOT(r3, r1, r7, 1760);
+    break;
+case 4832:
+    OP_ADDNOT(r3, r2, r0, 1753);
+    break;
+case 4833:
+    OP_ADDNOT(r3, r2, r1, 1754);
+    break;
+case 4834:
+    OP_ADDNOT(r3, r2, r2, 1755);
+    break;
+case 4835:
+    OP_ADDNOT(r3, r2, r3, 1756);
+    break;
+case 4836:
+    OP_ADDNOT(r3, r2, r4, 1757);
+    break;
+case 4837:
+    OP_ADDNOT(r3, r2, r5, 1758);
+    break;
+case 4838:
+    OP_ADDNOT(r3, r2, r6, 1759);
+    break;
+case 4839:
+    OP_ADDNOT(r3, r2, r7, 1760);
+    break;
+case 4840:
+    OP_ADDNOT(r3, r3, r0, 1753);
+    break;
+case 4841:
+    OP_ADDNOT(r3, r3, r1, 1754);
+    break;
+case 4842:
+    OP_ADDNOT(r3, r3, r2, 1755);
+    break;
+case 4843:
+    OP_ADDNOT(r3, r3, r3, 1756);
+    break;
+case 4844:
+    OP_ADDNOT(r3, r3, r4, 1757);
+    break;
+case 4845:
+    OP_ADDNOT(r3, r3, r5, 1758);
+    break;
+case 4846:
+    OP_ADDNOT(r3, r3, r6, 1759);
+    break;
+case 4847:
+    OP_ADDNOT(r3, r3, r7, 1760);
+    break;
+case 4848:
+    OP_ADDNOT(r3, r4, r0, 1753);
+    break;
+case 4849:
+    OP_ADDNOT(r3, r4, r1, 1754);
+    break;
+case 4850:
+    OP_ADDNOT(r3, r4, r2, 1755);
+    break;
+case 4851:
+    OP_ADDNOT(r3, r4, r3, 1756);
+    break;
+case 4852:
+    OP_ADDNOT(r3, r4, r4, 1757);
+    break;
+case 4853:
+    OP_ADDNOT(r3, r4, r5, 1758);
+    break;
+case 4854:
+    OP_ADDNOT(r3, r4, r6, 1759);
+    break;
+case 4855:
+    OP_ADDNOT(r3, r4, r7, 1760);
+    break;
+case 4856:
+    OP_ADDNOT(r3, r5, r0, 1753);
+    break;
+case 4857:
+    OP_ADDNOT(r3, r5, r1, 1754);
+    break;
+case 4858:
+    OP_ADDNOT(r3, r5, r2, 1755);
+    break;
+case 4859:
+    OP_ADDNOT(r3, r5, r3, 1756);
+    break;
+case 4860:
+    OP_ADDNOT(r3, r5, r4, 1757);
+    break;
+case 4861:
+    OP_ADDNOT(r3, r5, r5, 1758);
+    break;
+case 4862:
+    OP_ADDNOT(r3, r5, r6, 1759);
+    break;
+case 4863:
+    OP_ADDNOT(r3, r5, r7, 1760);
+    break;
+case 4864:
+    OP_ADDNOT(r3, r6, r0, 1753);
+    break;
+case 4865:
+    OP_ADDNOT(r3, r6, r1, 1754);
+    break;
+case 4866:
+    OP_ADDNOT(r3, r6, r2, 1755);
+    break;
+case 4867:
+    OP_ADDNOT(r3, r6, r3, 1756);
+    break;
+case 4868:
+    OP_ADDNOT(r3, r6, r4, 1757);
+    break;
+case 4869:
+    OP_ADDNOT(r3, r6, r5, 1758);
+    break;
+case 4870:
+    OP_ADDNOT(r3, r6, r6, 1759);
+    break;
+case 4871:
+    OP_ADDNOT(r3, r6, r7, 1760);
+    break;
+case 4872:
+    OP_ADDNOT(r3, r7, r0, 1753);
+    break;
+case 4873:
+    OP_ADDNOT(r3, r7, r1, 1754);
+    break;
+case 4874:
+    OP_ADDNOT(r3, r7, r2, 1755);
+    break;
+case 4875:
+    OP_ADDNOT(r3, r7, r3, 1756);
+    break;
+case 4876:
+    OP_ADDNOT(r3, r7, r4, 1757);
+    break;
+case 4877:
+    OP_ADDNOT(r3, r7, r5, 1758);
+    break;
+case 4878:
+    OP_ADDNOT(r3, r7, r6, 1759);
+    break;
+case 4879:
+    OP_ADDNOT(r3, r7, r7, 1760);
+    break;
+case 4880:
+    OP_ADDNOT(r4, r0, r0, 1825);
+    break;
+case 4881:
+    OP_ADDNOT(r4, r0, r1, 1826);
+    break;
+case 4882:
+    OP_ADDNOT(r4, r0, r2, 1827);
+    break;
+case 4883:
+    OP_ADDNOT(r4, r0, r3, 1828);
+    break;
+case 4884:
+    OP_ADDNOT(r4, r0, r4, 1829);
+    break;
+case 4885:
+    OP_ADDNOT(r4, r0, r5, 1830);
+    break;
+case 4886:
+    OP_ADDNOT(r4, r0, r6, 1831);
+    break;
+case 4887:
+    OP_ADDNOT(r4, r0, r7, 1832);
+    break;
+case 4888:
+    OP_ADDNOT(r4, r1, r0, 1825);
+    break;
+case 4889:
+    OP_ADDNOT(r4, r1, r1, 1826);
+    break;
+case 4890:
+    OP_ADDNOT(r4, r1, r2, 1827);
+    break;
+case 4891:
+    OP_ADDNOT(r4, r1, r3, 1828);
+    break;
+case 4892:
+    OP_ADDNOT(r4, r1, r4, 1829);
+    break;
+case 4893:
+    OP_ADDNOT(r4, r1, r5, 1830);
+    break;
+case 4894:
+    OP_ADDNOT(r4, r1, r6, 1831);
+    break;
+case 4895:
+    OP_ADDNOT(r4, r1, r7, 1832);
+    break;
+case 4896:
+    OP_ADDNOT(r4, r2, r0, 1825);
+    break;
+case 4897:
+    OP_ADDNOT(r4, r2, r1, 1826);
+    break;
+case 4898:
+    OP_ADDNOT(r4, r2, r2, 1827);
+    break;
+case 4899:
+    OP_ADDNOT(r4, r2, r3, 1828);
+    break;
+case 4900:
+    OP_ADDNOT(r4, r2, r4, 1829);
+    break;
+case 4901:
+    OP_ADDNOT(r4, r2, r5, 1830);
+    break;
+case 4902:
+    OP_ADDNOT(r4, r2, r6, 1831);
+    break;
+case 4903:
+    OP_ADDNOT(r4, r2, r7, 1832);
+    break;
+case 4904:
+    OP_ADDNOT(r4, r3, r0, 1825);
+    break;
+case 4905:
+    OP_ADDNOT(r4, r3, r1, 1826);
+    break;
+case 4906:
+    OP_ADDNOT(r4, r3, r2, 1827);
+    break;
+case 4907:
+    OP_ADDNOT(r4, r3, r3, 1828);
+    break;
+case 4908:
+    OP_ADDNOT(r4, r3, r4, 1829);
+    break;
+case 4909:
+    OP_ADDNOT(r4, r3, r5, 1830);
+    break;
+case 4910:
+    OP_ADDNOT(r4, r3, r6, 1831);
+    break;
+case 4911:
+    OP_ADDNOT(r4, r3, r7, 1832);
+    break;
+case 4912:
+    OP_ADDNOT(r4, r4, r0, 1825);
+    break;
+case 4913:
+    OP_ADDNOT(r4, r4, r1, 1826);
+    break;
+case 4914:
+    OP_ADDNOT(r4, r4, r2, 1827);
+    break;
+case 4915:
+    OP_ADDNOT(r4, r4, r3, 1828);
+    break;
+case 4916:
+    OP_ADDNOT(r4, r4, r4, 1829);
+    break;
+case 4917:
+    OP_ADDNOT(r4, r4, r5, 1830);
+    break;
+case 4918:
+    OP_ADDNOT(r4, r4, r6, 1831);
+    break;
+case 4919:
+    OP_ADDNOT(r4, r4, r7, 1832);
+    break;
+case 4920:
+    OP_ADDNOT(r4, r5, r0, 1825);
+    break;
+case 4921:
+    OP_ADDNOT(r4, r5, r1, 1826);
+    break;
+case 4922:
+    OP_ADDNOT(r4, r5, r2, 1827);
+    break;
+case 4923:
+    OP_ADDNOT(r4, r5, r3, 1828);
+    break;
+case 4924:
+    OP_ADDNOT(r4, r5, r4, 1829);
+    break;
+case 4925:
+    OP_ADDNOT(r4, r5, r5, 1830);
+    break;
+case 4926:
+    OP_ADDNOT(r4, r5, r6, 1831);
+    break;
+case 4927:
+    OP_ADDNOT(r4, r5, r7, 1832);
+    break;
+case 4928:
+    OP_ADDNOT(r4, r6, r0, 1825);
+    break;
+case 4929:
+    OP_ADDNOT(r4, r6, r1, 1826);
+    break;
+case 4930:
+    OP_ADDNOT(r4, r6, r2, 1827);
+    break;
+case 4931:
+    OP_ADDNOT(r4, r6, r3, 1828);
+    break;
+case 4932:
+    OP_ADDNOT(r4, r6, r4, 1829);
+    break;
+case 4933:
+    OP_ADDNOT(r4, r6, r5, 1830);
+    break;
+case 4934:
+    OP_ADDNOT(r4, r6, r6, 1831);
+    break;
+case 4935:
+    OP_ADDNOT(r4, r6, r7, 1832);
+    break;
+case 4936:
+    OP_ADDNOT(r4, r7, r0, 1825);
+    break;
+case 4937:
+    OP_ADDNOT(r4, r7, r1, 1826);
+    break;
+case 4938:
+    OP_ADDNOT(r4, r7, r2, 1827);
+    break;
+case 4939:
+    OP_ADDNOT(r4, r7, r3, 1828);
+    break;
+case 4940:
+    OP_ADDNOT(r4, r7, r4, 1829);
+    break;
+case 4941:
+    OP_ADDNOT(r4, r7, r5, 1830);
+    break;
+case 4942:
+    OP_ADDNOT(r4, r7, r6, 1831);
+    break;
+case 4943:
+    OP_ADDNOT(r4, r7, r7, 1832);
+    break;
+case 4944:
+    OP_ADDNOT(r5, r0, r0, 1897);
+    break;
+case 4945:
+    OP_ADDNOT(r5, r0, r1, 1898);
+    break;
+case 4946:
+    OP_ADDNOT(r5, r0, r2, 1899);
+    break;
+case 4947:
+    OP_ADDNOT(r5, r0, r3, 1900);
+    break;
+case 4948:
+    OP_ADDNOT(r5, r0, r4, 1901);
+    break;
+case 4949:
+    OP_ADDNOT(r5, r0, r5, 1902);
+    break;
+case 4950:
+    OP_ADDNOT(r5, r0, r6, 1903);
+    break;
+case 4951:
+    OP_ADDNOT(r5, r0, r7, 1904);
+    break;
+case 4952:
+    OP_ADDNOT(r5, r1, r0, 1897);
+    break;
+case 4953:
+    OP_ADDNOT(r5, r1, r1, 1898);
+    break;
+case 4954:
+    OP_ADDNOT(r5, r1, r2, 1899);
+    break;
+case 4955:
+    OP_ADDNOT(r5, r1, r3, 1900);
+    break;
+case 4956:
+    OP_ADDNOT(r5, r1, r4, 1901);
+    break;
+case 4957:
+    OP_ADDNOT(r5, r1, r5, 1902);
+    break;
+case 4958:
+    OP_ADDNOT(r5, r1, r6, 1903);
+    break;
+case 4959:
+    OP_ADDNOT(r5, r1, r7, 1904);
+    break;
+case 4960:
+    OP_ADDNOT(r5, r2, r0, 1897);
+    break;
+case 4961:
+    OP_ADDNOT(r5, r2, r1, 1898);
+    break;
+case 4962:
+    OP_ADDNOT(r5, r2, r2, 1899);
+    break;
+case 4963:
+    OP_ADDNOT(r5, r2, r3, 1900);
+    break;
+case 4964:
+    OP_ADDNOT(r5, r2, r4, 1901);
+    break;
+case 4965:
+    OP_ADDNOT(r5, r2, r5, 1902);
+    break;
+case 4966:
+    OP_ADDNOT(r5, r2, r6, 1903);
+    break;
+case 4967:
+    OP_ADDNOT(r5, r2, r7, 1904);
+    break;
+case 4968:
+    OP_ADDNOT(r5, r3, r0, 1897);
+    break;
+case 4969:
+    OP_ADDNOT(r5, r3, r1, 1898);
+    break;
+case 4970:
+    OP_ADDNOT(r5, r3, r2, 1899);
+    break;
+case 4971:
+    OP_ADDNOT(r5, r3, r3, 1900);
+    break;
+case 4972:
+    OP_ADDNOT(r5, r3, r4, 1901);
+    break;
+case 4973:
+    OP_ADDNOT(r5, r3, r5, 1902);
+    break;
+case 4974:
+    OP_ADDNOT(r5, r3, r6, 1903);
+    break;
+case 4975:
+    OP_ADDNOT(r5, r3, r7, 1904);
+    break;
+case 4976:
+    OP_ADDNOT(r5, r4, r0, 1897);
+    break;
+case 4977:
+    OP_ADDNOT(r5, r4, r1, 1898);
+    break;
+case 4978:
+    OP_ADDNOT(r5, r4, r2, 1899);
+    break;
+case 4979:
+    OP_ADDNOT(r5, r4, r3, 1900);
+    break;
+case 4980:
+    OP_ADDNOT(r5, r4, r4, 1901);
+    break;
+case 4981:
+    OP_ADDNOT(r5, r4, r5, 1902);
+    break;
+case 4982:
+    OP_ADDNOT(r5, r4, r6, 1903);
+    break;
+case 4983:
+    OP_ADDNOT(r5, r4, r7, 1904);
+    break;
+case 4984:
+    OP_ADDNOT(r5, r5, r0, 1897);
+    break;
+case 4985:
+    OP_ADDNOT(r5, r5, r1, 1898);
+    break;
+case 4986:
+    OP_ADDNOT(r5, r5, r2, 1899);
+    break;
+case 4987:
+    OP_ADDNOT(r5, r5, r3, 1900);
+    break;
+case 4988:
+    OP_ADDNOT(r5, r5, r4, 1901);
+    break;
+case 4989:
+    OP_ADDNOT(r5, r5, r5, 1902);
+    break;
+case 4990:
+    OP_ADDNOT(r5, r5, r6, 1903);
+    break;
+case 4991:
+    OP_ADDNOT(r5, r5, r7, 1904);
+    break;
+case 4992:
+    OP_ADDNOT(r5, r6, r0, 1897);
+    break;
+case 4993:
+    OP_ADDNOT(r5, r6, r1, 1898);
+    break;
+case 4994:
+    OP_ADDNOT(r5, r6, r2, 1899);
+    break;
+case 4995:
+    OP_ADDNOT(r5, r6, r3, 1900);
+    break;
+case 4996:
+    OP_ADDNOT(r5, r6, r4, 1901);
+    break;
+case 4997:
+    OP_ADDNOT(r5, r6, r5, 1902);
+    break;
+case 4998:
+    OP_ADDNOT(r5, r6, r6, 1903);
+    break;
+case 4999:
+    OP_ADDNOT(r5, r6, r7, 1904);
+    break;
+case 5000:
+    OP_ADDNOT(r5, r7, r0, 1897);
+    break;
+case 5001:
+    OP_ADDNOT(r5, r7, r1, 1898);
+    break;
+case 5002:
+    OP_ADDNOT(r5, r7, r2, 1899);
+    break;
+case 5003:
+    OP_ADDNOT(r5, r7, r3, 1900);
+    break;
+case 5004:
+    OP_ADDNOT(r5, r7, r4, 1901);
+    break;
+case 5005:
+    OP_ADDNOT(r5, r7, r5, 1902);
+    break;
+case 5006:
+    OP_ADDNOT(r5, r7, r6, 1903);
+    break;
+case 5007:
+    OP_ADDNOT(r5, r7, r7, 1904);
+    break;
+case 5008:
+    OP_ADDNOT(r6, r0, r0, 1969);
+    break;
+case 5009:
+    OP_ADDNOT(r6, r0, r1, 1970);
+    break;
+case 5010:
+    OP_ADDNOT(r6, r0, r2, 1971);
+    break;
+case 5011:
+    OP_ADDNOT(r6, r0, r3, 1972);
+    break;
+case 5012:
+    OP_ADDNOT(r6, r0, r4, 1973);
+    break;
+case 5013:
+    OP_ADDNOT(r6, r0, r5, 1974);
+    break;
+case 5014:
+    OP_ADDNOT(r6, r0, r6, 1975);
+    break;
+case 5015:
+    OP_ADDNOT(r6, r0, r7, 1976);
+    break;
+case 5016:
+    OP_ADDNOT(r6, r1, r0, 1969);
+    break;
+case 5017:
+    OP_ADDNOT(r6, r1, r1, 1970);
+    break;
+case 5018:
+    OP_ADDNOT(r6, r1, r2, 1971);
+    break;
+case 5019:
+    OP_ADDNOT(r6, r1, r3, 1972);
+    break;
+case 5020:
+    OP_ADDNOT(r6, r1, r4, 1973);
+    break;
+case 5021:
+    OP_ADDNOT(r6, r1, r5, 1974);
+    break;
+case 5022:
+    OP_ADDNOT(r6, r1, r6, 1975);
+    break;
+case 5023:
+    OP_ADDNOT(r6, r1, r7, 1976);
+    break;
+case 5024:
+    OP_ADDNOT(r6, r2, r0, 1969);
+    break;
+case 5025:
+    OP_ADDNOT(r6, r2, r1, 1970);
+    break;
+case 5026:
+    OP_ADDNOT(r6, r2, r2, 1971);
+    break;
+case 5027:
+    OP_ADDNOT(r6, r2, r3, 1972);
+    break;
+case 5028:
+    OP_ADDNOT(r6, r2, r4, 1973);
+    break;
+case 5029:
+    OP_ADDNOT(r6, r2, r5, 1974);
+    break;
+case 5030:
+    OP_ADDNOT(r6, r2, r6, 1975);
+    break;
+case 5031:
+    OP_ADDNOT(r6, r2, r7, 1976);
+    break;
+case 5032:
+    OP_ADDNOT(r6, r3, r0, 1969);
+    break;
+case 5033:
+    OP_ADDNOT(r6, r3, r1, 1970);
+    break;
+case 5034:
+    OP_ADDNOT(r6, r3, r2, 1971);
+    break;
+case 5035:
+    OP_ADDNOT(r6, r3, r3, 1972);
+    break;
+case 5036:
+    OP_ADDNOT(r6, r3, r4, 1973);
+    break;
+case 5037:
+    OP_ADDNOT(r6, r3, r5, 1974);
+    break;
+case 5038:
+    OP_ADDNOT(r6, r3, r6, 1975);
+    break;
+case 5039:
+    OP_ADDNOT(r6, r3, r7, 1976);
+    break;
+case 5040:
+    OP_ADDNOT(r6, r4, r0, 1969);
+    break;
+case 5041:
+    OP_ADDNOT(r6, r4, r1, 1970);
+    break;
+case 5042:
+    OP_ADDNOT(r6, r4, r2, 1971);
+    break;
+case 5043:
+    OP_ADDNOT(r6, r4, r3, 1972);
+    break;
+case 5044:
+    OP_ADDNOT(r6, r4, r4, 1973);
+    break;
+case 5045:
+    OP_ADDNOT(r6, r4, r5, 1974);
+    break;
+case 5046:
+    OP_ADDNOT(r6, r4, r6, 1975);
+    break;
+case 5047:
+    OP_ADDNOT(r6, r4, r7, 1976);
+    break;
+case 5048:
+    OP_ADDNOT(r6, r5, r0, 1969);
+    break;
+case 5049:
+    OP_ADDNOT(r6, r5, r1, 1970);
+    break;
+case 5050:
+    OP_ADDNOT(r6, r5, r2, 1971);
+    break;
+case 5051:
+    OP_ADDNOT(r6, r5, r3, 1972);
+    break;
+case 5052:
+    OP_ADDNOT(r6, r5, r4, 1973);
+    break;
+case 5053:
+    OP_ADDNOT(r6, r5, r5, 1974);
+    break;
+case 5054:
+    OP_ADDNOT(r6, r5, r6, 1975);
+    break;
+case 5055:
+    OP_ADDNOT(r6, r5, r7, 1976);
+    break;
+case 5056:
+    OP_ADDNOT(r6, r6, r0, 1969);
+    break;
+case 5057:
+    OP_ADDNOT(r6, r6, r1, 1970);
+    break;
+case 5058:
+    OP_ADDNOT(r6, r6, r2, 1971);
+    break;
+case 5059:
+    OP_ADDNOT(r6, r6, r3, 1972);
+    break;
+case 5060:
+    OP_ADDNOT(r6, r6, r4, 1973);
+    break;
+case 5061:
+    OP_ADDNOT(r6, r6, r5, 1974);
+    break;
+case 5062:
+    OP_ADDNOT(r6, r6, r6, 1975);
+    break;
+case 5063:
+    OP_ADDNOT(r6, r6, r7, 1976);
+    break;
+case 5064:
+    OP_ADDNOT(r6, r7, r0, 1969);
+    break;
+case 5065:
+    OP_ADDNOT(r6, r7, r1, 1970);
+    break;
+case 5066:
+    OP_ADDNOT(r6, r7, r2, 1971);
+    break;
+case 5067:
+    OP_ADDNOT(r6, r7, r3, 1972);
+    break;
+case 5068:
+    OP_ADDNOT(r6, r7, r4, 1973);
+    break;
+case 5069:
+    OP_ADDNOT(r6, r7, r5, 1974);
+    break;
+case 5070:
+    OP_ADDNOT(r6, r7, r6, 1975);
+    break;
+case 5071:
+    OP_ADDNOT(r6, r7, r7, 1976);
+    break;
+case 5072:
+    OP_ADDNOT(r7, r0, r0, 2041);
+    break;
+case 5073:
+    OP_ADDNOT(r7, r0, r1, 2042);
+    break;
+case 5074:
+    OP_ADDNOT(r7, r0, r2, 2043);
+    break;
+case 5075:
+    OP_ADDNOT(r7, r0, r3, 2044);
+    break;
+case 5076:
+    OP_ADDNOT(r7, r0, r4, 2045);
+    break;
+case 5077:
+    OP_ADDNOT(r7, r0, r5, 2046);
+    break;
+case 5078:
+    OP_ADDNOT(r7, r0, r6, 2047);
+    break;
+case 5079:
+    OP_ADDNOT(r7, r0, r7, 2048);
+    break;
+case 5080:
+    OP_ADDNOT(r7, r1, r0, 2041);
+    break;
+case 5081:
+    OP_ADDNOT(r7, r1, r1, 2042);
+    break;
+case 5082:
+    OP_ADDNOT(r7, r1, r2, 2043);
+    break;
+case 5083:
+    OP_ADDNOT(r7, r1, r3, 2044);
+    break;
+case 5084:
+    OP_ADDNOT(r7, r1, r4, 2045);
+    break;
+case 5085:
+    OP_ADDNOT(r7, r1, r5, 2046);
+    break;
+case 5086:
+    OP_ADDNOT(r7, r1, r6, 2047);
+    break;
+case 5087:
+    OP_ADDNOT(r7, r1, r7, 2048);
+    break;
+case 5088:
+    OP_ADDNOT(r7, r2, r0, 2041);
+    break;
+case 5089:
+    OP_ADDNOT(r7, r2, r1, 2042);
+    break;
+case 5090:
+    OP_ADDNOT(r7, r2, r2, 2043);
+    break;
+case 5091:
+    OP_ADDNOT(r7, r2, r3, 2044);
+    break;
+case 5092:
+    OP_ADDNOT(r7, r2, r4, 2045);
+    break;
+case 5093:
+    OP_ADDNOT(r7, r2, r5, 2046);
+    break;
+case 5094:
+    OP_ADDNOT(r7, r2, r6, 2047);
+    break;
+case 5095:
+    OP_ADDNOT(r7, r2, r7, 2048);
+    break;
+case 5096:
+    OP_ADDNOT(r7, r3, r0, 2041);
+    break;
+case 5097:
+    OP_ADDNOT(r7, r3, r1, 2042);
+    break;
+case 5098:
+    OP_ADDNOT(r7, r3, r2, 2043);
+    break;
+case 5099:
+    OP_ADDNOT(r7, r3, r3, 2044);
+    break;
+case 5100:
+    OP_ADDNOT(r7, r3, r4, 2045);
+    break;
+case 5101:
+    OP_ADDNOT(r7, r3, r5, 2046);
+    break;
+case 5102:
+    OP_ADDNOT(r7, r3, r6, 2047);
+    break;
+case 5103:
+    OP_ADDNOT(r7, r3, r7, 2048);
+    break;
+case 5104:
+    OP_ADDNOT(r7, r4, r0, 2041);
+    break;
+case 5105:
+    OP_ADDNOT(r7, r4, r1, 2042);
+    break;
+case 5106:
+    OP_ADDNOT(r7, r4, r2, 2043);
+    break;
+case 5107:
+    OP_ADDNOT(r7, r4, r3, 2044);
+    break;
+case 5108:
+    OP_ADDNOT(r7, r4, r4, 2045);
+    break;
+case 5109:
+    OP_ADDNOT(r7, r4, r5, 2046);
+    break;
+case 5110:
+    OP_ADDNOT(r7, r4, r6, 2047);
+    break;
+case 5111:
+    OP_ADDNOT(r7, r4, r7, 2048);
+    break;
+case 5112:
+    OP_ADDNOT(r7, r5, r0, 2041);
+    break;
+case 5113:
+    OP_ADDNOT(r7, r5, r1, 2042);
+    break;
+case 5114:
+    OP_ADDNOT(r7, r5, r2, 2043);
+    break;
+case 5115:
+    OP_ADDNOT(r7, r5, r3, 2044);
+    break;
+case 5116:
+    OP_ADDNOT(r7, r5, r4, 2045);
+    break;
+case 5117:
+    OP_ADDNOT(r7, r5, r5, 2046);
+    break;
+case 5118:
+    OP_ADDNOT(r7, r5, r6, 2047);
+    break;
+case 5119:
+    OP_ADDNOT(r7, r5, r7, 2048);
+    break;
+case 5120:
+    OP_ADDNOT(r7, r6, r0, 2041);
+    break;
+case 5121:
+    OP_ADDNOT(r7, r6, r1, 2042);
+    break;
+case 5122:
+    OP_ADDNOT(r7, r6, r2, 2043);
+    break;
+case 5123:
+    OP_ADDNOT(r7, r6, r3, 2044);
+    break;
+case 5124:
+    OP_ADDNOT(r7, r6, r4, 2045);
+    break;
+case 5125:
+    OP_ADDNOT(r7, r6, r5, 2046);
+    break;
+case 5126:
+    OP_ADDNOT(r7, r6, r6, 2047);
+    break;
+case 5127:
+    OP_ADDNOT(r7, r6, r7, 2048);
+    break;
+case 5128:
+    OP_ADDNOT(r7, r7, r0, 2041);
+    break;
+case 5129:
+    OP_ADDNOT(r7, r7, r1, 2042);
+    break;
+case 5130:
+    OP_ADDNOT(r7, r7, r2, 2043);
+    break;
+case 5131:
+    OP_ADDNOT(r7, r7, r3, 2044);
+    break;
+case 5132:
+    OP_ADDNOT(r7, r7, r4, 2045);
+    break;
+case 5133:
+    OP_ADDNOT(r7, r7, r5, 2046);
+    break;
+case 5134:
+    OP_ADDNOT(r7, r7, r6, 2047);
+    break;
+case 5135:
+    OP_ADDNOT(r7, r7, r7, 2048);
+    break;
+case 5137:
+    SPILL_REGISTERS();
+    RUN_NAND(0);
+    if ((RUN_WORD(1) >> 28) == 6 &&
+        (RUN_WORD(2) >> 28) == 6 &&
+        (RUN_WORD(3) >> 28) == 6 &&
+        (RUN_WORD(4) >> 28) == 6 &&
+        (RUN_WORD(5) >> 28) == 6) {
+        RUN_NAND(1);
+        RUN_NAND(2);
+        RUN_NAND(3);
+        RUN_NAND(4);
+        RUN_NAND(5);
+        program_pointer += 5;
+    }
+    RELOAD_REGISTERS();
+    break;
+case 5136:
+    SPILL_REGISTERS();
+    RUN_NAND(0);
+    if ((RUN_WORD(1) >> 28) == 6 &&
+        (RUN_WORD(2) >> 28) == 6) {
+        RUN_NAND(1);
+        RUN_NAND(2);
+        program_pointer += 2;
+    }
+    RELOAD_REGISTERS();
+    break;
+case 5138:
+    SPILL_REGISTERS();
+    RUN_NAND(0);
+    if ((RUN_WORD(1) >> 28) == 3 &&
+        (RUN_WORD(2) >> 28) == 3) {
+        RUN_ADD(1);
+        RUN_ADD(2);
+        program_pointer += 2;
+    }
+    RELOAD_REGISTERS();
+    break;
+case 5139:
+    OP_SSTORE_WATCHED(r0, r0, r0);
+    break;
+case 5140:
+    OP_SSTORE_WATCHED(r0, r0, r1);
+    break;
+case 5141:
+    OP_SSTORE_WATCHED(r0, r0, r2);
+    break;
+case 5142:
+    OP_SSTORE_WATCHED(r0, r0, r3);
+    break;
+case 5143:
+    OP_SSTORE_WATCHED(r0, r0, r4);
+    break;
+case 5144:
+    OP_SSTORE_WATCHED(r0, r0, r5);
+    break;
+case 5145:
+    OP_SSTORE_WATCHED(r0, r0, r6);
+    break;
+case 5146:
+    OP_SSTORE_WATCHED(r0, r0, r7);
+    break;
+case 5147:
+    OP_SSTORE_WATCHED(r0, r1, r0);
+    break;
+case 5148:
+    OP_SSTORE_WATCHED(r0, r1, r1);
+    break;
+case 5149:
+    OP_SSTORE_WATCHED(r0, r1, r2);
+    break;
+case 5150:
+    OP_SSTORE_WATCHED(r0, r1, r3);
+    break;
+case 5151:
+    OP_SSTORE_WATCHED(r0, r1, r4);
+    break;
+case 5152:
+    OP_SSTORE_WATCHED(r0, r1, r5);
+    break;
+case 5153:
+    OP_SSTORE_WATCHED(r0, r1, r6);
+    break;
+case 5154:
+    OP_SSTORE_WATCHED(r0, r1, r7);
+    break;
+case 5155:
+    OP_SSTORE_WATCHED(r0, r2, r0);
+    break;
+case 5156:
+    OP_SSTORE_WATCHED(r0, r2, r1);
+    break;
+case 5157:
+    OP_SSTORE_WATCHED(r0, r2, r2);
+    break;
+case 5158:
+    OP_SSTORE_WATCHED(r0, r2, r3);
+    break;
+case 5159:
+    OP_SSTORE_WATCHED(r0, r2, r4);
+    break;
+case 5160:
+    OP_SSTORE_WATCHED(r0, r2, r5);
+    break;
+case 5161:
+    OP_SSTORE_WATCHED(r0, r2, r6);
+    break;
+case 5162:
+    OP_SSTORE_WATCHED(r0, r2, r7);
+    break;
+case 5163:
+    OP_SSTORE_WATCHED(r0, r3, r0);
+    break;
+case 5164:
+    OP_SSTORE_WATCHED(r0, r3, r1);
+    break;
+case 5165:
+    OP_SSTORE_WATCHED(r0, r3, r2);
+    break;
+case 5166:
+    OP_SSTORE_WATCHED(r0, r3, r3);
+    break;
+case 5167:
+    OP_SSTORE_WATCHED(r0, r3, r4);
+    break;
+case 5168:
+    OP_SSTORE_WATCHED(r0, r3, r5);
+    break;
+case 5169:
+    OP_SSTORE_WATCHED(r0, r3, r6);
+    break;
+case 5170:
+    OP_SSTORE_WATCHED(r0, r3, r7);
+    break;
+case 5171:
+    OP_SSTORE_WATCHED(r0, r4, r0);
+    break;
+case 5172:
+    OP_SSTORE_WATCHED(r0, r4, r1);
+    break;
+case 5173:
+    OP_SSTORE_WATCHED(r0, r4, r2);
+    break;
+case 5174:
+    OP_SSTORE_WATCHED(r0, r4, r3);
+    break;
+case 5175:
+    OP_SSTORE_WATCHED(r0, r4, r4);
+    break;
+case 5176:
+    OP_SSTORE_WATCHED(r0, r4, r5);
+    break;
+case 5177:
+    OP_SSTORE_WATCHED(r0, r4, r6);
+    break;
+case 5178:
+    OP_SSTORE_WATCHED(r0, r4, r7);
+    break;
+case 5179:
+    OP_SSTORE_WATCHED(r0, r5, r0);
+    break;
+case 5180:
+    OP_SSTORE_WATCHED(r0, r5, r1);
+    break;
+case 5181:
+    OP_SSTORE_WATCHED(r0, r5, r2);
+    break;
+case 5182:
+    OP_SSTORE_WATCHED(r0, r5, r3);
+    break;
+case 5183:
+    OP_SSTORE_WATCHED(r0, r5, r4);
+    break;
+case 5184:
+    OP_SSTORE_WATCHED(r0, r5, r5);
+    break;
+case 5185:
+    OP_SSTORE_WATCHED(r0, r5, r6);
+    break;
+case 5186:
+    OP_SSTORE_WATCHED(r0, r5, r7);
+    break;
+case 5187:
+    OP_SSTORE_WATCHED(r0, r6, r0);
+    break;
+case 5188:
+    OP_SSTORE_WATCHED(r0, r6, r1);
+    break;
+case 5189:
+    OP_SSTORE_WATCHED(r0, r6, r2);
+    break;
+case 5190:
+    OP_SSTORE_WATCHED(r0, r6, r3);
+    break;
+case 5191:
+    OP_SSTORE_WATCHED(r0, r6, r4);
+    break;
+case 5192:
+    OP_SSTORE_WATCHED(r0, r6, r5);
+    break;
+case 5193:
+    OP_SSTORE_WATCHED(r0, r6, r6);
+    break;
+case 5194:
+    OP_SSTORE_WATCHED(r0, r6, r7);
+    break;
+case 5195:
+    OP_SSTORE_WATCHED(r0, r7, r0);
+    break;
+case 5196:
+    OP_SSTORE_WATCHED(r0, r7, r1);
+    break;
+case 5197:
+    OP_SSTORE_WATCHED(r0, r7, r2);
+    break;
+case 5198:
+    OP_SSTORE_WATCHED(r0, r7, r3);
+    break;
+case 5199:
+    OP_SSTORE_WATCHED(r0, r7, r4);
+    break;
+case 5200:
+    OP_SSTORE_WATCHED(r0, r7, r5);
+    break;
+case 5201:
+    OP_SSTORE_WATCHED(r0, r7, r6);
+    break;
+case 5202:
+    OP_SSTORE_WATCHED(r0, r7, r7);
+    break;
+case 5203:
+    OP_SSTORE_WATCHED(r1, r0, r0);
+    break;
+case 5204:
+    OP_SSTORE_WATCHED(r1, r0, r1);
+    break;
+case 5205:
+    OP_SSTORE_WATCHED(r1, r0, r2);
+    break;
+case 5206:
+    OP_SSTORE_WATCHED(r1, r0, r3);
+    break;
+case 5207:
+    OP_SSTORE_WATCHED(r1, r0, r4);
+    break;
+case 5208:
+    OP_SSTORE_WATCHED(r1, r0, r5);
+    break;
+case 5209:
+    OP_SSTORE_WATCHED(r1, r0, r6);
+    break;
+case 5210:
+    OP_SSTORE_WATCHED(r1, r0, r7);
+    break;
+case 5211:
+    OP_SSTORE_WATCHED(r1, r1, r0);
+    break;
+case 5212:
+    OP_SSTORE_WATCHED(r1, r1, r1);
+    break;
+case 5213:
+    OP_SSTORE_WATCHED(r1, r1, r2);
+    break;
+case 5214:
+    OP_SSTORE_WATCHED(r1, r1, r3);
+    break;
+case 5215:
+    OP_SSTORE_WATCHED(r1, r1, r4);
+    break;
+case 5216:
+    OP_SSTORE_WATCHED(r1, r1, r5);
+    break;
+case 5217:
+    OP_SSTORE_WATCHED(r1, r1, r6);
+    break;
+case 5218:
+    OP_SSTORE_WATCHED(r1, r1, r7);
+    break;
+case 5219:
+    OP_SSTORE_WATCHED(r1, r2, r0);
+    break;
+case 5220:
+    OP_SSTORE_WATCHED(r1, r2, r1);
+    break;
+case 5221:
+    OP_SSTORE_WATCHED(r1, r2, r2);
+    break;
+case 5222:
+    OP_SSTORE_WATCHED(r1, r2, r3);
+    break;
+case 5223:
+    OP_SSTORE_WATCHED(r1, r2, r4);
+    break;
+case 5224:
+    OP_SSTORE_WATCHED(r1, r2, r5);
+    break;
+case 5225:
+    OP_SSTORE_WATCHED(r1, r2, r6);
+    break;
+case 5226:
+    OP_SSTORE_WATCHED(r1, r2, r7);
+    break;
+case 5227:
+    OP_SSTORE_WATCHED(r1, r3, r0);
+    break;
+case 5228:
+    OP_SSTORE_WATCHED(r1, r3, r1);
+    break;
+case 5229:
+    OP_SSTORE_WATCHED(r1, r3, r2);
+    break;
+case 5230:
+    OP_SSTORE_WATCHED(r1, r3, r3);
+    break;
+case 5231:
+    OP_SSTORE_WATCHED(r1, r3, r4);
+    break;
+case 5232:
+    OP_SSTORE_WATCHED(r1, r3, r5);
+    break;
+case 5233:
+    OP_SSTORE_WATCHED(r1, r3, r6);
+    break;
+case 5234:
+    OP_SSTORE_WATCHED(r1, r3, r7);
+    break;
+case 5235:
+    OP_SSTORE_WATCHED(r1, r4, r0);
+    break;
+case 5236:
+    OP_SSTORE_WATCHED(r1, r4, r1);
+    break;
+case 5237:
+    OP_SSTORE_WATCHED(r1, r4, r2);
+    break;
+case 5238:
+    OP_SSTORE_WATCHED(r1, r4, r3);
+    break;
+case 5239:
+    OP_SSTORE_WATCHED(r1, r4, r4);
+    break;
+case 5240:
+    OP_SSTORE_WATCHED(r1, r4, r5);
+    break;
+case 5241:
+    OP_SSTORE_WATCHED(r1, r4, r6);
+    break;
+case 5242:
+    OP_SSTORE_WATCHED(r1, r4, r7);
+    break;
+case 5243:
+    OP_SSTORE_WATCHED(r1, r5, r0);
+    break;
+case 5244:
+    OP_SSTORE_WATCHED(r1, r5, r1);
+    break;
+case 5245:
+    OP_SSTORE_WATCHED(r1, r5, r2);
+    break;
+case 5246:
+    OP_SSTORE_WATCHED(r1, r5, r3);
+    break;
+case 5247:
+    OP_SSTORE_WATCHED(r1, r5, r4);
+    break;
+case 5248:
+    OP_SSTORE_WATCHED(r1, r5, r5);
+    break;
+case 5249:
+    OP_SSTORE_WATCHED(r1, r5, r6);
+    break;
+case 5250:
+    OP_SSTORE_WATCHED(r1, r5, r7);
+    break;
+case 5251:
+    OP_SSTORE_WATCHED(r1, r6, r0);
+    break;
+case 5252:
+    OP_SSTORE_WATCHED(r1, r6, r1);
+    break;
+case 5253:
+    OP_SSTORE_WATCHED(r1, r6, r2);
+    break;
+case 5254:
+    OP_SSTORE_WATCHED(r1, r6, r3);
+    break;
+case 5255:
+    OP_SSTORE_WATCHED(r1, r6, r4);
+    break;
+case 5256:
+    OP_SSTORE_WATCHED(r1, r6, r5);
+    break;
+case 5257:
+    OP_SSTORE_WATCHED(r1, r6, r6);
+    break;
+case 5258:
+    OP_SSTORE_WATCHED(r1, r6, r7);
+    break;
+case 5259:
+    OP_SSTORE_WATCHED(r1, r7, r0);
+    break;
+case 5260:
+    OP_SSTORE_WATCHED(r1, r7, r1);
+    break;
+case 5261:
+    OP_SSTORE_WATCHED(r1, r7, r2);
+    break;
+case 5262:
+    OP_SSTORE_WATCHED(r1, r7, r3);
+    break;
+case 5263:
+    OP_SSTORE_WATCHED(r1, r7, r4);
+    break;
+case 5264:
+    OP_SSTORE_WATCHED(r1, r7, r5);
+    break;
+case 5265:
+    OP_SSTORE_WATCHED(r1, r7, r6);
+    break;
+case 5266:
+    OP_SSTORE_WATCHED(r1, r7, r7);
+    break;
+case 5267:
+    OP_SSTORE_WATCHED(r2, r0, r0);
+    break;
+case 5268:
+    OP_SSTORE_WATCHED(r2, r0, r1);
+    break;
+case 5269:
+    OP_SSTORE_WATCHED(r2, r0, r2);
+    break;
+case 5270:
+    OP_SSTORE_WATCHED(r2, r0, r3);
+    break;
+case 5271:
+    OP_SSTORE_WATCHED(r2, r0, r4);
+    break;
+case 5272:
+    OP_SSTORE_WATCHED(r2, r0, r5);
+    break;
+case 5273:
+    OP_SSTORE_WATCHED(r2, r0, r6);
+    break;
+case 5274:
+    OP_SSTORE_WATCHED(r2, r0, r7);
+    break;
+case 5275:
+    OP_SSTORE_WATCHED(r2, r1, r0);
+    break;
+case 5276:
+    OP_SSTORE_WATCHED(r2, r1, r1);
+    break;
+case 5277:
+    OP_SSTORE_WATCHED(r2, r1, r2);
+    break;
+case 5278:
+    OP_SSTORE_WATCHED(r2, r1, r3);
+    break;
+case 5279:
+    OP_SSTORE_WATCHED(r2, r1, r4);
+    break;
+case 5280:
+    OP_SSTORE_WATCHED(r2, r1, r5);
+    break;
+case 5281:
+    OP_SSTORE_WATCHED(r2, r1, r6);
+    break;
+case 5282:
+    OP_SSTORE_WATCHED(r2, r1, r7);
+    break;
+case 5283:
+    OP_SSTORE_WATCHED(r2, r2, r0);
+    break;
+case 5284:
+    OP_SSTORE_WATCHED(r2, r2, r1);
+    break;
+case 5285:
+    OP_SSTORE_WATCHED(r2, r2, r2);
+    break;
+case 5286:
+    OP_SSTORE_WATCHED(r2, r2, r3);
+    break;
+case 5287:
+    OP_SSTORE_WATCHED(r2, r2, r4);
+    break;
+case 5288:
+    OP_SSTORE_WATCHED(r2, r2, r5);
+    break;
+case 5289:
+    OP_SSTORE_WATCHED(r2, r2, r6);
+    break;
+case 5290:
+    OP_SSTORE_WATCHED(r2, r2, r7);
+    break;
+case 5291:
+    OP_SSTORE_WATCHED(r2, r3, r0);
+    break;
+case 5292:
+    OP_SSTORE_WATCHED(r2, r3, r1);
+    break;
+case 5293:
+    OP_SSTORE_WATCHED(r2, r3, r2);
+    break;
+case 5294:
+    OP_SSTORE_WATCHED(r2, r3, r3);
+    break;
+case 5295:
+    OP_SSTORE_WATCHED(r2, r3, r4);
+    break;
+case 5296:
+    OP_SSTORE_WATCHED(r2, r3, r5);
+    break;
+case 5297:
+    OP_SSTORE_WATCHED(r2, r3, r6);
+    break;
+case 5298:
+    OP_SSTORE_WATCHED(r2, r3, r7);
+    break;
+case 5299:
+    OP_SSTORE_WATCHED(r2, r4, r0);
+    break;
+case 5300:
+    OP_SSTORE_WATCHED(r2, r4, r1);
+    break;
+case 5301:
+    OP_SSTORE_WATCHED(r2, r4, r2);
+    break;
+case 5302:
+    OP_SSTORE_WATCHED(r2, r4, r3);
+    break;
+case 5303:
+    OP_SSTORE_WATCHED(r2, r4, r4);
+    break;
+case 5304:
+    OP_SSTORE_WATCHED(r2, r4, r5);
+    break;
+case 5305:
+    OP_SSTORE_WATCHED(r2, r4, r6);
+    break;
+case 5306:
+    OP_SSTORE_WATCHED(r2, r4, r7);
+    break;
+case 5307:
+    OP_SSTORE_WATCHED(r2, r5, r0);
+    break;
+case 5308:
+    OP_SSTORE_WATCHED(r2, r5, r1);
+    break;
+case 5309:
+    OP_SSTORE_WATCHED(r2, r5, r2);
+    break;
+case 5310:
+    OP_SSTORE_WATCHED(r2, r5, r3);
+    break;
+case 5311:
+    OP_SSTORE_WATCHED(r2, r5, r4);
+    break;
+case 5312:
+    OP_SSTORE_WATCHED(r2, r5, r5);
+    break;
+case 5313:
+    OP_SSTORE_WATCHED(r2, r5, r6);
+    break;
+case 5314:
+    OP_SSTORE_WATCHED(r2, r5, r7);
+    break;
+case 5315:
+    OP_SSTORE_WATCHED(r2, r6, r0);
+    break;
+case 5316:
+    OP_SSTORE_WATCHED(r2, r6, r1);
+    break;
+case 5317:
+    OP_SSTORE_WATCHED(r2, r6, r2);
+    break;
+case 5318:
+    OP_SSTORE_WATCHED(r2, r6, r3);
+    break;
+case 5319:
+    OP_SSTORE_WATCHED(r2, r6, r4);
+    break;
+case 5320:
+    OP_SSTORE_WATCHED(r2, r6, r5);
+    break;
+case 5321:
+    OP_SSTORE_WATCHED(r2, r6, r6);
+    break;
+case 5322:
+    OP_SSTORE_WATCHED(r2, r6, r7);
+    break;
+case 5323:
+    OP_SSTORE_WATCHED(r2, r7, r0);
+    break;
+case 5324:
+    OP_SSTORE_WATCHED(r2, r7, r1);
+    break;
+case 5325:
+    OP_SSTORE_WATCHED(r2, r7, r2);
+    break;
+case 5326:
+    OP_SSTORE_WATCHED(r2, r7, r3);
+    break;
+case 5327:
+    OP_SSTORE_WATCHED(r2, r7, r4);
+    break;
+case 5328:
+    OP_SSTORE_WATCHED(r2, r7, r5);
+    break;
+case 5329:
+    OP_SSTORE_WATCHED(r2, r7, r6);
+    break;
+case 5330:
+    OP_SSTORE_WATCHED(r2, r7, r7);
+    break;
+case 5331:
+    OP_SSTORE_WATCHED(r3, r0, r0);
+    break;
+case 5332:
+    OP_SSTORE_WATCHED(r3, r0, r1);
+    break;
+case 5333:
+    OP_SSTORE_WATCHED(r3, r0, r2);
+    break;
+case 5334:
+    OP_SSTORE_WATCHED(r3, r0, r3);
+    break;
+case 5335:
+    OP_SSTORE_WATCHED(r3, r0, r4);
+    break;
+case 5336:
+    OP_SSTORE_WATCHED(r3, r0, r5);
+    break;
+case 5337:
+    OP_SSTORE_WATCHED(r3, r0, r6);
+    break;
+case 5338:
+    OP_SSTORE_WATCHED(r3, r0, r7);
+    break;
+case 5339:
+    OP_SSTORE_WATCHED(r3, r1, r0);
+    break;
+case 5340:
+    OP_SSTORE_WATCHED(r3, r1, r1);
+    break;
+case 5341:
+    OP_SSTORE_WATCHED(r3, r1, r2);
+    break;
+case 5342:
+    OP_SSTORE_WATCHED(r3, r1, r3);
+    break;
+case 5343:
+    OP_SSTORE_WATCHED(r3, r1, r4);
+    break;
+case 5344:
+    OP_SSTORE_WATCHED(r3, r1, r5);
+    break;
+case 5345:
+    OP_SSTORE_WATCHED(r3, r1, r6);
+    break;
+case 5346:
+    OP_SSTORE_WATCHED(r3, r1, r7);
+    break;
+case 5347:
+    OP_SSTORE_WATCHED(r3, r2, r0);
+    break;
+case 5348:
+    OP_SSTORE_WATCHED(r3, r2, r1);
+    break;
+case 5349:
+    OP_SSTORE_WATCHED(r3, r2, r2);
+    break;
+case 5350:
+    OP_SSTORE_WATCHED(r3, r2, r3);
+    break;
+case 5351:
+    OP_SSTORE_WATCHED(r3, r2, r4);
+    break;
+case 5352:
+    OP_SSTORE_WATCHED(r3, r2, r5);
+    break;
+case 5353:
+    OP_SSTORE_WATCHED(r3, r2, r6);
+    break;
+case 5354:
+    OP_SSTORE_WATCHED(r3, r2, r7);
+    break;
+case 5355:
+    OP_SSTORE_WATCHED(r3, r3, r0);
+    break;
+case 5356:
+    OP_SSTORE_WATCHED(r3, r3, r1);
+    break;
+case 5357:
+    OP_SSTORE_WATCHED(r3, r3, r2);
+    break;
+case 5358:
+    OP_SSTORE_WATCHED(r3, r3, r3);
+    break;
+case 5359:
+    OP_SSTORE_WATCHED(r3, r3, r4);
+    break;
+case 5360:
+    OP_SSTORE_WATCHED(r3, r3, r5);
+    break;
+case 5361:
+    OP_SSTORE_WATCHED(r3, r3, r6);
+    break;
+case 5362:
+    OP_SSTORE_WATCHED(r3, r3, r7);
+    break;
+case 5363:
+    OP_SSTORE_WATCHED(r3, r4, r0);
+    break;
+case 5364:
+    OP_SSTORE_WATCHED(r3, r4, r1);
+    break;
+case 5365:
+    OP_SSTORE_WATCHED(r3, r4, r2);
+    break;
+case 5366:
+    OP_SSTORE_WATCHED(r3, r4, r3);
+    break;
+case 5367:
+    OP_SSTORE_WATCHED(r3, r4, r4);
+    break;
+case 5368:
+    OP_SSTORE_WATCHED(r3, r4, r5);
+    break;
+case 5369:
+    OP_SSTORE_WATCHED(r3, r4, r6);
+    break;
+case 5370:
+    OP_SSTORE_WATCHED(r3, r4, r7);
+    break;
+case 5371:
+    OP_SSTORE_WATCHED(r3, r5, r0);
+    break;
+case 5372:
+    OP_SSTORE_WATCHED(r3, r5, r1);
+    break;
+case 5373:
+    OP_SSTORE_WATCHED(r3, r5, r2);
+    break;
+case 5374:
+    OP_SSTORE_WATCHED(r3, r5, r3);
+    break;
+case 5375:
+    OP_SSTORE_WATCHED(r3, r5, r4);
+    break;
+case 5376:
+    OP_SSTORE_WATCHED(r3, r5, r5);
+    break;
+case 5377:
+    OP_SSTORE_WATCHED(r3, r5, r6);
+    break;
+case 5378:
+    OP_SSTORE_WATCHED(r3, r5, r7);
+    break;
+case 5379:
+    OP_SSTORE_WATCHED(r3, r6, r0);
+    break;
+case 5380:
+    OP_SSTORE_WATCHED(r3, r6, r1);
+    break;
+case 5381:
+    OP_SSTORE_WATCHED(r3, r6, r2);
+    break;
+case 5382:
+    OP_SSTORE_WATCHED(r3, r6, r3);
+    break;
+case 5383:
+    OP_SSTORE_WATCHED(r3, r6, r4);
+    break;
+case 5384:
+    OP_SSTORE_WATCHED(r3, r6, r5);
+    break;
+case 5385:
+    OP_SSTORE_WATCHED(r3, r6, r6);
+    break;
+case 5386:
+    OP_SSTORE_WATCHED(r3, r6, r7);
+    break;
+case 5387:
+    OP_SSTORE_WATCHED(r3, r7, r0);
+    break;
+case 5388:
+    OP_SSTORE_WATCHED(r3, r7, r1);
+    break;
+case 5389:
+    OP_SSTORE_WATCHED(r3, r7, r2);
+    break;
+case 5390:
+    OP_SSTORE_WATCHED(r3, r7, r3);
+    break;
+case 5391:
+    OP_SSTORE_WATCHED(r3, r7, r4);
+    break;
+case 5392:
+    OP_SSTORE_WATCHED(r3, r7, r5);
+    break;
+case 5393:
+    OP_SSTORE_WATCHED(r3, r7, r6);
+    break;
+case 5394:
+    OP_SSTORE_WATCHED(r3, r7, r7);
+    break;
+case 5395:
+    OP_SSTORE_WATCHED(r4, r0, r0);
+    break;
+case 5396:
+    OP_SSTORE_WATCHED(r4, r0, r1);
+    break;
+case 5397:
+    OP_SSTORE_WATCHED(r4, r0, r2);
+    break;
+case 5398:
+    OP_SSTORE_WATCHED(r4, r0, r3);
+    break;
+case 5399:
+    OP_SSTORE_WATCHED(r4, r0, r4);
+    break;
+case 5400:
+    OP_SSTORE_WATCHED(r4, r0, r5);
+    break;
+case 5401:
+    OP_SSTORE_WATCHED(r4, r0, r6);
+    break;
+case 5402:
+    OP_SSTORE_WATCHED(r4, r0, r7);
+    break;
+case 5403:
+    OP_SSTORE_WATCHED(r4, r1, r0);
+    break;
+case 5404:
+    OP_SSTORE_WATCHED(r4, r1, r1);
+    break;
+case 5405:
+    OP_SSTORE_WATCHED(r4, r1, r2);
+    break;
+case 5406:
+    OP_SSTORE_WATCHED(r4, r1, r3);
+    break;
+case 5407:
+    OP_SSTORE_WATCHED(r4, r1, r4);
+    break;
+case 5408:
+    OP_SSTORE_WATCHED(r4, r1, r5);
+    break;
+case 5409:
+    OP_SSTORE_WATCHED(r4, r1, r6);
+    break;
+case 5410:
+    OP_SSTORE_WATCHED(r4, r1, r7);
+    break;
+case 5411:
+    OP_SSTORE_WATCHED(r4, r2, r0);
+    break;
+case 5412:
+    OP_SSTORE_WATCHED(r4, r2, r1);
+    break;
+case 5413:
+    OP_SSTORE_WATCHED(r4, r2, r2);
+    break;
+case 5414:
+    OP_SSTORE_WATCHED(r4, r2, r3);
+    break;
+case 5415:
+    OP_SSTORE_WATCHED(r4, r2, r4);
+    break;
+case 5416:
+    OP_SSTORE_WATCHED(r4, r2, r5);
+    break;
+case 5417:
+    OP_SSTORE_WATCHED(r4, r2, r6);
+    break;
+case 5418:
+    OP_SSTORE_WATCHED(r4, r2, r7);
+    break;
+case 5419:
+    OP_SSTORE_WATCHED(r4, r3, r0);
+    break;
+case 5420:
+    OP_SSTORE_WATCHED(r4, r3, r1);
+    break;
+case 5421:
+    OP_SSTORE_WATCHED(r4, r3, r2);
+    break;
+case 5422:
+    OP_SSTORE_WATCHED(r4, r3, r3);
+    break;
+case 5423:
+    OP_SSTORE_WATCHED(r4, r3, r4);
+    break;
+case 5424:
+    OP_SSTORE_WATCHED(r4, r3, r5);
+    break;
+case 5425:
+    OP_SSTORE_WATCHED(r4, r3, r6);
+    break;
+case 5426:
+    OP_SSTORE_WATCHED(r4, r3, r7);
+    break;
+case 5427:
+    OP_SSTORE_WATCHED(r4, r4, r0);
+    break;
+case 5428:
+    OP_SSTORE_WATCHED(r4, r4, r1);
+    break;
+case 5429:
+    OP_SSTORE_WATCHED(r4, r4, r2);
+    break;
+case 5430:
+    OP_SSTORE_WATCHED(r4, r4, r3);
+    break;
+case 5431:
+    OP_SSTORE_WATCHED(r4, r4, r4);
+    break;
+case 5432:
+    OP_SSTORE_WATCHED(r4, r4, r5);
+    break;
+case 5433:
+    OP_SSTORE_WATCHED(r4, r4, r6);
+    break;
+case 5434:
+    OP_SSTORE_WATCHED(r4, r4, r7);
+    break;
+case 5435:
+    OP_SSTORE_WATCHED(r4, r5, r0);
+    break;
+case 5436:
+    OP_SSTORE_WATCHED(r4, r5, r1);
+    break;
+case 5437:
+    OP_SSTORE_WATCHED(r4, r5, r2);
+    break;
+case 5438:
+    OP_SSTORE_WATCHED(r4, r5, r3);
+    break;
+case 5439:
+    OP_SSTORE_WATCHED(r4, r5, r4);
+    break;
+case 5440:
+    OP_SSTORE_WATCHED(r4, r5, r5);
+    break;
+case 5441:
+    OP_SSTORE_WATCHED(r4, r5, r6);
+    break;
+case 5442:
+    OP_SSTORE_WATCHED(r4, r5, r7);
+    break;
+case 5443:
+    OP_SSTORE_WATCHED(r4, r6, r0);
+    break;
+case 5444:
+    OP_SSTORE_WATCHED(r4, r6, r1);
+    break;
+case 5445:
+    OP_SSTORE_WATCHED(r4, r6, r2);
+    break;
+case 5446:
+    OP_SSTORE_WATCHED(r4, r6, r3);
+    break;
+case 5447:
+    OP_SSTORE_WATCHED(r4, r6, r4);
+    break;
+case 5448:
+    OP_SSTORE_WATCHED(r4, r6, r5);
+    break;
+case 5449:
+    OP_SSTORE_WATCHED(r4, r6, r6);
+    break;
+case 5450:
+    OP_SSTORE_WATCHED(r4, r6, r7);
+    break;
+case 5451:
+    OP_SSTORE_WATCHED(r4, r7, r0);
+    break;
+case 5452:
+    OP_SSTORE_WATCHED(r4, r7, r1);
+    break;
+case 5453:
+    OP_SSTORE_WATCHED(r4, r7, r2);
+    break;
+case 5454:
+    OP_SSTORE_WATCHED(r4, r7, r3);
+    break;
+case 5455:
+    OP_SSTORE_WATCHED(r4, r7, r4);
+    break;
+case 5456:
+    OP_SSTORE_WATCHED(r4, r7, r5);
+    break;
+case 5457:
+    OP_SSTORE_WATCHED(r4, r7, r6);
+    break;
+case 5458:
+    OP_SSTORE_WATCHED(r4, r7, r7);
+    break;
+case 5459:
+    OP_SSTORE_WATCHED(r5, r0, r0);
+    break;
+case 5460:
+    OP_SSTORE_WATCHED(r5, r0, r1);
+    break;
+case 5461:
+    OP_SSTORE_WATCHED(r5, r0, r2);
+    break;
+case 5462:
+    OP_SSTORE_WATCHED(r5, r0, r3);
+    break;
+case 5463:
+    OP_SSTORE_WATCHED(r5, r0, r4);
+    break;
+case 5464:
+    OP_SSTORE_WATCHED(r5, r0, r5);
+    break;
+case 5465:
+    OP_SSTORE_WATCHED(r5, r0, r6);
+    break;
+case 5466:
+    OP_SSTORE_WATCHED(r5, r0, r7);
+    break;
+case 5467:
+    OP_SSTORE_WATCHED(r5, r1, r0);
+    break;
+case 5468:
+    OP_SSTORE_WATCHED(r5, r1, r1);
+    break;
+case 5469:
+    OP_SSTORE_WATCHED(r5, r1, r2);
+    break;
+case 5470:
+    OP_SSTORE_WATCHED(r5, r1, r3);
+    break;
+case 5471:
+    OP_SSTORE_WATCHED(r5, r1, r4);
+    break;
+case 5472:
+    OP_SSTORE_WATCHED(r5, r1, r5);
+    break;
+case 5473:
+    OP_SSTORE_WATCHED(r5, r1, r6);
+    break;
+case 5474:
+    OP_SSTORE_WATCHED(r5, r1, r7);
+    break;
+case 5475:
+    OP_SSTORE_WATCHED(r5, r2, r0);
+    break;
+case 5476:
+    OP_SSTORE_WATCHED(r5, r2, r1);
+    break;
+case 5477:
+    OP_SSTORE_WATCHED(r5, r2, r2);
+    break;
+case 5478:
+    OP_SSTORE_WATCHED(r5, r2, r3);
+    break;
+case 5479:
+    OP_SSTORE_WATCHED(r5, r2, r4);
+    break;
+case 5480:
+    OP_SSTORE_WATCHED(r5, r2, r5);
+    break;
+case 5481:
+    OP_SSTORE_WATCHED(r5, r2, r6);
+    break;
+case 5482:
+    OP_SSTORE_WATCHED(r5, r2, r7);
+    break;
+case 5483:
+    OP_SSTORE_WATCHED(r5, r3, r0);
+    break;
+case 5484:
+    OP_SSTORE_WATCHED(r5, r3, r1);
+    break;
+case 5485:
+    OP_SSTORE_WATCHED(r5, r3, r2);
+    break;
+case 5486:
+    OP_SSTORE_WATCHED(r5, r3, r3);
+    break;
+case 5487:
+    OP_SSTORE_WATCHED(r5, r3, r4);
+    break;
+case 5488:
+    OP_SSTORE_WATCHED(r5, r3, r5);
+    break;
+case 5489:
+    OP_SSTORE_WATCHED(r5, r3, r6);
+    break;
+case 5490:
+    OP_SSTORE_WATCHED(r5, r3, r7);
+    break;
+case 5491:
+    OP_SSTORE_WATCHED(r5, r4, r0);
+    break;
+case 5492:
+    OP_SSTORE_WATCHED(r5, r4, r1);
+    break;
+case 5493:
+    OP_SSTORE_WATCHED(r5, r4, r2);
+    break;
+case 5494:
+    OP_SSTORE_WATCHED(r5, r4, r3);
+    break;
+case 5495:
+    OP_SSTORE_WATCHED(r5, r4, r4);
+    break;
+case 5496:
+    OP_SSTORE_WATCHED(r5, r4, r5);
+    break;
+case 5497:
+    OP_SSTORE_WATCHED(r5, r4, r6);
+    break;
+case 5498:
+    OP_SSTORE_WATCHED(r5, r4, r7);
+    break;
+case 5499:
+    OP_SSTORE_WATCHED(r5, r5, r0);
+    break;
+case 5500:
+    OP_SSTORE_WATCHED(r5, r5, r1);
+    break;
+case 5501:
+    OP_SSTORE_WATCHED(r5, r5, r2);
+    break;
+case 5502:
+    OP_SSTORE_WATCHED(r5, r5, r3);
+    break;
+case 5503:
+    OP_SSTORE_WATCHED(r5, r5, r4);
+    break;
+case 5504:
+    OP_SSTORE_WATCHED(r5, r5, r5);
+    break;
+case 5505:
+    OP_SSTORE_WATCHED(r5, r5, r6);
+    break;
+case 5506:
+    OP_SSTORE_WATCHED(r5, r5, r7);
+    break;
+case 5507:
+    OP_SSTORE_WATCHED(r5, r6, r0);
+    break;
+case 5508:
+    OP_SSTORE_WATCHED(r5, r6, r1);
+    break;
+case 5509:
+    OP_SSTORE_WATCHED(r5, r6, r2);
+    break;
+case 5510:
+    OP_SSTORE_WATCHED(r5, r6, r3);
+    break;
+case 5511:
+    OP_SSTORE_WATCHED(r5, r6, r4);
+    break;
+case 5512:
+    OP_SSTORE_WATCHED(r5, r6, r5);
+    break;
+case 5513:
+    OP_SSTORE_WATCHED(r5, r6, r6);
+    break;
+case 5514:
+    OP_SSTORE_WATCHED(r5, r6, r7);
+    break;
+case 5515:
+    OP_SSTORE_WATCHED(r5, r7, r0);
+    break;
+case 5516:
+    OP_SSTORE_WATCHED(r5, r7, r1);
+    break;
+case 5517:
+    OP_SSTORE_WATCHED(r5, r7, r2);
+    break;
+case 5518:
+    OP_SSTORE_WATCHED(r5, r7, r3);
+    break;
+case 5519:
+    OP_SSTORE_WATCHED(r5, r7, r4);
+    break;
+case 5520:
+    OP_SSTORE_WATCHED(r5, r7, r5);
+    break;
+case 5521:
+    OP_SSTORE_WATCHED(r5, r7, r6);
+    break;
+case 5522:
+    OP_SSTORE_WATCHED(r5, r7, r7);
+    break;
+case 5523:
+    OP_SSTORE_WATCHED(r6, r0, r0);
+    break;
+case 5524:
+    OP_SSTORE_WATCHED(r6, r0, r1);
+    break;
+case 5525:
+    OP_SSTORE_WATCHED(r6, r0, r2);
+    break;
+case 5526:
+    OP_SSTORE_WATCHED(r6, r0, r3);
+    break;
+case 5527:
+    OP_SSTORE_WATCHED(r6, r0, r4);
+    break;
+case 5528:
+    OP_SSTORE_WATCHED(r6, r0, r5);
+    break;
+case 5529:
+    OP_SSTORE_WATCHED(r6, r0, r6);
+    break;
+case 5530:
+    OP_SSTORE_WATCHED(r6, r0, r7);
+    break;
+case 5531:
+    OP_SSTORE_WATCHED(r6, r1, r0);
+    break;
+case 5532:
+    OP_SSTORE_WATCHED(r6, r1, r1);
+    break;
+case 5533:
+    OP_SSTORE_WATCHED(r6, r1, r2);
+    break;
+case 5534:
+    OP_SSTORE_WATCHED(r6, r1, r3);
+    break;
+case 5535:
+    OP_SSTORE_WATCHED(r6, r1, r4);
+    break;
+case 5536:
+    OP_SSTORE_WATCHED(r6, r1, r5);
+    break;
+case 5537:
+    OP_SSTORE_WATCHED(r6, r1, r6);
+    break;
+case 5538:
+    OP_SSTORE_WATCHED(r6, r1, r7);
+    break;
+case 5539:
+    OP_SSTORE_WATCHED(r6, r2, r0);
+    break;
+case 5540:
+    OP_SSTORE_WATCHED(r6, r2, r1);
+    break;
+case 5541:
+    OP_SSTORE_WATCHED(r6, r2, r2);
+    break;
+case 5542:
+    OP_SSTORE_WATCHED(r6, r2, r3);
+    break;
+case 5543:
+    OP_SSTORE_WATCHED(r6, r2, r4);
+    break;
+case 5544:
+    OP_SSTORE_WATCHED(r6, r2, r5);
+    break;
+case 5545:
+    OP_SSTORE_WATCHED(r6, r2, r6);
+    break;
+case 5546:
+    OP_SSTORE_WATCHED(r6, r2, r7);
+    break;
+case 5547:
+    OP_SSTORE_WATCHED(r6, r3, r0);
+    break;
+case 5548:
+    OP_SSTORE_WATCHED(r6, r3, r1);
+    break;
+case 5549:
+    OP_SSTORE_WATCHED(r6, r3, r2);
+    break;
+case 5550:
+    OP_SSTORE_WATCHED(r6, r3, r3);
+    break;
+case 5551:
+    OP_SSTORE_WATCHED(r6, r3, r4);
+    break;
+case 5552:
+    OP_SSTORE_WATCHED(r6, r3, r5);
+    break;
+case 5553:
+    OP_SSTORE_WATCHED(r6, r3, r6);
+    break;
+case 5554:
+    OP_SSTORE_WATCHED(r6, r3, r7);
+    break;
+case 5555:
+    OP_SSTORE_WATCHED(r6, r4, r0);
+    break;
+case 5556:
+    OP_SSTORE_WATCHED(r6, r4, r1);
+    break;
+case 5557:
+    OP_SSTORE_WATCHED(r6, r4, r2);
+    break;
+case 5558:
+    OP_SSTORE_WATCHED(r6, r4, r3);
+    break;
+case 5559:
+    OP_SSTORE_WATCHED(r6, r4, r4);
+    break;
+case 5560:
+    OP_SSTORE_WATCHED(r6, r4, r5);
+    break;
+case 5561:
+    OP_SSTORE_WATCHED(r6, r4, r6);
+    break;
+case 5562:
+    OP_SSTORE_WATCHED(r6, r4, r7);
+    break;
+case 5563:
+    OP_SSTORE_WATCHED(r6, r5, r0);
+    break;
+case 5564:
+    OP_SSTORE_WATCHED(r6, r5, r1);
+    break;
+case 5565:
+    OP_SSTORE_WATCHED(r6, r5, r2);
+    break;
+case 5566:
+    OP_SSTORE_WATCHED(r6, r5, r3);
+    break;
+case 5567:
+    OP_SSTORE_WATCHED(r6, r5, r4);
+    break;
+case 5568:
+    OP_SSTORE_WATCHED(r6, r5, r5);
+    break;
+case 5569:
+    OP_SSTORE_WATCHED(r6, r5, r6);
+    break;
+case 5570:
+    OP_SSTORE_WATCHED(r6, r5, r7);
+    break;
+case 5571:
+    OP_SSTORE_WATCHED(r6, r6, r0);
+    break;
+case 5572:
+    OP_SSTORE_WATCHED(r6, r6, r1);
+    break;
+case 5573:
+    OP_SSTORE_WATCHED(r6, r6, r2);
+    break;
+case 5574:
+    OP_SSTORE_WATCHED(r6, r6, r3);
+    break;
+case 5575:
+    OP_SSTORE_WATCHED(r6, r6, r4);
+    break;
+case 5576:
+    OP_SSTORE_WATCHED(r6, r6, r5);
+    break;
+case 5577:
+    OP_SSTORE_WATCHED(r6, r6, r6);
+    break;
+case 5578:
+    OP_SSTORE_WATCHED(r6, r6, r7);
+    break;
+case 5579:
+    OP_SSTORE_WATCHED(r6, r7, r0);
+    break;
+case 5580:
+    OP_SSTORE_WATCHED(r6, r7, r1);
+    break;
+case 5581:
+    OP_SSTORE_WATCHED(r6, r7, r2);
+    break;
+case 5582:
+    OP_SSTORE_WATCHED(r6, r7, r3);
+    break;
+case 5583:
+    OP_SSTORE_WATCHED(r6, r7, r4);
+    break;
+case 5584:
+    OP_SSTORE_WATCHED(r6, r7, r5);
+    break;
+case 5585:
+    OP_SSTORE_WATCHED(r6, r7, r6);
+    break;
+case 5586:
+    OP_SSTORE_WATCHED(r6, r7, r7);
+    break;
+case 5587:
+    OP_SSTORE_WATCHED(r7, r0, r0);
+    break;
+case 5588:
+    OP_SSTORE_WATCHED(r7, r0, r1);
+    break;
+case 5589:
+    OP_SSTORE_WATCHED(r7, r0, r2);
+    break;
+case 5590:
+    OP_SSTORE_WATCHED(r7, r0, r3);
+    break;
+case 5591:
+    OP_SSTORE_WATCHED(r7, r0, r4);
+    break;
+case 5592:
+    OP_SSTORE_WATCHED(r7, r0, r5);
+    break;
+case 5593:
+    OP_SSTORE_WATCHED(r7, r0, r6);
+    break;
+case 5594:
+    OP_SSTORE_WATCHED(r7, r0, r7);
+    break;
+case 5595:
+    OP_SSTORE_WATCHED(r7, r1, r0);
+    break;
+case 5596:
+    OP_SSTORE_WATCHED(r7, r1, r1);
+    break;
+case 5597:
+    OP_SSTORE_WATCHED(r7, r1, r2);
+    break;
+case 5598:
+    OP_SSTORE_WATCHED(r7, r1, r3);
+    break;
+case 5599:
+    OP_SSTORE_WATCHED(r7, r1, r4);
+    break;
+case 5600:
+    OP_SSTORE_WATCHED(r7, r1, r5);
+    break;
+case 5601:
+    OP_SSTORE_WATCHED(r7, r1, r6);
+    break;
+case 5602:
+    OP_SSTORE_WATCHED(r7, r1, r7);
+    break;
+case 5603:
+    OP_SSTORE_WATCHED(r7, r2, r0);
+    break;
+case 5604:
+    OP_SSTORE_WATCHED(r7, r2, r1);
+    break;
+case 5605:
+    OP_SSTORE_WATCHED(r7, r2, r2);
+    break;
+case 5606:
+    OP_SSTORE_WATCHED(r7, r2, r3);
+    break;
+case 5607:
+    OP_SSTORE_WATCHED(r7, r2, r4);
+    break;
+case 5608:
+    OP_SSTORE_WATCHED(r7, r2, r5);
+    break;
+case 5609:
+    OP_SSTORE_WATCHED(r7, r2, r6);
+    break;
+case 5610:
+    OP_SSTORE_WATCHED(r7, r2, r7);
+    break;
+case 5611:
+    OP_SSTORE_WATCHED(r7, r3, r0);
+    break;
+case 5612:
+    OP_SSTORE_WATCHED(r7, r3, r1);
+    break;
+case 5613:
+    OP_SSTORE_WATCHED(r7, r3, r2);
+    break;
+case 5614:
+    OP_SSTORE_WATCHED(r7, r3, r3);
+    break;
+case 5615:
+    OP_SSTORE_WATCHED(r7, r3, r4);
+    break;
+case 5616:
+    OP_SSTORE_WATCHED(r7, r3, r5);
+    break;
+case 5617:
+    OP_SSTORE_WATCHED(r7, r3, r6);
+    break;
+case 5618:
+    OP_SSTORE_WATCHED(r7, r3, r7);
+    break;
+case 5619:
+    OP_SSTORE_WATCHED(r7, r4, r0);
+    break;
+case 5620:
+    OP_SSTORE_WATCHED(r7, r4, r1);
+    break;
+case 5621:
+    OP_SSTORE_WATCHED(r7, r4, r2);
+    break;
+case 5622:
+    OP_SSTORE_WATCHED(r7, r4, r3);
+    break;
+case 5623:
+    OP_SSTORE_WATCHED(r7, r4, r4);
+    break;
+case 5624:
+    OP_SSTORE_WATCHED(r7, r4, r5);
+    break;
+case 5625:
+    OP_SSTORE_WATCHED(r7, r4, r6);
+    break;
+case 5626:
+    OP_SSTORE_WATCHED(r7, r4, r7);
+    break;
+case 5627:
+    OP_SSTORE_WATCHED(r7, r5, r0);
+    break;
+case 5628:
+    OP_SSTORE_WATCHED(r7, r5, r1);
+    break;
+case 5629:
+    OP_SSTORE_WATCHED(r7, r5, r2);
+    break;
+case 5630:
+    OP_SSTORE_WATCHED(r7, r5, r3);
+    break;
+case 5631:
+    OP_SSTORE_WATCHED(r7, r5, r4);
+    break;
+case 5632:
+    OP_SSTORE_WATCHED(r7, r5, r5);
+    break;
+case 5633:
+    OP_SSTORE_WATCHED(r7, r5, r6);
+    break;
+case 5634:
+    OP_SSTORE_WATCHED(r7, r5, r7);
+    break;
+case 5635:
+    OP_SSTORE_WATCHED(r7, r6, r0);
+    break;
+case 5636:
+    OP_SSTORE_WATCHED(r7, r6, r1);
+    break;
+case 5637:
+    OP_SSTORE_WATCHED(r7, r6, r2);
+    break;
+case 5638:
+    OP_SSTORE_WATCHED(r7, r6, r3);
+    break;
+case 5639:
+    OP_SSTORE_WATCHED(r7, r6, r4);
+    break;
+case 5640:
+    OP_SSTORE_WATCHED(r7, r6, r5);
+    break;
+case 5641:
+    OP_SSTORE_WATCHED(r7, r6, r6);
+    break;
+case 5642:
+    OP_SSTORE_WATCHED(r7, r6, r7);
+    break;
+case 5643:
+    OP_SSTORE_WATCHED(r7, r7, r0);
+    break;
+case 5644:
+    OP_SSTORE_WATCHED(r7, r7, r1);
+    break;
+case 5645:
+    OP_SSTORE_WATCHED(r7, r7, r2);
+    break;
+case 5646:
+    OP_SSTORE_WATCHED(r7, r7, r3);
+    break;
+case 5647:
+    OP_SSTORE_WATCHED(r7, r7, r4);
+    break;
+case 5648:
+    OP_SSTORE_WATCHED(r7, r7, r5);
+    break;
+case 5649:
+    OP_SSTORE_WATCHED(r7, r7, r6);
+    break;
+case 5650:
+    OP_SSTORE_WATCHED(r7, r7, r7);
+    break;
+case 5651:
+    OP_STALE();
+case 5652:
+    DISPATCH_GENERIC(OP_SSTORE_TRACKED);
+    break;
+default:
+    __builtin_unreachable();
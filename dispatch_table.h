@@ -0,0 +1,133 @@
+/* Generated by gen_dispatch; do not edit */
+
+#ifndef DISPATCH_TABLE_H
+#define DISPATCH_TABLE_H
+
+#include <stdint.h>
+
+#define DISPATCH_NUM_KEYS 5653
+#define DISPATCH_END_KEY 0
+#define DISPATCH_TRACKED_STORE_KEY 5652
+#define DISPATCH_STALE_KEY 5651
+#define DISPATCH_WATCHED_STORE_OFFSET 4114
+
+static const uint16_t Dispatch_base[16] = {
+    1, 513, 1025, 1537, 2049, 2561, 3073, 3585, 3586, 3587, 3588, 3589, 3590, 4102, 4110, 4111
+};
+
+static const uint16_t Dispatch_mask[16] = {
+    0x1ff, 0x1ff, 0x1ff, 0x1ff, 0x1ff, 0x1ff, 0x1ff, 0, 0, 0, 0, 0, 0x1ff, 0, 0, 0
+};
+
+/* Dispatch_key
+ * Purpose:    Pre-decodes an instruction into its dispatch key.
+ * Parameters: uint32_t word - the instruction
+ * Returns:    uint16_t - the key of the case executing it
+ */
+static inline uint16_t Dispatch_key(uint32_t word)
+{
+    uint32_t op = word >> 28;
+    if (op == 13) {
+        return Dispatch_base[op] + ((word >> 25) & 7);
+    }
+    return Dispatch_base[op] + (word & Dispatch_mask[op]);
+}
+
+/* Dispatch_lift
+ * Purpose:    Pre-decodes the instructions of a lifted idiom into the key of
+ *             the case executing them all.
+ * Parameters: const uint32_t *words - the first instruction
+ *             uint32_t available - how many words there are from the first
+ *                                  to the end of segment 0, at least 1
+ * Returns:    uint16_t - the key, or 0 if the instructions start no idiom
+ */
+static inline uint16_t Dispatch_lift(const uint32_t *words, uint32_t available)
+{
+    uint32_t word = words[0];
+    if ((word >> 28) != 6 || available < 2) {
+        return 0;
+    }
+    if (available >= 6 &&
+        (words[1] >> 28) == 6 &&
+        (words[2] >> 28) == 6 &&
+        (words[3] >> 28) == 6 &&
+        (words[4] >> 28) == 6 &&
+        (words[5] >> 28) == 6 &&
+        ((words[0] >> 0) & 7) == ((words[0] >> 3) & 7) &&
+        ((words[1] >> 0) & 7) == ((words[1] >> 3) & 7) &&
+        ((words[2] >> 6) & 7) == ((words[1] >> 6) & 7) &&
+        ((words[2] >> 3) & 7) == ((words[0] >> 6) & 7) &&
+        ((words[2] >> 0) & 7) == ((words[1] >> 6) & 7) &&
+        ((words[3] >> 6) & 7) == ((words[0] >> 6) & 7) &&
+        ((words[3] >> 3) & 7) == ((words[0] >> 3) & 7) &&
+        ((words[3] >> 0) & 7) == ((words[1] >> 3) & 7) &&
+        ((words[4] >> 6) & 7) == ((words[1] >> 6) & 7) &&
+        ((words[4] >> 3) & 7) == ((words[0] >> 6) & 7) &&
+        ((words[4] >> 0) & 7) == ((words[1] >> 6) & 7) &&
+        ((words[5] >> 6) & 7) == ((words[1] >> 6) & 7) &&
+        ((words[5] >> 3) & 7) == ((words[1] >> 6) & 7) &&
+        ((words[5] >> 0) & 7) == ((words[1] >> 6) & 7)) {
+        return 5137;
+    }
+    if (available >= 3 &&
+        (words[1] >> 28) == 6 &&
+        (words[2] >> 28) == 6 &&
+        ((words[0] >> 0) & 7) == ((words[0] >> 3) & 7) &&
+        ((words[1] >> 0) & 7) == ((words[1] >> 3) & 7) &&
+        ((words[2] >> 3) & 7) == ((words[0] >> 6) & 7) &&
+        ((words[2] >> 0) & 7) == ((words[1] >> 6) & 7)) {
+        return 5136;
+    }
+    if (available >= 3 &&
+        (words[1] >> 28) == 3 &&
+        (words[2] >> 28) == 3 &&
+        ((words[0] >> 0) & 7) == ((words[0] >> 3) & 7) &&
+        ((words[1] >> 0) & 7) == ((words[0] >> 6) & 7) &&
+        ((words[2] >> 6) & 7) == ((words[1] >> 6) & 7) &&
+        ((words[2] >> 0) & 7) == ((words[1] >> 6) & 7)) {
+        return 5138;
+    }
+    uint32_t a = (word >> 6) & 7, b = (word >> 3) & 7;
+    uint32_t c = word & 7;
+    uint32_t next = words[1];
+    uint32_t next_a = (next >> 6) & 7;
+    uint32_t next_b = (next >> 3) & 7;
+    uint32_t next_c = next & 7;
+    if ((next >> 28) == 6 && next_a == a && next_b == a &&
+        next_c == a) {
+        return 4112 + (word & 0x1ff);
+    }
+    if ((next >> 28) == 3 && b == c && next_b == next_a &&
+        next_c == a) {
+        return 4624 + ((next_a << 6) | (b << 3) | a);
+    }
+    (void)a;
+    (void)b;
+    (void)c;
+    (void)next_a;
+    (void)next_b;
+    (void)next_c;
+    return 0;
+}
+
+/* Dispatch_lifted_length
+ * Purpose:    Returns how many instructions the case of a lifted idiom runs.
+ * Parameters: uint16_t key - a key from Dispatch_lift
+ * Returns:    uint32_t - the length of the idiom
+ */
+static inline uint32_t Dispatch_lifted_length(uint16_t key)
+{
+    if (key == 5137) {
+        return 6;
+    }
+    if (key == 5136) {
+        return 3;
+    }
+    if (key == 5138) {
+        return 3;
+    }
+    (void)key;
+    return 2;
+}
+
+#endif
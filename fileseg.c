@@ -0,0 +1,246 @@
+/******************************************************************************
+ *
+ *                                fileseg.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of file-backed segments as outlined in
+ *                 fileseg.h. Each segment's storage is a reservation of
+ *                 the size Pages_free expects, with a memory file of the
+ *                 file's size mapped over its start, inaccessible. A
+ *                 second, writable mapping of the memory file (the alias)
+ *                 is where the SIGSEGV handler reads and swaps a page
+ *                 before making it accessible in the segment, so no UM
+ *                 thread can see it half swapped. A byte per page records
+ *                 its progress. A thread that faults on a page another
+ *                 thread is swapping waits for that page alone, then
+ *                 retries its access.
+ *
+ *****************************************************************************/
+
+/* For memfd_create */
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "fileseg.h"
+#include "pages.h"
+#include "assert.h"
+
+#define SIZE_OF_UINT32 4
+
+/* The progress of a page, in Mapped_file.swapped */
+enum { UNSWAPPED = 0, SWAPPING, SWAPPED };
+
+typedef struct Mapped_file {
+    Mem_Address address;
+    char *region;        /* NULL once the segment is unmapped */
+    char *alias;         /* the same pages, always writable */
+    size_t bytes;        /* the file's size, rounded up to whole pages */
+    int fd;              /* the file, read a page at a time */
+    uint8_t *swapped;    /* per page: UNSWAPPED, SWAPPING or SWAPPED */
+} Mapped_file;
+
+static size_t page_size = 0;
+static Mapped_file *files = NULL;
+static int num_files = 0;
+static struct sigaction previous_action;
+
+/* swap_page
+ * Purpose:    Reads a page of a mapped file through the alias, converts
+ *             its words from big-endian, then makes it accessible in the
+ *             segment.
+ * Parameters: Mapped_file *file - the file
+ *             size_t page - the page's index
+ * Returns:    none
+ * Notes:      Runs in the SIGSEGV handler, so it allocates nothing. The
+ *             part of the last page past the end of the file stays zero.
+ */
+static void swap_page(Mapped_file *file, size_t page)
+{
+    size_t offset = page * page_size;
+    char *copy = file->alias + offset;
+    size_t done = 0;
+    while (done < page_size) {
+        ssize_t got = pread(file->fd, copy + done, page_size - done,
+                            offset + done);
+        if (got < 0 && errno == EINTR) {
+            continue;
+        } else if (got <= 0) {
+            break;
+        }
+        done += got;
+    }
+    uint32_t *words = (uint32_t *)copy;
+    for (size_t i = 0; i < page_size / SIZE_OF_UINT32; i++) {
+        words[i] = __builtin_bswap32(words[i]);
+    }
+    mprotect(file->region + offset, page_size, PROT_READ | PROT_WRITE);
+}
+
+/* fault_handler
+ * Purpose:    Swaps in the page of a mapped file holding the faulting
+ *             address. Faults anywhere else go to whatever handler was
+ *             installed before.
+ * Parameters: int signum - SIGSEGV
+ *             siginfo_t *info - describes the faulting address
+ *             void *context - passed on to the previous handler
+ * Returns:    none
+ */
+static void fault_handler(int signum, siginfo_t *info, void *context)
+{
+    char *address = info->si_addr;
+    for (int i = 0; i < num_files; i++) {
+        Mapped_file *file = &files[i];
+        if (file->region == NULL || address < file->region ||
+            address >= file->region + file->bytes) {
+            continue;
+        }
+        size_t page = (address - file->region) / page_size;
+        uint8_t unswapped = UNSWAPPED;
+        if (__atomic_compare_exchange_n(&file->swapped[page], &unswapped,
+                                        SWAPPING, 0, __ATOMIC_ACQUIRE,
+                                        __ATOMIC_ACQUIRE)) {
+            int saved_errno = errno;
+            swap_page(file, page);
+            errno = saved_errno;
+            __atomic_store_n(&file->swapped[page], SWAPPED,
+                             __ATOMIC_RELEASE);
+        }
+        while (__atomic_load_n(&file->swapped[page], __ATOMIC_ACQUIRE) !=
+               SWAPPED) {
+            /* Another thread is swapping this page; it never takes long */
+        }
+        return;
+    }
+
+    if (previous_action.sa_flags & SA_SIGINFO) {
+        previous_action.sa_sigaction(signum, info, context);
+    } else {
+        /* Let the fault happen again under the previous disposition */
+        sigaction(SIGSEGV, &previous_action, NULL);
+    }
+}
+
+/* Fileseg_init
+ * Purpose:    Installs the SIGSEGV handler. Any other SIGSEGV handler
+ *             must be installed first.
+ * Parameters: none
+ * Returns:    none
+ */
+void Fileseg_init(void)
+{
+    page_size = sysconf(_SC_PAGESIZE);
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = fault_handler;
+    action.sa_flags = SA_SIGINFO | SA_NODEFER;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGSEGV, &action, &previous_action);
+}
+
+/* Fileseg_map
+ * Purpose:    Maps a file into a new segment, exiting if it cannot.
+ * Parameters: Mem_T mem - main memory
+ *             const char *path - the file, which must be a regular file
+ *             uint32_t *num_words_p - set to the length of the segment
+ * Returns:    Mem_Address - the segment
+ */
+Mem_Address Fileseg_map(Mem_T mem, const char *path, uint32_t *num_words_p)
+{
+    int fd = open(path, O_RDONLY);
+    struct stat buf;
+    if (fd < 0 || fstat(fd, &buf) != 0 || !S_ISREG(buf.st_mode)) {
+        fprintf(stderr, "Could not map %s: not a readable regular file.\n",
+                path);
+        exit(EXIT_FAILURE);
+    }
+    uint64_t num_words = ((uint64_t)buf.st_size + SIZE_OF_UINT32 - 1) /
+                         SIZE_OF_UINT32;
+    if (num_words > UINT32_MAX) {
+        fprintf(stderr, "Could not map %s: too large for a segment.\n",
+                path);
+        exit(EXIT_FAILURE);
+    }
+    Mem_Address address = Mem_create_segment(mem, 0);
+    *num_words_p = num_words;
+    if (num_words == 0) {
+        close(fd);
+        return address;
+    }
+
+    /* The pages start out as holes in a memory file: nothing is read,
+       copied or committed until the handler swaps them in */
+    size_t file_bytes = (buf.st_size + page_size - 1) & ~(page_size - 1);
+    int memory_fd = memfd_create("um-map-file", MFD_CLOEXEC);
+    char *region = (char *)Pages_reserve(num_words * SIZE_OF_UINT32);
+    char *alias = MAP_FAILED;
+    if (memory_fd < 0 || ftruncate(memory_fd, file_bytes) != 0 ||
+        region == NULL ||
+        mmap(region, file_bytes, PROT_NONE, MAP_SHARED | MAP_FIXED,
+             memory_fd, 0) == MAP_FAILED ||
+        (alias = mmap(NULL, file_bytes, PROT_READ | PROT_WRITE,
+                      MAP_SHARED, memory_fd, 0)) == MAP_FAILED) {
+        fprintf(stderr, "Could not map %s.\n", path);
+        exit(EXIT_FAILURE);
+    }
+    /* The mappings keep the memory file alive */
+    close(memory_fd);
+    Mem_segment_at(mem, address)->length = num_words;
+    if (!Mem_adopt_storage(mem, address, (uint32_t *)region, 1)) {
+        fprintf(stderr, "--map-file is not supported by the %s memory "
+                "backend.\n", Mem_backend_name());
+        exit(EXIT_FAILURE);
+    }
+
+    files = realloc(files, (num_files + 1) * sizeof(*files));
+    assert(files != NULL);
+    Mapped_file *file = &files[num_files++];
+    file->address = address;
+    file->region = region;
+    file->alias = alias;
+    file->bytes = file_bytes;
+    file->fd = fd;
+    file->swapped = calloc(file_bytes / page_size, 1);
+    assert(file->swapped != NULL);
+    return address;
+}
+
+/* Fileseg_forget
+ * Purpose:    Stops handling faults for a segment that is being unmapped,
+ *             and releases its file and alias.
+ * Parameters: Mem_Address address - the segment
+ * Returns:    none
+ * Notes:      Backends that keep an unmapped segment's storage hand it to
+ *             the next segment mapped, so the memory file is replaced with
+ *             fresh memory rather than left with inaccessible pages.
+ */
+void Fileseg_forget(Mem_Address address)
+{
+    for (int i = 0; i < num_files; i++) {
+        if (files[i].region != NULL && files[i].address == address) {
+            char *region = files[i].region;
+            files[i].region = NULL;
+            if (mmap(region, files[i].bytes, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) ==
+                MAP_FAILED) {
+                fprintf(stderr, "Could not unmap a mapped file.\n");
+                exit(EXIT_FAILURE);
+            }
+            munmap(files[i].alias, files[i].bytes);
+            close(files[i].fd);
+            free(files[i].swapped);
+            files[i].swapped = NULL;
+        }
+    }
+}
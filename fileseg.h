@@ -0,0 +1,38 @@
+/******************************************************************************
+ *
+ *                                fileseg.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for file-backed segments (--map-file). A host
+ *                 file is mapped into a new segment instead of being fed
+ *                 through IN a byte per instruction. Only the mapping
+ *                 takes constant time: its words read big-endian, as the
+ *                 words of a .um file do, and since the host is
+ *                 little-endian each page starts out inaccessible. The
+ *                 first touch of a page faults, and the SIGSEGV handler
+ *                 copies it from the file and byte-swaps it, so a page
+ *                 costs a read and a pass over its words the first time,
+ *                 and nothing after. Pages a program never touches are
+ *                 never read.
+ *
+ *                 The file is only ever read; stores into the segment
+ *                 change the UM's copy alone. A file whose size is not a
+ *                 multiple of four is padded with zero bytes.
+ *
+ *****************************************************************************/
+
+#ifndef FILESEG_H
+#define FILESEG_H
+
+#include <stdint.h>
+#include "memory.h"
+
+extern void Fileseg_init(void);
+extern Mem_Address Fileseg_map(Mem_T mem, const char *path,
+                               uint32_t *num_words_p);
+extern void Fileseg_forget(Mem_Address address);
+
+#endif
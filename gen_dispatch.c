@@ -0,0 +1,486 @@
+/******************************************************************************
+ *
+ *                              gen_dispatch.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Build-time generator for the interpreter's dispatch switch.
+ *                 Every instruction of segment 0 is pre-decoded into a 16-bit
+ *                 key, and each key selects a case of one switch statement.
+ *                 For a specialized opcode there is one key (and one case)
+ *                 per register triple, so the case names its registers
+ *                 directly and the interpreter can keep all eight registers
+ *                 in local variables. Any other opcode gets a single key and
+ *                 a generic case that decodes the registers at run time.
+ *                 Opcodes that call out of the interpreter (HALT, map,
+ *                 unmap, OUT and IN) are always generic, as are the
+ *                 extension opcodes: SPAWN (14) and EXTEND (15), which
+ *                 holds JOIN and the bulk memory instructions.
+ *
+ *                 Some pairs of instructions are idioms for an operation
+ *                 the UM lacks, and get a key of their own, which
+ *                 Dispatch_lift gives the first of the pair:
+ *
+ *                   AND     NAND a, b, c; NAND a, a, a   (a = b & c)
+ *                   ADDNOT  NAND t, b, b; ADD a, a, t    (a += ~b)
+ *
+ *                 A lifted case runs both instructions in one, writing
+ *                 every register they write, in order, so it needs to
+ *                 know nothing about which registers are live, and skips
+ *                 the second. The second keeps its own key for jumps to
+ *                 it, and the case is given that key, so it can check
+ *                 that no store has replaced the second instruction
+ *                 since it was decoded; if one has, the case runs only
+ *                 the first. Only a specialized opcode's key names its
+ *                 registers, so lifting an idiom also specializes the
+ *                 opcode of its second instruction. Like opcodes, lifted
+ *                 idioms are named in the specialization arguments and
+ *                 have one case per register triple; those not named are
+ *                 not lifted.
+ *
+ *                 OR, XOR and subtraction take more distinct registers
+ *                 than a triple holds, so they are lifted as runs instead
+ *                 (see the runs table), with one key each:
+ *
+ *                   OR      NAND t, b, b; NAND u, c, c; NAND a, t, u
+ *                   XOR     OR, then NAND t, b, c; NAND u, t, u;
+ *                           NAND u, u, u
+ *                   SUB     NAND t, b, b; ADD a, c, t; ADD a, d, a
+ *                           (a = c - b when d holds 1)
+ *
+ *                 Each begins with a NOT (NAND t, b, b), which alone is a
+ *                 single instruction whose specialized case is a = ~b
+ *                 already. A run's case decodes the registers from the
+ *                 words of its instructions as it runs them, on the
+ *                 spilled registers, so a store that has replaced one of
+ *                 them only matters if it changed an opcode, which the
+ *                 case checks; if one has, the case runs only the first.
+ *
+ *                 Usage: gen_dispatch header|cases [all | none | hot |
+ *                                                   OPCODE ...]
+ *
+ *                 "header" writes the key tables and Dispatch_key, "cases"
+ *                 writes the case labels to be included inside the switch.
+ *                 One extra key runs SSTORE through OP_SSTORE_TRACKED; the
+ *                 interpreter decodes stores to it only while checkpointing,
+ *                 so dirty tracking costs nothing otherwise. Likewise, with
+ *                 --protect-seg0 stores are decoded to a second set of
+ *                 SSTORE keys, whose cases leave segment 0 to codewatch,
+ *                 and the instructions of a page codewatch saw written get
+ *                 the stale key, whose case decodes each as it runs and
+ *                 dispatches again.
+ *                 Specializing more opcodes makes the switch (and its jump
+ *                 table) bigger; testing/dispatch_matrix.sh measures the
+ *                 tradeoff.
+ *
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_OPCODES 16
+#define NUM_LIFTED 5
+#define MAX_RUN 6
+#define NUM_TRIPLES 512
+#define ADD 3
+#define NAND 6
+#define LV 13
+#define SPAWN 14
+#define EXTEND 15
+#define END_KEY 0
+#define SSTORE 2
+/* Lifted idioms are numbered after the opcodes, the runs last */
+#define AND NUM_OPCODES
+#define ADDNOT (NUM_OPCODES + 1)
+#define OR (NUM_OPCODES + 2)
+#define XOR (NUM_OPCODES + 3)
+#define SUB (NUM_OPCODES + 4)
+#define FIRST_RUN OR
+
+static const char *opcode_names[] = {
+    "CMOV", "SLOAD", "SSTORE", "ADD", "MUL", "DIV", "NAND", "HALT",
+    "ACTIVATE", "INACTIVATE", "OUT", "IN", "LOADP", "LV", "SPAWN",
+    "EXTEND", "AND", "ADDNOT", "OR", "XOR", "SUB"
+};
+
+/* A run: the opcodes of its instructions, and their A, B and C registers
+   as letters; a letter names the same register wherever it appears */
+typedef struct Run {
+    int idiom;
+    int length;
+    int opcodes[MAX_RUN];
+    const char *registers;
+} Run;
+
+/* Longest first, since an XOR starts with an OR */
+static const Run runs[] = {
+    { XOR, 6, { NAND, NAND, NAND, NAND, NAND, NAND },
+      "tbb" "ucc" "utu" "tbc" "utu" "uuu" },
+    { OR,  3, { NAND, NAND, NAND }, "tbb" "ucc" "atu" },
+    { SUB, 3, { NAND, ADD, ADD },   "tbb" "act" "ada" }
+};
+#define NUM_RUNS (int)(sizeof(runs) / sizeof(runs[0]))
+
+/* Opcodes that call out of the interpreter, which spills the registers
+   anyway; specializing them would only make the switch bigger */
+static const int calls_out[] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0
+};
+
+/* The opcodes and idioms that dominate compiled UM code (see
+   --sample-profile and --cost) */
+static const char *hot_opcodes[] = {
+    "CMOV", "SLOAD", "SSTORE", "ADD", "NAND", "LOADP", "AND", "ADDNOT"
+};
+
+/* opcode_number
+ * Purpose:    Looks up an opcode or lifted idiom by name.
+ * Parameters: const char *name - the opcode's name, e.g. "ADD"
+ * Returns:    int - the opcode, or -1 if there is no such opcode
+ */
+static int opcode_number(const char *name)
+{
+    for (int op = 0; op < NUM_OPCODES + NUM_LIFTED; op++) {
+        if ((op < LV || op >= AND) && strcmp(name, opcode_names[op]) == 0) {
+            return op;
+        }
+    }
+    return -1;
+}
+
+/* parse_specialized
+ * Purpose:    Works out which opcodes to specialize from the command line.
+ * Parameters: int argc, char *argv[] - the specialization arguments
+ *             int specialized[] - set to 1 for each specialized opcode
+ * Returns:    none
+ */
+static void parse_specialized(int argc, char *argv[], int specialized[])
+{
+    for (int i = 0; i < argc; i++) {
+        if (strcmp(argv[i], "all") == 0) {
+            for (int op = 0; op < LV; op++) {
+                specialized[op] = !calls_out[op];
+            }
+            for (int op = AND; op < AND + NUM_LIFTED; op++) {
+                specialized[op] = 1;
+            }
+        } else if (strcmp(argv[i], "hot") == 0) {
+            for (unsigned j = 0; j < sizeof(hot_opcodes) /
+                                     sizeof(hot_opcodes[0]); j++) {
+                specialized[opcode_number(hot_opcodes[j])] = 1;
+            }
+        } else if (strcmp(argv[i], "none") != 0) {
+            int op = opcode_number(argv[i]);
+            if (op < 0) {
+                fprintf(stderr, "gen_dispatch: unknown opcode %s\n",
+                        argv[i]);
+                exit(EXIT_FAILURE);
+            } else if (op < LV && calls_out[op]) {
+                fprintf(stderr, "gen_dispatch: %s cannot be specialized\n",
+                        argv[i]);
+                exit(EXIT_FAILURE);
+            }
+            specialized[op] = 1;
+        }
+    }
+    /* The lifted cases check the keys of their second instructions */
+    specialized[NAND] |= specialized[AND];
+    specialized[ADD] |= specialized[ADDNOT];
+}
+
+/* write_run_match
+ * Purpose:    Writes the test Dispatch_lift makes for a run: that its
+ *             instructions have the run's opcodes and that a letter names
+ *             the same register wherever it appears.
+ * Parameters: const Run *run - the run
+ *             int key - the run's key
+ * Returns:    none
+ */
+static void write_run_match(const Run *run, int key)
+{
+    static const int register_lsb[3] = { 6, 3, 0 };
+    printf("    if (available >= %d", run->length);
+    for (int k = 1; k < run->length; k++) {
+        printf(" &&\n        (words[%d] >> 28) == %d", k, run->opcodes[k]);
+    }
+    for (int i = 0; i < run->length * 3; i++) {
+        const char *first = strchr(run->registers, run->registers[i]);
+        int j = first - run->registers;
+        if (j < i) {
+            printf(" &&\n        ((words[%d] >> %d) & 7) == "
+                   "((words[%d] >> %d) & 7)", i / 3, register_lsb[i % 3],
+                   j / 3, register_lsb[j % 3]);
+        }
+    }
+    printf(") {\n        return %d;\n    }\n", key);
+}
+
+/* write_lift
+ * Purpose:    Writes Dispatch_lift, which recognizes the lifted idioms
+ *             that are specialized, and Dispatch_lifted_length.
+ * Parameters: const int specialized[] - the specialized opcodes and idioms
+ *             const int base[] - the first key of each
+ * Returns:    none
+ */
+static void write_lift(const int specialized[], const int base[])
+{
+    printf("/* Dispatch_lift\n"
+           " * Purpose:    Pre-decodes the instructions of a lifted idiom "
+           "into the key of\n"
+           " *             the case executing them all.\n"
+           " * Parameters: const uint32_t *words - the first "
+           "instruction\n"
+           " *             uint32_t available - how many words there are "
+           "from the first\n"
+           " *                                  to the end of segment 0, "
+           "at least 1\n"
+           " * Returns:    uint16_t - the key, or 0 if the instructions "
+           "start no idiom\n"
+           " */\n"
+           "static inline uint16_t Dispatch_lift(const uint32_t *words, "
+           "uint32_t available)\n"
+           "{\n");
+    int any = 0;
+    for (int op = AND; op < AND + NUM_LIFTED; op++) {
+        any |= specialized[op];
+    }
+    if (!any) {
+        printf("    (void)words;\n    (void)available;\n    return 0;\n"
+               "}\n\n");
+    } else {
+        printf("    uint32_t word = words[0];\n"
+               "    if ((word >> 28) != %d || available < 2) {\n"
+               "        return 0;\n"
+               "    }\n", NAND);
+        for (int i = 0; i < NUM_RUNS; i++) {
+            if (specialized[runs[i].idiom]) {
+                write_run_match(&runs[i], base[runs[i].idiom]);
+            }
+        }
+        printf("    uint32_t a = (word >> 6) & 7, b = (word >> 3) & 7;\n"
+               "    uint32_t c = word & 7;\n"
+               "    uint32_t next = words[1];\n"
+               "    uint32_t next_a = (next >> 6) & 7;\n"
+               "    uint32_t next_b = (next >> 3) & 7;\n"
+               "    uint32_t next_c = next & 7;\n");
+        if (specialized[AND]) {
+            printf("    if ((next >> 28) == %d && next_a == a && "
+                   "next_b == a &&\n"
+                   "        next_c == a) {\n"
+                   "        return %d + (word & 0x1ff);\n"
+                   "    }\n", NAND, base[AND]);
+        }
+        if (specialized[ADDNOT]) {
+            printf("    if ((next >> 28) == %d && b == c && "
+                   "next_b == next_a &&\n"
+                   "        next_c == a) {\n"
+                   "        return %d + ((next_a << 6) | (b << 3) | a);\n"
+                   "    }\n", ADD, base[ADDNOT]);
+        }
+        printf("    (void)a;\n    (void)b;\n    (void)c;\n"
+               "    (void)next_a;\n    (void)next_b;\n    (void)next_c;\n"
+               "    return 0;\n}\n\n");
+    }
+
+    printf("/* Dispatch_lifted_length\n"
+           " * Purpose:    Returns how many instructions the case of a "
+           "lifted idiom runs.\n"
+           " * Parameters: uint16_t key - a key from Dispatch_lift\n"
+           " * Returns:    uint32_t - the length of the idiom\n"
+           " */\n"
+           "static inline uint32_t Dispatch_lifted_length(uint16_t key)\n"
+           "{\n");
+    for (int i = 0; i < NUM_RUNS; i++) {
+        if (specialized[runs[i].idiom]) {
+            printf("    if (key == %d) {\n        return %d;\n    }\n",
+                   base[runs[i].idiom], runs[i].length);
+        }
+    }
+    printf("    (void)key;\n    return 2;\n}\n\n");
+}
+
+/* write_header
+ * Purpose:    Writes the key layout: key 0 marks the end of segment 0,
+ *             then each opcode owns 512 keys if specialized or 1 if not,
+ *             LV owns one key per destination register, SPAWN and EXTEND
+ *             own one each, each specialized lifted pair owns 512 and
+ *             each specialized run one, the watched SSTORE owns as many
+ *             as SSTORE, and the last two keys are the stale key and the
+ *             tracked SSTORE.
+ * Parameters: const int specialized[] - the specialized opcodes
+ *             const int base[] - the first key of each opcode
+ *             int watched_base - the first key of the watched SSTORE
+ *             int num_keys - the total number of keys
+ * Returns:    none
+ */
+static void write_header(const int specialized[], const int base[],
+                         int watched_base, int num_keys)
+{
+    printf("/* Generated by gen_dispatch; do not edit */\n\n");
+    printf("#ifndef DISPATCH_TABLE_H\n#define DISPATCH_TABLE_H\n\n");
+    printf("#include <stdint.h>\n\n");
+    printf("#define DISPATCH_NUM_KEYS %d\n", num_keys);
+    printf("#define DISPATCH_END_KEY %d\n", END_KEY);
+    printf("#define DISPATCH_TRACKED_STORE_KEY %d\n", num_keys - 1);
+    printf("#define DISPATCH_STALE_KEY %d\n", num_keys - 2);
+    printf("#define DISPATCH_WATCHED_STORE_OFFSET %d\n\n",
+           watched_base - base[SSTORE]);
+    printf("static const uint16_t Dispatch_base[16] = {\n   ");
+    for (int op = 0; op < NUM_OPCODES; op++) {
+        printf(" %d%s", base[op], op == NUM_OPCODES - 1 ? "\n" : ",");
+    }
+    printf("};\n\n");
+    printf("static const uint16_t Dispatch_mask[16] = {\n   ");
+    for (int op = 0; op < NUM_OPCODES; op++) {
+        printf(" %s%s", op < LV && specialized[op] ? "0x1ff" : "0",
+               op == NUM_OPCODES - 1 ? "\n" : ",");
+    }
+    printf("};\n\n");
+    printf("/* Dispatch_key\n"
+           " * Purpose:    Pre-decodes an instruction into its dispatch "
+           "key.\n"
+           " * Parameters: uint32_t word - the instruction\n"
+           " * Returns:    uint16_t - the key of the case executing it\n"
+           " */\n"
+           "static inline uint16_t Dispatch_key(uint32_t word)\n"
+           "{\n"
+           "    uint32_t op = word >> 28;\n"
+           "    if (op == %d) {\n"
+           "        return Dispatch_base[op] + ((word >> 25) & 7);\n"
+           "    }\n"
+           "    return Dispatch_base[op] + (word & Dispatch_mask[op]);\n"
+           "}\n\n", LV);
+    write_lift(specialized, base);
+    printf("#endif\n");
+}
+
+/* write_cases
+ * Purpose:    Writes one case per key. Specialized cases apply the opcode's
+ *             OP_ macro to the register variables r0..r7 directly; generic
+ *             cases go through DISPATCH_GENERIC.
+ * Parameters: const int specialized[] - the specialized opcodes
+ *             const int base[] - the first key of each opcode
+ *             int watched_base - the first key of the watched SSTORE
+ *             int num_keys - the total number of keys
+ * Returns:    none
+ */
+static void write_cases(const int specialized[], const int base[],
+                        int watched_base, int num_keys)
+{
+    printf("/* Generated by gen_dispatch; do not edit */\n\n");
+    printf("case %d:\n    OP_END();\n", END_KEY);
+    for (int op = 0; op < LV; op++) {
+        if (!specialized[op]) {
+            printf("case %d:\n    DISPATCH_GENERIC(OP_%s);\n    break;\n",
+                   base[op], opcode_names[op]);
+            continue;
+        }
+        for (int abc = 0; abc < NUM_TRIPLES; abc++) {
+            printf("case %d:\n    OP_%s(r%d, r%d, r%d);\n    break;\n",
+                   base[op] + abc, opcode_names[op], abc >> 6,
+                   (abc >> 3) & 7, abc & 7);
+        }
+    }
+    for (int a = 0; a < 8; a++) {
+        printf("case %d:\n    OP_LV(r%d, 0, 0);\n    break;\n",
+               base[LV] + a, a);
+    }
+    for (int op = SPAWN; op <= EXTEND; op++) {
+        printf("case %d:\n    DISPATCH_GENERIC(OP_%s);\n    break;\n",
+               base[op], opcode_names[op]);
+    }
+    /* The second instruction of AND a, b, c is NAND a, a, a, and that
+       of ADDNOT a, b, t is ADD a, a, t */
+    for (int op = AND; op < FIRST_RUN; op++) {
+        int second = op == AND ? NAND : ADD;
+        for (int abc = 0; specialized[op] && abc < NUM_TRIPLES; abc++) {
+            int a = abc >> 6;
+            int next = op == AND ? (a << 6) | (a << 3) | a
+                                 : (a << 6) | (a << 3) | (abc & 7);
+            printf("case %d:\n    OP_%s(r%d, r%d, r%d, %d);\n    break;\n",
+                   base[op] + abc, opcode_names[op], a, (abc >> 3) & 7,
+                   abc & 7, base[second] + next);
+        }
+    }
+    /* A run checks the opcodes after its first, then runs them all */
+    for (int i = 0; i < NUM_RUNS; i++) {
+        const Run *run = &runs[i];
+        if (!specialized[run->idiom]) {
+            continue;
+        }
+        printf("case %d:\n    SPILL_REGISTERS();\n    RUN_%s(0);\n"
+               "    if (", base[run->idiom], opcode_names[run->opcodes[0]]);
+        for (int k = 1; k < run->length; k++) {
+            printf("%s(RUN_WORD(%d) >> 28) == %d", k > 1 ? " &&\n        "
+                   : "", k, run->opcodes[k]);
+        }
+        printf(") {\n");
+        for (int k = 1; k < run->length; k++) {
+            printf("        RUN_%s(%d);\n", opcode_names[run->opcodes[k]],
+                   k);
+        }
+        printf("        program_pointer += %d;\n    }\n"
+               "    RELOAD_REGISTERS();\n    break;\n", run->length - 1);
+    }
+    if (!specialized[SSTORE]) {
+        printf("case %d:\n    DISPATCH_GENERIC(OP_SSTORE_WATCHED);\n"
+               "    break;\n", watched_base);
+    }
+    for (int abc = 0; specialized[SSTORE] && abc < NUM_TRIPLES; abc++) {
+        printf("case %d:\n    OP_SSTORE_WATCHED(r%d, r%d, r%d);\n"
+               "    break;\n", watched_base + abc, abc >> 6,
+               (abc >> 3) & 7, abc & 7);
+    }
+    printf("case %d:\n    OP_STALE();\n", num_keys - 2);
+    printf("case %d:\n    DISPATCH_GENERIC(OP_SSTORE_TRACKED);\n"
+           "    break;\n", num_keys - 1);
+    /* Every key has a case, which spares the switch its range check */
+    printf("default:\n    __builtin_unreachable();\n");
+}
+
+/* main
+ * Purpose:    Lays out the keys and writes the requested file to stdout.
+ * Parameters: int argc - number of command-line arguments
+ *             char *argv[] - "header" or "cases", then the opcodes to
+ *                            specialize
+ * Returns:    int - the status code
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 2 || (strcmp(argv[1], "header") != 0 &&
+                     strcmp(argv[1], "cases") != 0)) {
+        fprintf(stderr, "Usage: %s header|cases [all | none | hot | "
+                "OPCODE ...]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    int specialized[NUM_OPCODES + NUM_LIFTED] = { 0 };
+    parse_specialized(argc - 2, argv + 2, specialized);
+
+    int base[NUM_OPCODES + NUM_LIFTED];
+    int next_key = END_KEY + 1;
+    for (int op = 0; op < LV; op++) {
+        base[op] = next_key;
+        next_key += specialized[op] ? NUM_TRIPLES : 1;
+    }
+    base[LV] = next_key;
+    next_key += 8;
+    base[SPAWN] = next_key++;
+    base[EXTEND] = next_key++;
+    for (int op = AND; op < AND + NUM_LIFTED; op++) {
+        base[op] = next_key;
+        next_key += !specialized[op] ? 0 : op < FIRST_RUN ? NUM_TRIPLES : 1;
+    }
+    int watched_base = next_key;
+    next_key += specialized[SSTORE] ? NUM_TRIPLES : 1;
+    next_key += 2;    /* the stale key and the tracked SSTORE */
+
+    if (strcmp(argv[1], "header") == 0) {
+        write_header(specialized, base, watched_base, next_key);
+    } else {
+        write_cases(specialized, base, watched_base, next_key);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,75 @@
+/******************************************************************************
+ *
+ *                               imagecache.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the program image cache outlined in
+ *                 imagecache.h. The cache directory holds one snapshot per
+ *                 program, named after the 64-bit hash and length of the
+ *                 program file's words. Snapshots are written under a
+ *                 name unique to the process and renamed into place, so
+ *                 UMs running the same program at once never see a torn
+ *                 file.
+ *
+ *****************************************************************************/
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "imagecache.h"
+
+#define PATH_LENGTH 4096
+/* Programs that reach their first LOADP sooner are not worth a file */
+#define MIN_INSTRUCTIONS 1000000
+
+static char entry_path[PATH_LENGTH];
+
+/* Imagecache_lookup
+ * Purpose:    Restores the cached snapshot of a program, if there is one,
+ *             and otherwise remembers where to store it.
+ * Parameters: const char *directory - the cache directory, created if it
+ *                                     does not exist
+ *             Mem_segment program - segment 0 as loaded from the file
+ *             int program_page_flags - passed on to Mem_new
+ *             Checkpoint_machine *machine - filled in on a hit
+ * Returns:    Mem_T - main memory as of the snapshot, or NULL on a miss
+ */
+Mem_T Imagecache_lookup(const char *directory, Mem_segment program,
+                        int program_page_flags, Checkpoint_machine *machine)
+{
+    if (mkdir(directory, 0777) != 0 && errno != EEXIST) {
+        fprintf(stderr, "Could not create image cache %s.\n", directory);
+        exit(EXIT_FAILURE);
+    }
+    snprintf(entry_path, PATH_LENGTH, "%s/%016llx-%u.image", directory,
+             (unsigned long long)Mem_segment_hash(program),
+             (unsigned)program->length);
+    return Checkpoint_load_snapshot(entry_path, program_page_flags, machine);
+}
+
+/* Imagecache_store
+ * Purpose:    Stores a snapshot of the machine for the program passed to
+ *             the last Imagecache_lookup.
+ * Parameters: Mem_T mem - main memory, just after the LOADP
+ *             const Checkpoint_machine *machine - the registers, the
+ *                                                 LOADP target and the
+ *                                                 instructions retired
+ * Returns:    none
+ * Notes:      The caller checks that no input was read and no output
+ *             written; programs that get here quickly are not stored.
+ */
+void Imagecache_store(Mem_T mem, const Checkpoint_machine *machine)
+{
+    if (machine->instructions_retired < MIN_INSTRUCTIONS) {
+        return;
+    }
+    char temporary[PATH_LENGTH + 32];
+    snprintf(temporary, sizeof(temporary), "%s.%ld", entry_path,
+             (long)getpid());
+    Checkpoint_save_snapshot(entry_path, temporary, mem, machine);
+}
@@ -0,0 +1,36 @@
+/******************************************************************************
+ *
+ *                               imagecache.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for the on-disk cache of unpacked programs.
+ *                 Compressed programs such as sandmark.umz spend their
+ *                 first seconds unpacking themselves into a new segment,
+ *                 then LOADP it. The first LOADP that replaces segment 0
+ *                 is a natural point to snapshot the machine, keyed by a
+ *                 hash of the program file, so later runs of the same file
+ *                 can start from there.
+ *
+ *                 A snapshot is only valid for every later run if nothing
+ *                 the program did depended on its surroundings, so one is
+ *                 only taken if the program has read no input and written
+ *                 no output by then. Snapshots use the checkpoint file
+ *                 format (see checkpoint.h).
+ *
+ *****************************************************************************/
+
+#ifndef IMAGECACHE_H
+#define IMAGECACHE_H
+
+#include "checkpoint.h"
+#include "memory.h"
+
+extern Mem_T Imagecache_lookup(const char *directory, Mem_segment program,
+                               int program_page_flags,
+                               Checkpoint_machine *machine);
+extern void Imagecache_store(Mem_T mem, const Checkpoint_machine *machine);
+
+#endif
@@ -16,17 +16,60 @@
  *                 streams, loading a new program to replace the current
  *                 program, and loading values into registers directly.
  *
+ *                 With --threads, the otherwise unused opcodes 14 and 15
+ *                 become SPAWN and JOIN: SPAWN starts a UM thread at the
+ *                 instruction in register C with a copy of the registers,
+ *                 putting the new thread's id (or 0 on failure) in
+ *                 register B of the spawning thread and 0 in that of the
+ *                 new one; JOIN waits for the thread whose id is in
+ *                 register C. All threads share main memory.
+ *
+ *                 With --bulk-memory, opcode 15 also copies, fills and
+ *                 compares runs of words on the host. Bits 25 to 27 of an
+ *                 opcode 15 instruction select the operation: 0 is JOIN,
+ *                 1 COPY, 2 FILL and 3 COMPARE. Registers A and B name
+ *                 the first of a pair of registers holding a segment and
+ *                 an offset (register 7 pairs with register 0):
+ *
+ *                   COPY    copies $C words from segment $B at $B+1 to
+ *                           segment $A at $A+1; the runs may overlap
+ *                   FILL    sets $C words of segment $A from $A+1 to $B
+ *                   COMPARE sets $C to how many leading words of the $C
+ *                           words at segment $A, $A+1 and segment $B, $B+1
+ *                           are equal
+ *
+ *                 A run that is not inside its segment is an error.
+ *                 Without the options, opcodes 14 and 15 do nothing, as
+ *                 before.
+ *
  *****************************************************************************/
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
+#include <getopt.h>
 #include <sys/stat.h>
 #include "assert.h"
 #include "bitpack.h"
-#include "seq.h"
-// #include "memory.h"
-//#include "unpacker.h"
+#include "io.h"
+#include "pages.h"
+#include "codewatch.h"
+#include "telemetry.h"
+#include "perfcount.h"
+#include "cachesim.h"
+#include "costmodel.h"
+#include "profiler.h"
+#include "checkpoint.h"
+#include "coldseg.h"
+#include "dedup.h"
+#include "imagecache.h"
+#include "watchdog.h"
+#include "umthread.h"
+#include "bulkmem.h"
+#include "fileseg.h"
+#include "dispatch_table.h"
+#include "memory.h"
 
 /* Named constants for instruction execution */
 #define PROG_ADDRESS 0
@@ -50,676 +93,1277 @@
 
 #define SIZE_OF_UINT32 4
 
+/* Files mapped with --map-file start in segments 1 to 7, with their
+   lengths in the registers of the same numbers */
+#define MAX_MAPPED_FILES (NUM_REGISTERS - 1)
+
+/* Longest program or file name in a batch manifest, and the matching
+   sscanf conversion */
+#define BATCH_FIELD_LENGTH 4096
+#define BATCH_FIELD_FORMAT "%4095s"
+
 /* Enumeration for each opcode value */
 typedef enum Um_opcode {
     CMOV = 0, SLOAD, SSTORE, ADD, MUL, DIV,
-    NAND, HALT, ACTIVATE, INACTIVATE, OUT, IN, LOADP, LV
+    NAND, HALT, ACTIVATE, INACTIVATE, OUT, IN, LOADP, LV, SPAWN, EXTEND
 } Um_opcode;
 
-// typedef struct Mem_T {
-//     Seq_T main_memory;
-//     Seq_T deleted_addresses;
-// } *Mem_T;
-
-typedef int Mem_Address;
-
-/* #define MEM_UPDATE_WORD(main_mem, address, index, value) \
-do { \
-    UArray_T segment = Seq_get(main_mem->main_memory, address); \
-    *((uint32_t *)UArray_at(segment, index)) = value; \
-} while (0) */
-
-/*****************************************************************************/
+/* Operations of opcode 15, selected by bits 25 to 27 */
+typedef enum Um_extension {
+    JOIN = 0, BULK_COPY, BULK_FILL, BULK_COMPARE
+} Um_extension;
 
-typedef struct SArray_T {
-    uint32_t *data;
-    int length;
-} *SArray_T;
+/* Page flags for segment 0; PAGES_ALIGNED is added when segment 0 is
+   watched for self-modification */
+static int seg_0_page_flags = PAGES_HOT;
+/* Set by --protect-seg0 (see codewatch.h) */
+static int watch_seg_0 = 0;
+static int profiling = 0;
+static int checkpointing = 0;
+static int resuming = 0;
+static int compressing = 0;
+static int deduplicating = 0;
+static int counting = 0;
+static int tracing_locality = 0;
+/* Set by --cost, which counts the instructions executed per opcode */
+static int costing = 0;
+/* Set by --threads, which makes SPAWN and JOIN more than no-ops */
+static int threading = 0;
+/* Set by --bulk-memory, which enables COPY, FILL and COMPARE */
+static int bulk_memory = 0;
+static const char *mapped_files[MAX_MAPPED_FILES];
+static int num_mapped_files = 0;
+static char *image_cache_dir = NULL;
+/* Set until the first LOADP that replaces segment 0 after a cache miss */
+static int caching_image = 0;
+static int input_consumed = 0;
 
-static SArray_T SArray_new(int length)
+/* conditional_move
+ * Purpose:    Perform the conditional move operation. The value in register C
+ *             determines if the other registers get updated. 
+ * Parameters: uint32_t *rA_p - a pointer to the value stored in register A 
+ *             uint32_t rB_val - the value stored in register B
+ *             uint32_t rC_val - the value stored in register C 
+ * Returns:    none
+ */
+static inline void conditional_move(uint32_t *rA_p, uint32_t rB_val,
+                                    uint32_t rC_val)
 {
-    uint32_t *data = malloc(length * SIZE_OF_UINT32);
-    assert(data != NULL);
-    SArray_T sarr = malloc(sizeof *sarr);
-    assert(sarr != NULL);
-    sarr->data = data;
-    sarr->length = length;
-    return sarr; 
+    if (rC_val != 0) {
+        *rA_p = rB_val;
+    }
 }
 
-static uint32_t *SArray_at(SArray_T sarr, int index)
+/* map_segment
+ * Purpose:    Perform the map segment operation. Create a new segment and 
+ *             initializes each value in the segment to be 0. 
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be NULL)
+ *             uint32_t rC_val - the value stored in register C
+ * Returns:    uint32_t - the address of the new segment, for register B
+ */
+static inline uint32_t map_segment(Mem_T mem, uint32_t rC_val)
 {
-    return (sarr->data) + index; 
+    /* The backend hands back the segment with each value set to 0 */
+    Mem_Address address = Mem_create_segment(mem, rC_val);
+    Telemetry->map_words_zeroed += rC_val;
+    if (checkpointing) {
+        Checkpoint_mark_mapped(address, rC_val);
+    }
+    return address;
 }
 
-static uint32_t SArray_get(SArray_T sarr, int index)
+/* unmap_segment
+ * Purpose:    Perform the unmap segment operation.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be NULL)
+ *             uint32_t rC_val - the value stored in register C
+ * Returns:    none
+ */
+static inline void unmap_segment(Mem_T mem, uint32_t rC_val)
 {
-    return sarr->data[index];
+    if (compressing) {
+        Coldseg_forget(rC_val);
+    }
+    if (deduplicating) {
+        Dedup_forget(rC_val);
+    }
+    if (num_mapped_files > 0) {
+        Fileseg_forget(rC_val);
+    }
+    Mem_remove_segment(mem, rC_val);
+    if (checkpointing) {
+        Checkpoint_mark_unmapped(rC_val);
+    }
 }
 
-// new_length must be greater than length
-static void SArray_expand(SArray_T sarr, int new_length)
-{
-    int length = sarr->length;
-    uint32_t *data = sarr->data;
-    uint32_t *new_data = malloc(new_length * SIZE_OF_UINT32);
-    assert(new_data != NULL);
-    for (int i = 0; i < length; i++) {
-        new_data[i] = data[i];
-    }
-    free(data);
-    sarr->data = new_data;
-    sarr->length = new_length;
+/* get_input
+ * Purpose:    Performs the input operation. Reads in 1 byte at a time 
+ *             and returns the value to be stored in register C. 
+ * Parameters: uint64_t instruction_count - instructions retired so far,
+ *                                          used when recording input
+ * Returns:    uint32_t - the byte read, or IO_END_OF_INPUT
+ */
+static uint32_t get_input(uint64_t instruction_count) {
+    Telemetry->instructions_retired = instruction_count;
+    Telemetry->state = TELEMETRY_WAITING_INPUT;
+    input_consumed = 1;
+    /* If the end of input have been signal, then register C is loaded with 
+       a 32-bit word where every bit is 1 */
+    uint32_t value = Io_get_input(instruction_count);
+    Telemetry->state = TELEMETRY_RUNNING;
+    if (value != IO_END_OF_INPUT) {
+        Telemetry->bytes_in++;
+    }
+    return value;
 }
 
-static void SArray_free(SArray_T *sarr)
-{
-    free((*sarr)->data);
-    free(*sarr); 
-}
-/*****************************************************************************/
-
-// static void Mem_delete_segment(Mem_T mem, Mem_Address address);
-
-/* Memory struct, details hidden from client */
-// struct Mem_T {
-//     Seq_T main_memory;
-//     Seq_T deleted_addresses;
-// };
-
-/* Mem_new
- * Purpose:    Dynamically allocates space for a new Mem_T struct instance and
- *             returns a pointer to that struct. Also initializes its members.
- * Parameters: none
- * Returns:    Mem_T - a pointer to the newly allocated Mem_T struct
- * Notes:      Leaves memory on the heap after this function terminates.
- */
-// static Mem_T Mem_new()
-// {
-//     Mem_T mem = malloc(sizeof(*mem));
-//     /* Ensure that malloc was successful */
-//     assert(mem != NULL);
-
-//     /* Instantiate each struct element */
-//     mem->main_memory = Seq_new(0);
-//     mem->deleted_addresses = Seq_new(0);
-//     return mem; 
-// }
-
-/* Mem_free_memory
- * Purpose:    Deallocates all heap allocated memory associated with a Mem_T
- *             instance. 
- * Parameters: Mem_T *mem_p - A double pointer to a Mem_T struct instance, 
- *                            which will be freed. mem_p may be null, but if it
- *                            is not null, *mem_p cannot be null.
+/* decode_words
+ * Purpose:    Pre-decodes a run of instructions of segment 0 into the keys
+ *             of the dispatch cases that execute them.
+ * Parameters: const uint32_t *words - the words of segment 0
+ *             uint32_t length - the length of segment 0
+ *             uint16_t *keys - the key array
+ *             uint32_t first - the first instruction to decode
+ *             uint32_t end - the instruction after the last one
  * Returns:    none
+ * Notes:      The instruction before the run is decoded again too, since
+ *             it may start a lifted pair (see gen_dispatch.c) that ends
+ *             in the run. Longer runs check their instructions as they
+ *             execute, so one ending in the run needs no decoding.
  */
-static void Mem_free_memory(Seq_T main_memory, Seq_T deleted_addresses)
+static void decode_words(const uint32_t *words, uint32_t length,
+                         uint16_t *keys, uint32_t first, uint32_t end)
 {
-    // if (mem_p == NULL) {
-    //     return;
-    // }
-    // Mem_T mem = *mem_p;
-    // assert(mem != NULL);
-
-    // Seq_T main_memory = mem->main_memory;
-    // Seq_T deleted_addresses = mem->deleted_addresses;
-    /* Iterate over main memory and delete all existing segments */
-    int main_mem_len = Seq_length(main_memory);
-    for (int i = 0; i < main_mem_len; i++) {
-        //if (Seq_get(main_memory, i) != NULL) {
-            // Mem_delete_segment(mem, i);
-        SArray_T segment = Seq_get(main_memory, i);
-        SArray_free(&segment);
-        //}
-    }
-
-    /* Free remaining struct memory before freeing the struct itself */
-    Seq_free(&main_memory);
-    Seq_free(&deleted_addresses);
-    // free(mem);
+    if (first > 0) {
+        first--;
+    }
+    for (uint32_t i = first; i < end; i++) {
+        keys[i] = Dispatch_key(words[i]);
+    }
+    for (uint32_t i = first; i < end; i++) {
+        uint16_t key = Dispatch_lift(&words[i], length - i);
+        if (key != 0) {
+            keys[i] = key;
+        }
+    }
+    if (checkpointing) {
+        /* Stores go to the case that marks them dirty; a separate pass
+           keeps the loop above vectorizable */
+        for (uint32_t i = first; i < end; i++) {
+            if ((words[i] >> OPCODE_LSB) == SSTORE) {
+                keys[i] = DISPATCH_TRACKED_STORE_KEY;
+            }
+        }
+    } else if (watch_seg_0) {
+        /* Stores go to the cases that do not check for segment 0 */
+        for (uint32_t i = first; i < end; i++) {
+            if ((words[i] >> OPCODE_LSB) == SSTORE) {
+                keys[i] += DISPATCH_WATCHED_STORE_OFFSET;
+            }
+        }
+    }
 }
 
-/* Mem_create_segment
- * Purpose:    Creates a new segment with the specified length at a free index
- *             in main memory. The index of the new segment is returned to the
- *             client.
- * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
- *             int length - length of the segment
- * Returns:    Mem_Address - the address of the newly instantiated segment
+/* decode_program
+ * Purpose:    Pre-decodes every instruction of segment 0 into the key of
+ *             the dispatch case that executes it, followed by the key that
+ *             ends the program.
+ * Parameters: uint32_t *words - the words of segment 0
+ *             uint32_t length - the length of segment 0
+ *             uint16_t *keys - the previous key array, or NULL
+ * Returns:    uint16_t * - the key array, resized to length entries
  */
-static Mem_Address Mem_create_segment(Seq_T main_memory,
-                                      Seq_T deleted_addresses, int length)
+static uint16_t *decode_program(uint32_t *words, uint32_t length,
+                                uint16_t *keys)
 {
-    // assert(mem != NULL);
-    /* Use a macro instead of sizeof(uint32_t) for efficiency */
-    Mem_Address address;
-    // Seq_T deleted_addresses = mem->deleted_addresses;
-    // Seq_T main_memory = mem->main_memory;
-    /* In this case, add a new segment (which will expand the sequence) */
-    if (Seq_length(deleted_addresses) == 0) {
-        SArray_T segment = SArray_new(length);
-        address = Seq_length(main_memory);
-        Seq_addhi(main_memory, segment);
-    } else {
-        /* In this case, use the top element of the stack as the address */
-        address = (uintptr_t)Seq_remhi(deleted_addresses);
-        SArray_T segment = Seq_get(main_memory, address); 
-        int curr_seg_length = segment->length;
-        if (curr_seg_length < length) {
-            // for (int i = 0; i < curr_seg_length; i++) {
-            //     *((uint32_t *)UArray_at(segment, i)) = 0;
-            // }
-            SArray_expand(segment, length);
-        }
+    size_t bytes = ((size_t)length + 1) * sizeof(*keys);
+    keys = realloc(keys, bytes);
+    if (keys == NULL) {
+        Mem_allocation_failed("the decoded program", bytes);
     }
-    return address;
+    decode_words(words, length, keys, 0, length);
+    keys[length] = DISPATCH_END_KEY;
+    return keys;
 }
 
-/* Mem_delete_segment
- * Purpose:    Remove a segment corresponding with a specified index 
- *             and stores its address in a Hanson sequence representing 
- *             the deleted addresses. 
- * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
- *             Mem_Address address - 32-bit address corresponding with an 
- *                                   existing segment
- * Returns: none
+/* bulk_range
+ * Purpose:    Finds the run of words a bulk memory instruction names,
+ *             exiting if it is not inside its segment.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be NULL)
+ *             uint32_t segment - the segment id
+ *             uint32_t offset - the index of the first word
+ *             uint32_t num_words - the length of the run
+ *             uint32_t pc - the instruction, for the error message
+ * Returns:    uint32_t * - the first word of the run
  */
-// static void Mem_delete_segment(Mem_T mem, Mem_Address address)
-// {
-//     Seq_T main_memory = mem->main_memory;
-//     // assert(mem != NULL);
-//     SArray_T segment = Seq_get(main_memory, address);
-//     SArray_free(&segment);
-//     // Seq_put(main_memory, address, NULL); 
-//     /* Add the removed index to deleted addresses */
-//     // Seq_addhi(mem->deleted_addresses, (void *)(uintptr_t)address);
-// }
-
-static void Mem_remove_segment(Seq_T deleted_addresses, Mem_Address address)
+static uint32_t *bulk_range(Mem_T mem, uint32_t segment, uint32_t offset,
+                            uint32_t num_words, uint32_t pc)
 {
-    Seq_addhi(deleted_addresses, (void *)(uintptr_t)address); 
+    if (segment >= Mem_num_segments(mem) ||
+        (uint64_t)offset + num_words >
+        (uint64_t)Mem_segment_at(mem, segment)->length) {
+        fprintf(stderr, "Bulk memory instruction at pc %u: %u words at "
+                "%u are outside segment %u.\n", pc, num_words, offset,
+                segment);
+        exit(EXIT_FAILURE);
+    }
+    return Mem_segment_at(mem, segment)->data + offset;
 }
 
-/* Mem_update_word
- * Purpose:    Inserts a given 32-bit value into a segment corresponding with 
- *             a specified index. 
- * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
- *             Mem_Address address - 32-bit address corresponding with an 
- *                                   existing segment
- *             int index - index of the word to update within the segment 
- *             uint32_t value - 32-bit updated value of the specified word
+/* trace_range
+ * Purpose:    Reports every word of a run to the cache simulator.
+ * Parameters: uint32_t pc - the instruction touching them
+ *             uint32_t segment - the segment id
+ *             const uint32_t *words - the run
+ *             uint32_t num_words - its length
  * Returns:    none
  */
-static void Mem_update_word(Seq_T main_memory, Mem_Address address, 
-                                        int index, uint32_t value)
+static void trace_range(uint32_t pc, uint32_t segment, const uint32_t *words,
+                        uint32_t num_words)
 {
-    // assert(mem != NULL);
-    SArray_T segment = Seq_get(main_memory, address);
-    *SArray_at(segment, index) = value;
+    for (uint32_t i = 0; i < num_words; i++) {
+        Cachesim_data(pc, segment, &words[i]);
+    }
 }
 
-/* Mem_get_word
- * Purpose:    Returns the value of the 32-bit word at the specified index
- *             within the segment specified by the given address.
- * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
- *             Mem_Address address - 32-bit address corresponding with an 
- *                                   existing segment
- * Returns:    uint32_t - the 32-bit word at the specified address/index
+/* bulk_memory_op
+ * Purpose:    Performs COPY, FILL or COMPARE (see the top of this file).
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be NULL)
+ *             uint16_t *keys - the dispatch keys of segment 0, updated if
+ *                              it is written, or NULL if there are none
+ *             uint32_t *registers - the eight registers
+ *             uint32_t word - the instruction
+ *             uint32_t pc - where it is
+ * Returns:    none
  */
-static uint32_t Mem_get_word(Seq_T main_memory, Mem_Address address, int index)
+static void bulk_memory_op(Mem_T mem, uint16_t *keys, uint32_t *registers,
+                           uint32_t word, uint32_t pc)
 {
-    // assert(mem != NULL);
-    SArray_T segment = Seq_get(main_memory, address);
-    return SArray_get(segment, index);
-} 
-
-/* Mem_duplicate_segment
- * Purpose:    Duplicates the segment at the first address and stores the 
- *             duplicate at the second address. 
- * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
- *             Mem_Address address_to_dup - 32-bit address corresponding with 
- *                                          an existing segment to duplicate
- *             Mem_Address address_to_replace - 32-bit address corresponding 
- *                                              with an existing segment to 
- *                                              replace
- * Returns:    int - the length of the newly duplicated segment
+    int function = (word >> RA_13_LSB) & 7;
+    int ra = (word >> RA_LSB) & 7;
+    int rb = (word >> RB_LSB) & 7;
+    uint32_t *rC_p = &registers[(word >> RC_LSB) & 7];
+    uint32_t num_words = *rC_p;
+    uint32_t a_segment = registers[ra];
+    uint32_t a_offset = registers[(ra + 1) & 7];
+    uint32_t b_segment = registers[rb];
+    uint32_t b_offset = registers[(rb + 1) & 7];
+    uint32_t *a = bulk_range(mem, a_segment, a_offset, num_words, pc);
+    uint32_t *b = NULL;
+
+    if (function != BULK_FILL) {
+        b = bulk_range(mem, b_segment, b_offset, num_words, pc);
+        if (tracing_locality) {
+            trace_range(pc, b_segment, b, num_words);
+        }
+    }
+    if (tracing_locality) {
+        trace_range(pc, a_segment, a, num_words);
+    }
+    if (function == BULK_COMPARE) {
+        *rC_p = Bulkmem_compare(a, b, num_words);
+        return;
+    } else if (function == BULK_COPY) {
+        Bulkmem_copy(a, b, num_words);
+    } else {
+        Bulkmem_fill(a, registers[rb], num_words);
+    }
+    if (num_words == 0) {
+        return;
+    }
+    if (checkpointing) {
+        Checkpoint_mark_range(a_segment, a_offset, num_words);
+    }
+    /* With --protect-seg0 the write has already made the keys stale */
+    if (a_segment == PROG_ADDRESS && keys != NULL && !watch_seg_0) {
+        decode_words(a - a_offset, Mem_segment_at(mem, PROG_ADDRESS)->length,
+                     keys, a_offset, a_offset + num_words);
+    }
+}
+
+/* load_program
+ * Purpose:    Perform the load program operation. Duplicates a segment of the 
+ *             address that stores in register B and replaces segment 0 with 
+ *             the duplicated segment. The caller sets the program pointer.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be NULL)
+ *             uint32_t rB_val - the value stored in register B, which must
+ *                               not be 0
+ *             uint16_t *keys - the dispatch keys of the old segment 0
+ * Returns:    uint16_t * - the dispatch keys of the new segment 0
  */
-static int Mem_duplicate_segment(Seq_T main_memory, Seq_T deleted_addresses, Mem_Address address_to_dup,
-                          Mem_Address address_to_replace)
+static uint16_t *load_program(Mem_T mem, uint32_t rB_val, uint16_t *keys)
 {
-    // assert(mem != NULL);
-    SArray_T segment_to_dup = Seq_get(main_memory, address_to_dup); 
-    int segment_to_dup_len = segment_to_dup->length;
-    Mem_remove_segment(deleted_addresses, address_to_replace);
-    Mem_create_segment(main_memory, deleted_addresses, segment_to_dup_len);
-    
-    /* Populate new segment with 32-bit words from the duplicated segment */
-    for (int i = 0; i < segment_to_dup_len; i++) {
-        Mem_update_word(main_memory, address_to_replace, i,
-                        Mem_get_word(main_memory, address_to_dup, i));
+    if (watch_seg_0) {
+        Codewatch_release();
     }
-    return segment_to_dup_len;
-} 
-
-static SArray_T Mem_get_segment(Seq_T main_memory, Mem_Address address) {
-   return Seq_get(main_memory, address); 
+    uint32_t seg_0_len = Mem_duplicate_segment(mem, rB_val, PROG_ADDRESS);
+    uint32_t *seg_0_ptr = Mem_segment_at(mem, PROG_ADDRESS)->data;
+    if (profiling) {
+        Profiler_set_image(Profiler_hash_image(seg_0_ptr, seg_0_len));
+    }
+    if (checkpointing) {
+        Checkpoint_mark_mapped(PROG_ADDRESS, seg_0_len);
+    }
+    return decode_program(seg_0_ptr, seg_0_len, keys);
 }
 
-// static uint32_t Mem_get_word_from_seg(SArray_T segment, int index)
-// {
-//     // assert(mem != NULL);
-//     return SArray_get(segment, index);
-// } 
-
-/*****************************************************************************/
-
-/* conditional_move
- * Purpose:    Perform the conditional move operation. The value in register C
- *             determines if the other registers get updated. 
- * Parameters: uint32_t *rA_p - a pointer to the value stored in register A 
- *             uint32_t rB_val - the value stored in register B
- *             uint32_t rC_val - the value stored in register C 
+/* take_checkpoint
+ * Purpose:    Writes a checkpoint of the machine at a block boundary.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be NULL)
+ *             const uint32_t *registers - the eight registers
+ *             uint32_t program_pointer - where execution continues
+ *             uint64_t instructions_retired - instructions executed so far
  * Returns:    none
  */
-static inline void conditional_move(uint32_t *rA_p, uint32_t rB_val,
-                                    uint32_t rC_val)
+static void take_checkpoint(Mem_T mem, const uint32_t *registers,
+                            uint32_t program_pointer,
+                            uint64_t instructions_retired)
 {
-    if (rC_val != 0) {
-        *rA_p = rB_val;
-    }
+    Checkpoint_machine machine;
+    memcpy(machine.registers, registers, sizeof(machine.registers));
+    machine.program_pointer = program_pointer;
+    machine.instructions_retired = instructions_retired;
+    Checkpoint_take(mem, &machine);
 }
 
-/* map_segment
- * Purpose:    Perform the map segment operation. Create a new segment and 
- *             initializes each value in the segment to be 0. 
- * Parameters: Mem_T main_mem - an instance of Mem_T (must not be NULL)
- *             uint32_t *rB_p - a pointer to the value stored in register B
- *             uint32_t rC_val - the value stored in register C
+/* cache_image
+ * Purpose:    Stores the machine in the image cache just after the first
+ *             LOADP that replaced segment 0, unless the program has
+ *             already read input or written output.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be NULL)
+ *             const uint32_t *registers - the eight registers
+ *             uint32_t program_pointer - the LOADP target
+ *             uint64_t instructions_retired - instructions executed so far
  * Returns:    none
  */
-static void map_segment(Seq_T main_memory, Seq_T deleted_addresses, 
-                                   uint32_t *rB_p, uint32_t rC_val)
+static void cache_image(Mem_T mem, const uint32_t *registers,
+                        uint32_t program_pointer,
+                        uint64_t instructions_retired)
 {
-    Mem_Address address = Mem_create_segment(main_memory, deleted_addresses, rC_val);
-    
-    /* Initializes each value in the segment to be 0 */
-    SArray_T segment = Seq_get(main_memory, address); 
-    for (unsigned i = 0; i < rC_val; i++) {
-        // Mem_update_word(main_mem, address, i, 0);
-        *SArray_at(segment, i) = 0;
+    caching_image = 0;
+    if (input_consumed || Telemetry->bytes_out != 0) {
+        return;
     }
-    *rB_p = address;
+    Checkpoint_machine machine;
+    memcpy(machine.registers, registers, sizeof(machine.registers));
+    machine.program_pointer = program_pointer;
+    machine.instructions_retired = instructions_retired;
+    Imagecache_store(mem, &machine);
 }
 
-/* get_input
- * Purpose:    Performs the input operation. Reads in 1 byte at a time 
- *             and stores the value in register C. 
- * Parameters: uint32_t  *rC_p - a pointer to the value stored in register C
- * Returns:    none
- */
-static void get_input(uint32_t *rC_p) {
-    int byte = getchar();
+/* Semantics of each instruction, shared by the generated dispatch cases
+   (see gen_dispatch.c). A, B and C are the register variables named by the
+   instruction. Only opcodes that stay inside the interpreter (no calls)
+   may be specialized; the others always run through DISPATCH_GENERIC. */
+#define OP_CMOV(A, B, C)       conditional_move(&(A), B, C)
+#define OP_SLOAD(A, B, C)      (A) = Mem_segment_at(mem, B)->data[C]
+/* A store into segment 0 re-decodes the word it wrote */
+#define OP_SSTORE(A, B, C)                                              \
+    do {                                                                \
+        Mem_segment_at(mem, A)->data[B] = (C);                          \
+        if ((A) == PROG_ADDRESS) {                                      \
+            keys[B] = Dispatch_key(C);                                   \
+        }                                                               \
+    } while (0)
+/* While checkpointing, every SSTORE runs here instead (see
+   decode_program), so the specialized cases need no check of their own */
+#define OP_SSTORE_TRACKED(A, B, C)                                      \
+    do {                                                                \
+        OP_SSTORE(A, B, C);                                             \
+        Checkpoint_mark_store(A, B);                                    \
+        if ((A) == PROG_ADDRESS && ((C) >> OPCODE_LSB) == SSTORE) {     \
+            keys[B] = DISPATCH_TRACKED_STORE_KEY;                       \
+        }                                                               \
+    } while (0)
+/* With --protect-seg0, every SSTORE runs here instead (see decode_words),
+   and codewatch catches the first store to each page of segment 0 */
+#define OP_SSTORE_WATCHED(A, B, C)                                      \
+    Mem_segment_at(mem, A)->data[B] = (C)
+#define OP_ADD(A, B, C)        (A) = (B) + (C)
+#define OP_MUL(A, B, C)        (A) = (B) * (C)
+#define OP_DIV(A, B, C)        (A) = (B) / (C)
+#define OP_NAND(A, B, C)       (A) = ~((B) & (C))
+#define OP_HALT(A, B, C)       goto halt
+#define OP_ACTIVATE(A, B, C)   (B) = map_segment(mem, C)
+#define OP_INACTIVATE(A, B, C) unmap_segment(mem, C)
+#define OP_OUT(A, B, C)                                                 \
+    do {                                                                \
+        Io_put_output(C);                                               \
+        Telemetry->bytes_out++;                                         \
+    } while (0)
+#define OP_IN(A, B, C)                                                  \
+    (C) = get_input(instructions_retired + (program_pointer - block_start))
+#define OP_LOADP(A, B, C)                                               \
+    do {                                                                \
+        loadp_segment = (B);                                            \
+        loadp_target = (C);                                             \
+        goto loadp;                                                     \
+    } while (0)
+#define OP_LV(A, B, C)         (A) = DISPATCH_WORD & 0x1ffffff
+/* Lifted pairs (see gen_dispatch.c) run both of their instructions,
+   unless a store into segment 0 has replaced the second, whose key is
+   then no longer NEXT. SSTORE replaces the key of a lifted first one. */
+#define OP_AND(A, B, C, NEXT)                                           \
+    do {                                                                \
+        (A) = ~((B) & (C));                                             \
+        if (keys[program_pointer] == (NEXT)) {                          \
+            (A) = ~(A);                                                 \
+            program_pointer++;                                          \
+        }                                                               \
+    } while (0)
+#define OP_ADDNOT(A, B, T, NEXT)                                        \
+    do {                                                                \
+        (T) = ~(B);                                                     \
+        if (keys[program_pointer] == (NEXT)) {                          \
+            (A) = (A) + (T);                                            \
+            program_pointer++;                                          \
+        }                                                               \
+    } while (0)
+#define OP_SPAWN(A, B, C)                                               \
+    do {                                                                \
+        if (threading) {                                                \
+            (B) = spawn_thread(mem, keys, (DISPATCH_WORD >> RB_LSB) & 7, \
+                               C);                                      \
+        }                                                               \
+    } while (0)
+#define OP_EXTEND(A, B, C)                                              \
+    do {                                                                \
+        if (((DISPATCH_WORD >> RA_13_LSB) & 7) == JOIN) {               \
+            if (threading) {                                            \
+                Umthread_join(C);                                       \
+            }                                                           \
+        } else if (bulk_memory &&                                       \
+                   ((DISPATCH_WORD >> RA_13_LSB) & 7) <= BULK_COMPARE) { \
+            bulk_memory_op(mem, keys, spilled_registers, DISPATCH_WORD, \
+                           program_pointer - 1);                        \
+        }                                                               \
+    } while (0)
+#define OP_END()               goto end_of_program
+/* An instruction on a page of segment 0 written since it was protected
+   (see codewatch.h) is decoded each time it runs */
+#define OP_STALE()                                                      \
+    do {                                                                \
+        key = Dispatch_key(DISPATCH_WORD);                              \
+        if ((DISPATCH_WORD >> OPCODE_LSB) == SSTORE) {                  \
+            key += DISPATCH_WATCHED_STORE_OFFSET;                       \
+        }                                                               \
+        goto dispatch;                                                  \
+    } while (0)
 
-    /* If the end of input have been signal, then register C is loaded with 
-       a 32-bit word where every bit is 1 */
-    if (byte == EOF) {
-        *rC_p = ~0; 
-        return;
+/* The instruction being executed, for cases that need more than its key */
+#define DISPATCH_WORD seg_0_ptr[program_pointer - 1]
+
+/* Registers are copied out to (and back from) a static array around any
+   call, so the register variables are never live across one and the
+   compiler has no reason to keep them anywhere but in host registers.
+   Each UM thread has its own. */
+static __thread uint32_t spilled_registers[NUM_REGISTERS];
+
+#define SPILL_REGISTERS()                                               \
+    do {                                                                \
+        spilled_registers[0] = r0; spilled_registers[1] = r1;           \
+        spilled_registers[2] = r2; spilled_registers[3] = r3;           \
+        spilled_registers[4] = r4; spilled_registers[5] = r5;           \
+        spilled_registers[6] = r6; spilled_registers[7] = r7;           \
+    } while (0)
+#define RELOAD_REGISTERS()                                              \
+    do {                                                                \
+        r0 = spilled_registers[0]; r1 = spilled_registers[1];           \
+        r2 = spilled_registers[2]; r3 = spilled_registers[3];           \
+        r4 = spilled_registers[4]; r5 = spilled_registers[5];           \
+        r6 = spilled_registers[6]; r7 = spilled_registers[7];           \
+    } while (0)
+
+/* The cases of lifted runs (see gen_dispatch.c) execute each instruction
+   on the spilled registers, K words after the first */
+#define RUN_WORD(K)            seg_0_ptr[program_pointer - 1 + (K)]
+#define RUN_REGISTER(K, LSB)   spilled_registers[(RUN_WORD(K) >> (LSB)) & 7]
+#define RUN_NAND(K)                                                     \
+    RUN_REGISTER(K, RA_LSB) = ~(RUN_REGISTER(K, RB_LSB) &               \
+                                RUN_REGISTER(K, RC_LSB))
+#define RUN_ADD(K)                                                      \
+    RUN_REGISTER(K, RA_LSB) = RUN_REGISTER(K, RB_LSB) +                 \
+                              RUN_REGISTER(K, RC_LSB)
+
+/* Executes an opcode that has no specialized cases: the instruction
+   indexes the spilled registers at run time */
+#define DISPATCH_GENERIC(OP)                                            \
+    do {                                                                \
+        SPILL_REGISTERS();                                              \
+        OP(spilled_registers[(DISPATCH_WORD >> RA_LSB) & 7],            \
+           spilled_registers[(DISPATCH_WORD >> RB_LSB) & 7],            \
+           spilled_registers[(DISPATCH_WORD >> RC_LSB) & 7]);           \
+        RELOAD_REGISTERS();                                             \
+    } while (0)
+
+/* Spawned threads share the dispatch keys of the thread that started the
+   program, which is the only one allowed to replace them */
+typedef struct Spawned_thread {
+    Mem_T mem;
+    uint16_t *keys;
+    Checkpoint_machine start;
+} Spawned_thread;
+
+static int execute_instructions(Mem_T mem, const Checkpoint_machine *start,
+                                uint16_t *shared_keys);
+
+/* run_spawned
+ * Purpose:    Runs a spawned UM thread until it halts. If it fails, or
+ *             hits a limit, the whole machine stops with its status.
+ * Parameters: void *arg - the Spawned_thread, freed here
+ * Returns:    void * - NULL
+ */
+static void *run_spawned(void *arg)
+{
+    Spawned_thread spawned = *(Spawned_thread *)arg;
+    free(arg);
+    int status = execute_instructions(spawned.mem, &spawned.start,
+                                      spawned.keys);
+    if (status != EXIT_SUCCESS) {
+        exit(status);
     }
-    *rC_p = byte;
+    return NULL;
 }
 
-/* load_program
- * Purpose:    Perform the load program operation. Duplicates a segment of the 
- *             address that stores in register B and replaces segment 0 with 
- *             the duplicated segment. 
- * Parameters: Mem_T main_mem - an instance of Mem_T (must not be NULL)
- *             uint32_t *rB_p - a pointer to the value store in register B
- *             uint32_t rC_val - the value stored in register C
- *             uint32_t *program_pointer - a pointer to the value of the 
- *                                         program pointer
- *             uint32_t *seg_0_len - a pointer to the length of segment 0
- * Returns:    none
+/* spawn_thread
+ * Purpose:    Performs the SPAWN operation: starts a UM thread at a given
+ *             instruction with a copy of the spawning thread's registers.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be NULL)
+ *             uint16_t *keys - the dispatch keys of segment 0
+ *             int rB_index - the number of register B
+ *             uint32_t rC_val - the value stored in register C, where the
+ *                               new thread starts
+ * Returns:    uint32_t - the new thread's id for the spawning thread's
+ *             register B, or 0 if no thread could be started
+ * Notes:      Reads the registers from spilled_registers, so it must run
+ *             through DISPATCH_GENERIC. In the new thread, register B
+ *             holds 0, which tells the two apart.
  */
-static void load_program(Seq_T main_memory, Seq_T deleted_addresses, uint32_t *rB_p, uint32_t rC_val,
-                         uint32_t *program_pointer, uint32_t *seg_0_len,
-                         SArray_T *seg_0_ptr)
+static uint32_t spawn_thread(Mem_T mem, uint16_t *keys, int rB_index,
+                             uint32_t rC_val)
 {
-    if (*rB_p != PROG_ADDRESS) {
-        *seg_0_len = Mem_duplicate_segment(main_memory, deleted_addresses, 
-                                                     *rB_p, PROG_ADDRESS);
-        *seg_0_ptr = Mem_get_segment(main_memory, PROG_ADDRESS);
-        // *curr_segment = *seg_0_ptr;
-        // *curr_segment_address = PROG_ADDRESS;
-    }
-    *program_pointer = rC_val;
+    Spawned_thread *spawned = malloc(sizeof(*spawned));
+    assert(spawned != NULL);
+    spawned->mem = mem;
+    spawned->keys = keys;
+    memcpy(spawned->start.registers, spilled_registers,
+           sizeof(spawned->start.registers));
+    spawned->start.registers[rB_index] = 0;
+    spawned->start.program_pointer = rC_val;
+    spawned->start.instructions_retired = 0;
+    uint32_t id = Umthread_spawn(run_spawned, spawned);
+    if (id == 0) {
+        free(spawned);
+    }
+    return id;
 }
 
-/* execute_cases
- * Purpose:    Executes the correct instruction based on the specified opcode
- *             value, which must be between 0 and 12. If the opcode value is
- *             not within the range of valid opcodes, no instruction is
- *             executed. This function does not handle opcode value 13.
- * Parameters: Mem_T main_mem - an instance of Mem_T (must not be NULL)
- *             int opcode - a value between 0 and 12 that corresponds directly
- *                          with the intended instruction to execute
- *             uint32_t *rA_p - a pointer to the value stored in register A
- *             uint32_t *rB_p - a pointer to the value stored in register B
- *             uint32_t *rC_p - a pointer to the value stored in register C
- *             uint32_t *program_pointer - a pointer to the value of the 
- *                                         program pointer
- *             uint32_t *seg_0_len - a pointer to the length of segment 0
- * Returns:    none
+/* stop_thread
+ * Purpose:    Ends a run of execute_instructions.
+ * Parameters: uint16_t *keys - the dispatch keys
+ *             int owns_keys - nonzero in the thread that started the
+ *                             program, whose keys they are
+ *             int status - the exit status of the thread
+ * Returns:    int - status
+ * Notes:      With --threads, the first thread waits for every other one
+ *             when it halts, and a failure in any thread exits at once,
+ *             since the others may still be using main memory.
  */
-// static void execute_cases(Mem_T main_mem, int opcode, uint32_t *rA_p,
-//                           uint32_t *rB_p, uint32_t *rC_p,
-//                           uint32_t *program_pointer, uint32_t *seg_0_len,
-//                           UArray_T *seg_0_ptr)
-// {
-//     UArray_T segment;
-//     switch (opcode) {
-//         case CMOV:
-//             conditional_move(rA_p, *rB_p, *rC_p);
-//             break;
-//         case SLOAD:
-//             //*rA_p = Mem_get_word(main_mem, *rB_p, *rC_p);
-//             segment = Seq_get(main_mem->main_memory, *rB_p);
-//             *rA_p = *((uint32_t *)UArray_at(segment, *rC_p));
-//             break;
-//         case SSTORE:
-//             //Mem_update_word(main_mem, *rA_p, *rB_p, *rC_p);
-//             segment = Seq_get(main_mem->main_memory, *rA_p);
-//             *((uint32_t *)UArray_at(segment, *rB_p)) = *rC_p;
-//             // MEM_UPDATE_WORD(main_mem, *rA_p, *rB_p, *rC_p);
-//             break;
-//         case ADD:
-//             *rA_p = *rB_p + *rC_p;
-//             break;
-//         case MUL:
-//             *rA_p = *rB_p * *rC_p;
-//             break;
-//         case DIV:
-//             *rA_p = *rB_p / *rC_p;
-//             break;
-//         case NAND:
-//             *rA_p = ~(*rB_p & *rC_p);
-//             break;
-//         case HALT:
-//             Mem_free_memory(&main_mem); 
-//             exit(EXIT_SUCCESS); 
-//             break;
-//         case ACTIVATE:
-//             map_segment(main_mem, rB_p, *rC_p); 
-//             // *rB_p = Mem_create_segment(main_mem, *rC_p);
-//             break;
-//         case INACTIVATE:
-//             Mem_remove_segment(main_mem, *rC_p);
-//             break;
-//         case OUT:
-//             putchar(*rC_p);
-//             break;
-//         case IN:
-//             get_input(rC_p);
-//             break;
-//         case LOADP:
-//             load_program(main_mem, rB_p, *rC_p, program_pointer, seg_0_len, seg_0_ptr);
-//             break;
-//     }
-// }
+static int stop_thread(uint16_t *keys, int owns_keys, int status)
+{
+    if (threading && status != EXIT_SUCCESS) {
+        exit(status);
+    }
+    if (watch_seg_0) {
+        Codewatch_release();
+    }
+    if (owns_keys) {
+        if (threading) {
+            Umthread_join_all();
+        }
+        free(keys);
+    }
+    return status;
+}
 
 /* execute_instructions
  * Purpose:    Executes instructions loaded into the first segment of main
  *             memory, which is passed as a parameter to this function.
  *             Declares and initializes the registers and program pointer
  *             necessary to run any UM program.
- * Parameters: Mem_T main_mem - an instance of Mem_T (must not be NULL)
- *             uint32_t seg_0_len - the number of instructions stored in
- *                                  segment 0 of main memory
- * Returns:    none
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be NULL)
+ *             const Checkpoint_machine *start - the registers, program
+ *                                               pointer and instruction
+ *                                               count to start from
+ *             uint16_t *shared_keys - the dispatch keys of a spawned
+ *                                     thread, or NULL to decode segment 0
+ * Returns:    int - the exit status of the program: EXIT_SUCCESS if it
+ *             halted, or that of the error or limit that stopped it
+ * Notes:      Each instruction is pre-decoded into a dispatch key (see
+ *             gen_dispatch.c) whose case names the registers directly, so
+ *             the eight registers are plain local variables. The key after
+ *             the last instruction ends the program, which saves checking
+ *             the program pointer on every instruction. SSTORE into
+ *             segment 0 and LOADP keep the keys in step with the program,
+ *             or with --protect-seg0, LOADP and codewatch do.
+ *             The case of a lifted idiom (see gen_dispatch.c) runs two
+ *             instructions and skips the second.
+ *             With --threads, only the first thread may LOADP another
+ *             segment, and only once it has joined every thread, since
+ *             that replaces the keys the others run from.
  */
-static void execute_instructions(Seq_T main_memory, Seq_T deleted_addresses,
-                                 uint32_t seg_0_len)
+static int execute_instructions(Mem_T mem, const Checkpoint_machine *start,
+                                uint16_t *shared_keys)
 {
-    //assert(main_mem != NULL);
-    uint32_t registers[NUM_REGISTERS];
-
-    /* Initializes each register to be 0 */
-    for (int i = 0; i < NUM_REGISTERS; i++) {
-        registers[i] = 0;
-    }
+    /* Initializes each register from the starting state */
+    uint32_t r0, r1, r2, r3, r4, r5, r6, r7;
+    memcpy(spilled_registers, start->registers, sizeof(spilled_registers));
+    RELOAD_REGISTERS();
     
-    uint32_t program_pointer = 0;
-    uint32_t curr_instruction;
-    int curr_opcode;
-    SArray_T seg_0_ptr = Mem_get_segment(main_memory, PROG_ADDRESS);
-    // uint32_t curr_segment_address = 0;
-    SArray_T curr_segment = seg_0_ptr;
-    // Seq_T main_memory = main_mem->main_memory;
-
-    // int num_mem_ops = 0;
-    // int num_mem_cache_hits = 0;
+    uint32_t seg_0_len = Mem_segment_at(mem, PROG_ADDRESS)->length;
+    uint32_t program_pointer = start->program_pointer < seg_0_len
+                               ? start->program_pointer : seg_0_len;
+    /* Instructions are counted per basic block: every UM block ends in a
+       LOADP, so the count only needs updating there */
+    uint64_t instructions_retired = start->instructions_retired;
+    uint32_t block_start = program_pointer;
+    uint32_t loadp_segment, loadp_target;
+    uint32_t *seg_0_ptr = Mem_segment_at(mem, PROG_ADDRESS)->data;
+    int owns_keys = shared_keys == NULL;
+    uint16_t *keys = owns_keys ? decode_program(seg_0_ptr, seg_0_len, NULL)
+                               : shared_keys;
+    if (watch_seg_0) {
+        Codewatch_protect(seg_0_ptr, seg_0_len, keys, DISPATCH_STALE_KEY);
+    }
 
     /* Interating through segment 0 */
-    while (program_pointer < seg_0_len) {
-        // curr_instruction = Mem_get_word(main_mem, PROG_ADDRESS,
-        //                                 program_pointer);
-        // curr_instruction = Mem_get_word_from_seg(seg_0_ptr, program_pointer);
-        curr_instruction = SArray_get(seg_0_ptr, program_pointer);
-        // curr_opcode = Unpacker_get_opcode(curr_instruction);
-        // curr_opcode = Bitpack_getu(curr_instruction, OPCODE_WIDTH, OPCODE_LSB);
-        curr_opcode = curr_instruction >> 28;
+    uint16_t key;
+    for (;;) {
         /* Update the program pointer before executing the instruction */
-        program_pointer++;
-        /* Special case for the load-value instruction */
-        if (curr_opcode == LV) {
-            // Operation_13 op_13 = Unpacker_unpack_13(curr_instruction);
-            // int rA = Bitpack_getu(curr_instruction, RA_13_WIDTH, RA_13_LSB);
-            int rA = (curr_instruction & 0xe000000) >> 25;
-            // printf("rA: %d\n", rA);
-            // int value = Bitpack_getu(curr_instruction, VALUE_WIDTH, VALUE_LSB);
-            int value = (curr_instruction & 0x1ffffff);
-            // printf("value: %d\n", value);
-            registers[rA] = value;
-        } else {
-            //Operation op = Unpacker_unpack(curr_instruction);
-            // int rA = Bitpack_getu(curr_instruction, RA_WIDTH, RA_LSB);
-            int rA = (curr_instruction & 448) >> 6;
-            // int rB = Bitpack_getu(curr_instruction, RB_WIDTH, RB_LSB);
-            int rB = (curr_instruction & 56) >> 3;
-            // int rC = Bitpack_getu(curr_instruction, RC_WIDTH, RC_LSB);
-            int rC = curr_instruction & 7;
-            // execute_cases(main_mem, curr_opcode, registers + rA,
-            //               registers + rB, registers + rC,
-            //               &program_pointer, &seg_0_len, &seg_0_ptr);
-            uint32_t *rA_p = registers + rA;
-            uint32_t *rB_p = registers + rB;
-            uint32_t *rC_p = registers + rC;
-            uint32_t rA_val = registers[rA];
-            uint32_t rB_val = registers[rB];
-            uint32_t rC_val = registers[rC];
-
-            switch (curr_opcode) {
-                case CMOV:
-                    conditional_move(rA_p, rB_val, rC_val);
-                    break;
-                case SLOAD:
-                    //*rA_p = Mem_get_word(main_mem, *rB_p, *rC_p);
-                    // num_mem_ops++;
-                    // if (curr_segment_address != rB_val) { 
-                    curr_segment = Seq_get(main_memory, rB_val);
-                        // curr_segment_address = rB_val;
-                    // } else {
-                    //     num_mem_cache_hits++;
-                    // }
-                    *rA_p = SArray_get(curr_segment, rC_val);
-                    break;
-                case SSTORE:
-                    // num_mem_ops++;
-                    //Mem_update_word(main_mem, *rA_p, *rB_p, *rC_p);
-                    //if (curr_segment_address != rA_val) { 
-                    curr_segment = Seq_get(main_memory, rA_val);
-                        // curr_segment_address = rA_val;
-                    // } else {
-                    //     num_mem_cache_hits++; 
-                    // }
-                    // curr_segment = Seq_get(main_mem->main_memory, rA_val);
-                    *SArray_at(curr_segment, rB_val) = rC_val;
-                    // MEM_UPDATE_WORD(main_mem, *rA_p, *rB_p, *rC_p);
-                    break;
-                case ADD:
-                    *rA_p = rB_val + rC_val;
-                    break;
-                case MUL:
-                    *rA_p = rB_val * rC_val;
-                    break;
-                case DIV:
-                    *rA_p = rB_val / rC_val;
-                    break;
-                case NAND:
-                    *rA_p = ~(rB_val & rC_val);
-                    break;
-                case HALT:
-                    // printf("\nMemory operations: %d\n", num_mem_ops);
-                    // printf("Memory operation cache hits: %d\n", num_mem_cache_hits);
-                    // Mem_free_memory(&main_mem); 
-                    Mem_free_memory(main_memory, deleted_addresses);
-                    exit(EXIT_SUCCESS); 
-                    break;
-                case ACTIVATE:
-                    map_segment(main_memory, deleted_addresses, rB_p, rC_val); 
-                    // *rB_p = Mem_create_segment(main_mem, *rC_p);
-                    break;
-                case INACTIVATE:
-                    Mem_remove_segment(deleted_addresses, rC_val);
-                    break;
-                case OUT:
-                    putchar(rC_val);
-                    break;
-                case IN:
-                    get_input(rC_p);
-                    break;
-                case LOADP:
-                    load_program(main_memory, deleted_addresses, rB_p, rC_val, &program_pointer,
-                                 &seg_0_len, &seg_0_ptr);
-                    
-                    // if (rB_val != PROG_ADDRESS) {
-                    //     seg_0_len = Mem_duplicate_segment(main_memory, deleted_addresses, 
-                    //                                                 rB_val, PROG_ADDRESS);
-                    //     seg_0_ptr = Mem_get_segment(main_memory, PROG_ADDRESS);
-                    //     // *curr_segment = *seg_0_ptr;
-                    //     // *curr_segment_address = PROG_ADDRESS;
-                    // }
-                    // program_pointer = rC_val;
-
-                    break;
+        key = keys[program_pointer++];
+    dispatch:
+        switch (key) {
+#include "dispatch_cases.h"
+        }
+        continue;
+
+    loadp:
+        instructions_retired += program_pointer - block_start;
+        if (Profiler_pending || Checkpoint_pending || Coldseg_pending ||
+            Dedup_pending || Watchdog_expired ||
+            instructions_retired >= Watchdog_instruction_limit ||
+            loadp_segment != PROG_ADDRESS) {
+            SPILL_REGISTERS();
+            if (Profiler_pending) {
+                Profiler_sample(block_start, program_pointer - 1);
+            }
+            if (Watchdog_expired ||
+                instructions_retired >= Watchdog_instruction_limit) {
+                return stop_thread(keys, owns_keys,
+                                   Watchdog_report(block_start,
+                                                   program_pointer - 1,
+                                                   instructions_retired));
             }
+            /* Let the passes below read watched segments without
+               faulting on them */
+            if (compressing && ((Dedup_pending && deduplicating) ||
+                                (Checkpoint_pending && checkpointing) ||
+                                caching_image)) {
+                Coldseg_expose(mem);
+            }
+            if (loadp_segment != PROG_ADDRESS) {
+                if (threading && (!owns_keys || Umthread_running() > 0)) {
+                    fprintf(stderr, "LOADP of segment %u at pc %u while "
+                            "other threads run.\n", loadp_segment,
+                            program_pointer - 1);
+                    return stop_thread(keys, owns_keys, EXIT_FAILURE);
+                }
+                keys = load_program(mem, loadp_segment, keys);
+                seg_0_ptr = Mem_segment_at(mem, PROG_ADDRESS)->data;
+                seg_0_len = Mem_segment_at(mem, PROG_ADDRESS)->length;
+                if (watch_seg_0) {
+                    Codewatch_protect(seg_0_ptr, seg_0_len, keys,
+                                      DISPATCH_STALE_KEY);
+                }
+                if (caching_image) {
+                    cache_image(mem, spilled_registers, loadp_target,
+                                instructions_retired);
+                }
+            }
+            if (Dedup_pending && deduplicating) {
+                Dedup_pass(mem);
+            }
+            if (Coldseg_pending && compressing) {
+                Coldseg_sweep(mem);
+            }
+            if (Checkpoint_pending && checkpointing) {
+                take_checkpoint(mem, spilled_registers, loadp_target,
+                                instructions_retired);
+            }
+            RELOAD_REGISTERS();
         }
+        /* Jumping past the end lands on the end-of-program key */
+        program_pointer = loadp_target < seg_0_len ? loadp_target
+                                                   : seg_0_len;
+        block_start = program_pointer;
+        Telemetry->instructions_retired = instructions_retired;
+        Telemetry->block_pc = program_pointer;
     }
 
+end_of_program:
     /* If the execution loop terminates, there was no halt instruction */
     fprintf(stderr, "Program terminated without a halt instruction.\n");
-    // Mem_free_memory(&main_mem);
-    Mem_free_memory(main_memory, deleted_addresses);
-    exit(EXIT_FAILURE);
+    Telemetry->instructions_retired = instructions_retired +
+        (program_pointer - block_start);
+    return stop_thread(keys, owns_keys, EXIT_FAILURE);
+
+halt:
+    if (Profiler_pending) {
+        Profiler_sample(block_start, program_pointer - 1);
+    }
+    Telemetry->instructions_retired = instructions_retired +
+        (program_pointer - block_start);
+    if (checkpointing) {
+        Checkpoint_finish();
+    }
+    return stop_thread(keys, owns_keys, EXIT_SUCCESS);
+}
+
+/* execute_traced
+ * Purpose:    Executes a program like execute_instructions, but reports
+ *             every instruction fetch, and the word every SLOAD and SSTORE
+ *             touches, to the cache simulator if --locality was given, and
+ *             counts every instruction by opcode if --cost was.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be NULL)
+ *             const Checkpoint_machine *start - the registers, program
+ *                                               pointer and instruction
+ *                                               count to start from
+ * Returns:    int - the exit status of the program
+ * Notes:      Only used with --locality and --cost, which are slow
+ *             anyway. Keeping it apart leaves the interpreter proper
+ *             exactly as fast as without it: registers live in an array
+ *             and each instruction is decoded as it runs.
+ */
+static int execute_traced(Mem_T mem, const Checkpoint_machine *start)
+{
+    uint32_t registers[NUM_REGISTERS];
+    memcpy(registers, start->registers, sizeof(registers));
+    uint32_t *seg_0_ptr = Mem_segment_at(mem, PROG_ADDRESS)->data;
+    uint32_t seg_0_len = Mem_segment_at(mem, PROG_ADDRESS)->length;
+    uint32_t program_pointer = start->program_pointer;
+    uint64_t instructions_retired = start->instructions_retired;
+    uint32_t block_start = program_pointer;
+    /* Only for load_program, which keeps them up to date */
+    uint16_t *keys = NULL;
+    /* The end of the lifted idiom being executed, for --cost */
+    uint32_t lifted_end = 0;
+    int status = EXIT_FAILURE;
+
+    for (;;) {
+        if (program_pointer >= seg_0_len) {
+            fprintf(stderr, "Program terminated without a halt "
+                    "instruction.\n");
+            break;
+        }
+        uint32_t pc = program_pointer++;
+        uint32_t word = seg_0_ptr[pc];
+        uint32_t *rA_p = &registers[(word >> RA_LSB) & 7];
+        uint32_t rB = registers[(word >> RB_LSB) & 7];
+        uint32_t rC = registers[(word >> RC_LSB) & 7];
+        uint32_t *word_p;
+        if (tracing_locality) {
+            Cachesim_fetch(pc, &seg_0_ptr[pc]);
+        }
+        if (costing) {
+            Costmodel_opcodes[word >> OPCODE_LSB]++;
+            uint16_t lifted = pc >= lifted_end ?
+                Dispatch_lift(&seg_0_ptr[pc], seg_0_len - pc) : 0;
+            if (lifted != 0) {
+                Costmodel_lifted++;
+                lifted_end = pc + Dispatch_lifted_length(lifted);
+            }
+        }
+
+        switch (word >> OPCODE_LSB) {
+            case CMOV:
+                conditional_move(rA_p, rB, rC);
+                break;
+            case SLOAD:
+                word_p = &Mem_segment_at(mem, rB)->data[rC];
+                if (tracing_locality) {
+                    Cachesim_data(pc, rB, word_p);
+                }
+                *rA_p = *word_p;
+                break;
+            case SSTORE:
+                word_p = &Mem_segment_at(mem, *rA_p)->data[rB];
+                if (tracing_locality) {
+                    Cachesim_data(pc, *rA_p, word_p);
+                }
+                *word_p = rC;
+                break;
+            case ADD:
+                *rA_p = rB + rC;
+                break;
+            case MUL:
+                *rA_p = rB * rC;
+                break;
+            case DIV:
+                *rA_p = rB / rC;
+                break;
+            case NAND:
+                *rA_p = ~(rB & rC);
+                break;
+            case HALT:
+                status = EXIT_SUCCESS;
+                break;
+            case ACTIVATE:
+                registers[(word >> RB_LSB) & 7] = map_segment(mem, rC);
+                break;
+            case INACTIVATE:
+                unmap_segment(mem, rC);
+                break;
+            case OUT:
+                Io_put_output(rC);
+                Telemetry->bytes_out++;
+                break;
+            case IN:
+                registers[(word >> RC_LSB) & 7] =
+                    get_input(instructions_retired +
+                              (program_pointer - block_start));
+                break;
+            case LOADP:
+                instructions_retired += program_pointer - block_start;
+                if (Profiler_pending) {
+                    Profiler_sample(block_start, pc);
+                }
+                if (Watchdog_expired ||
+                    instructions_retired >= Watchdog_instruction_limit) {
+                    free(keys);
+                    return Watchdog_report(block_start, pc,
+                                           instructions_retired);
+                }
+                if (rB != PROG_ADDRESS) {
+                    keys = load_program(mem, rB, keys);
+                    seg_0_ptr = Mem_segment_at(mem, PROG_ADDRESS)->data;
+                    seg_0_len = Mem_segment_at(mem, PROG_ADDRESS)->length;
+                }
+                program_pointer = rC;
+                block_start = program_pointer;
+                lifted_end = 0;
+                Telemetry->instructions_retired = instructions_retired;
+                Telemetry->block_pc = program_pointer;
+                break;
+            case LV:
+                registers[(word >> RA_13_LSB) & 7] = word & 0x1ffffff;
+                break;
+            case EXTEND:
+                /* --threads cannot be given with --locality or --cost */
+                if (bulk_memory && ((word >> RA_13_LSB) & 7) != JOIN &&
+                    ((word >> RA_13_LSB) & 7) <= BULK_COMPARE) {
+                    bulk_memory_op(mem, NULL, registers, word, pc);
+                }
+                break;
+            default:
+                break;
+        }
+        if (status == EXIT_SUCCESS) {
+            break;
+        }
+    }
+    Telemetry->instructions_retired = instructions_retired +
+        (program_pointer - block_start);
+    free(keys);
+    return status;
+}
+
+/* execute_counted
+ * Purpose:    Executes a program, traced for the cache simulator or the
+ *             cost model if --locality or --cost was given and with the
+ *             performance counters running if --perf-counters was, and
+ *             reports the counts.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be NULL)
+ *             const Checkpoint_machine *start - as for execute_instructions
+ * Returns:    int - the exit status of the program
+ */
+static int execute_counted(Mem_T mem, const Checkpoint_machine *start)
+{
+    int traced = tracing_locality || costing;
+    if (!counting) {
+        return traced ? execute_traced(mem, start)
+                      : execute_instructions(mem, start, NULL);
+    }
+    uint64_t start_instructions = start->instructions_retired;
+    Perfcount_start();
+    int status = traced ? execute_traced(mem, start)
+                        : execute_instructions(mem, start, NULL);
+    Perfcount_stop();
+    Perfcount_report(Telemetry->instructions_retired - start_instructions);
+    return status;
 }
 
 /* read_instructions
  * Purpose:    Opens the given file, retrieves information from the file to
  *             bitpack 32-bit word instructions, and stores all 32-bit word
  *             instructions in segment 0 of main memory. 
- * Parameters: Mem_T main_mem - an instance of Mem_T (must not be NULL)
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be NULL)
  *             char *filename - a string representing the name of the file to
  *                              process instructions from
- *             int num_words - the number of instructions in the specified file
- * Returns:    none
+ *             uint32_t num_words - the number of instructions in the
+ *                                  specified file
+ * Returns:    int - 1, or 0 (after saying why) if the file could not be read
  */
-static void read_instructions(Seq_T main_memory, char *filename, int num_words)
+static int read_instructions(Mem_T mem, char *filename, uint32_t num_words)
 {
-    //assert(main_mem != NULL && filename != NULL);
-    FILE *fp = fopen(filename, "r"); 
+    FILE *fp = fopen(filename, "r");
     if (fp == NULL) {
         fprintf(stderr, "Could not open file.\n");
-        exit(EXIT_FAILURE); 
+        return 0;
     }
     uint32_t curr_word = 0;
     int curr_byte;
-    SArray_T segment_0 = Seq_get(main_memory, PROG_ADDRESS);
+    uint32_t *segment_0 = Mem_segment_at(mem, PROG_ADDRESS)->data;
 
     /* Read through the file 4 bytes at a time */
-    for (int i = 0; i < num_words; i++) {
+    for (uint32_t i = 0; i < num_words; i++) {
         for (int j = 3; j >= 0; j--) {
             curr_byte = getc(fp);
             /* File is improper if EOF is encountered prematurely */
             if (curr_byte == EOF) {
                 fprintf(stderr, "Could not read contents of file.\n");
                 fclose(fp);
-                exit(EXIT_FAILURE);
+                return 0;
             }
             /* Progressively build the instruction with Bitpack_newu */
             curr_word = Bitpack_newu(curr_word, 8, 8 * j, curr_byte);
         }
         /* Store each 32 bit word instruction in segment 0 */
-        // Mem_update_word(main_mem, PROG_ADDRESS, i, curr_word);
-        // MEM_UPDATE_WORD(main_mem, PROG_ADDRESS, i, curr_word);
-        //segment = Seq_get(main_mem->main_memory, *rA_p);
-        *(SArray_at(segment_0, i)) = curr_word;
+        segment_0[i] = curr_word;
     }
     fclose(fp);
+    return 1;
+}
+
+/* read_um_file
+ * Purpose:    Loads the program of a .um file into segment 0 of an empty
+ *             main memory.
+ * Parameters: Mem_T mem - an instance of Mem_T with no segments
+ *             char *filename - a string representing the name of the file to
+ *                              process instructions from
+ * Returns:    int - 1, or 0 (after saying why) if the file is unusable
+ */
+static int read_um_file(Mem_T mem, char *filename)
+{
+    struct stat buf;
+    
+    /* Ensure the file size can be determined using the stat function */
+    if (stat(filename, &buf) != 0) {
+        fprintf(stderr, "Could not determine file size.\n");
+        return 0;
+    }
+
+    uint64_t num_bytes = buf.st_size;
+
+    /* Ensure that file size does not contain truncated 32-bit words */
+    if (num_bytes % 4 != 0) {
+        fprintf(stderr, "Improper total file size.\n");
+        return 0;
+    } else if (num_bytes / 4 > UINT32_MAX) {
+        fprintf(stderr, "Program is too large for segment 0.\n");
+        return 0;
+    }
+
+    /* Create segment 0, then load instructions */
+    uint32_t num_words = num_bytes / 4;
+    Mem_create_segment(mem, num_words);
+    if (!read_instructions(mem, filename, num_words)) {
+        return 0;
+    }
+    if (checkpointing) {
+        Checkpoint_mark_mapped(PROG_ADDRESS, num_words);
+    }
+    return 1;
+}
+
+/* load_um_file
+ * Purpose:    Creates main memory holding the program of a .um file in
+ *             segment 0, exiting if the file is unusable.
+ * Parameters: char *filename - a string representing the name of the file to
+ *                              process instructions from
+ * Returns:    Mem_T - the new main memory
+ */
+static Mem_T load_um_file(char *filename)
+{
+    Mem_T mem = Mem_new(seg_0_page_flags);
+    if (!read_um_file(mem, filename)) {
+        Mem_free_memory(&mem);
+        exit(EXIT_FAILURE);
+    }
+    return mem;
+}
+
+/* prepare_program
+ * Purpose:    Checks that segment 0 can be watched and starts profiling it
+ *             as the options ask, just before a program starts running.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be NULL)
+ * Returns:    none
+ */
+static void prepare_program(Mem_T mem)
+{
+    Mem_segment segment_0 = Mem_segment_at(mem, PROG_ADDRESS);
+    /* Protection needs page-aligned storage of the UM's own */
+    if (watch_seg_0 && !segment_0->mapped) {
+        fprintf(stderr, "--protect-seg0 is not supported by the %s "
+                "memory backend.\n", Mem_backend_name());
+        Mem_free_memory(&mem);
+        exit(EXIT_FAILURE);
+    }
+    if (profiling) {
+        Profiler_set_image(Profiler_hash_image(segment_0->data,
+                                               segment_0->length));
+    }
 }
 
 /* run_program
  * Purpose:    Initializes the UM by creating main memory, parsing instructions
  *             from the specified input file, and executing said instructions.
+ *             With --resume, the newest checkpoint is restored instead if
+ *             there is one; with --image-cache, a cached snapshot of the
+ *             unpacked program is.
  * Parameters: char *filename - a string representing the name of the file to
  *                              process instructions from
- * Returns:    none
+ * Returns:    int - the exit status of the program
  */
-static void run_program(char *filename) 
+static int run_program(char *filename) 
 {
     assert(filename != NULL);
-    // Mem_T main_mem = Mem_new();
-
+    Checkpoint_machine machine;
+    memset(&machine, 0, sizeof(machine));
+    Mem_T mem = NULL;
+    if (resuming) {
+        mem = Checkpoint_resume(seg_0_page_flags, &machine);
+    }
+    if (mem == NULL) {
+        mem = load_um_file(filename);
+        if (image_cache_dir != NULL) {
+            Mem_T cached = Imagecache_lookup(image_cache_dir,
+                                             Mem_segment_at(mem,
+                                                            PROG_ADDRESS),
+                                             seg_0_page_flags, &machine);
+            if (cached != NULL) {
+                Mem_free_memory(&mem);
+                mem = cached;
+            } else {
+                caching_image = 1;
+            }
+        }
+    }
 
-    // Mem_T mem = malloc(sizeof(*mem));
-    /* Ensure that malloc was successful */
-    // assert(mem != NULL);
+    for (int i = 0; i < num_mapped_files; i++) {
+        /* Main memory is new, so the files get segments 1, 2, ... */
+        Fileseg_map(mem, mapped_files[i], &machine.registers[i + 1]);
+    }
+    if (threading && !Mem_enable_threads(mem)) {
+        fprintf(stderr, "--threads is not supported by the %s memory "
+                "backend.\n", Mem_backend_name());
+        Mem_free_memory(&mem);
+        exit(EXIT_FAILURE);
+    }
+    prepare_program(mem);
+    int status = execute_counted(mem, &machine);
+    if (compressing) {
+        Coldseg_stop();
+    }
+    Mem_free_memory(&mem);
+    return status;
+}
 
-    /* Instantiate each struct element */
-    Seq_T main_memory = Seq_new(0);
-    Seq_T deleted_addresses = Seq_new(0);
-    // return mem; 
+/* run_job
+ * Purpose:    Runs one job of a batch in main memory left empty by the
+ *             previous job, then empties it again.
+ * Parameters: Mem_T mem - an instance of Mem_T with no segments
+ *             char *program - the .um file
+ *             const char *input - the file IN reads, or - for none
+ *             const char *output - the file OUT writes, or - to discard
+ * Returns:    int - the exit status of the job
+ */
+static int run_job(Mem_T mem, char *program, const char *input,
+                   const char *output)
+{
+    FILE *input_fp = fopen(strcmp(input, "-") == 0 ? "/dev/null" : input,
+                           "rb");
+    FILE *output_fp = fopen(strcmp(output, "-") == 0 ? "/dev/null"
+                                                      : output, "wb");
+    if (input_fp == NULL || output_fp == NULL) {
+        fprintf(stderr, "Could not open %s.\n", input_fp == NULL ? input
+                                                                 : output);
+        if (input_fp != NULL) {
+            fclose(input_fp);
+        }
+        if (output_fp != NULL) {
+            fclose(output_fp);
+        }
+        return EXIT_FAILURE;
+    }
+    Io_redirect(input_fp, output_fp);
+    Telemetry->instructions_retired = 0;
 
+    int status = EXIT_FAILURE;
+    if (read_um_file(mem, program)) {
+        Checkpoint_machine machine;
+        memset(&machine, 0, sizeof(machine));
+        prepare_program(mem);
+        Watchdog_rearm();
+        status = execute_counted(mem, &machine);
+    }
+    Mem_reset(mem);
 
-    // Seq_T main_memory = main_mem->main_memory;
-    // Seq_T deleted_addresses = main_mem->deleted_addresses;
-    struct stat buf;
-    
-    /* Ensure the file size can be determined using the stat function */
-    if (stat(filename, &buf) != 0) {
-        fprintf(stderr, "Could not determine file size.\n");
-        // Mem_free_memory(&main_mem);
-        Mem_free_memory(main_memory, deleted_addresses);
+    Io_redirect(stdin, stdout);
+    fclose(input_fp);
+    if (fclose(output_fp) != 0) {
+        fprintf(stderr, "Could not write %s.\n", output);
+        status = EXIT_FAILURE;
+    }
+    return status;
+}
 
+/* run_batch
+ * Purpose:    Runs every job listed in a manifest, one after another, in a
+ *             single main memory that is reset between jobs instead of
+ *             being freed and created again.
+ * Parameters: const char *manifest - the manifest file. Each line names a
+ *                                    program, the file its input comes
+ *                                    from and the file its output goes
+ *                                    to, separated by white space; - means
+ *                                    no input or discarded output. Blank
+ *                                    lines and lines starting with # are
+ *                                    skipped.
+ * Returns:    int - EXIT_SUCCESS if every job halted, or EXIT_FAILURE
+ * Notes:      Writes a tab-separated line per job to stdout: the job's
+ *             number, program, exit status, instructions retired and
+ *             wall-clock time in milliseconds.
+ */
+static int run_batch(const char *manifest)
+{
+    FILE *fp = fopen(manifest, "r");
+    if (fp == NULL) {
+        fprintf(stderr, "Could not open manifest %s.\n", manifest);
         exit(EXIT_FAILURE);
     }
+    Mem_T mem = Mem_new(seg_0_page_flags);
+    char line[3 * BATCH_FIELD_LENGTH];
+    char program[BATCH_FIELD_LENGTH], input[BATCH_FIELD_LENGTH];
+    char output[BATCH_FIELD_LENGTH];
+    int job = 0, failed = 0;
 
-    int num_bytes = buf.st_size;
+    printf("#job\tprogram\tstatus\tinstructions\tms\n");
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        int num_fields = sscanf(line, BATCH_FIELD_FORMAT " "
+                                BATCH_FIELD_FORMAT " " BATCH_FIELD_FORMAT,
+                                program, input, output);
+        if (num_fields <= 0 || program[0] == '#') {
+            continue;
+        }
+        job++;
+        if (num_fields != 3) {
+            fprintf(stderr, "Job %d of %s needs a program, an input and "
+                    "an output.\n", job, manifest);
+            failed = 1;
+            continue;
+        }
 
-    /* Ensure that file size does not contain truncated 32-bit words */
-    if (num_bytes % 4 != 0) {
-        fprintf(stderr, "Improper total file size.\n");
-        // Mem_free_memory(&main_mem);
-        Mem_free_memory(main_memory, deleted_addresses);
-        exit(EXIT_FAILURE);
+        uint64_t start_ns = Telemetry_now_ns();
+        int status = run_job(mem, program, input, output);
+        uint64_t elapsed_ns = Telemetry_now_ns() - start_ns;
+        printf("%d\t%s\t%d\t%llu\t%.3f\n", job, program, status,
+               (unsigned long long)Telemetry->instructions_retired,
+               elapsed_ns / 1e6);
+        fflush(stdout);
+        if (status != EXIT_SUCCESS) {
+            failed = 1;
+        }
     }
+    fclose(fp);
+    Mem_free_memory(&mem);
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
 
-    /* Create segment 0, then load/execute instructions */
-    Mem_create_segment(main_memory, deleted_addresses, num_bytes / 4); 
-    read_instructions(main_memory, filename, num_bytes / 4);
-    execute_instructions(main_memory, deleted_addresses, num_bytes / 4);
-    //Mem_free_memory(main_memory, ; 
-    Mem_free_memory(main_memory, deleted_addresses);
+/* usage
+ * Purpose:    Prints a summary of the command-line options and exits.
+ * Parameters: char *progname - the name the UM was invoked with
+ * Returns:    none
+ */
+static void usage(char *progname)
+{
+    fprintf(stderr,
+            "Usage: %s [options] program.um\n"
+            "       %s [options] --batch MANIFEST\n"
+            "  --record-input FILE   log every byte read by IN to FILE\n"
+            "  --replay-input FILE   feed IN from a log instead of stdin\n"
+            "  --async-io            move OUT and IN onto helper threads\n"
+            "  --hugepage-threshold BYTES\n"
+            "                        put segments of at least BYTES on huge\n"
+            "                        pages (default 2MB, 0 disables)\n"
+            "  --protect-seg0        map segment 0 read-only and catch the\n"
+            "                        first store to each page, instead of\n"
+            "                        checking every SSTORE\n"
+            "  --telemetry           publish live statistics in\n"
+            "                        /dev/shm/um.<pid> (see umstat) and\n"
+            "                        dump them to stderr on SIGUSR1\n"
+            "  --sample-profile FILE write a folded-stack profile of UM\n"
+            "                        basic blocks to FILE (- for stderr)\n"
+            "  --sample-interval US  profiler sampling interval in\n"
+            "                        microseconds of CPU time (default\n"
+            "                        1000)\n"
+            "  --checkpoint DIR      write incremental checkpoints to the\n"
+            "                        directory DIR\n"
+            "  --checkpoint-interval SECONDS\n"
+            "                        time between checkpoints (default 5)\n"
+            "  --resume              continue from the newest checkpoint in\n"
+            "                        the --checkpoint directory, if any\n"
+            "  --compress-cold SECONDS\n"
+            "                        compress segments of 64KB or more left\n"
+            "                        unchanged for SECONDS of CPU time\n"
+            "  --dedup SECONDS       share the storage of identical\n"
+            "                        segments, looking every SECONDS of\n"
+            "                        CPU time\n"
+            "  --image-cache DIR     start from a snapshot in DIR taken at\n"
+            "                        the first LOADP of an earlier run of\n"
+            "                        the same program, or save one there\n"
+            "  --max-instructions N  stop with status 3 once N instructions\n"
+            "                        have run (checked at each LOADP)\n"
+            "  --timeout SECONDS     stop with status 4 once SECONDS of\n"
+            "                        wall-clock time have passed\n"
+            "  --perf-counters       count cycles, instructions, branch,\n"
+            "                        cache and TLB misses while the\n"
+            "                        program executes, reported on stderr\n"
+            "  --locality FILE       simulate instruction and data caches\n"
+            "                        and write hit rates per segment and\n"
+            "                        pc region to FILE (- for stderr)\n"
+            "  --locality-cache SIZE:LINE:WAYS\n"
+            "                        geometry of each simulated cache\n"
+            "                        (default " CACHESIM_DEFAULT_GEOMETRY
+            ")\n"
+            "  --cost FILE           write a deterministic cost vector:\n"
+            "                        instructions per opcode, idioms\n"
+            "                        lifted, words copied and zeroed, and\n"
+            "                        allocations, to FILE (- for stderr)\n"
+            "  --threads             let opcode 14 spawn a UM thread at\n"
+            "                        $C, and opcode 15 join thread $C\n"
+            "  --bulk-memory         let opcode 15 copy, fill and compare\n"
+            "                        runs of words (see\n"
+            "                        instruction_executor.c)\n"
+            "  --map-file FILE       map FILE, as big-endian words, into\n"
+            "                        the next of segments 1 to 7, and put\n"
+            "                        its length in the register of the\n"
+            "                        same number (may be repeated)\n"
+            "  --batch MANIFEST      run the program, input file and output\n"
+            "                        file on each line of MANIFEST in turn\n"
+            "                        in one process, reporting each job's\n"
+            "                        status and time on stdout\n"
+            "Segments hold up to 2^32-1 words, mapped lazily; a UM built\n"
+            "with MEM_BACKEND=uarray rejects those of more than 2^29-1.\n",
+            progname, progname);
+    exit(EXIT_FAILURE);
 }
 
 /* main
@@ -728,16 +1372,272 @@ static void run_program(char *filename)
  * Parameters: int argc - number of command-line arguments
  *             char *argv[] - array of strings representing the command-line
  *                            arguments, where the first argument should be the
- *                            executable name and the second should be the name
- *                            of the .um file to execute
+ *                            executable name, followed by any options and
+ *                            then the name of the .um file to execute
  * Returns:    int - the status code for the UM program
  */
 int main(int argc, char *argv[])
 {
-    if (argc != 2) {
+    enum {
+        OPT_RECORD_INPUT = 256, OPT_REPLAY_INPUT, OPT_ASYNC_IO,
+        OPT_HUGEPAGE_THRESHOLD, OPT_PROTECT_SEG0, OPT_TELEMETRY,
+        OPT_SAMPLE_PROFILE, OPT_SAMPLE_INTERVAL, OPT_CHECKPOINT,
+        OPT_CHECKPOINT_INTERVAL, OPT_RESUME, OPT_COMPRESS_COLD,
+        OPT_DEDUP, OPT_IMAGE_CACHE, OPT_MAX_INSTRUCTIONS, OPT_TIMEOUT,
+        OPT_BATCH, OPT_PERF_COUNTERS, OPT_LOCALITY, OPT_LOCALITY_CACHE,
+        OPT_THREADS, OPT_BULK_MEMORY, OPT_MAP_FILE, OPT_COST
+    };
+    static struct option long_options[] = {
+        { "record-input", required_argument, NULL, OPT_RECORD_INPUT },
+        { "replay-input", required_argument, NULL, OPT_REPLAY_INPUT },
+        { "async-io",     no_argument,       NULL, OPT_ASYNC_IO },
+        { "hugepage-threshold", required_argument, NULL,
+          OPT_HUGEPAGE_THRESHOLD },
+        { "protect-seg0", no_argument,       NULL, OPT_PROTECT_SEG0 },
+        { "telemetry",    no_argument,       NULL, OPT_TELEMETRY },
+        { "sample-profile",  required_argument, NULL, OPT_SAMPLE_PROFILE },
+        { "sample-interval", required_argument, NULL, OPT_SAMPLE_INTERVAL },
+        { "checkpoint",   required_argument, NULL, OPT_CHECKPOINT },
+        { "checkpoint-interval", required_argument, NULL,
+          OPT_CHECKPOINT_INTERVAL },
+        { "resume",       no_argument,       NULL, OPT_RESUME },
+        { "compress-cold", required_argument, NULL, OPT_COMPRESS_COLD },
+        { "dedup",        required_argument, NULL, OPT_DEDUP },
+        { "image-cache",  required_argument, NULL, OPT_IMAGE_CACHE },
+        { "max-instructions", required_argument, NULL,
+          OPT_MAX_INSTRUCTIONS },
+        { "timeout",      required_argument, NULL, OPT_TIMEOUT },
+        { "batch",        required_argument, NULL, OPT_BATCH },
+        { "perf-counters", no_argument,      NULL, OPT_PERF_COUNTERS },
+        { "locality",     required_argument, NULL, OPT_LOCALITY },
+        { "locality-cache", required_argument, NULL, OPT_LOCALITY_CACHE },
+        { "threads",      no_argument,       NULL, OPT_THREADS },
+        { "bulk-memory",  no_argument,       NULL, OPT_BULK_MEMORY },
+        { "map-file",     required_argument, NULL, OPT_MAP_FILE },
+        { "cost",         required_argument, NULL, OPT_COST },
+        { NULL, 0, NULL, 0 }
+    };
+    Io_input_mode input_mode = IO_INPUT_LIVE;
+    char *input_log = NULL;
+    int async_io = 0;
+    char *profile_report = NULL;
+    unsigned sample_interval = 1000;
+    char *checkpoint_dir = NULL;
+    unsigned checkpoint_interval = 5;
+    unsigned cold_seconds = 0;
+    unsigned dedup_seconds = 0;
+    double timeout = 0;
+    int telemetry = 0;
+    char *manifest = NULL;
+    char *locality_report = NULL;
+    const char *locality_cache = CACHESIM_DEFAULT_GEOMETRY;
+    char *cost_report = NULL;
+    int opt;
+
+    while ((opt = getopt_long(argc, argv, "", long_options, NULL)) != -1) {
+        switch (opt) {
+            case OPT_RECORD_INPUT:
+            case OPT_REPLAY_INPUT:
+                if (input_mode != IO_INPUT_LIVE) {
+                    fprintf(stderr, "Only one of --record-input and "
+                            "--replay-input may be given.\n");
+                    exit(EXIT_FAILURE);
+                }
+                input_mode = (opt == OPT_RECORD_INPUT) ? IO_INPUT_RECORD
+                                                       : IO_INPUT_REPLAY;
+                input_log = optarg;
+                break;
+            case OPT_ASYNC_IO:
+                async_io = 1;
+                break;
+            case OPT_HUGEPAGE_THRESHOLD:
+                Pages_set_threshold(strtoull(optarg, NULL, 0));
+                break;
+            case OPT_PROTECT_SEG0:
+                watch_seg_0 = 1;
+                seg_0_page_flags |= PAGES_ALIGNED;
+                break;
+            case OPT_TELEMETRY:
+                Telemetry_init(1);
+                telemetry = 1;
+                break;
+            case OPT_SAMPLE_PROFILE:
+                profile_report = optarg;
+                break;
+            case OPT_SAMPLE_INTERVAL:
+                sample_interval = strtoul(optarg, NULL, 0);
+                break;
+            case OPT_CHECKPOINT:
+                checkpoint_dir = optarg;
+                break;
+            case OPT_CHECKPOINT_INTERVAL:
+                checkpoint_interval = strtoul(optarg, NULL, 0);
+                break;
+            case OPT_RESUME:
+                resuming = 1;
+                break;
+            case OPT_COMPRESS_COLD:
+                cold_seconds = strtoul(optarg, NULL, 0);
+                compressing = 1;
+                break;
+            case OPT_DEDUP:
+                dedup_seconds = strtoul(optarg, NULL, 0);
+                deduplicating = 1;
+                break;
+            case OPT_IMAGE_CACHE:
+                image_cache_dir = optarg;
+                break;
+            case OPT_MAX_INSTRUCTIONS:
+                Watchdog_instruction_limit = strtoull(optarg, NULL, 0);
+                break;
+            case OPT_PERF_COUNTERS:
+                counting = 1;
+                break;
+            case OPT_LOCALITY:
+                locality_report = optarg;
+                break;
+            case OPT_LOCALITY_CACHE:
+                locality_cache = optarg;
+                break;
+            case OPT_COST:
+                cost_report = optarg;
+                break;
+            case OPT_BATCH:
+                manifest = optarg;
+                break;
+            case OPT_THREADS:
+                threading = 1;
+                break;
+            case OPT_BULK_MEMORY:
+                bulk_memory = 1;
+                break;
+            case OPT_MAP_FILE:
+                if (num_mapped_files == MAX_MAPPED_FILES) {
+                    fprintf(stderr, "At most %d files may be mapped.\n",
+                            MAX_MAPPED_FILES);
+                    exit(EXIT_FAILURE);
+                }
+                mapped_files[num_mapped_files++] = optarg;
+                break;
+            case OPT_TIMEOUT:
+                timeout = strtod(optarg, NULL);
+                if (timeout <= 0) {
+                    fprintf(stderr, "--timeout must be positive.\n");
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            default:
+                usage(argv[0]);
+        }
+    }
+
+    if (argc - optind != (manifest == NULL ? 1 : 0)) {
         fprintf(stderr, "Improper number of arguments.\n");
         exit(EXIT_FAILURE); 
     }
-    run_program(argv[1]);
-    return EXIT_SUCCESS;
-}
\ No newline at end of file
+    if (locality_report != NULL &&
+        (checkpoint_dir != NULL || image_cache_dir != NULL || compressing ||
+         deduplicating)) {
+        fprintf(stderr, "--locality cannot be combined with --checkpoint, "
+                "--image-cache, --compress-cold or --dedup.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (cost_report != NULL &&
+        (checkpoint_dir != NULL || image_cache_dir != NULL || compressing ||
+         deduplicating || manifest != NULL)) {
+        /* Each would make the counts depend on timing or earlier runs */
+        fprintf(stderr, "--cost cannot be combined with --checkpoint, "
+                "--image-cache, --compress-cold, --dedup or --batch.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (manifest != NULL &&
+        (input_mode != IO_INPUT_LIVE || async_io || checkpoint_dir != NULL ||
+         image_cache_dir != NULL || compressing || deduplicating)) {
+        fprintf(stderr, "--batch cannot be combined with input logs, "
+                "--async-io, --checkpoint, --image-cache, --compress-cold "
+                "or --dedup.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (threading &&
+        (input_mode != IO_INPUT_LIVE || async_io || watch_seg_0 ||
+         profile_report != NULL || checkpoint_dir != NULL ||
+         image_cache_dir != NULL || compressing || deduplicating ||
+         counting || locality_report != NULL || cost_report != NULL ||
+         manifest != NULL)) {
+        fprintf(stderr, "--threads cannot be combined with input logs, "
+                "--async-io, --protect-seg0, --sample-profile, "
+                "--checkpoint, --image-cache, --compress-cold, --dedup, "
+                "--perf-counters, --locality, --cost or --batch.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (watch_seg_0 && checkpoint_dir != NULL) {
+        /* Both would have SSTORE run cases of their own */
+        fprintf(stderr, "--protect-seg0 cannot be combined with "
+                "--checkpoint.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (num_mapped_files > 0 &&
+        (checkpoint_dir != NULL || image_cache_dir != NULL || compressing ||
+         deduplicating || manifest != NULL)) {
+        fprintf(stderr, "--map-file cannot be combined with --checkpoint, "
+                "--image-cache, --compress-cold, --dedup or --batch.\n");
+        exit(EXIT_FAILURE);
+    }
+    Io_init(input_mode, input_log);
+    /* The other SIGSEGV handlers pass on faults they do not own */
+    if (watch_seg_0) {
+        Codewatch_init();
+    }
+    if (num_mapped_files > 0) {
+        Fileseg_init();
+    }
+    if (profile_report != NULL) {
+        profiling = 1;
+        Profiler_start(profile_report, sample_interval > 0 ? sample_interval
+                                                           : 1000);
+    }
+    if (async_io) {
+        Io_start_async();
+    }
+    if (resuming && checkpoint_dir == NULL) {
+        fprintf(stderr, "--resume requires --checkpoint.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (checkpoint_dir != NULL) {
+        checkpointing = 1;
+        Checkpoint_start(checkpoint_dir, checkpoint_interval > 0
+                                         ? checkpoint_interval : 5);
+    }
+    if (compressing) {
+        Coldseg_start(cold_seconds > 0 ? cold_seconds : 1);
+    }
+    if (deduplicating) {
+        Dedup_start(dedup_seconds > 0 ? dedup_seconds : 1);
+    }
+    if (!telemetry && (timeout > 0 ||
+                       Watchdog_instruction_limit != UINT64_MAX)) {
+        /* The limits dump the statistics when they stop a program */
+        Telemetry_init(0);
+    }
+    if (timeout > 0) {
+        Watchdog_start(timeout);
+    }
+    if (counting) {
+        Perfcount_open();
+    }
+    if (locality_report != NULL) {
+        tracing_locality = 1;
+        Cachesim_start(locality_report, locality_cache);
+    }
+    if (cost_report != NULL) {
+        costing = 1;
+        Costmodel_start(cost_report);
+    }
+    int status = manifest != NULL ? run_batch(manifest)
+                                  : run_program(argv[optind]);
+    if (counting) {
+        Perfcount_close();
+    }
+    Io_close();
+    return status;
+}
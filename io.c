@@ -0,0 +1,555 @@
+/******************************************************************************
+ *
+ *                                  io.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the I/O interface outlined in io.h.
+ *                 In record mode every value handed to the IN instruction is
+ *                 appended to a log as an (instruction count, value) pair. In
+ *                 replay mode the whole log is read into memory up front so
+ *                 that IN never waits on a terminal or a pipe, which makes
+ *                 interactive programs usable as deterministic benchmarks.
+ *                 In asynchronous mode, OUT bytes go into a single-producer/
+ *                 single-consumer lock-free ring drained by a writer thread,
+ *                 and stdin is read ahead by a reader thread into a second
+ *                 ring that IN consumes.
+ *
+ *                 When live input comes from a regular file, the file is
+ *                 mapped into memory instead and IN reads the bytes
+ *                 straight from the mapping, without a call per byte.
+ *                 Pipes and terminals are read through stdio as before.
+ *
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "io.h"
+#include "assert.h"
+
+/* Log files start with a magic string followed by fixed-size records */
+#define LOG_MAGIC "UMIN0001"
+#define LOG_MAGIC_LEN 8
+#define COUNT_BYTES 8
+#define VALUE_BYTES 4
+
+/* Ring sizes must be powers of two */
+#define RING_SIZE (1 << 16)
+#define RING_MASK (RING_SIZE - 1)
+#define SPINS_BEFORE_YIELD 64
+#define YIELDS_BEFORE_SLEEP 64
+#define SLEEP_NANOSECONDS 50000
+
+/* A single-producer/single-consumer byte ring. head is only written by the
+   consumer and tail only by the producer, so no locks are needed. */
+typedef struct Io_ring {
+    unsigned char data[RING_SIZE];
+    size_t head;
+    size_t tail;
+    int done;
+    pthread_t thread;
+} Io_ring;
+
+typedef struct Io_record {
+    uint64_t instruction_count;
+    uint32_t value;
+} Io_record;
+
+/* Module state; the UM only ever has one input stream */
+static Io_input_mode input_mode = IO_INPUT_LIVE;
+static FILE *log_fp = NULL;
+static Io_record *replay_records = NULL;
+static size_t replay_length = 0;
+static size_t replay_index = 0;
+static int replay_diverged = 0;
+
+/* Where synchronous IN and OUT read and write; stdin and stdout unless a
+   batch job redirects them */
+static FILE *input_fp = NULL;
+static FILE *output_fp = NULL;
+
+/* Live input mapped from a regular file: the mapping, the next byte IN
+   returns and the end of the file; mapped_next is NULL when input is read
+   through input_fp instead */
+static unsigned char *mapped_input = NULL;
+static size_t mapped_length = 0;
+static const unsigned char *mapped_next = NULL;
+static const unsigned char *mapped_end = NULL;
+
+static int async_io = 0;
+static Io_ring *output_ring = NULL;
+static Io_ring *input_ring = NULL;
+
+/* ring_wait
+ * Purpose:    Backs off while a ring is full (producer) or empty (consumer):
+ *             spins briefly, then yields the CPU, then sleeps.
+ * Parameters: int *attempts - how many times this wait has been retried;
+ *                             reset by the caller once progress is made
+ * Returns:    none
+ */
+static void ring_wait(int *attempts)
+{
+    int n = (*attempts)++;
+    if (n < SPINS_BEFORE_YIELD) {
+        return;
+    } else if (n < SPINS_BEFORE_YIELD + YIELDS_BEFORE_SLEEP) {
+        sched_yield();
+    } else {
+        struct timespec pause = { 0, SLEEP_NANOSECONDS };
+        nanosleep(&pause, NULL);
+    }
+}
+
+/* ring_new
+ * Purpose:    Allocates an empty ring.
+ * Parameters: none
+ * Returns:    Io_ring * - the new ring
+ */
+static Io_ring *ring_new(void)
+{
+    Io_ring *ring = malloc(sizeof(*ring));
+    assert(ring != NULL);
+    ring->head = 0;
+    ring->tail = 0;
+    ring->done = 0;
+    return ring;
+}
+
+/* write_all
+ * Purpose:    Writes length bytes to file descriptor fd, retrying after
+ *             partial writes and interrupted system calls.
+ * Parameters: int fd - the file descriptor to write to
+ *             const unsigned char *bytes - the bytes to write
+ *             size_t length - the number of bytes to write
+ * Returns:    none
+ */
+static void write_all(int fd, const unsigned char *bytes, size_t length)
+{
+    while (length > 0) {
+        ssize_t written = write(fd, bytes, length);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        bytes += written;
+        length -= written;
+    }
+}
+
+/* output_thread
+ * Purpose:    Drains the output ring to stdout until the interpreter has
+ *             finished and every queued byte has been written.
+ * Parameters: void *arg - the output ring
+ * Returns:    void * - always NULL
+ */
+static void *output_thread(void *arg)
+{
+    Io_ring *ring = arg;
+    int attempts = 0;
+    for (;;) {
+        size_t head = ring->head;
+        size_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+        if (head == tail) {
+            if (__atomic_load_n(&ring->done, __ATOMIC_ACQUIRE) &&
+                __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) == head) {
+                return NULL;
+            }
+            ring_wait(&attempts);
+            continue;
+        }
+        attempts = 0;
+
+        /* Write the contiguous run up to the end of the buffer */
+        size_t start = head & RING_MASK;
+        size_t run = tail - head;
+        if (run > RING_SIZE - start) {
+            run = RING_SIZE - start;
+        }
+        write_all(STDOUT_FILENO, ring->data + start, run);
+        __atomic_store_n(&ring->head, head + run, __ATOMIC_RELEASE);
+    }
+}
+
+/* input_thread
+ * Purpose:    Reads stdin ahead of the interpreter into the input ring until
+ *             end of file or an error.
+ * Parameters: void *arg - the input ring
+ * Returns:    void * - always NULL
+ */
+static void *input_thread(void *arg)
+{
+    Io_ring *ring = arg;
+    int attempts = 0;
+    for (;;) {
+        size_t tail = ring->tail;
+        size_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        if (tail - head == RING_SIZE) {
+            ring_wait(&attempts);
+            continue;
+        }
+        attempts = 0;
+
+        size_t start = tail & RING_MASK;
+        size_t space = RING_SIZE - (tail - head);
+        if (space > RING_SIZE - start) {
+            space = RING_SIZE - start;
+        }
+        ssize_t nread = read(STDIN_FILENO, ring->data + start, space);
+        if (nread < 0 && errno == EINTR) {
+            continue;
+        }
+        if (nread <= 0) {
+            __atomic_store_n(&ring->done, 1, __ATOMIC_RELEASE);
+            return NULL;
+        }
+        __atomic_store_n(&ring->tail, tail + nread, __ATOMIC_RELEASE);
+    }
+}
+
+/* get_async_input
+ * Purpose:    Takes the next byte from the input ring, waiting for the
+ *             reader thread if it has not caught up yet.
+ * Parameters: none
+ * Returns:    uint32_t - the next input byte, or IO_END_OF_INPUT
+ */
+static uint32_t get_async_input(void)
+{
+    Io_ring *ring = input_ring;
+    size_t head = ring->head;
+    int attempts = 0;
+    while (__atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) == head) {
+        /* The reader publishes its last bytes before setting done */
+        if (__atomic_load_n(&ring->done, __ATOMIC_ACQUIRE) &&
+            __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) == head) {
+            return IO_END_OF_INPUT;
+        }
+        ring_wait(&attempts);
+    }
+    uint32_t value = ring->data[head & RING_MASK];
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+    return value;
+}
+
+/* write_big_endian
+ * Purpose:    Writes the low num_bytes bytes of value to fp, most significant
+ *             byte first, so logs are portable between hosts.
+ * Parameters: FILE *fp - the log file (must not be NULL)
+ *             uint64_t value - the value to write
+ *             int num_bytes - how many bytes of value to write
+ * Returns:    none
+ */
+static void write_big_endian(FILE *fp, uint64_t value, int num_bytes)
+{
+    for (int i = num_bytes - 1; i >= 0; i--) {
+        putc((value >> (8 * i)) & 0xff, fp);
+    }
+}
+
+/* read_big_endian
+ * Purpose:    Reads num_bytes bytes from fp, most significant byte first.
+ * Parameters: FILE *fp - the log file (must not be NULL)
+ *             int num_bytes - how many bytes to read
+ *             uint64_t *value_p - where the value is stored
+ * Returns:    int - 1 if a full value was read, 0 at end of file
+ */
+static int read_big_endian(FILE *fp, int num_bytes, uint64_t *value_p)
+{
+    uint64_t value = 0;
+    for (int i = 0; i < num_bytes; i++) {
+        int byte = getc(fp);
+        if (byte == EOF) {
+            return 0;
+        }
+        value = (value << 8) | (uint64_t)byte;
+    }
+    *value_p = value;
+    return 1;
+}
+
+/* load_replay_log
+ * Purpose:    Reads every record of an input log into memory.
+ * Parameters: const char *log_filename - the name of the log to replay
+ * Returns:    none
+ * Notes:      Exits with EXIT_FAILURE if the log is missing or malformed.
+ */
+static void load_replay_log(const char *log_filename)
+{
+    FILE *fp = fopen(log_filename, "rb");
+    if (fp == NULL) {
+        fprintf(stderr, "Could not open input log %s.\n", log_filename);
+        exit(EXIT_FAILURE);
+    }
+    char magic[LOG_MAGIC_LEN];
+    if (fread(magic, 1, LOG_MAGIC_LEN, fp) != LOG_MAGIC_LEN ||
+        memcmp(magic, LOG_MAGIC, LOG_MAGIC_LEN) != 0) {
+        fprintf(stderr, "%s is not an input log.\n", log_filename);
+        fclose(fp);
+        exit(EXIT_FAILURE);
+    }
+
+    size_t capacity = 64;
+    replay_records = malloc(capacity * sizeof(*replay_records));
+    assert(replay_records != NULL);
+
+    uint64_t count, value;
+    while (read_big_endian(fp, COUNT_BYTES, &count)) {
+        if (!read_big_endian(fp, VALUE_BYTES, &value)) {
+            fprintf(stderr, "Input log %s is truncated.\n", log_filename);
+            fclose(fp);
+            exit(EXIT_FAILURE);
+        }
+        if (replay_length == capacity) {
+            capacity *= 2;
+            replay_records = realloc(replay_records,
+                                     capacity * sizeof(*replay_records));
+            assert(replay_records != NULL);
+        }
+        replay_records[replay_length].instruction_count = count;
+        replay_records[replay_length].value = value;
+        replay_length++;
+    }
+    fclose(fp);
+}
+
+/* map_input
+ * Purpose:    Maps the rest of the input file into memory, if it is a
+ *             non-empty regular file, so IN can read it without stdio.
+ * Parameters: FILE *fp - the input file, read from its current position
+ * Returns:    none
+ * Notes:      Nothing may have been read from fp through stdio yet.
+ */
+static void map_input(FILE *fp)
+{
+    int fd = fileno(fp);
+    struct stat buf;
+    if (fd < 0 || fstat(fd, &buf) != 0 || !S_ISREG(buf.st_mode)) {
+        return;
+    }
+    off_t start = lseek(fd, 0, SEEK_CUR);
+    if (start < 0 || start >= buf.st_size) {
+        return;
+    }
+    void *mapping = mmap(NULL, buf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+        return;
+    }
+    madvise(mapping, buf.st_size, MADV_SEQUENTIAL);
+    mapped_input = mapping;
+    mapped_length = buf.st_size;
+    mapped_next = mapped_input + start;
+    mapped_end = mapped_input + mapped_length;
+}
+
+/* unmap_input
+ * Purpose:    Releases mapped input, leaving the file positioned after the
+ *             last byte IN consumed, as if it had been read.
+ * Parameters: none
+ * Returns:    none
+ */
+static void unmap_input(void)
+{
+    if (mapped_input == NULL) {
+        return;
+    }
+    /* Reads at the end of the file still advance mapped_next */
+    if (mapped_next > mapped_end) {
+        mapped_next = mapped_end;
+    }
+    lseek(fileno(input_fp), mapped_next - mapped_input, SEEK_SET);
+    munmap(mapped_input, mapped_length);
+    mapped_input = NULL;
+    mapped_length = 0;
+    mapped_next = mapped_end = NULL;
+}
+
+/* Io_init
+ * Purpose:    Selects where the IN instruction gets its bytes from.
+ * Parameters: Io_input_mode mode - live stdin, record, or replay
+ *             const char *log_filename - the log to write (record mode) or
+ *                                        read (replay mode); ignored in live
+ *                                        mode
+ * Returns:    none
+ */
+void Io_init(Io_input_mode mode, const char *log_filename)
+{
+    input_mode = mode;
+    input_fp = stdin;
+    output_fp = stdout;
+    if (mode == IO_INPUT_RECORD) {
+        assert(log_filename != NULL);
+        log_fp = fopen(log_filename, "wb");
+        if (log_fp == NULL) {
+            fprintf(stderr, "Could not create input log %s.\n",
+                    log_filename);
+            exit(EXIT_FAILURE);
+        }
+        fwrite(LOG_MAGIC, 1, LOG_MAGIC_LEN, log_fp);
+    } else if (mode == IO_INPUT_REPLAY) {
+        assert(log_filename != NULL);
+        load_replay_log(log_filename);
+    }
+    if (mode != IO_INPUT_REPLAY) {
+        map_input(input_fp);
+    }
+}
+
+/* Io_redirect
+ * Purpose:    Points IN and OUT at other files, e.g. those of a batch job.
+ *             Not supported with recorded, replayed or asynchronous I/O.
+ * Parameters: FILE *input - where IN reads from
+ *             FILE *output - where OUT writes to
+ * Returns:    none
+ */
+void Io_redirect(FILE *input, FILE *output)
+{
+    unmap_input();
+    input_fp = input;
+    output_fp = output;
+    map_input(input_fp);
+}
+
+/* Io_start_async
+ * Purpose:    Moves output, and live input, onto helper threads. Must be
+ *             called after Io_init and before the UM starts executing.
+ * Parameters: none
+ * Returns:    none
+ * Notes:      The UM exits early on errors such as an invalid segment or
+ *             a failed allocation, so Io_close is also registered with
+ *             atexit to write out whatever output is still queued.
+ */
+void Io_start_async(void)
+{
+    async_io = 1;
+    output_ring = ring_new();
+    if (pthread_create(&output_ring->thread, NULL, output_thread,
+                       output_ring) != 0) {
+        fprintf(stderr, "Could not start output thread.\n");
+        exit(EXIT_FAILURE);
+    }
+    atexit(Io_close);
+
+    /* A replayed session never reads stdin, and mapped input never
+       blocks, so neither needs a reader */
+    if (input_mode != IO_INPUT_REPLAY && mapped_next == NULL) {
+        input_ring = ring_new();
+        if (pthread_create(&input_ring->thread, NULL, input_thread,
+                           input_ring) != 0) {
+            fprintf(stderr, "Could not start input thread.\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
+/* Io_get_input
+ * Purpose:    Produces the next value for the IN instruction.
+ * Parameters: uint64_t instruction_count - the number of UM instructions
+ *                                          retired so far, including the IN
+ * Returns:    uint32_t - the next input byte, or IO_END_OF_INPUT
+ */
+uint32_t Io_get_input(uint64_t instruction_count)
+{
+    if (input_mode == IO_INPUT_REPLAY) {
+        if (replay_index == replay_length) {
+            return IO_END_OF_INPUT;
+        }
+        Io_record record = replay_records[replay_index++];
+        if (record.instruction_count != instruction_count &&
+            !replay_diverged) {
+            fprintf(stderr, "Warning: replayed input diverged at "
+                    "instruction %llu (recorded at %llu).\n",
+                    (unsigned long long)instruction_count,
+                    (unsigned long long)record.instruction_count);
+            replay_diverged = 1;
+        }
+        return record.value;
+    }
+
+    uint32_t value;
+    if (mapped_next != NULL) {
+        /* UM threads may read at once; each takes the next offset */
+        const unsigned char *next = __atomic_fetch_add(&mapped_next, 1,
+                                                       __ATOMIC_RELAXED);
+        value = (next < mapped_end) ? *next : IO_END_OF_INPUT;
+    } else if (input_ring != NULL) {
+        value = get_async_input();
+    } else {
+        int byte = getc(input_fp);
+        value = (byte == EOF) ? IO_END_OF_INPUT : (uint32_t)byte;
+    }
+    if (input_mode == IO_INPUT_RECORD) {
+        write_big_endian(log_fp, instruction_count, COUNT_BYTES);
+        write_big_endian(log_fp, value, VALUE_BYTES);
+    }
+    return value;
+}
+
+/* Io_put_output
+ * Purpose:    Performs the output operation for a single byte. In
+ *             asynchronous mode the byte is queued for the writer thread,
+ *             waiting for space if the consumer has fallen behind.
+ * Parameters: uint32_t value - the byte to output (must be at most 255)
+ * Returns:    none
+ */
+void Io_put_output(uint32_t value)
+{
+    if (!async_io) {
+        putc(value, output_fp);
+        return;
+    }
+    Io_ring *ring = output_ring;
+    size_t tail = ring->tail;
+    int attempts = 0;
+    while (tail - __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) ==
+           RING_SIZE) {
+        ring_wait(&attempts);
+    }
+    ring->data[tail & RING_MASK] = value;
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+}
+
+/* Io_close
+ * Purpose:    Flushes and releases everything held by the I/O module. In
+ *             asynchronous mode this waits until every queued output byte
+ *             has been written, so output is complete and in order when the
+ *             UM halts. Calling it again does nothing.
+ * Parameters: none
+ * Returns:    none
+ */
+void Io_close(void)
+{
+    if (output_ring != NULL) {
+        __atomic_store_n(&output_ring->done, 1, __ATOMIC_RELEASE);
+        pthread_join(output_ring->thread, NULL);
+        free(output_ring);
+        output_ring = NULL;
+    }
+    if (input_ring != NULL) {
+        /* The reader may be blocked on a terminal; read() is a
+           cancellation point */
+        pthread_cancel(input_ring->thread);
+        pthread_join(input_ring->thread, NULL);
+        free(input_ring);
+        input_ring = NULL;
+    }
+    async_io = 0;
+    unmap_input();
+    if (log_fp != NULL) {
+        fclose(log_fp);
+        log_fp = NULL;
+    }
+    free(replay_records);
+    replay_records = NULL;
+    replay_length = replay_index = 0;
+}
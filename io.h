@@ -0,0 +1,41 @@
+/******************************************************************************
+ *
+ *                                  io.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for the I/O side of the Universal Machine. The
+ *                 IN instruction obtains its bytes through this module, which
+ *                 can read them live from stdin, record every byte consumed
+ *                 (together with the instruction count at which it was read)
+ *                 to a log file, or replay a previously recorded log without
+ *                 touching stdin at all. OUT sends its bytes here as well.
+ *                 Optionally, both directions can be handed to helper
+ *                 threads so a slow consumer or producer never stalls the
+ *                 interpreter.
+ *
+ *****************************************************************************/
+
+#ifndef IO_H
+#define IO_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+/* Value handed to the UM when the end of input has been reached */
+#define IO_END_OF_INPUT (~(uint32_t)0)
+
+typedef enum Io_input_mode {
+    IO_INPUT_LIVE = 0, IO_INPUT_RECORD, IO_INPUT_REPLAY
+} Io_input_mode;
+
+extern void Io_init(Io_input_mode mode, const char *log_filename);
+extern void Io_redirect(FILE *input, FILE *output);
+extern void Io_start_async(void);
+extern uint32_t Io_get_input(uint64_t instruction_count);
+extern void Io_put_output(uint32_t value);
+extern void Io_close(void);
+
+#endif
@@ -0,0 +1,233 @@
+/******************************************************************************
+ *
+ *                                   lz.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the LZ77 codec outlined in lz.h. Each
+ *                 sequence starts with a token byte whose high nibble is
+ *                 the literal count and low nibble the match length minus
+ *                 MIN_MATCH; a nibble of 15 is continued by bytes of 255
+ *                 and a final byte below 255. The literals follow, then a
+ *                 two-byte little-endian offset back into the output. The
+ *                 last sequence holds only literals and ends the stream.
+ *                 Matches are found through a table of the most recent
+ *                 position of each hashed 4-byte string.
+ *
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+#include "lz.h"
+
+#define MIN_MATCH 4
+#define MAX_OFFSET 65535
+#define HASH_BITS 12
+#define NIBBLE_MAX 15
+
+/* read32
+ * Purpose:    Reads four bytes at any alignment.
+ * Parameters: const uint8_t *p - the first byte
+ * Returns:    uint32_t - the bytes as a host-order word
+ */
+static inline uint32_t read32(const uint8_t *p)
+{
+    uint32_t word;
+    memcpy(&word, p, sizeof(word));
+    return word;
+}
+
+/* hash
+ * Purpose:    Hashes four bytes into an index of the match table.
+ * Parameters: uint32_t word - the bytes
+ * Returns:    uint32_t - an index below 2^HASH_BITS
+ */
+static inline uint32_t hash(uint32_t word)
+{
+    return (word * 2654435761u) >> (32 - HASH_BITS);
+}
+
+/* put_length
+ * Purpose:    Writes the continuation bytes of a length whose nibble was
+ *             saturated.
+ * Parameters: uint8_t *op - where to write
+ *             size_t length - the length minus NIBBLE_MAX
+ * Returns:    uint8_t * - the byte after the last one written
+ */
+static uint8_t *put_length(uint8_t *op, size_t length)
+{
+    while (length >= 255) {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = length;
+    return op;
+}
+
+/* put_sequence
+ * Purpose:    Writes one sequence: a token, literals and, unless this is
+ *             the last sequence, a match.
+ * Parameters: uint8_t *op - where to write
+ *             const uint8_t *literals - the literal bytes
+ *             size_t num_literals - how many there are
+ *             size_t offset - how far back the match starts (0 if last)
+ *             size_t match_length - its length (at least MIN_MATCH)
+ * Returns:    uint8_t * - the byte after the sequence
+ */
+static uint8_t *put_sequence(uint8_t *op, const uint8_t *literals,
+                             size_t num_literals, size_t offset,
+                             size_t match_length)
+{
+    size_t match_code = offset == 0 ? 0 : match_length - MIN_MATCH;
+    uint8_t *token = op++;
+    *token = (num_literals < NIBBLE_MAX ? num_literals : NIBBLE_MAX) << 4 |
+             (match_code < NIBBLE_MAX ? match_code : NIBBLE_MAX);
+    if (num_literals >= NIBBLE_MAX) {
+        op = put_length(op, num_literals - NIBBLE_MAX);
+    }
+    memcpy(op, literals, num_literals);
+    op += num_literals;
+    if (offset == 0) {
+        return op;
+    }
+    *op++ = offset & 0xff;
+    *op++ = offset >> 8;
+    if (match_code >= NIBBLE_MAX) {
+        op = put_length(op, match_code - NIBBLE_MAX);
+    }
+    return op;
+}
+
+/* Lz_bound
+ * Purpose:    Returns the most bytes Lz_compress can produce.
+ * Parameters: size_t bytes - the size of the input
+ * Returns:    size_t - the size the output buffer must have
+ */
+size_t Lz_bound(size_t bytes)
+{
+    return bytes + bytes / 255 + 16;
+}
+
+/* Lz_compress
+ * Purpose:    Compresses a buffer.
+ * Parameters: const void *source - the input
+ *             size_t bytes - its size
+ *             void *destination - room for Lz_bound(bytes) bytes
+ * Returns:    size_t - the size of the compressed stream
+ * Notes:      Incompressible stretches are skipped over with a growing
+ *             step, so random data costs little time.
+ */
+size_t Lz_compress(const void *source, size_t bytes, void *destination)
+{
+    const uint8_t *input = source;
+    uint8_t *op = destination;
+    uint32_t table[1 << HASH_BITS];   /* position + 1, or 0 if none */
+    memset(table, 0, sizeof(table));
+
+    size_t ip = 0, anchor = 0;
+    while (ip + MIN_MATCH <= bytes) {
+        uint32_t word = read32(input + ip);
+        uint32_t *slot = &table[hash(word)];
+        size_t candidate = *slot;
+        *slot = ip + 1;
+        if (candidate == 0 || ip - (candidate - 1) > MAX_OFFSET ||
+            read32(input + candidate - 1) != word) {
+            ip += 1 + ((ip - anchor) >> 6);
+            continue;
+        }
+
+        candidate--;
+        size_t length = MIN_MATCH;
+        while (ip + length < bytes &&
+               input[candidate + length] == input[ip + length]) {
+            length++;
+        }
+        op = put_sequence(op, input + anchor, ip - anchor, ip - candidate,
+                          length);
+        ip += length;
+        anchor = ip;
+    }
+    op = put_sequence(op, input + anchor, bytes - anchor, 0, 0);
+    return op - (uint8_t *)destination;
+}
+
+/* get_length
+ * Purpose:    Reads the continuation bytes of a saturated nibble.
+ * Parameters: const uint8_t **ip_p - the read position, advanced
+ *             const uint8_t *end - the end of the input
+ *             size_t *length_p - the length, added to
+ * Returns:    int - 0, or -1 if the input ended first
+ */
+static int get_length(const uint8_t **ip_p, const uint8_t *end,
+                      size_t *length_p)
+{
+    const uint8_t *ip = *ip_p;
+    uint8_t byte;
+    do {
+        if (ip == end) {
+            return -1;
+        }
+        byte = *ip++;
+        *length_p += byte;
+    } while (byte == 255);
+    *ip_p = ip;
+    return 0;
+}
+
+/* Lz_decompress
+ * Purpose:    Decompresses a stream written by Lz_compress.
+ * Parameters: const void *source - the compressed stream
+ *             size_t compressed_bytes - its size
+ *             void *destination - room for the output
+ *             size_t bytes - the size of the output
+ * Returns:    int - 0, or -1 if the stream is malformed or does not
+ *             decompress to exactly bytes bytes
+ */
+int Lz_decompress(const void *source, size_t compressed_bytes,
+                  void *destination, size_t bytes)
+{
+    const uint8_t *ip = source;
+    const uint8_t *end = ip + compressed_bytes;
+    uint8_t *out = destination;
+    size_t op = 0;
+
+    while (ip < end) {
+        uint8_t token = *ip++;
+        size_t num_literals = token >> 4;
+        if (num_literals == NIBBLE_MAX &&
+            get_length(&ip, end, &num_literals) < 0) {
+            return -1;
+        }
+        if (num_literals > (size_t)(end - ip) ||
+            num_literals > bytes - op) {
+            return -1;
+        }
+        for (size_t i = 0; i < num_literals; i++) {
+            out[op++] = *ip++;
+        }
+        if (ip == end) {
+            break;
+        }
+
+        if (end - ip < 2) {
+            return -1;
+        }
+        size_t offset = ip[0] | (size_t)ip[1] << 8;
+        ip += 2;
+        size_t length = token & NIBBLE_MAX;
+        if (length == NIBBLE_MAX && get_length(&ip, end, &length) < 0) {
+            return -1;
+        }
+        length += MIN_MATCH;
+        if (offset == 0 || offset > op || length > bytes - op) {
+            return -1;
+        }
+        /* Byte by byte, since the copy may overlap its own output */
+        for (size_t i = 0; i < length; i++, op++) {
+            out[op] = out[op - offset];
+        }
+    }
+    return op == bytes ? 0 : -1;
+}
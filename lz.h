@@ -0,0 +1,30 @@
+/******************************************************************************
+ *
+ *                                   lz.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for a small LZ77 codec in the style of LZ4:
+ *                 a byte stream of sequences, each a run of literal bytes
+ *                 followed by a copy of earlier output. It favors speed
+ *                 over ratio, which suits UM segments: they are mostly
+ *                 runs of zero words and repeated instruction patterns.
+ *                 Decompression allocates nothing and makes no calls, so
+ *                 it may run in a signal handler.
+ *
+ *****************************************************************************/
+
+#ifndef LZ_H
+#define LZ_H
+
+#include <stddef.h>
+
+extern size_t Lz_bound(size_t bytes);
+extern size_t Lz_compress(const void *source, size_t bytes,
+                          void *destination);
+extern int Lz_decompress(const void *source, size_t compressed_bytes,
+                         void *destination, size_t bytes);
+
+#endif
@@ -0,0 +1,637 @@
+/******************************************************************************
+ *
+ *                               mem_arena.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the arena memory backend described in
+ *                 mem_arena.h. Blocks of 2^k words (k >= MIN_CLASS) are
+ *                 bump-allocated from chunks obtained from the pages module;
+ *                 a free block stores the link to the next free block of its
+ *                 class in its first bytes. Requests too large for a chunk
+ *                 get storage of their own. A descriptor's storage field
+ *                 holds its size class plus one, or NULL for storage of its
+ *                 own.
+ *
+ *                 With threads, the table and the links of the stack of
+ *                 unmapped addresses are reserved at their largest size up
+ *                 front, so they never move under a running thread; only
+ *                 the pages used are ever touched. Addresses come from
+ *                 that stack or the end of the table without a lock, while
+ *                 storage comes from the pool under pool_lock.
+ *
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "memory.h"
+#include "pages.h"
+#include "telemetry.h"
+#include "assert.h"
+
+#define PROG_ADDRESS 0
+#define SIZE_OF_UINT32 4
+#define INITIAL_CAPACITY 64
+#define MIN_CLASS 2
+#define CHUNK_BYTES (32 * 1024 * 1024)
+#define LARGEST_POOLED_BYTES (CHUNK_BYTES / 4)
+/* Size of the table reserved when threads are enabled */
+#define MAX_THREADED_SEGMENTS (1 << 26)
+#define STACK_COUNTER_ONE ((uint64_t)1 << 32)
+
+/* size_class
+ * Purpose:    Finds the smallest size class holding length words.
+ * Parameters: uint32_t length - the number of words
+ * Returns:    int - k such that 2^k >= length
+ */
+static int size_class(uint32_t length)
+{
+    int k = MIN_CLASS;
+    while (((size_t)1 << k) < length) {
+        k++;
+    }
+    return k;
+}
+
+/* new_chunk
+ * Purpose:    Starts bump-allocating from the next chunk, reusing one kept
+ *             from before the last reset if there is one.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ * Returns:    none
+ */
+static void new_chunk(Mem_T mem)
+{
+    if (mem->chunks_in_use == mem->num_chunks) {
+        int mapped;
+        uint32_t *chunk = Pages_alloc(CHUNK_BYTES, 0, &mapped);
+        if (chunk == NULL) {
+            Mem_allocation_failed("a chunk of small segments", CHUNK_BYTES);
+        }
+        if (mem->num_chunks == mem->chunks_capacity) {
+            mem->chunks_capacity = mem->chunks_capacity == 0
+                                   ? 8 : 2 * mem->chunks_capacity;
+            mem->chunks = realloc(mem->chunks, mem->chunks_capacity *
+                                  sizeof(*mem->chunks));
+            if (mem->chunks == NULL) {
+                Mem_allocation_failed("the chunk list", mem->chunks_capacity *
+                                      sizeof(*mem->chunks));
+            }
+        }
+        mem->chunks[mem->num_chunks].data = chunk;
+        mem->chunks[mem->num_chunks].mapped = mapped;
+        mem->num_chunks++;
+        Telemetry->bytes_allocated += CHUNK_BYTES;
+        Telemetry->allocations++;
+    }
+    char *chunk = (char *)mem->chunks[mem->chunks_in_use++].data;
+    mem->chunk_next = chunk;
+    mem->chunk_end = chunk + CHUNK_BYTES;
+}
+
+/* allocate_unpooled
+ * Purpose:    Gives a segment storage of its own.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_segment segment - the descriptor, with no storage
+ *             uint32_t length - the number of words needed
+ *             int page_flags - passed on to Pages_alloc
+ * Returns:    int - 1 if the storage is zero-filled, as for
+ *             Mem_segment_allocate
+ */
+static int allocate_unpooled(Mem_T mem, Mem_segment segment,
+                             uint32_t length, int page_flags)
+{
+    int zeroed = Mem_segment_allocate(segment, length, page_flags);
+    if (segment->data != NULL) {
+        mem->num_unpooled++;
+    }
+    return zeroed;
+}
+
+/* release_storage
+ * Purpose:    Returns a segment's storage to its free list, or to the pages
+ *             module if it was not pooled.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_segment segment - the descriptor
+ * Returns:    none
+ */
+static void release_storage(Mem_T mem, Mem_segment segment)
+{
+    if (segment->storage == NULL) {
+        if (segment->data != NULL) {
+            mem->num_unpooled--;
+        }
+        Mem_segment_release(segment);
+        return;
+    }
+    int k = (uintptr_t)segment->storage - 1;
+    *(void **)segment->data = mem->free_blocks[k];
+    mem->free_blocks[k] = segment->data;
+    segment->data = NULL;
+    segment->storage = NULL;
+    segment->capacity = 0;
+}
+
+/* discard_block
+ * Purpose:    Hands the whole pages of a pooled block back to the host,
+ *             keeping the first bytes, which hold its free-list link once
+ *             the block is released. The pages read as zero afterwards.
+ * Parameters: Mem_segment segment - a descriptor with pooled storage
+ * Returns:    none
+ */
+static void discard_block(Mem_segment segment)
+{
+    uintptr_t page_size = sysconf(_SC_PAGESIZE);
+    uintptr_t start = ((uintptr_t)segment->data + sizeof(void *) +
+                       page_size - 1) & ~(page_size - 1);
+    uintptr_t end = ((uintptr_t)segment->data +
+                     (uintptr_t)segment->capacity * SIZE_OF_UINT32) &
+                    ~(page_size - 1);
+    if (end > start) {
+        madvise((void *)start, end - start, MADV_DONTNEED);
+    }
+}
+
+/* allocate_storage
+ * Purpose:    Gives a segment storage for at least length words, releasing
+ *             whatever storage it had.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_Address address - the segment's address
+ *             uint32_t length - the number of words needed
+ * Returns:    int - 1 if the storage is known to be zero-filled, else 0
+ */
+static int allocate_storage(Mem_T mem, Mem_Address address, uint32_t length)
+{
+    Mem_segment segment = &mem->segments[address];
+    release_storage(mem, segment);
+
+    int k = size_class(length);
+    size_t block_bytes = ((size_t)1 << k) * SIZE_OF_UINT32;
+    /* Segment 0 keeps storage of its own, on huge pages if it can */
+    if (address == PROG_ADDRESS) {
+        return allocate_unpooled(mem, segment, length,
+                                 mem->program_page_flags);
+    } else if (block_bytes > LARGEST_POOLED_BYTES) {
+        return allocate_unpooled(mem, segment, length, 0);
+    }
+
+    void *block = mem->free_blocks[k];
+    if (block != NULL) {
+        mem->free_blocks[k] = *(void **)block;
+    } else {
+        if (mem->chunk_next == NULL ||
+            (size_t)(mem->chunk_end - mem->chunk_next) < block_bytes) {
+            new_chunk(mem);
+        }
+        block = mem->chunk_next;
+        mem->chunk_next += block_bytes;
+    }
+    segment->data = block;
+    segment->capacity = (uint32_t)1 << k;
+    segment->mapped = 0;
+    segment->anonymous = 0;
+    segment->storage = (void *)(uintptr_t)(k + 1);
+    return 0;
+}
+
+/* push_free
+ * Purpose:    Pushes an unmapped address onto the stack awaiting reuse.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_Address address - the address
+ * Returns:    none
+ */
+static void push_free(Mem_T mem, Mem_Address address)
+{
+    if (!mem->threaded) {
+        mem->free_links[address] = (uint32_t)mem->free_top;
+        mem->free_top = ((mem->free_top & ~(uint64_t)UINT32_MAX) +
+                         STACK_COUNTER_ONE) | (uint32_t)(address + 1);
+        mem->num_deleted++;
+        return;
+    }
+    uint64_t top = __atomic_load_n(&mem->free_top, __ATOMIC_ACQUIRE);
+    uint64_t new_top;
+    do {
+        __atomic_store_n(&mem->free_links[address], (uint32_t)top,
+                         __ATOMIC_RELAXED);
+        new_top = ((top & ~(uint64_t)UINT32_MAX) + STACK_COUNTER_ONE) |
+                  (uint32_t)(address + 1);
+    } while (!__atomic_compare_exchange_n(&mem->free_top, &top, new_top, 1,
+                                          __ATOMIC_RELEASE,
+                                          __ATOMIC_ACQUIRE));
+    __atomic_fetch_add(&mem->num_deleted, 1, __ATOMIC_RELAXED);
+}
+
+/* pop_free
+ * Purpose:    Takes the most recently unmapped address off the stack.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_Address *address_p - set to the address
+ * Returns:    int - 1, or 0 if the stack is empty
+ * Notes:      The counter in free_top changes with every push and pop, so
+ *             a thread that read a link just before the address on top
+ *             was popped and pushed again cannot install the stale link.
+ */
+static int pop_free(Mem_T mem, Mem_Address *address_p)
+{
+    if (!mem->threaded) {
+        if ((uint32_t)mem->free_top == 0) {
+            return 0;
+        }
+        *address_p = (uint32_t)mem->free_top - 1;
+        mem->free_top = ((mem->free_top & ~(uint64_t)UINT32_MAX) +
+                         STACK_COUNTER_ONE) | mem->free_links[*address_p];
+        mem->num_deleted--;
+        return 1;
+    }
+    uint64_t top = __atomic_load_n(&mem->free_top, __ATOMIC_ACQUIRE);
+    uint64_t new_top;
+    do {
+        if ((uint32_t)top == 0) {
+            return 0;
+        }
+        uint32_t link = __atomic_load_n(&mem->free_links[(uint32_t)top - 1],
+                                        __ATOMIC_RELAXED);
+        new_top = ((top & ~(uint64_t)UINT32_MAX) + STACK_COUNTER_ONE) |
+                  link;
+    } while (!__atomic_compare_exchange_n(&mem->free_top, &top, new_top, 1,
+                                          __ATOMIC_ACQ_REL,
+                                          __ATOMIC_ACQUIRE));
+    *address_p = (uint32_t)top - 1;
+    __atomic_fetch_sub(&mem->num_deleted, 1, __ATOMIC_RELAXED);
+    return 1;
+}
+
+/* new_address
+ * Purpose:    Takes the next address from the end of the table, growing it
+ *             if need be.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ * Returns:    Mem_Address - the address, whose descriptor is all zeros
+ */
+static Mem_Address new_address(Mem_T mem)
+{
+    if (mem->threaded) {
+        /* The reserved table is zero-filled and never moves */
+        Mem_Address address = __atomic_fetch_add(&mem->num_segments, 1,
+                                                  __ATOMIC_RELAXED);
+        if (address >= mem->table_capacity) {
+            fprintf(stderr, "More than %u segments are mapped.\n",
+                    mem->table_capacity);
+            exit(EXIT_FAILURE);
+        }
+        return address;
+    }
+    if (mem->num_segments == mem->table_capacity) {
+        if (mem->table_capacity == MEM_MAX_SEGMENTS) {
+            fprintf(stderr, "More than %u segments are mapped.\n",
+                    MEM_MAX_SEGMENTS);
+            exit(EXIT_FAILURE);
+        }
+        Telemetry->table_entries_copied += mem->num_segments;
+        Telemetry->allocations++;
+        mem->table_capacity = mem->table_capacity > MEM_MAX_SEGMENTS / 2
+                              ? MEM_MAX_SEGMENTS : 2 * mem->table_capacity;
+        size_t bytes = (size_t)mem->table_capacity * sizeof(*mem->segments);
+        mem->segments = realloc(mem->segments, bytes);
+        if (mem->segments == NULL) {
+            Mem_allocation_failed("the segment table", bytes);
+        }
+        bytes = (size_t)mem->table_capacity * sizeof(*mem->free_links);
+        mem->free_links = realloc(mem->free_links, bytes);
+        if (mem->free_links == NULL) {
+            Mem_allocation_failed("the segment table", bytes);
+        }
+    }
+    Mem_Address address = mem->num_segments++;
+    memset(&mem->segments[address], 0, sizeof(mem->segments[address]));
+    return address;
+}
+
+/* reserve_table
+ * Purpose:    Reserves zero-filled address space for a table that never
+ *             has to move, and copies the current table into it.
+ * Parameters: void *table - the current table
+ *             size_t used_bytes - the bytes of it in use
+ *             size_t bytes - the size to reserve
+ * Returns:    void * - the new table, or NULL if it could not be reserved
+ */
+static void *reserve_table(void *table, size_t used_bytes, size_t bytes)
+{
+    void *reserved = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1,
+                          0);
+    if (reserved == MAP_FAILED) {
+        return NULL;
+    }
+    memcpy(reserved, table, used_bytes);
+    free(table);
+    return reserved;
+}
+
+/* Mem_new
+ * Purpose:    Dynamically allocates space for a new Mem_T struct instance and
+ *             returns a pointer to that struct. Also initializes its members.
+ * Parameters: int program_page_flags - Pages_alloc flags for segment 0 when
+ *                                      it is too large to be pooled
+ * Returns:    Mem_T - a pointer to the newly allocated Mem_T struct
+ * Notes:      Leaves memory on the heap after this function terminates.
+ */
+Mem_T Mem_new(int program_page_flags)
+{
+    Mem_T mem = calloc(1, sizeof(*mem));
+    assert(mem != NULL);
+    mem->segments = malloc(INITIAL_CAPACITY * sizeof(*mem->segments));
+    mem->free_links = malloc(INITIAL_CAPACITY * sizeof(*mem->free_links));
+    assert(mem->segments != NULL && mem->free_links != NULL);
+    mem->table_capacity = INITIAL_CAPACITY;
+    mem->program_page_flags = program_page_flags;
+    mem->snapshot_top = UINT64_MAX;
+    return mem;
+}
+
+/* Mem_enable_threads
+ * Purpose:    Makes main memory safe to map and unmap segments in from
+ *             several threads at once. Must be called before a second
+ *             thread touches it.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ * Returns:    int - 1, or 0 if this backend cannot be shared
+ */
+int Mem_enable_threads(Mem_T mem)
+{
+    if (mem->threaded) {
+        return 1;
+    }
+    size_t bytes = MAX_THREADED_SEGMENTS * sizeof(*mem->segments);
+    struct Mem_segment *segments =
+        reserve_table(mem->segments, (size_t)mem->num_segments *
+                      sizeof(*mem->segments), bytes);
+    if (segments == NULL) {
+        Mem_allocation_failed("the shared segment table", bytes);
+    }
+    mem->segments = segments;
+    bytes = MAX_THREADED_SEGMENTS * sizeof(*mem->free_links);
+    uint32_t *free_links =
+        reserve_table(mem->free_links, (size_t)mem->num_segments *
+                      sizeof(*mem->free_links), bytes);
+    if (free_links == NULL) {
+        Mem_allocation_failed("the shared segment table", bytes);
+    }
+    mem->free_links = free_links;
+    mem->table_capacity = MAX_THREADED_SEGMENTS;
+    pthread_mutex_init(&mem->pool_lock, NULL);
+    mem->threaded = 1;
+    return 1;
+}
+
+/* Mem_free_memory
+ * Purpose:    Deallocates all heap allocated memory associated with a Mem_T
+ *             instance. Pooled segments are not visited one by one: their
+ *             chunks are released wholesale.
+ * Parameters: Mem_T *mem_p - A double pointer to a Mem_T struct instance, 
+ *                            which will be freed. mem_p may be null, but if it
+ *                            is not null, *mem_p cannot be null.
+ * Returns:    none
+ */
+void Mem_free_memory(Mem_T *mem_p)
+{
+    if (mem_p == NULL) {
+        return;
+    }
+    Mem_T mem = *mem_p;
+    assert(mem != NULL);
+    for (uint32_t i = 0; i < mem->num_segments; i++) {
+        if (mem->segments[i].storage == NULL) {
+            Mem_segment_release(&mem->segments[i]);
+        }
+    }
+    for (int i = 0; i < mem->num_chunks; i++) {
+        Pages_free(mem->chunks[i].data, CHUNK_BYTES, mem->chunks[i].mapped);
+        Telemetry->bytes_allocated -= CHUNK_BYTES;
+    }
+    free(mem->chunks);
+    if (mem->threaded) {
+        munmap(mem->segments, (size_t)mem->table_capacity *
+                              sizeof(*mem->segments));
+        munmap(mem->free_links, (size_t)mem->table_capacity *
+                                sizeof(*mem->free_links));
+        pthread_mutex_destroy(&mem->pool_lock);
+    } else {
+        free(mem->segments);
+        free(mem->free_links);
+    }
+    free(mem->free_snapshot);
+    free(mem);
+    *mem_p = NULL;
+}
+
+/* Mem_reset
+ * Purpose:    Empties main memory so another program can run in it, as if
+ *             it had just been created by Mem_new. Every chunk is kept and
+ *             bump allocation restarts at the first, so pooled segments
+ *             cost nothing to discard however many there were.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ * Returns:    none
+ * Notes:      Storage of a segment's own (segment 0's, and that of
+ *             segments too large to pool) is released one segment at a
+ *             time, but the table is only walked as far as the last such
+ *             segment, which is usually segment 0.
+ */
+void Mem_reset(Mem_T mem)
+{
+    for (uint32_t i = 0; i < mem->num_segments && mem->num_unpooled > 0;
+         i++) {
+        if (mem->segments[i].storage == NULL) {
+            release_storage(mem, &mem->segments[i]);
+        }
+    }
+    memset(mem->free_blocks, 0, sizeof(mem->free_blocks));
+    mem->chunks_in_use = 0;
+    mem->chunk_next = NULL;
+    mem->chunk_end = NULL;
+    if (mem->threaded) {
+        /* new_address relies on the table past the end being zeros */
+        memset(mem->segments, 0, (size_t)mem->num_segments *
+                                 sizeof(*mem->segments));
+    }
+    mem->num_segments = 0;
+    mem->free_top = 0;
+    mem->num_deleted = 0;
+    mem->snapshot_top = UINT64_MAX;
+    Telemetry->live_segments = 0;
+    Telemetry->free_segments = 0;
+}
+
+/* Mem_create_segment
+ * Purpose:    Creates a new segment of the specified length, with every word
+ *             set to 0, at a free index in main memory. The index of the
+ *             new segment is returned to the client.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             uint32_t length - length of the segment
+ * Returns:    Mem_Address - the address of the newly instantiated segment
+ * Notes:      Fresh mapped storage is already zero, so a huge segment is
+ *             not touched here and stays uncommitted until used.
+ */
+Mem_Address Mem_create_segment(Mem_T mem, uint32_t length)
+{
+    Mem_Address address;
+    int reused = pop_free(mem, &address);
+    if (!reused) {
+        address = new_address(mem);
+    }
+
+    Mem_segment segment = &mem->segments[address];
+    if (mem->threaded) {
+        pthread_mutex_lock(&mem->pool_lock);
+    }
+    int zeroed = 0;
+    if (segment->capacity < length || segment->data == NULL) {
+        zeroed = allocate_storage(mem, address, length);
+    }
+    if (reused) {
+        Telemetry->free_segments--;
+    }
+    Telemetry->live_segments++;
+    if (mem->threaded) {
+        pthread_mutex_unlock(&mem->pool_lock);
+    }
+    segment->length = length;
+    if (length > 0 && !zeroed) {
+        Mem_segment_clear(segment, length);
+    }
+    return address;
+}
+
+/* Mem_remove_segment
+ * Purpose:    Unmaps the segment at a specified address, returning its
+ *             storage to the pool and its address to the stack awaiting
+ *             reuse.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_Address address - 32-bit address corresponding with an
+ *                                   existing segment
+ * Returns:    none
+ */
+void Mem_remove_segment(Mem_T mem, Mem_Address address)
+{
+    if (mem->threaded) {
+        pthread_mutex_lock(&mem->pool_lock);
+    }
+    /* Segment 0 is only unmapped to be replaced; keep its storage */
+    if (address != PROG_ADDRESS) {
+        release_storage(mem, &mem->segments[address]);
+    }
+    Telemetry->live_segments--;
+    Telemetry->free_segments++;
+    if (mem->threaded) {
+        pthread_mutex_unlock(&mem->pool_lock);
+    }
+    /* Only once its storage is back, or the next owner could lose it */
+    push_free(mem, address);
+}
+
+/* Mem_reserve
+ * Purpose:    Resizes an existing segment to length words, e.g. before
+ *             LOADP copies a new program into segment 0. The contents of the
+ *             segment are unspecified afterwards.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_Address address - address of an existing segment
+ *             uint32_t length - the new length
+ * Returns:    none
+ */
+void Mem_reserve(Mem_T mem, Mem_Address address, uint32_t length)
+{
+    Mem_segment segment = &mem->segments[address];
+    if (segment->capacity < length || segment->data == NULL) {
+        allocate_storage(mem, address, length);
+    }
+    segment->length = length;
+}
+
+/* Mem_adopt_storage
+ * Purpose:    Replaces the storage of a segment with storage obtained from
+ *             the pages module, releasing the storage it had. The length of
+ *             the segment is unchanged; its contents are whatever the new
+ *             storage holds.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_Address address - address of an existing segment
+ *             uint32_t *data - storage for at least the segment's length
+ *             int mapped - as set by Pages_alloc
+ * Returns:    int - 1, or 0 if this backend cannot adopt storage
+ * Notes:      A pooled block goes back to its free list with the pages
+ *             past its link handed back to the host, since the point of
+ *             adopting storage is usually to shrink the UM.
+ */
+int Mem_adopt_storage(Mem_T mem, Mem_Address address, uint32_t *data,
+                      int mapped)
+{
+    Mem_segment segment = &mem->segments[address];
+    if (segment->storage != NULL) {
+        discard_block(segment);
+    }
+    release_storage(mem, segment);
+    Mem_segment_adopt(segment, data, mapped);
+    mem->num_unpooled++;
+    return 1;
+}
+
+/* Mem_num_segments
+ * Purpose:    Returns the size of the segment table, mapped or not.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ * Returns:    uint32_t - one more than the highest address ever mapped
+ */
+uint32_t Mem_num_segments(Mem_T mem)
+{
+    return mem->num_segments;
+}
+
+/* Mem_num_free
+ * Purpose:    Returns the number of unmapped addresses awaiting reuse.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ * Returns:    uint32_t - the depth of the stack of unmapped addresses
+ */
+uint32_t Mem_num_free(Mem_T mem)
+{
+    return __atomic_load_n(&mem->num_deleted, __ATOMIC_RELAXED);
+}
+
+/* Mem_free_at
+ * Purpose:    Returns an entry of the stack of unmapped addresses.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             uint32_t i - the position, counted from the bottom of the
+ *                          stack
+ * Returns:    Mem_Address - the address; the next segment mapped reuses
+ *             the one at position Mem_num_free(mem) - 1
+ * Notes:      The stack is copied out in order the first time it is read
+ *             after it changes, so reading it all takes linear time. Not
+ *             for use while other threads map or unmap segments.
+ */
+Mem_Address Mem_free_at(Mem_T mem, uint32_t i)
+{
+    if (mem->snapshot_top != mem->free_top) {
+        size_t bytes = ((size_t)mem->num_deleted + 1) *
+                       sizeof(*mem->free_snapshot);
+        mem->free_snapshot = realloc(mem->free_snapshot, bytes);
+        if (mem->free_snapshot == NULL) {
+            Mem_allocation_failed("the list of unmapped segments", bytes);
+        }
+        uint32_t link = (uint32_t)mem->free_top;
+        for (uint32_t j = mem->num_deleted; j-- > 0; ) {
+            mem->free_snapshot[j] = link - 1;
+            link = mem->free_links[link - 1];
+        }
+        mem->snapshot_top = mem->free_top;
+    }
+    return mem->free_snapshot[i];
+}
+
+/* Mem_backend_name
+ * Purpose:    Identifies this backend, e.g. for benchmark reports.
+ * Parameters: none
+ * Returns:    const char * - the backend name
+ */
+const char *Mem_backend_name(void)
+{
+    return "arena";
+}
@@ -0,0 +1,83 @@
+/******************************************************************************
+ *
+ *                               mem_arena.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    The arena memory backend: a flat descriptor table like the
+ *                 flat backend, but segment storage is carved out of large
+ *                 pooled chunks in power-of-two size classes. Unmapping a
+ *                 segment returns its block to the free list of its class,
+ *                 so mapping rarely reaches the system allocator and the
+ *                 whole pool can be discarded, or reset for another
+ *                 program, at once.
+ *
+ *                 Unmapped addresses wait for reuse on a stack linked
+ *                 through a per-address array. Its top carries a counter
+ *                 bumped by every push and pop, so once Mem_enable_threads
+ *                 has been called the stack can be shared lock-free by
+ *                 concurrent UM threads, which then also get a table that
+ *                 never moves and a lock around the pool.
+ *
+ *****************************************************************************/
+
+#ifndef MEM_ARENA_H
+#define MEM_ARENA_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define MEM_ARENA_NUM_CLASSES 32
+
+struct Mem_T {
+    struct Mem_segment *segments;
+    uint32_t num_segments;
+    uint32_t table_capacity;
+    int program_page_flags;
+
+    /* Stack of unmapped addresses: free_top holds a counter in its high
+       half and the top address plus one (0 if empty) in its low half;
+       free_links[a] holds the address below a, plus one */
+    uint64_t free_top;
+    uint32_t *free_links;
+    uint32_t num_deleted;
+    /* Bottom-to-top copy of the stack for Mem_free_at, as of free_top */
+    Mem_Address *free_snapshot;
+    uint64_t snapshot_top;
+
+    /* Set by Mem_enable_threads */
+    int threaded;
+    pthread_mutex_t pool_lock;
+
+    /* Pool state: free blocks per size class and the current chunk */
+    void *free_blocks[MEM_ARENA_NUM_CLASSES];
+    char *chunk_next;
+    char *chunk_end;
+    struct Mem_arena_chunk {
+        uint32_t *data;
+        int mapped;
+    } *chunks;
+    int num_chunks;
+    int chunks_capacity;
+    int chunks_in_use;   /* chunks bump-allocated from since a reset */
+
+    /* Segments whose storage is their own rather than pooled */
+    int num_unpooled;
+};
+
+/* Mem_segment_at
+ * Purpose:    Returns the descriptor of the segment at an address.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_Address address - address of an existing segment
+ * Returns:    Mem_segment - the descriptor, valid until the next segment is
+ *             created (the table may move when it grows)
+ */
+static inline Mem_segment Mem_segment_at(Mem_T mem, Mem_Address address)
+{
+    return &mem->segments[address];
+}
+
+#endif
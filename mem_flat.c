@@ -0,0 +1,274 @@
+/******************************************************************************
+ *
+ *                                mem_flat.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the flat memory backend described in
+ *                 mem_flat.h. Both the descriptor table and the stack of
+ *                 deleted addresses double in size when full. As in the
+ *                 sarray backend, an unmapped segment keeps its storage for
+ *                 the next segment mapped at its address.
+ *
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "memory.h"
+#include "telemetry.h"
+#include "assert.h"
+
+#define PROG_ADDRESS 0
+#define SIZE_OF_UINT32 4
+#define INITIAL_CAPACITY 64
+
+/* grow_table
+ * Purpose:    Doubles the capacity of one of the tables, up to one entry
+ *             per possible address.
+ * Parameters: void *table - the table
+ *             uint32_t *capacity_p - its capacity in entries, updated
+ *             size_t entry_size - the size of an entry
+ *             const char *what - what the table holds, for errors
+ * Returns:    void * - the table, which may have moved
+ */
+static void *grow_table(void *table, uint32_t *capacity_p, size_t entry_size,
+                        const char *what)
+{
+    if (*capacity_p == MEM_MAX_SEGMENTS) {
+        fprintf(stderr, "More than %u segments are mapped.\n",
+                MEM_MAX_SEGMENTS);
+        exit(EXIT_FAILURE);
+    }
+    *capacity_p = *capacity_p > MEM_MAX_SEGMENTS / 2 ? MEM_MAX_SEGMENTS
+                                                     : 2 * *capacity_p;
+    size_t bytes = (size_t)*capacity_p * entry_size;
+    table = realloc(table, bytes);
+    if (table == NULL) {
+        Mem_allocation_failed(what, bytes);
+    }
+    return table;
+}
+
+/* Mem_new
+ * Purpose:    Dynamically allocates space for a new Mem_T struct instance and
+ *             returns a pointer to that struct. Also initializes its members.
+ * Parameters: int program_page_flags - Pages_alloc flags for segment 0
+ * Returns:    Mem_T - a pointer to the newly allocated Mem_T struct
+ * Notes:      Leaves memory on the heap after this function terminates.
+ */
+Mem_T Mem_new(int program_page_flags)
+{
+    Mem_T mem = malloc(sizeof(*mem));
+    assert(mem != NULL);
+    mem->segments = malloc(INITIAL_CAPACITY * sizeof(*mem->segments));
+    mem->deleted_addresses = malloc(INITIAL_CAPACITY *
+                                    sizeof(*mem->deleted_addresses));
+    assert(mem->segments != NULL && mem->deleted_addresses != NULL);
+    mem->num_segments = 0;
+    mem->table_capacity = INITIAL_CAPACITY;
+    mem->num_deleted = 0;
+    mem->deleted_capacity = INITIAL_CAPACITY;
+    mem->program_page_flags = program_page_flags;
+    return mem;
+}
+
+/* Mem_free_memory
+ * Purpose:    Deallocates all heap allocated memory associated with a Mem_T
+ *             instance. 
+ * Parameters: Mem_T *mem_p - A double pointer to a Mem_T struct instance, 
+ *                            which will be freed. mem_p may be null, but if it
+ *                            is not null, *mem_p cannot be null.
+ * Returns:    none
+ */
+void Mem_free_memory(Mem_T *mem_p)
+{
+    if (mem_p == NULL) {
+        return;
+    }
+    Mem_T mem = *mem_p;
+    assert(mem != NULL);
+    for (uint32_t i = 0; i < mem->num_segments; i++) {
+        Mem_segment_release(&mem->segments[i]);
+    }
+    free(mem->segments);
+    free(mem->deleted_addresses);
+    free(mem);
+    *mem_p = NULL;
+}
+
+/* Mem_reset
+ * Purpose:    Empties main memory so another program can run in it, as if
+ *             it had just been created by Mem_new. The tables keep their
+ *             capacity.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ * Returns:    none
+ */
+void Mem_reset(Mem_T mem)
+{
+    for (uint32_t i = 0; i < mem->num_segments; i++) {
+        Mem_segment_release(&mem->segments[i]);
+    }
+    mem->num_segments = 0;
+    mem->num_deleted = 0;
+    Telemetry->live_segments = 0;
+    Telemetry->free_segments = 0;
+}
+
+/* Mem_create_segment
+ * Purpose:    Creates a new segment of the specified length, with every word
+ *             set to 0, at a free index in main memory. The index of the
+ *             new segment is returned to the client.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             uint32_t length - length of the segment
+ * Returns:    Mem_Address - the address of the newly instantiated segment
+ */
+Mem_Address Mem_create_segment(Mem_T mem, uint32_t length)
+{
+    Mem_Address address;
+    if (mem->num_deleted == 0) {
+        if (mem->num_segments == mem->table_capacity) {
+            Telemetry->table_entries_copied += mem->num_segments;
+            Telemetry->allocations++;
+            mem->segments = grow_table(mem->segments, &mem->table_capacity,
+                                       sizeof(*mem->segments),
+                                       "the segment table");
+        }
+        address = mem->num_segments++;
+        memset(&mem->segments[address], 0, sizeof(mem->segments[address]));
+    } else {
+        /* Reuse the most recently deleted address */
+        address = mem->deleted_addresses[--mem->num_deleted];
+        Telemetry->free_segments--;
+    }
+
+    Mem_segment segment = &mem->segments[address];
+    int zeroed = 0;
+    if (segment->capacity < length) {
+        /* Segment 0 is the hottest segment, so it always gets huge pages */
+        zeroed = Mem_segment_allocate(segment, length,
+                                      address == PROG_ADDRESS ?
+                                      mem->program_page_flags : 0);
+    }
+    segment->length = length;
+    if (length > 0 && !zeroed) {
+        Mem_segment_clear(segment, length);
+    }
+    Telemetry->live_segments++;
+    return address;
+}
+
+/* Mem_remove_segment
+ * Purpose:    Unmaps the segment at a specified address and pushes the
+ *             address on the stack of deleted addresses. The segment keeps
+ *             its storage for reuse.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_Address address - 32-bit address corresponding with an
+ *                                   existing segment
+ * Returns:    none
+ */
+void Mem_remove_segment(Mem_T mem, Mem_Address address)
+{
+    if (mem->num_deleted == mem->deleted_capacity) {
+        mem->deleted_addresses = grow_table(mem->deleted_addresses,
+                                            &mem->deleted_capacity,
+                                            sizeof(*mem->deleted_addresses),
+                                            "the deleted addresses");
+    }
+    mem->deleted_addresses[mem->num_deleted++] = address;
+    Telemetry->live_segments--;
+    Telemetry->free_segments++;
+}
+
+/* Mem_reserve
+ * Purpose:    Resizes an existing segment to length words, e.g. before
+ *             LOADP copies a new program into segment 0. The contents of the
+ *             segment are unspecified afterwards.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_Address address - address of an existing segment
+ *             uint32_t length - the new length
+ * Returns:    none
+ */
+void Mem_reserve(Mem_T mem, Mem_Address address, uint32_t length)
+{
+    Mem_segment segment = &mem->segments[address];
+    if (segment->capacity < length) {
+        Mem_segment_allocate(segment, length, address == PROG_ADDRESS ?
+                                              mem->program_page_flags : 0);
+    }
+    segment->length = length;
+}
+
+/* Mem_adopt_storage
+ * Purpose:    Replaces the storage of a segment with storage obtained from
+ *             the pages module, releasing the storage it had. The length of
+ *             the segment is unchanged; its contents are whatever the new
+ *             storage holds.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_Address address - address of an existing segment
+ *             uint32_t *data - storage for at least the segment's length
+ *             int mapped - as set by Pages_alloc
+ * Returns:    int - 1, or 0 if this backend cannot adopt storage
+ */
+int Mem_adopt_storage(Mem_T mem, Mem_Address address, uint32_t *data,
+                      int mapped)
+{
+    Mem_segment_adopt(&mem->segments[address], data, mapped);
+    return 1;
+}
+
+/* Mem_num_segments
+ * Purpose:    Returns the size of the segment table, mapped or not.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ * Returns:    uint32_t - one more than the highest address ever mapped
+ */
+uint32_t Mem_num_segments(Mem_T mem)
+{
+    return mem->num_segments;
+}
+
+/* Mem_num_free
+ * Purpose:    Returns the number of unmapped addresses awaiting reuse.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ * Returns:    uint32_t - the depth of the stack of deleted addresses
+ */
+uint32_t Mem_num_free(Mem_T mem)
+{
+    return mem->num_deleted;
+}
+
+/* Mem_free_at
+ * Purpose:    Returns an entry of the stack of deleted addresses.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             uint32_t i - the position, counted from the bottom of the
+ *                          stack
+ * Returns:    Mem_Address - the address; the next segment mapped reuses
+ *             the one at position Mem_num_free(mem) - 1
+ */
+Mem_Address Mem_free_at(Mem_T mem, uint32_t i)
+{
+    return mem->deleted_addresses[i];
+}
+
+/* Mem_enable_threads
+ * Purpose:    Would make main memory safe to share between threads.
+ * Parameters: Mem_T mem - an instance of Mem_T
+ * Returns:    int - 0, since this backend cannot be shared
+ */
+int Mem_enable_threads(Mem_T mem)
+{
+    (void)mem;
+    return 0;
+}
+
+/* Mem_backend_name
+ * Purpose:    Identifies this backend, e.g. for benchmark reports.
+ * Parameters: none
+ * Returns:    const char * - the backend name
+ */
+const char *Mem_backend_name(void)
+{
+    return "flat";
+}
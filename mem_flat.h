@@ -0,0 +1,42 @@
+/******************************************************************************
+ *
+ *                                mem_flat.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    The flat memory backend: main memory is a single growable
+ *                 C array of segment descriptors indexed directly by
+ *                 address, and unmapped addresses are kept on a plain array
+ *                 stack. A segmented load is two dependent loads with no
+ *                 function call.
+ *
+ *****************************************************************************/
+
+#ifndef MEM_FLAT_H
+#define MEM_FLAT_H
+
+struct Mem_T {
+    struct Mem_segment *segments;
+    uint32_t num_segments;
+    uint32_t table_capacity;
+    Mem_Address *deleted_addresses;
+    uint32_t num_deleted;
+    uint32_t deleted_capacity;
+    int program_page_flags;
+};
+
+/* Mem_segment_at
+ * Purpose:    Returns the descriptor of the segment at an address.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_Address address - address of an existing segment
+ * Returns:    Mem_segment - the descriptor, valid until the next segment is
+ *             created (the table may move when it grows)
+ */
+static inline Mem_segment Mem_segment_at(Mem_T mem, Mem_Address address)
+{
+    return &mem->segments[address];
+}
+
+#endif
@@ -0,0 +1,266 @@
+/******************************************************************************
+ *
+ *                               mem_sarray.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the sarray memory backend described in
+ *                 mem_sarray.h. An unmapped segment keeps its storage, so
+ *                 mapping a segment that fits in a recycled one allocates
+ *                 nothing.
+ *
+ *****************************************************************************/
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "memory.h"
+#include "telemetry.h"
+#include "assert.h"
+
+#define PROG_ADDRESS 0
+#define SIZE_OF_UINT32 4
+
+/* count_table_growth
+ * Purpose:    Records the allocation of a new descriptor, and the copy the
+ *             Hanson sequence makes if adding it makes the sequence grow.
+ * Parameters: Mem_Address address - the address about to be added, which is
+ *                                   also the sequence's length
+ * Returns:    none
+ * Notes:      A sequence starts with room for 16 entries and doubles. Its
+ *             length is an int, which limits the number of segments.
+ */
+static void count_table_growth(Mem_Address address)
+{
+    if (address == INT_MAX) {
+        fprintf(stderr, "More than %d segments are mapped, the most the "
+                "%s memory backend allows.\n", INT_MAX, Mem_backend_name());
+        exit(EXIT_FAILURE);
+    }
+    Telemetry->allocations++;
+    if (address >= 16 && (address & (address - 1)) == 0) {
+        Telemetry->table_entries_copied += address;
+        Telemetry->allocations++;
+    }
+}
+
+/* Mem_new
+ * Purpose:    Dynamically allocates space for a new Mem_T struct instance and
+ *             returns a pointer to that struct. Also initializes its members.
+ * Parameters: int program_page_flags - Pages_alloc flags for segment 0
+ * Returns:    Mem_T - a pointer to the newly allocated Mem_T struct
+ * Notes:      Leaves memory on the heap after this function terminates.
+ */
+Mem_T Mem_new(int program_page_flags)
+{
+    Mem_T mem = malloc(sizeof(*mem));
+    /* Ensure that malloc was successful */
+    assert(mem != NULL);
+
+    /* Instantiate each struct element */
+    mem->main_memory = Seq_new(0);
+    mem->deleted_addresses = Seq_new(0);
+    mem->program_page_flags = program_page_flags;
+    return mem; 
+}
+
+/* Mem_free_memory
+ * Purpose:    Deallocates all heap allocated memory associated with a Mem_T
+ *             instance. 
+ * Parameters: Mem_T *mem_p - A double pointer to a Mem_T struct instance, 
+ *                            which will be freed. mem_p may be null, but if it
+ *                            is not null, *mem_p cannot be null.
+ * Returns:    none
+ */
+void Mem_free_memory(Mem_T *mem_p)
+{
+    if (mem_p == NULL) {
+        return;
+    }
+    Mem_T mem = *mem_p;
+    assert(mem != NULL);
+
+    /* Iterate over main memory and delete all existing segments */
+    int main_mem_len = Seq_length(mem->main_memory);
+    for (int i = 0; i < main_mem_len; i++) {
+        Mem_segment segment = Seq_get(mem->main_memory, i);
+        Mem_segment_release(segment);
+        free(segment);
+    }
+
+    /* Free remaining struct memory before freeing the struct itself */
+    Seq_free(&(mem->deleted_addresses));
+    Seq_free(&(mem->main_memory));
+    free(mem);
+    *mem_p = NULL;
+}
+
+/* Mem_reset
+ * Purpose:    Empties main memory so another program can run in it, as if
+ *             it had just been created by Mem_new.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ * Returns:    none
+ */
+void Mem_reset(Mem_T mem)
+{
+    while (Seq_length(mem->main_memory) > 0) {
+        Mem_segment segment = Seq_remhi(mem->main_memory);
+        Mem_segment_release(segment);
+        free(segment);
+    }
+    while (Seq_length(mem->deleted_addresses) > 0) {
+        Seq_remhi(mem->deleted_addresses);
+    }
+    Telemetry->live_segments = 0;
+    Telemetry->free_segments = 0;
+}
+
+/* Mem_create_segment
+ * Purpose:    Creates a new segment of the specified length, with every word
+ *             set to 0, at a free index in main memory. The index of the
+ *             new segment is returned to the client.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             uint32_t length - length of the segment
+ * Returns:    Mem_Address - the address of the newly instantiated segment
+ */
+Mem_Address Mem_create_segment(Mem_T mem, uint32_t length)
+{
+    Mem_Address address;
+    Mem_segment segment;
+    /* In this case, add a new segment (which will expand the sequence) */
+    if (Seq_length(mem->deleted_addresses) == 0) {
+        address = Seq_length(mem->main_memory);
+        segment = calloc(1, sizeof(*segment));
+        assert(segment != NULL);
+        count_table_growth(address);
+        Seq_addhi(mem->main_memory, segment);
+    } else {
+        /* In this case, use the top element of the stack as the address */
+        address = (uintptr_t)Seq_remhi(mem->deleted_addresses);
+        Telemetry->free_segments--;
+        segment = Seq_get(mem->main_memory, address);
+    }
+    int zeroed = 0;
+    if (segment->capacity < length) {
+        /* Segment 0 is the hottest segment, so it always gets huge pages */
+        zeroed = Mem_segment_allocate(segment, length,
+                                      address == PROG_ADDRESS ?
+                                      mem->program_page_flags : 0);
+    }
+    segment->length = length;
+    if (length > 0 && !zeroed) {
+        Mem_segment_clear(segment, length);
+    }
+    Telemetry->live_segments++;
+    return address;
+}
+
+/* Mem_remove_segment
+ * Purpose:    Unmaps the segment at a specified address and stores the
+ *             address in a Hanson sequence representing the deleted
+ *             addresses. The segment keeps its storage for reuse.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_Address address - 32-bit address corresponding with an
+ *                                   existing segment
+ * Returns:    none
+ */
+void Mem_remove_segment(Mem_T mem, Mem_Address address)
+{
+    Seq_addhi(mem->deleted_addresses, (void *)(uintptr_t)address); 
+    Telemetry->live_segments--;
+    Telemetry->free_segments++;
+}
+
+/* Mem_reserve
+ * Purpose:    Resizes an existing segment to length words, e.g. before
+ *             LOADP copies a new program into segment 0. The contents of the
+ *             segment are unspecified afterwards.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_Address address - address of an existing segment
+ *             uint32_t length - the new length
+ * Returns:    none
+ */
+void Mem_reserve(Mem_T mem, Mem_Address address, uint32_t length)
+{
+    Mem_segment segment = Seq_get(mem->main_memory, address);
+    if (segment->capacity < length) {
+        Mem_segment_allocate(segment, length, address == PROG_ADDRESS ?
+                                              mem->program_page_flags : 0);
+    }
+    segment->length = length;
+}
+
+/* Mem_adopt_storage
+ * Purpose:    Replaces the storage of a segment with storage obtained from
+ *             the pages module, releasing the storage it had. The length of
+ *             the segment is unchanged; its contents are whatever the new
+ *             storage holds.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_Address address - address of an existing segment
+ *             uint32_t *data - storage for at least the segment's length
+ *             int mapped - as set by Pages_alloc
+ * Returns:    int - 1, or 0 if this backend cannot adopt storage
+ */
+int Mem_adopt_storage(Mem_T mem, Mem_Address address, uint32_t *data,
+                      int mapped)
+{
+    Mem_segment_adopt(Seq_get(mem->main_memory, address), data, mapped);
+    return 1;
+}
+
+/* Mem_num_segments
+ * Purpose:    Returns the size of the segment table, mapped or not.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ * Returns:    uint32_t - one more than the highest address ever mapped
+ */
+uint32_t Mem_num_segments(Mem_T mem)
+{
+    return Seq_length(mem->main_memory);
+}
+
+/* Mem_num_free
+ * Purpose:    Returns the number of unmapped addresses awaiting reuse.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ * Returns:    uint32_t - the depth of the stack of deleted addresses
+ */
+uint32_t Mem_num_free(Mem_T mem)
+{
+    return Seq_length(mem->deleted_addresses);
+}
+
+/* Mem_free_at
+ * Purpose:    Returns an entry of the stack of deleted addresses.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             uint32_t i - the position, counted from the bottom of the
+ *                          stack
+ * Returns:    Mem_Address - the address; the next segment mapped reuses
+ *             the one at position Mem_num_free(mem) - 1
+ */
+Mem_Address Mem_free_at(Mem_T mem, uint32_t i)
+{
+    return (uintptr_t)Seq_get(mem->deleted_addresses, i);
+}
+
+/* Mem_enable_threads
+ * Purpose:    Would make main memory safe to share between threads.
+ * Parameters: Mem_T mem - an instance of Mem_T
+ * Returns:    int - 0, since this backend cannot be shared
+ */
+int Mem_enable_threads(Mem_T mem)
+{
+    (void)mem;
+    return 0;
+}
+
+/* Mem_backend_name
+ * Purpose:    Identifies this backend, e.g. for benchmark reports.
+ * Parameters: none
+ * Returns:    const char * - the backend name
+ */
+const char *Mem_backend_name(void)
+{
+    return "sarray";
+}
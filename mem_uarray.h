@@ -0,0 +1,39 @@
+/******************************************************************************
+ *
+ *                               mem_uarray.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    The uarray memory backend: main memory is a Hanson Seq_T
+ *                 of segment descriptors whose words live in Hanson UArray_T
+ *                 instances, as in the original memory module. Unmapped
+ *                 addresses are kept on a Seq_T stack for reuse.
+ *
+ *****************************************************************************/
+
+#ifndef MEM_UARRAY_H
+#define MEM_UARRAY_H
+
+#include "seq.h"
+#include "uarray.h"
+
+struct Mem_T {
+    Seq_T main_memory;
+    Seq_T deleted_addresses;
+    int program_page_flags;
+};
+
+/* Mem_segment_at
+ * Purpose:    Returns the descriptor of the segment at an address.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_Address address - address of an existing segment
+ * Returns:    Mem_segment - the descriptor
+ */
+static inline Mem_segment Mem_segment_at(Mem_T mem, Mem_Address address)
+{
+    return Seq_get(mem->main_memory, address);
+}
+
+#endif
@@ -6,205 +6,177 @@
  *     Authors:    Ryan Beckwith and Victoria Chen
  *     Date:       11/24/2020
  *
- *     Purpose:    Represents the implementation of the segmented main memory
- *                 structure outlined by the interface in memory.h.
- *                 Defines the Mem_T struct and its corresponding functions,
- *                 which can perform operations like word access/updates,
- *                 segment creation/deletion, and segment duplication.
+ *     Purpose:    Represents the backend-independent part of the segmented
+ *                 main memory outlined by the interface in memory.h:
+ *                 segment duplication (used by LOADP) and the word storage
+ *                 shared by the sarray and flat backends, which comes from
+ *                 the pages module so large segments get huge pages.
  *
  *****************************************************************************/
 
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
 #include "memory.h"
-#include "uarray.h"
-#include "seq.h"
-#include "assert.h"
+#include "pages.h"
+#include "telemetry.h"
 
 #define SIZE_OF_UINT32 4
-
-static void Mem_delete_segment(Mem_T mem, Mem_Address address);
-
-/* Memory struct, details hidden from client */
-// struct Mem_T {
-//     Seq_T main_memory;
-//     Seq_T deleted_addresses;
-// };
-
-/* Mem_new
- * Purpose:    Dynamically allocates space for a new Mem_T struct instance and
- *             returns a pointer to that struct. Also initializes its members.
- * Parameters: none
- * Returns:    Mem_T - a pointer to the newly allocated Mem_T struct
- * Notes:      Leaves memory on the heap after this function terminates.
+/* Mapped storage at least this large is cleared by discarding its pages */
+#define MIN_DISCARD_BYTES (256 * 1024)
+
+/* Mem_segment_allocate
+ * Purpose:    Gives a segment descriptor fresh storage for capacity words,
+ *             releasing any storage it already had.
+ * Parameters: Mem_segment segment - the descriptor (must not be null)
+ *             uint32_t capacity - the number of words needed
+ *             int page_flags - flags for Pages_alloc
+ * Returns:    int - 1 if the new storage is known to be zero-filled, so
+ *             the caller need not clear it, else 0
+ * Notes:      Mapped storage is zero-filled and only committed as it is
+ *             touched, so a huge segment costs nothing until it is used.
  */
-Mem_T Mem_new()
+int Mem_segment_allocate(Mem_segment segment, uint32_t capacity,
+                         int page_flags)
 {
-    Mem_T mem = malloc(sizeof(*mem));
-    /* Ensure that malloc was successful */
-    assert(mem != NULL);
-
-    /* Instantiate each struct element */
-    mem->main_memory = Seq_new(0);
-    mem->deleted_addresses = Seq_new(0);
-    return mem; 
+    int mapped;
+    size_t bytes = (size_t)capacity * SIZE_OF_UINT32;
+    uint32_t *data = Pages_alloc(bytes, page_flags, &mapped);
+    if (data == NULL && capacity != 0) {
+        Mem_allocation_failed("a segment", bytes);
+    }
+    Mem_segment_release(segment);
+    segment->data = data;
+    segment->capacity = capacity;
+    segment->mapped = mapped;
+    segment->anonymous = mapped;
+    Telemetry->bytes_allocated += bytes;
+    Telemetry->allocations++;
+    return mapped;
 }
 
-/* Mem_free_memory
- * Purpose:    Deallocates all heap allocated memory associated with a Mem_T
- *             instance. 
- * Parameters: Mem_T *mem_p - A double pointer to a Mem_T struct instance, 
- *                            which will be freed. mem_p may be null, but if it
- *                            is not null, *mem_p cannot be null.
+/* Mem_segment_release
+ * Purpose:    Frees the storage owned by a segment descriptor.
+ * Parameters: Mem_segment segment - the descriptor (must not be null)
  * Returns:    none
  */
-void Mem_free_memory(Mem_T *mem_p)
+void Mem_segment_release(Mem_segment segment)
 {
-    if (mem_p == NULL) {
+    if (segment->data == NULL) {
         return;
     }
-    Mem_T mem = *mem_p;
-    assert(mem != NULL);
-
-    /* Iterate over main memory and delete all existing segments */
-    int main_mem_len = Seq_length(mem->main_memory);
-    for (int i = 0; i < main_mem_len; i++) {
-        if (Seq_get(mem->main_memory, i) != NULL) {
-            Mem_delete_segment(mem, i);
-        }
-    }
-
-    /* Free remaining struct memory before freeing the struct itself */
-    Seq_free(&(mem->deleted_addresses));
-    Seq_free(&(mem->main_memory));
-    free(mem);
-}
-
-/* Mem_create_segment
- * Purpose:    Creates a new segment with the specified length at a free index
- *             in main memory. The index of the new segment is returned to the
- *             client.
- * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
- *             int length - length of the segment
- * Returns:    Mem_Address - the address of the newly instantiated segment
- */
-Mem_Address Mem_create_segment(Mem_T mem, int length)
-{
-    // assert(mem != NULL);
-    /* Use a macro instead of sizeof(uint32_t) for efficiency */
-    Mem_Address address;
-    Seq_T deleted_addresses = mem->deleted_addresses;
-    Seq_T main_memory = mem->main_memory;
-    /* In this case, add a new segment (which will expand the sequence) */
-    if (Seq_length(deleted_addresses) == 0) {
-        UArray_T segment = UArray_new(length, SIZE_OF_UINT32);
-        address = Seq_length(main_memory);
-        Seq_addhi(main_memory, segment);
-    } else {
-        /* In this case, use the top element of the stack as the address */
-        address = (uintptr_t)Seq_remhi(deleted_addresses);
-        UArray_T segment = Seq_get(main_memory, address); 
-        int curr_seg_length = UArray_length(segment);
-        if (curr_seg_length < length) {
-            // for (int i = 0; i < curr_seg_length; i++) {
-            //     *((uint32_t *)UArray_at(segment, i)) = 0;
-            // }
-            UArray_resize(segment, length);
-        }
-    }
-    return address;
+    Pages_free(segment->data, (size_t)segment->capacity * SIZE_OF_UINT32,
+               segment->mapped);
+    Telemetry->bytes_allocated -= (size_t)segment->capacity * SIZE_OF_UINT32;
+    segment->data = NULL;
+    segment->capacity = 0;
+    segment->mapped = 0;
+    segment->anonymous = 0;
 }
 
-/* Mem_delete_segment
- * Purpose:    Remove a segment corresponding with a specified index 
- *             and stores its address in a Hanson sequence representing 
- *             the deleted addresses. 
- * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
- *             Mem_Address address - 32-bit address corresponding with an 
- *                                   existing segment
- * Returns: none
+/* Mem_segment_adopt
+ * Purpose:    Gives a segment descriptor storage that was allocated
+ *             elsewhere, releasing any storage it already had. The storage
+ *             must hold the segment's length and be releasable with
+ *             Pages_free.
+ * Parameters: Mem_segment segment - the descriptor (must not be null)
+ *             uint32_t *data - the storage
+ *             int mapped - as set by Pages_alloc
+ * Returns:    none
  */
-static void Mem_delete_segment(Mem_T mem, Mem_Address address)
+void Mem_segment_adopt(Mem_segment segment, uint32_t *data, int mapped)
 {
-    Seq_T main_memory = mem->main_memory;
-    // assert(mem != NULL);
-    UArray_T segment = Seq_get(main_memory, address);
-    UArray_free(&segment);
-    Seq_put(main_memory, address, NULL); 
-    /* Add the removed index to deleted addresses */
-    Seq_addhi(mem->deleted_addresses, (void *)(uintptr_t)address); 
+    Mem_segment_release(segment);
+    segment->data = data;
+    segment->capacity = segment->length;
+    segment->mapped = mapped;
+    segment->anonymous = 0;
+    Telemetry->bytes_allocated += (size_t)segment->capacity * SIZE_OF_UINT32;
 }
 
-void Mem_remove_segment(Mem_T mem, Mem_Address address)
-{
-    Seq_addhi(mem->deleted_addresses, (void *)(uintptr_t)address); 
-}
-
-/* Mem_update_word
- * Purpose:    Inserts a given 32-bit value into a segment corresponding with 
- *             a specified index. 
- * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
- *             Mem_Address address - 32-bit address corresponding with an 
- *                                   existing segment
- *             int index - index of the word to update within the segment 
- *             uint32_t value - 32-bit updated value of the specified word
+/* Mem_segment_clear
+ * Purpose:    Sets the first length words of a segment's storage to 0.
+ * Parameters: Mem_segment segment - the descriptor (must not be null)
+ *             uint32_t length - how many words to clear (at most its
+ *                               capacity)
  * Returns:    none
+ * Notes:      Large anonymous storage has its whole pages handed back to
+ *             the host instead, which costs only what was resident: the
+ *             pages read as zero and are committed again only when
+ *             touched. Adopted storage may map a file (see dedup.c), whose
+ *             discarded pages would read back the file, so it is cleared.
  */
-void Mem_update_word(Mem_T mem, Mem_Address address, int index, uint32_t value)
+void Mem_segment_clear(Mem_segment segment, uint32_t length)
 {
-    // assert(mem != NULL);
-    UArray_T segment = Seq_get(mem->main_memory, address);
-    *((uint32_t *)UArray_at(segment, index)) = value;
+    size_t bytes = (size_t)length * SIZE_OF_UINT32;
+    if (segment->anonymous && bytes >= MIN_DISCARD_BYTES) {
+        /* Mapped storage starts on a page boundary */
+        size_t page_size = sysconf(_SC_PAGESIZE);
+        size_t whole = bytes & ~(page_size - 1);
+        if (madvise(segment->data, whole, MADV_DONTNEED) == 0) {
+            memset((char *)segment->data + whole, 0, bytes - whole);
+            return;
+        }
+    }
+    memset(segment->data, 0, bytes);
 }
 
-/* Mem_get_word
- * Purpose:    Returns the value of the 32-bit word at the specified index
- *             within the segment specified by the given address.
- * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
- *             Mem_Address address - 32-bit address corresponding with an 
- *                                   existing segment
- * Returns:    uint32_t - the 32-bit word at the specified address/index
- */
-uint32_t Mem_get_word(Mem_T mem, Mem_Address address, int index)
-{
-    // assert(mem != NULL);
-    UArray_T segment = Seq_get(mem->main_memory, address);
-    return *((uint32_t *)UArray_at(segment, index));
-} 
-
 /* Mem_duplicate_segment
- * Purpose:    Duplicates the segment at the first address and stores the 
- *             duplicate at the second address. 
+ * Purpose:    Duplicates the segment at the first address and stores the
+ *             duplicate at the second address.
  * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
- *             Mem_Address address_to_dup - 32-bit address corresponding with 
+ *             Mem_Address address_to_dup - 32-bit address corresponding with
  *                                          an existing segment to duplicate
- *             Mem_Address address_to_replace - 32-bit address corresponding 
- *                                              with an existing segment to 
+ *             Mem_Address address_to_replace - 32-bit address corresponding
+ *                                              with an existing segment to
  *                                              replace
- * Returns:    int - the length of the newly duplicated segment
+ * Returns:    uint32_t - the length of the newly duplicated segment
  */
-int Mem_duplicate_segment(Mem_T mem, Mem_Address address_to_dup,
-                          Mem_Address address_to_replace)
+uint32_t Mem_duplicate_segment(Mem_T mem, Mem_Address address_to_dup,
+                               Mem_Address address_to_replace)
 {
-    // assert(mem != NULL);
-    UArray_T segment_to_dup = Seq_get(mem->main_memory, address_to_dup); 
-    int segment_to_dup_len = UArray_length(segment_to_dup);
-    Mem_remove_segment(mem, address_to_replace);
-    Mem_create_segment(mem, segment_to_dup_len);
-    
-    /* Populate new segment with 32-bit words from the duplicated segment */
-    for (int i = 0; i < segment_to_dup_len; i++) {
-        Mem_update_word(mem, address_to_replace, i,
-                        Mem_get_word(mem, address_to_dup, i));
-    }
-    return segment_to_dup_len;
-} 
+    uint32_t length = Mem_segment_at(mem, address_to_dup)->length;
+    Mem_reserve(mem, address_to_replace, length);
+
+    /* Look the source up again: reserving may have moved descriptors */
+    memcpy(Mem_segment_at(mem, address_to_replace)->data,
+           Mem_segment_at(mem, address_to_dup)->data,
+           (size_t)length * SIZE_OF_UINT32);
+    Telemetry->loadp_copies++;
+    Telemetry->loadp_words_copied += length;
+    return length;
+}
 
-UArray_T Mem_get_segment(Mem_T mem, Mem_Address address) {
-   return Seq_get(mem->main_memory, address); 
+/* Mem_segment_hash
+ * Purpose:    Hashes the contents of a segment (64-bit FNV-1a over its
+ *             words), e.g. to notice that it changed or that two segments
+ *             may be identical.
+ * Parameters: Mem_segment segment - the descriptor (must not be null)
+ * Returns:    uint64_t - the hash
+ */
+uint64_t Mem_segment_hash(Mem_segment segment)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (uint32_t i = 0; i < segment->length; i++) {
+        hash = (hash ^ segment->data[i]) * 1099511628211ull;
+    }
+    return hash;
 }
 
-uint32_t Mem_get_word_from_seg(UArray_T segment, int index)
+/* Mem_allocation_failed
+ * Purpose:    Reports that main memory could not grow and ends the UM.
+ * Parameters: const char *what - what the storage was for
+ *             size_t bytes - how much was asked for
+ * Returns:    none; does not return
+ * Notes:      The guest asked for more than the host will give. That is
+ *             not a bug in the UM, so it exits with a message instead of
+ *             failing an assertion.
+ */
+void Mem_allocation_failed(const char *what, size_t bytes)
 {
-    // assert(mem != NULL);
-    return *((uint32_t *)UArray_at(segment, index));
-} 
\ No newline at end of file
+    fprintf(stderr, "Out of memory: could not allocate %zu bytes for %s.\n",
+            bytes, what);
+    exit(EXIT_FAILURE);
+}
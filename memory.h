@@ -6,11 +6,25 @@
  *     Authors:    Ryan Beckwith and Victoria Chen
  *     Date:       11/24/2020
  *
- *     Purpose:    Interface for functions representing the segmented memory
- *                 system required for the Universal Machine. Includes an
- *                 opaque pointer to the Mem_T struct, as well as functions
- *                 that can perform operations like word access/updates,
- *                 segment creation/deletion, and segment duplication.
+ *     Purpose:    Interface for the segmented memory system required for the
+ *                 Universal Machine. The segment table itself is provided by
+ *                 one of several interchangeable backends, chosen at compile
+ *                 time with the MEM_BACKEND Makefile variable:
+ *
+ *                     uarray - Hanson Seq_T of UArray_T segments
+ *                     sarray - Hanson Seq_T of plain word arrays
+ *                     flat   - a flat array of segment descriptors
+ *                     arena  - a flat table whose segments are carved from
+ *                              pooled arenas by size class
+ *
+ *                 Every backend describes a segment with the same Mem_segment
+ *                 descriptor and supplies Mem_segment_at as a static inline
+ *                 function in its header, so segmented loads and stores can
+ *                 be inlined into the interpreter whichever backend is used.
+ *
+ *                 Addresses and lengths are full 32-bit quantities, as
+ *                 registers are. Storage that cannot be had is reported on
+ *                 stderr and ends the UM (see Mem_allocation_failed).
  *
  *****************************************************************************/
 
@@ -18,27 +32,86 @@
 #define MEM_H
 
 #include <stdint.h>
-#include "uarray.h"
-#include "seq.h"
 
-typedef struct Mem_T {
-    Seq_T main_memory;
-    Seq_T deleted_addresses;
-} *Mem_T;
+#include <stddef.h>
+
+typedef uint32_t Mem_Address;
+
+/* The most segments a table may hold; the highest address is one less */
+#define MEM_MAX_SEGMENTS UINT32_MAX
+
+/* A segment: data points at capacity words, of which length are in use */
+typedef struct Mem_segment {
+    uint32_t *data;
+    uint32_t length;
+    uint32_t capacity;
+    int mapped;        /* storage came from Pages_alloc's mmap path */
+    int anonymous;     /* mapped by Pages_alloc itself, not adopted, so
+                          discarded pages read as zero */
+    void *storage;     /* backend-specific handle for the storage */
+} *Mem_segment;
 
-typedef int Mem_Address;
+typedef struct Mem_T *Mem_T;
 
-extern Mem_T Mem_new(); 
+#ifndef MEM_BACKEND_HEADER
+#define MEM_BACKEND_HEADER "mem_arena.h"
+#endif
+#include MEM_BACKEND_HEADER
+
+/* Implemented by each backend */
+extern Mem_T Mem_new(int program_page_flags);
 extern void Mem_free_memory(Mem_T *mem_p);
-extern Mem_Address Mem_create_segment(Mem_T mem, int length);
+extern void Mem_reset(Mem_T mem);
+extern Mem_Address Mem_create_segment(Mem_T mem, uint32_t length);
 extern void Mem_remove_segment(Mem_T mem, Mem_Address address);
-extern void Mem_update_word(Mem_T mem, Mem_Address address, int index,
-                            uint32_t value);
-extern uint32_t Mem_get_word(Mem_T mem, Mem_Address address, int index); 
-extern int Mem_duplicate_segment(Mem_T mem, Mem_Address address_to_dup,
-                                 Mem_Address address_to_replace); 
-extern UArray_T Mem_get_segment(Mem_T mem, Mem_Address address);
-extern uint32_t Mem_get_word_from_seg(UArray_T segment, int index); 
+extern void Mem_reserve(Mem_T mem, Mem_Address address, uint32_t length);
+extern int Mem_adopt_storage(Mem_T mem, Mem_Address address, uint32_t *data,
+                             int mapped);
+extern uint32_t Mem_num_segments(Mem_T mem);
+extern uint32_t Mem_num_free(Mem_T mem);
+extern Mem_Address Mem_free_at(Mem_T mem, uint32_t i);
+extern int Mem_enable_threads(Mem_T mem);
+extern const char *Mem_backend_name(void);
 
-#endif
+/* Implemented in memory.c on top of the backend */
+extern uint32_t Mem_duplicate_segment(Mem_T mem, Mem_Address address_to_dup,
+                                      Mem_Address address_to_replace);
+extern int Mem_segment_allocate(Mem_segment segment, uint32_t capacity,
+                                int page_flags);
+extern void Mem_segment_release(Mem_segment segment);
+extern void Mem_segment_clear(Mem_segment segment, uint32_t length);
+extern void Mem_segment_adopt(Mem_segment segment, uint32_t *data,
+                              int mapped);
+extern uint64_t Mem_segment_hash(Mem_segment segment);
+extern void Mem_allocation_failed(const char *what, size_t bytes);
 
+/* Mem_get_word
+ * Purpose:    Returns the value of the 32-bit word at the specified index
+ *             within the segment specified by the given address.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_Address address - address of an existing segment
+ *             uint32_t index - index of the word within the segment
+ * Returns:    uint32_t - the 32-bit word at the specified address/index
+ */
+static inline uint32_t Mem_get_word(Mem_T mem, Mem_Address address,
+                                    uint32_t index)
+{
+    return Mem_segment_at(mem, address)->data[index];
+}
+
+/* Mem_update_word
+ * Purpose:    Inserts a given 32-bit value into a segment corresponding with
+ *             a specified index.
+ * Parameters: Mem_T mem - an instance of Mem_T (must not be null)
+ *             Mem_Address address - address of an existing segment
+ *             uint32_t index - index of the word to update within the segment
+ *             uint32_t value - 32-bit updated value of the specified word
+ * Returns:    none
+ */
+static inline void Mem_update_word(Mem_T mem, Mem_Address address,
+                                   uint32_t index, uint32_t value)
+{
+    Mem_segment_at(mem, address)->data[index] = value;
+}
+
+#endif
@@ -0,0 +1,164 @@
+/******************************************************************************
+ *
+ *                                 pages.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the segment storage allocator outlined
+ *                 in pages.h. Large requests first try explicit hugetlb
+ *                 pages, then a 2MB-aligned anonymous mapping marked with
+ *                 MADV_HUGEPAGE for transparent huge pages, and finally fall
+ *                 back to malloc, so the UM runs the same on hosts without
+ *                 huge page support.
+ *
+ *****************************************************************************/
+
+#include <stdlib.h>
+#include <sys/mman.h>
+#include "pages.h"
+
+/* Requests of at least this many bytes are mapped; 0 disables mapping */
+static size_t huge_threshold = PAGES_HUGE_PAGE_SIZE;
+
+/* round_to_huge
+ * Purpose:    Rounds a byte count up to a whole number of huge pages.
+ * Parameters: size_t bytes - the number of bytes requested
+ * Returns:    size_t - the rounded size
+ */
+static size_t round_to_huge(size_t bytes)
+{
+    return (bytes + PAGES_HUGE_PAGE_SIZE - 1) &
+           ~(size_t)(PAGES_HUGE_PAGE_SIZE - 1);
+}
+
+/* map_aligned
+ * Purpose:    Maps an anonymous region of the given size whose start is
+ *             aligned to a huge page boundary, by over-allocating and
+ *             trimming the unaligned head and tail.
+ * Parameters: size_t bytes - the size of the region (a multiple of 2MB)
+ * Returns:    void * - the region, or NULL if mmap failed
+ * Notes:      Swap is not reserved for the region, so a segment far larger
+ *             than memory can be mapped and only the pages touched count.
+ */
+static void *map_aligned(size_t bytes)
+{
+    size_t padded = bytes + PAGES_HUGE_PAGE_SIZE;
+    char *raw = mmap(NULL, padded, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (raw == MAP_FAILED) {
+        return NULL;
+    }
+    uintptr_t start = ((uintptr_t)raw + PAGES_HUGE_PAGE_SIZE - 1) &
+                      ~(uintptr_t)(PAGES_HUGE_PAGE_SIZE - 1);
+    size_t head = start - (uintptr_t)raw;
+    if (head > 0) {
+        munmap(raw, head);
+    }
+    munmap((char *)start + bytes, padded - head - bytes);
+    return (void *)start;
+}
+
+/* Pages_set_threshold
+ * Purpose:    Sets the size at which allocations move to huge pages.
+ * Parameters: size_t threshold - size in bytes; 0 disables huge pages
+ * Returns:    none
+ */
+void Pages_set_threshold(size_t threshold)
+{
+    huge_threshold = threshold;
+}
+
+/* Pages_alloc
+ * Purpose:    Allocates storage for bytes bytes of segment data.
+ * Parameters: size_t bytes - the number of bytes needed
+ *             int flags - PAGES_HOT to use huge pages regardless of size
+ *                         (still subject to huge pages being enabled);
+ *                         PAGES_ALIGNED to map the storage even when huge
+ *                         pages are not used, and never from hugetlbfs,
+ *                         so each page of it can be mprotect'ed
+ *             int *mapped_p - set to 1 if the storage came from mmap (and
+ *                             must be released with Pages_free), else 0
+ * Returns:    uint32_t * - the storage, or NULL if allocation failed
+ * Notes:      Mapped storage is zero-filled; malloc'd storage is not.
+ */
+uint32_t *Pages_alloc(size_t bytes, int flags, int *mapped_p)
+{
+    *mapped_p = 0;
+    int huge = huge_threshold != 0 && bytes != 0 &&
+               ((flags & PAGES_HOT) || bytes >= huge_threshold);
+    if (!huge && !(flags & PAGES_ALIGNED)) {
+        return malloc(bytes);
+    }
+
+    size_t mapped_bytes = round_to_huge(bytes == 0 ? 1 : bytes);
+    void *region = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    if (huge && !(flags & PAGES_ALIGNED)) {
+        region = mmap(NULL, mapped_bytes, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+#endif
+    if (region == MAP_FAILED) {
+        region = map_aligned(mapped_bytes);
+        if (region == NULL) {
+            return (flags & PAGES_ALIGNED) ? NULL : malloc(bytes);
+        }
+#ifdef MADV_HUGEPAGE
+        if (huge) {
+            madvise(region, mapped_bytes, MADV_HUGEPAGE);
+        }
+#endif
+    }
+    *mapped_p = 1;
+    return region;
+}
+
+/* Pages_free
+ * Purpose:    Releases storage obtained from Pages_alloc.
+ * Parameters: uint32_t *data - the storage (may be NULL)
+ *             size_t bytes - the size passed to Pages_alloc
+ *             int mapped - the value Pages_alloc stored in *mapped_p
+ * Returns:    none
+ */
+void Pages_free(uint32_t *data, size_t bytes, int mapped)
+{
+    if (mapped) {
+        munmap(data, round_to_huge(bytes == 0 ? 1 : bytes));
+    } else {
+        free(data);
+    }
+}
+
+/* Pages_reserve
+ * Purpose:    Reserves address space for bytes bytes of segment data
+ *             without backing it: every access faults until the caller
+ *             mprotects it. Memory is only committed once the pages are
+ *             made accessible and touched.
+ * Parameters: size_t bytes - the number of bytes needed
+ * Returns:    uint32_t * - the region, page-aligned and releasable with
+ *             Pages_free as mapped storage, or NULL if mmap failed
+ */
+uint32_t *Pages_reserve(size_t bytes)
+{
+    void *region = mmap(NULL, round_to_huge(bytes == 0 ? 1 : bytes),
+                        PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS |
+                        MAP_NORESERVE, -1, 0);
+    return region == MAP_FAILED ? NULL : region;
+}
+
+/* Pages_map_private
+ * Purpose:    Maps a file as copy-on-write segment storage: pages are
+ *             shared with every other mapping of the file until written.
+ * Parameters: int fd - the file, at least bytes long
+ *             size_t bytes - the number of bytes to map
+ * Returns:    uint32_t * - the storage, releasable with Pages_free as
+ *             mapped storage, or NULL if mmap failed
+ */
+uint32_t *Pages_map_private(int fd, size_t bytes)
+{
+    void *region = mmap(NULL, round_to_huge(bytes == 0 ? 1 : bytes),
+                        PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    return region == MAP_FAILED ? NULL : region;
+}
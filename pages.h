@@ -0,0 +1,35 @@
+/******************************************************************************
+ *
+ *                                 pages.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for the allocator that backs segment storage.
+ *                 Small requests come from malloc; requests at or above a
+ *                 configurable threshold are placed in 2MB-aligned mmap
+ *                 regions backed by huge pages where the host allows it, so
+ *                 that large, hot segments cost fewer TLB entries.
+ *
+ *****************************************************************************/
+
+#ifndef PAGES_H
+#define PAGES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PAGES_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+/* Flags for Pages_alloc */
+#define PAGES_HOT 1      /* use huge pages at any size, if enabled */
+#define PAGES_ALIGNED 2  /* always mmap, so the storage can be mprotect'ed */
+
+extern void Pages_set_threshold(size_t threshold);
+extern uint32_t *Pages_alloc(size_t bytes, int flags, int *mapped_p);
+extern void Pages_free(uint32_t *data, size_t bytes, int mapped);
+extern uint32_t *Pages_reserve(size_t bytes);
+extern uint32_t *Pages_map_private(int fd, size_t bytes);
+
+#endif
@@ -0,0 +1,186 @@
+/******************************************************************************
+ *
+ *                               perfcount.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the performance counters outlined in
+ *                 perfcount.h, using perf_event_open. Each counter is
+ *                 opened on its own rather than as a group, so one the
+ *                 host lacks does not take the others down with it. When
+ *                 the hardware has fewer counters than requested, the
+ *                 kernel time-shares them, and each count is scaled up by
+ *                 the fraction of the run it was actually counting.
+ *                 Kernel and hypervisor events are excluded, which keeps
+ *                 the counters usable at the default paranoia level.
+ *
+ *****************************************************************************/
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "perfcount.h"
+
+#define NUM_COUNTERS 6
+#define CACHE_MISS(cache) (PERF_COUNT_HW_CACHE_##cache | \
+                           (PERF_COUNT_HW_CACHE_OP_READ << 8) | \
+                           (PERF_COUNT_HW_CACHE_RESULT_MISS << 16))
+
+typedef struct Counter {
+    const char *name;
+    uint32_t type;
+    uint64_t config;
+    int fd;              /* -1 if unavailable */
+    uint64_t start;      /* scaled count when the last run started */
+    uint64_t stop;       /* scaled count when it stopped */
+} Counter;
+
+static Counter counters[NUM_COUNTERS] = {
+    { "cycles",        PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES,
+      -1, 0, 0 },
+    { "instructions",  PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS,
+      -1, 0, 0 },
+    { "branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES,
+      -1, 0, 0 },
+    { "L1d-misses",    PERF_TYPE_HW_CACHE, CACHE_MISS(L1D), -1, 0, 0 },
+    { "LLC-misses",    PERF_TYPE_HW_CACHE, CACHE_MISS(LL), -1, 0, 0 },
+    { "dTLB-misses",   PERF_TYPE_HW_CACHE, CACHE_MISS(DTLB), -1, 0, 0 }
+};
+
+static int num_open = 0;
+
+/* read_counter
+ * Purpose:    Reads a counter, scaled for the time it was not scheduled.
+ * Parameters: Counter *counter - an open counter
+ * Returns:    uint64_t - the count since the counter was opened
+ */
+static uint64_t read_counter(Counter *counter)
+{
+    /* value, time enabled, time running */
+    uint64_t values[3];
+    if (read(counter->fd, values, sizeof(values)) != sizeof(values) ||
+        values[2] == 0) {
+        return 0;
+    }
+    if (values[2] == values[1]) {
+        return values[0];
+    }
+    return (uint64_t)((double)values[0] * values[1] / values[2]);
+}
+
+/* Perfcount_open
+ * Purpose:    Opens every counter the host provides, disabled.
+ * Parameters: none
+ * Returns:    none
+ * Notes:      Says so on stderr if no counter could be opened.
+ */
+void Perfcount_open(void)
+{
+    int error = 0;
+    for (int i = 0; i < NUM_COUNTERS; i++) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = counters[i].type;
+        attr.config = counters[i].config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED |
+                           PERF_FORMAT_TOTAL_TIME_RUNNING;
+        counters[i].fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1,
+                                 PERF_FLAG_FD_CLOEXEC);
+        if (counters[i].fd < 0) {
+            error = errno;
+        } else {
+            num_open++;
+        }
+    }
+    if (num_open == 0) {
+        fprintf(stderr, "Performance counters are unavailable: %s.\n",
+                strerror(error));
+    }
+}
+
+/* Perfcount_start
+ * Purpose:    Starts counting a run.
+ * Parameters: none
+ * Returns:    none
+ */
+void Perfcount_start(void)
+{
+    for (int i = 0; i < NUM_COUNTERS; i++) {
+        if (counters[i].fd >= 0) {
+            counters[i].start = read_counter(&counters[i]);
+            ioctl(counters[i].fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+/* Perfcount_stop
+ * Purpose:    Stops counting, at the end of a run.
+ * Parameters: none
+ * Returns:    none
+ */
+void Perfcount_stop(void)
+{
+    for (int i = 0; i < NUM_COUNTERS; i++) {
+        if (counters[i].fd >= 0) {
+            ioctl(counters[i].fd, PERF_EVENT_IOC_DISABLE, 0);
+            counters[i].stop = read_counter(&counters[i]);
+        }
+    }
+}
+
+/* Perfcount_report
+ * Purpose:    Writes the counts of the last run to stderr, in total and
+ *             per million UM instructions.
+ * Parameters: uint64_t um_instructions - UM instructions the run retired
+ * Returns:    none
+ */
+void Perfcount_report(uint64_t um_instructions)
+{
+    if (num_open == 0) {
+        return;
+    }
+    fprintf(stderr, "%-14s %16s %16s\n", "counter", "count",
+            "per M UM instr");
+    for (int i = 0; i < NUM_COUNTERS; i++) {
+        if (counters[i].fd < 0) {
+            fprintf(stderr, "%-14s %16s\n", counters[i].name,
+                    "unavailable");
+            continue;
+        }
+        uint64_t count = counters[i].stop - counters[i].start;
+        fprintf(stderr, "%-14s %16llu", counters[i].name,
+                (unsigned long long)count);
+        if (um_instructions > 0) {
+            fprintf(stderr, " %16.1f", count * 1e6 / um_instructions);
+        }
+        fprintf(stderr, "\n");
+    }
+    fprintf(stderr, "%-14s %16llu\n", "UM instr",
+            (unsigned long long)um_instructions);
+}
+
+/* Perfcount_close
+ * Purpose:    Closes every counter.
+ * Parameters: none
+ * Returns:    none
+ */
+void Perfcount_close(void)
+{
+    for (int i = 0; i < NUM_COUNTERS; i++) {
+        if (counters[i].fd >= 0) {
+            close(counters[i].fd);
+            counters[i].fd = -1;
+        }
+    }
+    num_open = 0;
+}
@@ -0,0 +1,31 @@
+/******************************************************************************
+ *
+ *                               perfcount.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for the hardware performance counters of a
+ *                 run: cycles, instructions, branch misses, L1 data and
+ *                 last-level cache misses, and data TLB misses. They count
+ *                 only while the interpreter executes, not while the
+ *                 program file is read, and are reported both per run and
+ *                 per million UM instructions. Counters the host does not
+ *                 provide are reported as unavailable; the run goes on
+ *                 either way.
+ *
+ *****************************************************************************/
+
+#ifndef PERFCOUNT_H
+#define PERFCOUNT_H
+
+#include <stdint.h>
+
+extern void Perfcount_open(void);
+extern void Perfcount_start(void);
+extern void Perfcount_stop(void);
+extern void Perfcount_report(uint64_t um_instructions);
+extern void Perfcount_close(void);
+
+#endif
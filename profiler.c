@@ -0,0 +1,245 @@
+/******************************************************************************
+ *
+ *                                profiler.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the sampling profiler outlined in
+ *                 profiler.h. The signal handler only increments a counter;
+ *                 all bookkeeping happens on the interpreter thread in an
+ *                 open-addressing hash table keyed by (image, block). At
+ *                 exit every block is written as one folded-stack line,
+ *
+ *                     image-<hash>;block-<start>-<end> <samples>
+ *
+ *                 which flamegraph tools accept directly.
+ *
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include "profiler.h"
+#include "assert.h"
+
+#define INITIAL_SLOTS 1024
+#define FNV_OFFSET 2166136261u
+#define FNV_PRIME 16777619u
+
+typedef struct Profile_entry {
+    uint32_t image_hash;
+    uint32_t block_pc;
+    uint32_t end_pc;
+    uint64_t samples;
+} Profile_entry;
+
+volatile sig_atomic_t Profiler_pending = 0;
+
+static Profile_entry *table = NULL;
+static size_t num_slots = 0;
+static size_t num_entries = 0;
+static uint32_t current_image = 0;
+static const char *report_name = NULL;
+
+/* tick_handler
+ * Purpose:    Counts a SIGPROF tick for the interpreter to charge later.
+ * Parameters: int signum - SIGPROF
+ * Returns:    none
+ */
+static void tick_handler(int signum)
+{
+    Profiler_pending++;
+    (void)signum;
+}
+
+/* slot_for
+ * Purpose:    Finds the slot holding a block, or the empty slot where it
+ *             belongs.
+ * Parameters: Profile_entry *slots - the table
+ *             size_t capacity - the number of slots (a power of two)
+ *             uint32_t image_hash - the program image
+ *             uint32_t block_pc - the block's starting program counter
+ * Returns:    Profile_entry * - the slot
+ */
+static Profile_entry *slot_for(Profile_entry *slots, size_t capacity,
+                               uint32_t image_hash, uint32_t block_pc)
+{
+    size_t i = ((image_hash ^ (block_pc * 2654435761u)) & (capacity - 1));
+    while (slots[i].samples != 0 &&
+           (slots[i].image_hash != image_hash ||
+            slots[i].block_pc != block_pc)) {
+        i = (i + 1) & (capacity - 1);
+    }
+    return &slots[i];
+}
+
+/* grow_table
+ * Purpose:    Doubles the hash table and rehashes every entry.
+ * Parameters: none
+ * Returns:    none
+ */
+static void grow_table(void)
+{
+    size_t new_slots = num_slots * 2;
+    Profile_entry *new_table = calloc(new_slots, sizeof(*new_table));
+    assert(new_table != NULL);
+    for (size_t i = 0; i < num_slots; i++) {
+        if (table[i].samples != 0) {
+            *slot_for(new_table, new_slots, table[i].image_hash,
+                      table[i].block_pc) = table[i];
+        }
+    }
+    free(table);
+    table = new_table;
+    num_slots = new_slots;
+}
+
+/* Profiler_start
+ * Purpose:    Starts sampling the UM every interval_us microseconds of CPU
+ *             time.
+ * Parameters: const char *report_filename - where the report is written at
+ *                                           exit ("-" for stderr)
+ *             unsigned interval_us - the sampling interval
+ * Returns:    none
+ */
+void Profiler_start(const char *report_filename, unsigned interval_us)
+{
+    report_name = report_filename;
+    num_slots = INITIAL_SLOTS;
+    table = calloc(num_slots, sizeof(*table));
+    assert(table != NULL);
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = tick_handler;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGPROF, &action, NULL);
+
+    struct itimerval timer;
+    timer.it_interval.tv_sec = interval_us / 1000000;
+    timer.it_interval.tv_usec = interval_us % 1000000;
+    timer.it_value = timer.it_interval;
+    setitimer(ITIMER_PROF, &timer, NULL);
+
+    atexit(Profiler_stop);
+}
+
+/* Profiler_hash_image
+ * Purpose:    Computes the identity of a program image (FNV-1a over its
+ *             words and length).
+ * Parameters: const uint32_t *code - the contents of segment 0
+ *             size_t length - the number of words
+ * Returns:    uint32_t - the hash
+ */
+uint32_t Profiler_hash_image(const uint32_t *code, size_t length)
+{
+    uint32_t hash = FNV_OFFSET;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ code[i]) * FNV_PRIME;
+    }
+    return (hash ^ (uint32_t)length) * FNV_PRIME;
+}
+
+/* Profiler_set_image
+ * Purpose:    Records which program image later samples belong to; called
+ *             whenever segment 0 is replaced.
+ * Parameters: uint32_t image_hash - from Profiler_hash_image
+ * Returns:    none
+ */
+void Profiler_set_image(uint32_t image_hash)
+{
+    current_image = image_hash;
+}
+
+/* Profiler_sample
+ * Purpose:    Charges every pending tick to the block that just finished.
+ * Parameters: uint32_t block_pc - the program counter the block started at
+ *             uint32_t end_pc - the program counter of the block's LOADP
+ * Returns:    none
+ */
+void Profiler_sample(uint32_t block_pc, uint32_t end_pc)
+{
+    sig_atomic_t ticks = Profiler_pending;
+    Profiler_pending = 0;
+    if (ticks <= 0 || table == NULL) {
+        return;
+    }
+    if (2 * (num_entries + 1) > num_slots) {
+        grow_table();
+    }
+    Profile_entry *entry = slot_for(table, num_slots, current_image,
+                                    block_pc);
+    if (entry->samples == 0) {
+        entry->image_hash = current_image;
+        entry->block_pc = block_pc;
+        num_entries++;
+    }
+    if (end_pc > entry->end_pc) {
+        entry->end_pc = end_pc;
+    }
+    entry->samples += ticks;
+}
+
+/* compare_entries
+ * Purpose:    qsort comparison placing the hottest blocks first.
+ * Parameters: const void *a, const void *b - Profile_entry pointers
+ * Returns:    int - negative, zero or positive
+ */
+static int compare_entries(const void *a, const void *b)
+{
+    const Profile_entry *x = a;
+    const Profile_entry *y = b;
+    if (x->samples != y->samples) {
+        return x->samples < y->samples ? 1 : -1;
+    }
+    if (x->image_hash != y->image_hash) {
+        return x->image_hash < y->image_hash ? -1 : 1;
+    }
+    return x->block_pc < y->block_pc ? -1 : (x->block_pc > y->block_pc);
+}
+
+/* Profiler_stop
+ * Purpose:    Stops the timer and writes the report. Safe to call more than
+ *             once.
+ * Parameters: none
+ * Returns:    none
+ */
+void Profiler_stop(void)
+{
+    if (table == NULL) {
+        return;
+    }
+    struct itimerval off;
+    memset(&off, 0, sizeof(off));
+    setitimer(ITIMER_PROF, &off, NULL);
+
+    FILE *fp = strcmp(report_name, "-") == 0 ? stderr
+                                              : fopen(report_name, "w");
+    if (fp == NULL) {
+        fprintf(stderr, "Could not write profile to %s.\n", report_name);
+    } else {
+        /* Compact the table so the entries can be sorted in place */
+        size_t n = 0;
+        for (size_t i = 0; i < num_slots; i++) {
+            if (table[i].samples != 0) {
+                table[n++] = table[i];
+            }
+        }
+        qsort(table, n, sizeof(*table), compare_entries);
+        for (size_t i = 0; i < n; i++) {
+            fprintf(fp, "image-%08x;block-%u-%u %llu\n",
+                    table[i].image_hash, table[i].block_pc,
+                    table[i].end_pc,
+                    (unsigned long long)table[i].samples);
+        }
+        if (fp != stderr) {
+            fclose(fp);
+        }
+    }
+    free(table);
+    table = NULL;
+}
@@ -0,0 +1,35 @@
+/******************************************************************************
+ *
+ *                                profiler.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for the sampling profiler. A SIGPROF timer
+ *                 raises Profiler_pending; the interpreter checks it at
+ *                 each block boundary and charges the samples to the basic
+ *                 block that was running, identified by a hash of the
+ *                 loaded program image and the block's starting program
+ *                 counter. The report is written in folded-stack format.
+ *
+ *****************************************************************************/
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <signal.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Number of SIGPROF ticks not yet charged to a block */
+extern volatile sig_atomic_t Profiler_pending;
+
+extern void Profiler_start(const char *report_filename,
+                           unsigned interval_us);
+extern uint32_t Profiler_hash_image(const uint32_t *code, size_t length);
+extern void Profiler_set_image(uint32_t image_hash);
+extern void Profiler_sample(uint32_t block_pc, uint32_t end_pc);
+extern void Profiler_stop(void);
+
+#endif
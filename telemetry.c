@@ -0,0 +1,217 @@
+/******************************************************************************
+ *
+ *                               telemetry.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the live statistics block outlined in
+ *                 telemetry.h. Without telemetry the counters live in a
+ *                 private static block; with it, in a shared-memory file
+ *                 named after the process id that is removed again when
+ *                 the UM exits.
+ *
+ *****************************************************************************/
+
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "telemetry.h"
+
+#define NAME_LENGTH 64
+#define DUMP_LENGTH 1024
+
+static Telemetry_stats private_stats;
+Telemetry_stats *Telemetry = &private_stats;
+
+static char shared_name[NAME_LENGTH];
+static int shared = 0;
+
+/* Telemetry_now_ns
+ * Purpose:    Reads the monotonic clock.
+ * Parameters: none
+ * Returns:    uint64_t - the time in nanoseconds
+ */
+uint64_t Telemetry_now_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+/* append_text
+ * Purpose:    Appends a string to a buffer without using stdio, so it can
+ *             be called from a signal handler.
+ * Parameters: char *buffer - the buffer (size DUMP_LENGTH)
+ *             size_t *length_p - the current length, updated
+ *             const char *text - the string to append
+ * Returns:    none
+ */
+static void append_text(char *buffer, size_t *length_p, const char *text)
+{
+    while (*text != '\0' && *length_p < DUMP_LENGTH) {
+        buffer[(*length_p)++] = *text++;
+    }
+}
+
+/* append_number
+ * Purpose:    Appends a labelled decimal number and a newline to a buffer,
+ *             without using stdio.
+ * Parameters: char *buffer - the buffer (size DUMP_LENGTH)
+ *             size_t *length_p - the current length, updated
+ *             const char *label - text printed before the number
+ *             uint64_t value - the number
+ * Returns:    none
+ */
+static void append_number(char *buffer, size_t *length_p, const char *label,
+                          uint64_t value)
+{
+    char digits[24];
+    int n = 0;
+    do {
+        digits[n++] = '0' + value % 10;
+        value /= 10;
+    } while (value > 0);
+
+    append_text(buffer, length_p, label);
+    while (n > 0 && *length_p < DUMP_LENGTH) {
+        buffer[(*length_p)++] = digits[--n];
+    }
+    append_text(buffer, length_p, "\n");
+}
+
+/* Telemetry_dump
+ * Purpose:    Writes the statistics block to stderr.
+ * Parameters: none
+ * Returns:    none
+ * Notes:      Safe to call from a signal handler.
+ */
+void Telemetry_dump(void)
+{
+    static const char *states[] = { "running", "waiting for input",
+                                    "halted" };
+    Telemetry_stats *stats = Telemetry;
+    char buffer[DUMP_LENGTH];
+    size_t length = 0;
+    uint64_t elapsed_ms = (Telemetry_now_ns() - stats->start_ns) / 1000000;
+    uint64_t ips = elapsed_ms == 0 ? 0 : stats->instructions_retired *
+                                         1000 / elapsed_ms;
+
+    append_number(buffer, &length, "um pid ", stats->pid);
+    append_text(buffer, &length, "  state               ");
+    append_text(buffer, &length, states[stats->state % 3]);
+    append_text(buffer, &length, "\n");
+    append_number(buffer, &length, "  elapsed ms          ", elapsed_ms);
+    append_number(buffer, &length, "  instructions        ",
+                  stats->instructions_retired);
+    append_number(buffer, &length, "  instructions/sec    ", ips);
+    append_number(buffer, &length, "  last block pc       ", stats->block_pc);
+    append_number(buffer, &length, "  live segments       ",
+                  stats->live_segments);
+    append_number(buffer, &length, "  free segments       ",
+                  stats->free_segments);
+    append_number(buffer, &length, "  bytes allocated     ",
+                  stats->bytes_allocated);
+    append_number(buffer, &length, "  LOADP copies        ",
+                  stats->loadp_copies);
+    append_number(buffer, &length, "  bytes in            ", stats->bytes_in);
+    append_number(buffer, &length, "  bytes out           ",
+                  stats->bytes_out);
+    append_number(buffer, &length, "  cold segments       ",
+                  stats->cold_segments);
+    append_number(buffer, &length, "  cold bytes saved    ",
+                  stats->cold_bytes_saved);
+    append_number(buffer, &length, "  dedup bytes saved   ",
+                  stats->dedup_bytes_saved);
+    append_number(buffer, &length, "  LOADP words copied  ",
+                  stats->loadp_words_copied);
+    append_number(buffer, &length, "  map words zeroed    ",
+                  stats->map_words_zeroed);
+    append_number(buffer, &length, "  table growth copies ",
+                  stats->table_entries_copied);
+    append_number(buffer, &length, "  storage words copied",
+                  stats->storage_words_copied);
+    append_number(buffer, &length, "  allocations         ",
+                  stats->allocations);
+    if (write(STDERR_FILENO, buffer, length) < 0) {
+        /* Nothing sensible to do from a signal handler */
+    }
+}
+
+/* dump_handler
+ * Purpose:    Writes the statistics block to stderr on SIGUSR1.
+ * Parameters: int signum - SIGUSR1
+ * Returns:    none
+ */
+static void dump_handler(int signum)
+{
+    Telemetry_dump();
+    (void)signum;
+}
+
+/* Telemetry_init
+ * Purpose:    Starts the statistics block and installs the SIGUSR1 dump.
+ * Parameters: int shared_block - nonzero to place the block in /dev/shm so
+ *                                other processes can read it
+ * Returns:    none
+ * Notes:      Falls back to a private block (with a warning) if the
+ *             shared-memory file cannot be created.
+ */
+void Telemetry_init(int shared_block)
+{
+    if (shared_block) {
+        snprintf(shared_name, NAME_LENGTH, TELEMETRY_NAME_FORMAT,
+                 (long)getpid());
+        int fd = shm_open(shared_name, O_CREAT | O_RDWR | O_TRUNC, 0644);
+        void *block = MAP_FAILED;
+        if (fd >= 0) {
+            if (ftruncate(fd, sizeof(Telemetry_stats)) == 0) {
+                block = mmap(NULL, sizeof(Telemetry_stats),
+                             PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            }
+            close(fd);
+        }
+        if (block == MAP_FAILED) {
+            fprintf(stderr, "Warning: could not create /dev/shm%s; "
+                    "telemetry is only available via SIGUSR1.\n",
+                    shared_name);
+            if (fd >= 0) {
+                shm_unlink(shared_name);
+            }
+        } else {
+            Telemetry = block;
+            shared = 1;
+        }
+    }
+
+    memset((void *)Telemetry, 0, sizeof(*Telemetry));
+    Telemetry->version = TELEMETRY_VERSION;
+    Telemetry->pid = getpid();
+    Telemetry->start_ns = Telemetry_now_ns();
+    Telemetry->state = TELEMETRY_RUNNING;
+    __atomic_store_n(&Telemetry->magic, TELEMETRY_MAGIC, __ATOMIC_RELEASE);
+    signal(SIGUSR1, dump_handler);
+
+    /* Covers every exit path, including errors */
+    atexit(Telemetry_close);
+}
+
+/* Telemetry_close
+ * Purpose:    Marks the machine halted and removes the shared-memory file.
+ * Parameters: none
+ * Returns:    none
+ */
+void Telemetry_close(void)
+{
+    Telemetry->state = TELEMETRY_HALTED;
+    if (shared) {
+        shm_unlink(shared_name);
+        shared = 0;
+    }
+}
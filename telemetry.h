@@ -0,0 +1,66 @@
+/******************************************************************************
+ *
+ *                               telemetry.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for the live statistics block of a running UM.
+ *                 The interpreter updates the counters in place as it runs
+ *                 (instruction counts at block boundaries, the rest as the
+ *                 corresponding events happen). When telemetry is enabled
+ *                 the block lives in a shared-memory file under /dev/shm so
+ *                 that the umstat tool can read it without stopping the
+ *                 machine, and SIGUSR1 dumps it to stderr.
+ *
+ *****************************************************************************/
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+#include <sys/types.h>
+
+#define TELEMETRY_MAGIC 0x554d5354   /* "UMST" */
+#define TELEMETRY_VERSION 4
+#define TELEMETRY_NAME_FORMAT "/um.%ld"
+
+typedef enum Telemetry_state {
+    TELEMETRY_RUNNING = 0, TELEMETRY_WAITING_INPUT, TELEMETRY_HALTED
+} Telemetry_state;
+
+typedef struct Telemetry_stats {
+    uint32_t magic;
+    uint32_t version;
+    int64_t pid;
+    uint64_t start_ns;              /* CLOCK_MONOTONIC at start */
+    volatile uint32_t state;
+    volatile uint32_t block_pc;     /* target of the most recent LOADP */
+    volatile uint64_t instructions_retired;
+    volatile uint64_t live_segments;
+    volatile uint64_t free_segments;
+    volatile uint64_t bytes_allocated;
+    volatile uint64_t loadp_copies;
+    volatile uint64_t bytes_in;
+    volatile uint64_t bytes_out;
+    volatile uint64_t cold_segments;   /* held compressed */
+    volatile uint64_t cold_bytes_saved;
+    volatile uint64_t dedup_bytes_saved;
+    /* Memory management work, for the cost vector (see costmodel.h) */
+    volatile uint64_t loadp_words_copied;
+    volatile uint64_t map_words_zeroed;
+    volatile uint64_t table_entries_copied;
+    volatile uint64_t storage_words_copied;
+    volatile uint64_t allocations;
+} Telemetry_stats;
+
+/* Always points at a valid block, so updates need no checks */
+extern Telemetry_stats *Telemetry;
+
+extern void Telemetry_init(int shared);
+extern void Telemetry_close(void);
+extern void Telemetry_dump(void);
+extern uint64_t Telemetry_now_ns(void);
+
+#endif
@@ -0,0 +1,40 @@
+#! /bin/bash
+#
+# backend_matrix.sh
+#
+# Builds one UM per memory backend (make um-backends) and runs benchmark.sh
+# against each, printing one column per backend. Any arguments are passed
+# to the UM as options, e.g.
+#
+#     ./backend_matrix.sh
+#     ./backend_matrix.sh --hugepage-threshold 0
+#
+# Environment: BACKENDS selects the backends (default all four), MAKE the
+# make command; REPS and PROGRAMS are passed on to benchmark.sh.
+#
+BACKENDS=${BACKENDS:-"uarray sarray flat arena"}
+MAKE=${MAKE:-make}
+
+cd "$(dirname "$0")"
+(cd .. && $MAKE $(printf "um-%s " $BACKENDS) > /dev/null) || exit 1
+
+results=$(mktemp -d)
+trap 'rm -rf "$results"' EXIT
+
+for backend in $BACKENDS ; do
+    UM=../um-$backend ./benchmark.sh "$@" > "$results/$backend"
+done
+
+printf "%-14s" "program"
+for backend in $BACKENDS ; do
+    printf " %9s" "$backend"
+done
+printf "\n"
+for program in $(awk '{ print $1 }' "$results/${BACKENDS%% *}") ; do
+    printf "%-14s" "$program"
+    for backend in $BACKENDS ; do
+        printf " %9s" "$(awk -v p="$program" '$1 == p { print $2 }' \
+                             "$results/$backend")"
+    done
+    printf "\n"
+done
@@ -0,0 +1,33 @@
+#! /bin/bash
+#
+# backend_tests.sh
+#
+# Runs the unit tests (see run_tests.sh) against a UM built with each memory
+# backend (make um-backends). The backends differ in what they keep of an
+# unmapped segment's storage, which is the case to watch after --dedup or
+# --map-file has given a segment storage of its own. Tests of what a backend
+# does not support are skipped: only arena runs UM threads, the cost test's
+# allocation count is arena's, and uarray can neither map files nor
+# protect segment 0.
+#
+# Environment: BACKENDS selects the backends (default all four), MAKE the
+# make command.
+#
+BACKENDS=${BACKENDS:-"arena flat sarray uarray"}
+MAKE=${MAKE:-make}
+
+cd "$(dirname "$0")"
+(cd .. && $MAKE $(printf "um-%s " $BACKENDS) > /dev/null) || exit 1
+
+for backend in $BACKENDS ; do
+    case $backend in
+        arena)  skip="" ;;
+        flat)   skip="spawn-join" ;;
+        sarray) skip="spawn-join cost" ;;
+        *)      skip="spawn-join cost map-file map-file-empty"
+                skip="$skip map-file-remap self-modify-protected"
+                skip="$skip self-modify-idiom-protected" ;;
+    esac
+    echo "MEM_BACKEND=$backend"
+    SKIP="$skip" UM=../um-$backend bash run_tests.sh
+done
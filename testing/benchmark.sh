@@ -0,0 +1,40 @@
+#! /bin/bash
+#
+# benchmark.sh
+#
+# Times the UM on the umbin benchmark programs. Any arguments are passed to
+# the UM as options, so two configurations can be compared directly, e.g.
+#
+#     ./benchmark.sh
+#     ./benchmark.sh --hugepage-threshold 0
+#
+# Environment: UM selects the binary (default ../um), REPS the number of
+# runs per program (default 3; the fastest run is reported), and PROGRAMS
+# the programs to run.
+#
+UM=${UM:-../um}
+REPS=${REPS:-3}
+PROGRAMS=${PROGRAMS:-"midmark.um sandmark.umz advent.umz codex.umz"}
+BIN=../umbin
+
+cd "$(dirname "$0")"
+if [ "$UM" = "../um" ] ; then
+    (cd .. && make um > /dev/null) || exit 1
+fi
+
+TIMEFORMAT=%R
+for program in $PROGRAMS ; do
+    name=$(echo $program | sed -E 's/\.umz?$//')
+    input=/dev/null
+    if [ -f "$BIN/${name}.0" ] ; then
+        input="$BIN/${name}.0"
+    fi
+    best=""
+    for i in $(seq $REPS) ; do
+        elapsed=$( { time "$UM" "$@" "$BIN/$program" < "$input" \
+                          > /dev/null 2> /dev/null ; } 2>&1 )
+        best=$(awk -v a="$elapsed" -v b="$best" \
+                   'BEGIN { print (b == "" || a + 0 < b + 0) ? a : b }')
+    done
+    printf "%-14s %8ss\n" "$program" "$best"
+done
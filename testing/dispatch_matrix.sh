@@ -0,0 +1,51 @@
+#! /bin/bash
+#
+# dispatch_matrix.sh
+#
+# Measures the dispatch-table size vs. speed tradeoff of the generated
+# interpreter switch (see gen_dispatch.c). The UM is built once per
+# SPECIALIZE level; for each build the number of dispatch keys (cases),
+# the size of the jump table, the text size of the interpreter and the
+# benchmark.sh times are printed. Any arguments are passed to the UM.
+#
+# Environment: LEVELS selects the SPECIALIZE levels (default "none hot
+# all"), MAKE the make command; REPS and PROGRAMS are passed on to
+# benchmark.sh. The default build is restored afterwards.
+#
+LEVELS=${LEVELS:-"none hot all"}
+MAKE=${MAKE:-make}
+
+cd "$(dirname "$0")"
+builds=$(mktemp -d)
+trap 'rm -rf "$builds"' EXIT
+
+for level in $LEVELS ; do
+    (cd .. && $MAKE SPECIALIZE="$level" um > /dev/null) || exit 1
+    cp ../um "$builds/um-$level"
+    keys=$(awk '/DISPATCH_NUM_KEYS/ { print $3 }' ../dispatch_table.h)
+    text=$(size ../instruction_executor.o | awk 'NR == 2 { print $1 }')
+    echo "$keys $((keys * 4)) $text" > "$builds/size-$level"
+    UM="$builds/um-$level" ./benchmark.sh "$@" > "$builds/times-$level"
+done
+(cd .. && $MAKE um > /dev/null)
+
+printf "%-14s" "level"
+for level in $LEVELS ; do
+    printf " %9s" "$level"
+done
+printf "\n"
+for row in 1:keys 2:table 3:text ; do
+    printf "%-14s" "${row#*:}"
+    for level in $LEVELS ; do
+        printf " %9s" "$(cut -d' ' -f${row%%:*} "$builds/size-$level")"
+    done
+    printf "\n"
+done
+for program in $(awk '{ print $1 }' "$builds/times-${LEVELS%% *}") ; do
+    printf "%-14s" "$program"
+    for level in $LEVELS ; do
+        printf " %9s" "$(awk -v p="$program" '$1 == p { print $2 }' \
+                             "$builds/times-$level")"
+    done
+    printf "\n"
+done
@@ -0,0 +1,30 @@
+#! /bin/bash
+#
+# dispatch_tests.sh
+#
+# Runs the unit tests (see run_tests.sh) against a UM built at each of
+# several SPECIALIZE levels (see gen_dispatch.c). Which opcodes have cases
+# of their own changes how the interpreter decodes, and so how it keeps up
+# with self-modifying code; lifting one idiom without the rest of "all"
+# is the case to watch. The default build is restored afterwards.
+#
+# Environment: LEVELS selects the SPECIALIZE levels (default "none hot all
+# AND ADDNOT OR XOR SUB"), MAKE the make command.
+#
+LEVELS=${LEVELS:-"none hot all AND ADDNOT OR XOR SUB"}
+MAKE=${MAKE:-make}
+
+cd "$(dirname "$0")"
+builds=$(mktemp -d)
+trap 'rm -rf "$builds"' EXIT
+
+for level in $LEVELS ; do
+    (cd .. && $MAKE SPECIALIZE="$level" um > /dev/null) || exit 1
+    cp ../um "$builds/um-$level"
+done
+(cd .. && $MAKE um > /dev/null)
+
+for level in $LEVELS ; do
+    echo "SPECIALIZE=$level"
+    UM="$builds/um-$level" bash run_tests.sh
+done
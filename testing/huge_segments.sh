@@ -0,0 +1,75 @@
+#! /bin/bash
+#
+# huge_segments.sh
+#
+# Checks that mapping huge segments stays lazy. The program it writes maps
+# eight segments of 2^32-1 words, stores a letter in the last word of each,
+# loads it back and prints it; only the pages it touches should ever be
+# backed. Builds one UM per memory backend (as backend_matrix.sh does) and
+# prints, for each, the time, the peak RSS (when /usr/bin/time is there)
+# and whether the output was right within the time limit. The uarray
+# backend is expected to reject segments of more than 2^29-1 words.
+#
+# Environment: BACKENDS selects the backends (default all four), MAKE the
+# make command, and LIMIT the seconds each run is allowed (default 10).
+#
+BACKENDS=${BACKENDS:-"uarray sarray flat arena"}
+MAKE=${MAKE:-make}
+LIMIT=${LIMIT:-10}
+
+cd "$(dirname "$0")"
+(cd .. && $MAKE $(printf "um-%s " $BACKENDS) > /dev/null) || exit 1
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+# word N: writes N as a big-endian 32-bit word
+word() {
+    printf "$(printf '\\%03o\\%03o\\%03o\\%03o' \
+               $(($1 >> 24 & 255)) $(($1 >> 16 & 255)) \
+               $(($1 >> 8 & 255)) $(($1 & 255)))"
+}
+three_register() { word $(($1 << 28 | $2 << 6 | $3 << 3 | $4)) ; }
+loadval() { word $((13 << 28 | $1 << 25 | $2)) ; }
+
+{
+    loadval 0 0
+    three_register 6 1 0 0              # r1 = ~0, the length
+    loadval 4 1
+    three_register 6 4 4 4              # r4 = ~1, the last word
+    for letter in a b c d e f g h ; do
+        three_register 8 0 2 1          # r2 = map r1 words
+        loadval 5 $(printf "%d" "'$letter")
+        three_register 2 2 4 5          # m[r2][r4] = r5
+        three_register 1 6 2 4          # r6 = m[r2][r4]
+        three_register 10 0 0 6         # output r6
+    done
+    word $((7 << 28))                   # halt
+} > "$work/huge.um"
+
+if [ -x /usr/bin/time ] ; then
+    measure() { /usr/bin/time -f "%e %M" -o "$work/usage" "$@" ; }
+else
+    measure() { "$@" ; }
+fi
+
+TIMEFORMAT=%R
+printf "%-8s %8s %10s  %s\n" "backend" "seconds" "peak_kb" "result"
+for backend in $BACKENDS ; do
+    rm -f "$work/usage"
+    elapsed=$( { time measure timeout $LIMIT ../um-$backend "$work/huge.um" \
+                      < /dev/null > "$work/out" 2> "$work/err" ; } 2>&1 )
+    status=$?
+    peak=-
+    if [ -f "$work/usage" ] ; then
+        peak=$(awk 'END { print $2 }' "$work/usage")
+    fi
+    if [ "$(cat "$work/out")" = "abcdefgh" ] ; then
+        result=lazy
+    elif [ $status = 124 ] ; then
+        result="timed out after ${LIMIT}s"
+    else
+        result="failed: $(head -1 "$work/err")"
+    fi
+    printf "%-8s %8s %10s  %s\n" $backend $elapsed $peak "$result"
+done
@@ -0,0 +1,28 @@
+#! /bin/bash
+#
+# pgo_speedup.sh
+#
+# Builds the regular UM and the profile-guided, link-time optimized one
+# (make um um-pgo), runs benchmark.sh against both and prints their times
+# side by side with the speedup of um-pgo. Any arguments are passed to the
+# UM as options.
+#
+# Environment: MAKE the make command; REPS and PROGRAMS are passed on to
+# benchmark.sh.
+#
+MAKE=${MAKE:-make}
+
+cd "$(dirname "$0")"
+(cd .. && $MAKE um um-pgo > /dev/null) || exit 1
+
+results=$(mktemp -d)
+trap 'rm -rf "$results"' EXIT
+
+UM=../um ./benchmark.sh "$@" > "$results/um"
+UM=../um-pgo ./benchmark.sh "$@" > "$results/um-pgo"
+
+printf "%-14s %9s %9s %9s\n" "program" "um" "um-pgo" "speedup"
+awk 'NR == FNR { base[$1] = $2; next }
+     { printf "%-14s %9s %9s %8.2fx\n", $1, base[$1], $2,
+              ($2 + 0 > 0) ? base[$1] / $2 : 0 }' \
+    "$results/um" "$results/um-pgo"
@@ -0,0 +1,24 @@
+#! /bin/bash
+#
+# pgo_train.sh
+#
+# Runs an instrumented UM (see the um-pgo target in ../Makefile) on the
+# training workloads: midmark, sandmark, and codex booted with the scripted
+# input in codex.0. Their profile is what the optimized build is tuned
+# for, so they should exercise the interpreter the way real programs do.
+#
+# Usage: ./pgo_train.sh UM
+#
+UM=$1
+BIN=../umbin
+
+if [ -z "$UM" ] ; then
+    echo "Usage: $0 UM" >&2
+    exit 1
+fi
+UM=$(realpath "$UM")
+cd "$(dirname "$0")"
+
+"$UM" "$BIN/midmark.um" < /dev/null > /dev/null || exit 1
+"$UM" "$BIN/sandmark.umz" < /dev/null > /dev/null || exit 1
+"$UM" "$BIN/codex.umz" < "$BIN/codex.0" > /dev/null || exit 1
@@ -24,9 +24,14 @@
 typedef uint32_t Um_instruction;
 typedef enum Um_opcode {
         CMOV = 0, SLOAD, SSTORE, ADD, MUL, DIV,
-        NAND, HALT, ACTIVATE, INACTIVATE, OUT, IN, LOADP, LV
+        NAND, HALT, ACTIVATE, INACTIVATE, OUT, IN, LOADP, LV, SPAWN, EXTEND
 } Um_opcode;
 
+/* Operations of EXTEND, selected by bits 25 to 27 */
+typedef enum Um_extension {
+        JOIN = 0, BULK_COPY, BULK_FILL, BULK_COMPARE
+} Um_extension;
+
 
 /* Functions that return the two instruction types */
 
@@ -126,6 +131,26 @@ static inline Um_instruction load_program(Um_register b, Um_register c)
 }
 
 
+/* The extensions: SPAWN and JOIN run with --threads, and the bulk
+   memory operations with --bulk-memory */
+static inline Um_instruction spawn(Um_register b, Um_register c)
+{
+        return three_register(SPAWN, 0, b, c);
+}
+
+static inline Um_instruction extend(Um_extension function, Um_register a,
+                                    Um_register b, Um_register c)
+{
+        Um_instruction word = three_register(EXTEND, a, b, c);
+        return Bitpack_newu(word, 3, 25, function);
+}
+
+static inline Um_instruction join(Um_register c)
+{
+        return extend(JOIN, 0, 0, c);
+}
+
+
 /* Functions for working with streams */
 
 static inline void append(Seq_T stream, Um_instruction inst)
@@ -541,6 +566,331 @@ void build_load_program_test(Seq_T stream)
         append(stream, halt());
 }
 
+void build_self_modify_test(Seq_T stream)
+{
+        /* Overwrite a halt in segment 0 with output(r1) before reaching it */
+        append(stream, loadval(r1, 'S'));
+        append(stream, loadval(r3, 0));
+        append(stream, loadval(r5, OUT));
+        append(stream, loadval(r6, 16384));
+        append(stream, mul(r5, r5, r6));
+        append(stream, mul(r5, r5, r6));
+        append(stream, loadval(r6, r1));
+        append(stream, add(r5, r5, r6));
+        append(stream, loadval(r4, Seq_length(stream) + 2));
+        append(stream, segmented_store(r3, r4, r5));
+        append(stream, halt()); // replaced by output(r1), prints 'S'
+        append(stream, halt());
+}
+
+void build_self_modify_idiom_test(Seq_T stream)
+{
+        /* Replace the second instruction of each idiom the UM lifts into
+           one dispatch case (see gen_dispatch.c) after it was decoded */
+        append(stream, add(r6, r6, r0)); // stored over the ADD below
+        load_max_val(stream, r7, r1, 3);
+        load_max_val(stream, r7, r2, 3);
+        append(stream, loadval(r3, 0));
+
+        /* NAND r4, r1, r2; NAND r4, r4, r4 becomes the first NAND twice */
+        int pair = Seq_length(stream) + 4;
+        append(stream, loadval(r5, pair));
+        append(stream, segmented_load(r7, r3, r5));
+        append(stream, loadval(r5, pair + 1));
+        append(stream, segmented_store(r3, r5, r7));
+        append(stream, nand(r4, r1, r2));
+        append(stream, nand(r4, r4, r4)); // replaced by nand(r4, r1, r2)
+        output_digit(stream, r4, r5); // should print 3
+
+        /* NAND r4, r2, r2; ADD r6, r6, r4 loses its ADD of r4 */
+        append(stream, loadval(r6, 5));
+        append(stream, loadval(r5, 0));
+        append(stream, segmented_load(r7, r3, r5));
+        append(stream, loadval(r5, Seq_length(stream) + 3));
+        append(stream, segmented_store(r3, r5, r7));
+        append(stream, nand(r4, r2, r2));
+        append(stream, add(r6, r6, r4)); // replaced by add(r6, r6, r0)
+        output_digit(stream, r6, r5); // should print 5
+        append(stream, halt());
+}
+
+void build_idiom_test(Seq_T stream)
+{
+        /* OR, XOR and subtraction as compilers write them, which the UM
+           may lift into one dispatch case each (see gen_dispatch.c) */
+        append(stream, loadval(r1, 5));
+        append(stream, loadval(r2, 3));
+        append(stream, loadval(r3, 1));
+        append(stream, nand(r4, r1, r1)); // r6 = r1 | r2
+        append(stream, nand(r5, r2, r2));
+        append(stream, nand(r6, r4, r5));
+        output_digit(stream, r6, r7); // should print 7
+        append(stream, nand(r4, r1, r1)); // r5 = r1 ^ r2
+        append(stream, nand(r5, r2, r2));
+        append(stream, nand(r5, r4, r5));
+        append(stream, nand(r4, r1, r2));
+        append(stream, nand(r5, r4, r5));
+        append(stream, nand(r5, r5, r5));
+        output_digit(stream, r5, r7); // should print 6
+        append(stream, nand(r4, r2, r2)); // r6 = r1 - r2, given r3 = 1
+        append(stream, add(r6, r1, r4));
+        append(stream, add(r6, r3, r6));
+        output_digit(stream, r6, r7); // should print 2
+        append(stream, loadval(r1, 9));
+        append(stream, nand(r4, r2, r2)); // r2 = r1 - r2, into r2
+        append(stream, add(r2, r1, r4));
+        append(stream, add(r2, r3, r2));
+        output_digit(stream, r2, r7); // should print 6
+        append(stream, halt());
+}
+
+void build_self_modify_run_test(Seq_T stream)
+{
+        /* Replace an instruction inside runs the UM lifts into one
+           dispatch case (see gen_dispatch.c) after they were decoded */
+        append(stream, nand(r6, r4, r4)); // stored into the OR below
+        append(stream, loadval(r6, 7)); // stored into the SUB below
+        append(stream, loadval(r0, 0));
+        append(stream, loadval(r1, 5));
+        append(stream, loadval(r2, 3));
+        append(stream, loadval(r3, 1));
+
+        /* r6 = r1 | r2 becomes r6 = r1: the opcodes stay the same */
+        append(stream, loadval(r5, 0));
+        append(stream, segmented_load(r7, r0, r5));
+        append(stream, loadval(r5, Seq_length(stream) + 4));
+        append(stream, segmented_store(r0, r5, r7));
+        append(stream, nand(r4, r1, r1));
+        append(stream, nand(r5, r2, r2));
+        append(stream, nand(r6, r4, r5)); // replaced by nand(r6, r4, r4)
+        output_digit(stream, r6, r5); // should print 5
+
+        /* r6 = r1 - r2 becomes r6 = 7: an opcode changes */
+        append(stream, loadval(r5, 1));
+        append(stream, segmented_load(r7, r0, r5));
+        append(stream, loadval(r5, Seq_length(stream) + 4));
+        append(stream, segmented_store(r0, r5, r7));
+        append(stream, nand(r4, r2, r2));
+        append(stream, add(r6, r1, r4));
+        append(stream, add(r6, r3, r6)); // replaced by loadval(r6, 7)
+        output_digit(stream, r6, r5); // should print 7
+        append(stream, halt());
+}
+
+void build_spawn_join_test(Seq_T stream)
+{
+        /* The spawned thread stores into a segment both threads share */
+        append(stream, loadval(r3, 1));
+        append(stream, map_segment(r4, r3));
+        int child = Seq_length(stream) + 9;
+        append(stream, loadval(r1, child));
+        append(stream, spawn(r2, r1));
+        append(stream, join(r2));
+        append(stream, loadval(r5, 0));
+        append(stream, segmented_load(r6, r4, r5));
+        append(stream, output(r6)); // should print 'c', once joined
+        append(stream, loadval(r6, 'p'));
+        append(stream, output(r6));
+        append(stream, halt());
+
+        assert(Seq_length(stream) == child);
+        output_digit(stream, r2, r7); // the new thread's r2: should print 0
+        append(stream, loadval(r6, 'c'));
+        append(stream, loadval(r5, 0));
+        append(stream, segmented_store(r4, r5, r6));
+        append(stream, halt()); // ends just this thread
+}
+
+/* Outputs the first length words of the segment in rA; uses rB and rC */
+static void output_segment(Seq_T stream, Um_register rA, Um_register rB,
+                           Um_register rC, int length)
+{
+        for (int i = 0; i < length; i++) {
+                append(stream, loadval(rB, i));
+                append(stream, segmented_load(rC, rA, rB));
+                append(stream, output(rC));
+        }
+}
+
+void build_bulk_memory_test(Seq_T stream)
+{
+        /* Runs are named by register pairs: r0, r1 and r2, r3 */
+        append(stream, loadval(r5, 8));
+        append(stream, map_segment(r0, r5));
+        append(stream, loadval(r3, 0));
+        append(stream, add(r2, r0, r3));
+
+        /* FILL 8 words with 'a', then store "bcd" after the first */
+        append(stream, loadval(r1, 0));
+        append(stream, loadval(r4, 'a'));
+        append(stream, extend(BULK_FILL, r0, r4, r5));
+        for (int i = 1; i < 4; i++) {
+                append(stream, loadval(r6, 'a' + i));
+                append(stream, loadval(r7, i));
+                append(stream, segmented_store(r0, r7, r6));
+        }
+
+        /* COPY 4 words 2 higher, then 3 words 1 lower, over themselves */
+        append(stream, loadval(r1, 2));
+        append(stream, loadval(r5, 4));
+        append(stream, extend(BULK_COPY, r0, r2, r5));
+        output_segment(stream, r0, r7, r6, 8); // should print ababcdaa
+        append(stream, loadval(r1, 0));
+        append(stream, loadval(r3, 1));
+        append(stream, loadval(r5, 3));
+        append(stream, extend(BULK_COPY, r0, r2, r5));
+        output_segment(stream, r0, r7, r6, 8); // should print babbcdaa
+
+        /* COMPARE leaves the number of equal leading words in rC */
+        append(stream, loadval(r3, 2));
+        append(stream, loadval(r5, 6));
+        append(stream, extend(BULK_COMPARE, r0, r2, r5));
+        output_digit(stream, r5, r7); // should print 1
+        append(stream, loadval(r3, 0));
+        append(stream, loadval(r5, 8));
+        append(stream, extend(BULK_COMPARE, r0, r2, r5));
+        output_digit(stream, r5, r7); // should print 8
+
+        /* A run past the end of its segment stops the UM */
+        append(stream, loadval(r1, 6));
+        append(stream, loadval(r5, 4));
+        append(stream, extend(BULK_FILL, r0, r4, r5));
+        append(stream, output(r4)); // should not be reached
+        append(stream, halt());
+}
+
+void build_map_file_test(Seq_T stream)
+{
+        /* map-file.dat holds "ABCDEFG", which maps to segment 1 as two
+           big-endian words, the last byte padded with 0, with the length
+           in r1 */
+        output_digit(stream, r1, r7); // should print 2
+        append(stream, loadval(r2, 1));
+        for (int i = 0; i < 8; i++) {
+                /* Byte k of a word is (word * 256^k) / 2^24 */
+                append(stream, loadval(r3, i / 4));
+                append(stream, segmented_load(r4, r2, r3));
+                append(stream, loadval(r5, 1 << (8 * (i % 4))));
+                append(stream, mul(r6, r4, r5));
+                append(stream, loadval(r5, 1 << 24));
+                append(stream, div(r6, r6, r5));
+                if (i < 7) {
+                        append(stream, output(r6)); // should print A to G
+                } else {
+                        output_digit(stream, r6, r7); // should print 0
+                }
+        }
+        append(stream, halt());
+}
+
+void build_map_file_empty_test(Seq_T stream)
+{
+        /* An empty file still takes segment 1, with length 0 */
+        output_digit(stream, r1, r7); // should print 0
+        append(stream, loadval(r3, 1));
+        append(stream, map_segment(r2, r3));
+        output_digit(stream, r2, r7); // should print 2
+        append(stream, halt());
+}
+
+void build_map_file_remap_test(Seq_T stream)
+{
+        /* map-file-remap.dat is two pages of 'U'; only the first is read
+           before segment 1 is unmapped, and a segment of the same length
+           mapped in its place must read as zero on both pages */
+        append(stream, loadval(r2, 1));
+        append(stream, loadval(r3, 0));
+        append(stream, segmented_load(r4, r2, r3));
+        append(stream, loadval(r5, 1 << 24));
+        append(stream, div(r4, r4, r5));
+        append(stream, output(r4)); // should print U
+        append(stream, unmap_segment(r2));
+        append(stream, map_segment(r2, r1));
+        append(stream, segmented_load(r4, r2, r3));
+        output_digit(stream, r4, r7); // should print 0
+        append(stream, loadval(r3, 1024));
+        append(stream, segmented_load(r4, r2, r3));
+        output_digit(stream, r4, r7); // should print 0
+        append(stream, halt());
+}
+
+void build_cost_test(Seq_T stream)
+{
+        /* Maps 3 words, stores a halt into the last and runs them; no
+           idioms, whose lifting depends on the build (see gen_dispatch.c) */
+        append(stream, loadval(r1, 3));
+        append(stream, map_segment(r2, r1));
+        append(stream, loadval(r3, HALT));
+        append(stream, loadval(r4, 1 << 14));
+        append(stream, mul(r4, r4, r4));
+        append(stream, mul(r3, r3, r4));
+        append(stream, loadval(r5, 2));
+        append(stream, segmented_store(r2, r5, r3));
+        append(stream, loadval(r6, 0));
+        append(stream, load_program(r2, r6));
+}
+
+void build_analysis_test(Seq_T stream)
+{
+        /* A jump to one known target, then one to either of two, in a
+           block that also reads a word of segment 0 as data */
+        append(stream, loadval(r1, 'a'));
+        append(stream, loadval(r2, 5));
+        append(stream, loadval(r3, 0));
+        append(stream, load_program(r3, r2));
+        append(stream, halt()); // never reached
+        append(stream, input(r7));
+        append(stream, segmented_load(r4, r3, r2));
+        append(stream, loadval(r5, 12));
+        append(stream, loadval(r6, 11));
+        append(stream, conditional_move(r5, r6, r7));
+        append(stream, load_program(r3, r5)); // to 11 unless r7 is 0
+        append(stream, output(r1)); // should print 'a'
+        append(stream, halt());
+}
+
+/* Loops for count * 1000 iterations, a few instructions each; uses rA,
+   rB and rC */
+static void spin(Seq_T stream, Um_register rA, Um_register rB,
+                 Um_register rC, int count)
+{
+        append(stream, loadval(rA, count));
+        append(stream, loadval(rB, 1000));
+        append(stream, mul(rA, rA, rB));
+        int loop = Seq_length(stream);
+        append(stream, loadval(rC, 0));
+        append(stream, nand(rC, rC, rC));
+        append(stream, add(rA, rA, rC)); // rA - 1
+        append(stream, loadval(rB, loop + 8));
+        append(stream, loadval(rC, loop));
+        append(stream, conditional_move(rB, rC, rA));
+        append(stream, loadval(rC, 0));
+        append(stream, load_program(rC, rB)); // to loop until rA is 0
+        assert(Seq_length(stream) == loop + 8);
+}
+
+void build_dedup_remap_test(Seq_T stream)
+{
+        /* Two identical segments share storage once --dedup has had a
+           second of CPU time; a segment mapped again at the address of
+           one of them must still start out zero */
+        append(stream, loadval(r1, 65536));
+        append(stream, map_segment(r2, r1));
+        append(stream, map_segment(r3, r1));
+        append(stream, loadval(r0, 0));
+        append(stream, loadval(r4, 7));
+        append(stream, segmented_store(r2, r0, r4));
+        append(stream, segmented_store(r3, r0, r4));
+        spin(stream, r5, r6, r7, 150000);
+        append(stream, unmap_segment(r3));
+        append(stream, map_segment(r3, r1));
+        append(stream, segmented_load(r4, r3, r0));
+        output_digit(stream, r4, r7); // should print 0
+        append(stream, segmented_load(r4, r2, r0));
+        output_digit(stream, r4, r7); // should print 7
+        append(stream, halt());
+}
+
 void build_performance_test(Seq_T stream)
 {
         for (int i = 1; i < 50000; i++) {
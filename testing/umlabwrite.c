@@ -31,10 +31,63 @@ extern void build_map_and_store_test(Seq_T instructions);
 extern void build_load_program_test(Seq_T instructions);
 extern void build_load_seg_0_test(Seq_T instructions);
 extern void build_map_empty_seg_test(Seq_T instructions);
+extern void build_self_modify_test(Seq_T instructions);
+extern void build_self_modify_idiom_test(Seq_T instructions);
+extern void build_idiom_test(Seq_T instructions);
+extern void build_self_modify_run_test(Seq_T instructions);
 extern void build_performance_test(Seq_T instructions);
+extern void build_spawn_join_test(Seq_T instructions);
+extern void build_bulk_memory_test(Seq_T instructions);
+extern void build_map_file_test(Seq_T instructions);
+extern void build_map_file_empty_test(Seq_T instructions);
+extern void build_cost_test(Seq_T instructions);
+extern void build_analysis_test(Seq_T instructions);
+extern void build_dedup_remap_test(Seq_T instructions);
+extern void build_map_file_remap_test(Seq_T instructions);
 //extern void build_no_halt_test(Seq_T instructions);
 // extern void build_arithmetic_test(Seq_T instructions);
 
+/* Two pages of 'U' for the map-file-remap test, filled in by main */
+static char two_pages[8192 + 1];
+
+/* What --cost reports for the cost test: the same on every run, though
+   the allocations differ with the memory backend (this is arena's) */
+static const char cost_vector[] =
+        "instructions\t13\n"
+        "op.CMOV\t2\nop.SLOAD\t0\nop.SSTORE\t1\nop.ADD\t0\nop.MUL\t2\n"
+        "op.DIV\t0\nop.NAND\t0\nop.HALT\t1\nop.ACTIVATE\t1\n"
+        "op.INACTIVATE\t0\nop.OUT\t0\nop.IN\t0\nop.LOADP\t1\nop.LV\t5\n"
+        "op.SPAWN\t0\nop.EXTEND\t0\n"
+        "loadp_words_copied\t3\nmap_words_zeroed\t3\n"
+        "table_entries_copied\t0\nstorage_words_copied\t0\n"
+        "allocations\t2\nlifted_idioms\t0\n";
+
+/* What umanalyze reports for the analysis test: its blocks and their
+   successors, the word it reads as data, and the totals */
+static const char analysis_cfg[] =
+        "block 0 4 jump - 5\n"
+        "block 5 6 jump r 11 12\n"
+        "block 11 1 fall - 12\n"
+        "block 12 1 halt -\n"
+        "data 5 1\n"
+        "stat words 13\nstat blocks 4\nstat reachable_words 12\n"
+        "stat edges 4\nstat jumps 2\nstat indirect_jumps 0\n"
+        "stat program_loads 0\nstat bad_targets 0\nstat halts 1\n"
+        "stat spawns 0\nstat code_reads 1\nstat unknown_code_reads 0\n"
+        "stat code_writes 0\nstat words_read 1\nstat code_words_read 1\n"
+        "stat constant_results 5\n";
+
+/* Tests whose umanalyze output is checked too; it goes in <name>.cfg */
+
+static struct analysis_info {
+        const char *name;
+        const char *expected_analysis;
+} analyses[] = {
+        { "analysis",      analysis_cfg },
+};
+
+#define NANALYSES (sizeof(analyses)/sizeof(analyses[0]))
+
 /* The array `tests` contains all unit tests for the lab. */
 
 static struct test_info {
@@ -43,30 +96,61 @@ static struct test_info {
         const char *expected_output; 
         /* writes instructions into sequence */
         void (*build_test)(Seq_T stream);
+        const char *options;             /* NULL means a plain UM */
+        const char *data;                /* contents of <name>.dat, e.g.
+                                            for --map-file; NULL for none */
 } tests[] = {
-        { "halt",          NULL,         "",                build_halt_test },
-        { "output",        NULL,         "",                build_output_test },
-        { "load-value",    NULL,         "abcdefg",         build_load_value_test },
-        { "halt-verbose",  NULL,         "",                build_verbose_halt_test },
-        { "add",           NULL,         "5",               build_add_test },
-        { "add-mod",       NULL,         "0",               build_add_mod_test },
-        { "mul",           NULL,         "6",               build_mul_test },
-        { "mul-mod",       NULL,         "0",               build_mul_mod_test },
-        { "div",           NULL,         "011",             build_div_test },
-        { "nand",          NULL,         "03",              build_nand_test },
-        { "print-six",     NULL,         "6",               build_print_six_test },
-        { "cmov",          NULL,         "abbb",            build_cmov_test },
-        { "sload",         NULL,         "ST",              build_sload_test },
-        { "sstore",        NULL,         "S",               build_sstore_test },
-        { "map-segment",   NULL,         "100002",          build_map_segment_test },
-        { "unmap-segment", NULL,         "",                build_unmap_segment_test },
-        { "input",         "abcde\nabc", "abcde\nabc",      build_input_test },
-        { "input-eof",     NULL,         "0",               build_input_eof_test },
-        { "load-program",  NULL,         "b",               build_load_program_test },
-        { "map-and-store", NULL,         "S",               build_map_and_store_test },
-        { "load-seg-0",    NULL,         "ab",              build_load_seg_0_test },
-        { "map-empty-seg", NULL,          "",               build_map_empty_seg_test },
-        { "performance",   NULL,          "",               build_performance_test },
+        { "halt",          NULL,         "",                build_halt_test, NULL, NULL },
+        { "output",        NULL,         "",                build_output_test, NULL, NULL },
+        { "load-value",    NULL,         "abcdefg",         build_load_value_test, NULL, NULL },
+        { "halt-verbose",  NULL,         "",                build_verbose_halt_test, NULL, NULL },
+        { "add",           NULL,         "5",               build_add_test, NULL, NULL },
+        { "add-mod",       NULL,         "0",               build_add_mod_test, NULL, NULL },
+        { "mul",           NULL,         "6",               build_mul_test, NULL, NULL },
+        { "mul-mod",       NULL,         "0",               build_mul_mod_test, NULL, NULL },
+        { "div",           NULL,         "011",             build_div_test, NULL, NULL },
+        { "nand",          NULL,         "03",              build_nand_test, NULL, NULL },
+        { "print-six",     NULL,         "6",               build_print_six_test, NULL, NULL },
+        { "cmov",          NULL,         "abbb",            build_cmov_test, NULL, NULL },
+        { "sload",         NULL,         "ST",              build_sload_test, NULL, NULL },
+        { "sstore",        NULL,         "S",               build_sstore_test, NULL, NULL },
+        { "map-segment",   NULL,         "100002",          build_map_segment_test, NULL, NULL },
+        { "unmap-segment", NULL,         "",                build_unmap_segment_test, NULL, NULL },
+        { "input",         "abcde\nabc", "abcde\nabc",      build_input_test, NULL, NULL },
+        { "input-eof",     NULL,         "0",               build_input_eof_test, NULL, NULL },
+        { "load-program",  NULL,         "b",               build_load_program_test, NULL, NULL },
+        { "map-and-store", NULL,         "S",               build_map_and_store_test, NULL, NULL },
+        { "load-seg-0",    NULL,         "ab",              build_load_seg_0_test, NULL, NULL },
+        { "map-empty-seg", NULL,          "",               build_map_empty_seg_test, NULL, NULL },
+        { "self-modify",   NULL,          "S",              build_self_modify_test, NULL, NULL },
+        { "self-modify-idiom", NULL,      "35",             build_self_modify_idiom_test, NULL, NULL },
+        { "idioms",        NULL,          "7626",           build_idiom_test, NULL, NULL },
+        { "self-modify-run", NULL,        "57",             build_self_modify_run_test, NULL, NULL },
+        /* The same programs must run the same with segment 0 protected */
+        { "self-modify-protected", NULL,  "S",              build_self_modify_test,
+          "--protect-seg0", NULL },
+        { "self-modify-idiom-protected", NULL, "35",        build_self_modify_idiom_test,
+          "--protect-seg0", NULL },
+        { "performance",   NULL,          "",               build_performance_test, NULL, NULL },
+        { "spawn-join",    NULL,          "0cp",            build_spawn_join_test,
+          "--threads", NULL },
+        { "bulk-memory",   NULL,          "ababcdaababbcdaa18", build_bulk_memory_test,
+          "--bulk-memory", NULL },
+        /* The same program must keep its output when it fails with OUT
+           on a helper thread */
+        { "bulk-memory-async", NULL,      "ababcdaababbcdaa18", build_bulk_memory_test,
+          "--async-io --bulk-memory", NULL },
+        { "map-file",      NULL,          "2ABCDEFG0",      build_map_file_test,
+          "--map-file map-file.dat", "ABCDEFG" },
+        { "map-file-empty", NULL,         "02",             build_map_file_empty_test,
+          "--map-file map-file-empty.dat", "" },
+        { "map-file-remap", NULL,         "U00",            build_map_file_remap_test,
+          "--map-file map-file-remap.dat", two_pages },
+        { "cost",          NULL,          cost_vector,      build_cost_test,
+          "--cost /dev/stdout", NULL },
+        { "analysis",      NULL,          "a",              build_analysis_test, NULL, NULL },
+        { "dedup-remap",   NULL,          "07",             build_dedup_remap_test,
+          "--dedup 1", NULL },
         //{ "no-halt",       NULL,         "11",              build_no_halt_test },
         // { "arithmetic",   NULL, "253",        build_arithmetic_test },
         
@@ -87,12 +171,18 @@ static FILE *open_and_free_pathname(char *path);
  */
 static void write_or_remove_file(char *path, const char *contents);
 
+/*
+ * write 'contents' into 'path', even if empty, then free 'path'
+ */
+static void write_file(char *path, const char *contents);
+
 static void write_test_files(struct test_info *test);
 
 
 int main (int argc, char *argv[])
 {
         bool failed = false;
+        memset(two_pages, 'U', sizeof(two_pages) - 1);
         if (argc == 1)
                 for (unsigned i = 0; i < NTESTS; i++) {
                         printf("***** Writing test '%s'.\n", tests[i].name);
@@ -130,6 +220,15 @@ static void write_test_files(struct test_info *test)
                              test->test_input);
         write_or_remove_file(Fmt_string("%s.1", test->name),
                              test->expected_output);
+        write_or_remove_file(Fmt_string("%s.opt", test->name),
+                             test->options);
+        if (test->data != NULL) {
+                write_file(Fmt_string("%s.dat", test->name), test->data);
+        }
+        for (unsigned i = 0; i < NANALYSES; i++)
+                if (!strcmp(analyses[i].name, test->name))
+                        write_file(Fmt_string("%s.cfg", test->name),
+                                   analyses[i].expected_analysis);
 }
 
 
@@ -148,6 +247,17 @@ static void write_or_remove_file(char *path, const char *contents)
 }
 
 
+static void write_file(char *path, const char *contents)
+{
+        FILE *fp = fopen(path, "wb");
+        assert(fp != NULL);
+
+        fputs(contents, fp);
+        fclose(fp);
+        free(path);
+}
+
+
 static FILE *open_and_free_pathname(char *path)
 {
         FILE *fp = fopen(path, "wb");
@@ -0,0 +1,72 @@
+/******************************************************************************
+ *
+ *                               umanalyze.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Analyzes a UM program without running it (see
+ *                 analysis.h) and writes its basic blocks, the edges
+ *                 between them, the words it reads as data and its
+ *                 statistics to stdout. With -s, only the statistics are
+ *                 written.
+ *
+ *                 Usage: umanalyze [-s] program.um
+ *
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "analysis.h"
+
+/* usage
+ * Purpose:    Describes the arguments and exits.
+ * Parameters: none
+ * Returns:    none
+ */
+static void usage(void)
+{
+    fprintf(stderr, "Usage: umanalyze [-s] program.um\n");
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char *argv[])
+{
+    int stats_only = 0;
+    int i = 1;
+    if (i < argc && strcmp(argv[i], "-s") == 0) {
+        stats_only = 1;
+        i++;
+    }
+    if (i != argc - 1) {
+        usage();
+    }
+
+    uint32_t num_words;
+    uint32_t *words = Analysis_read_program(argv[i], &num_words);
+    if (words == NULL) {
+        exit(EXIT_FAILURE);
+    }
+    Analysis_T analysis = Analysis_new(words, num_words);
+    if (stats_only) {
+        const Analysis_stats *stats = Analysis_get_stats(analysis);
+        printf("words %u\nblocks %u\nreachable_words %u\nedges %u\n"
+               "jumps %u\nindirect_jumps %u\nprogram_loads %u\n"
+               "bad_targets %u\nhalts %u\nspawns %u\ncode_reads %u\n"
+               "unknown_code_reads %u\ncode_writes %u\nwords_read %u\n"
+               "code_words_read %u\nconstant_results %u\n",
+               stats->num_words, stats->num_blocks, stats->reachable_words,
+               stats->num_edges, stats->jumps, stats->indirect_jumps,
+               stats->program_loads, stats->bad_targets, stats->halts,
+               stats->spawns, stats->code_reads, stats->unknown_code_reads,
+               stats->code_writes, stats->words_read,
+               stats->code_words_read, stats->constant_results);
+    } else {
+        Analysis_write(analysis, stdout);
+    }
+    Analysis_free(&analysis);
+    free(words);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,199 @@
+/******************************************************************************
+ *
+ *                                 umstat.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Reads the live statistics block of running um processes
+ *                 (started with --telemetry) from /dev/shm without stopping
+ *                 them. With no pid, every running UM is listed. With -w,
+ *                 the block is re-read every interval and the instruction
+ *                 rate over that interval is shown, which distinguishes a
+ *                 machine that is busy from one blocked on input.
+ *
+ *                 Usage: umstat [-w seconds] [pid ...]
+ *
+ *****************************************************************************/
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "telemetry.h"
+
+#define NAME_LENGTH 64
+#define SHM_DIRECTORY "/dev/shm"
+#define SHM_PREFIX "um."
+
+static const char *state_names[] = { "running", "waiting-input", "halted" };
+
+/* open_stats
+ * Purpose:    Maps the statistics block of the UM with the given pid.
+ * Parameters: long pid - the process id of a um started with --telemetry
+ * Returns:    Telemetry_stats * - the block, or NULL if it is not available
+ */
+static Telemetry_stats *open_stats(long pid)
+{
+    char name[NAME_LENGTH];
+    snprintf(name, NAME_LENGTH, TELEMETRY_NAME_FORMAT, pid);
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) {
+        return NULL;
+    }
+    Telemetry_stats *stats = mmap(NULL, sizeof(*stats), PROT_READ,
+                                  MAP_SHARED, fd, 0);
+    close(fd);
+    if (stats == MAP_FAILED) {
+        return NULL;
+    }
+    if (stats->magic != TELEMETRY_MAGIC ||
+        stats->version != TELEMETRY_VERSION) {
+        munmap(stats, sizeof(*stats));
+        return NULL;
+    }
+    return stats;
+}
+
+/* print_header
+ * Purpose:    Prints the column headings.
+ * Parameters: none
+ * Returns:    none
+ */
+static void print_header(void)
+{
+    printf("%8s %-13s %14s %12s %10s %8s %8s %12s %10s %10s %10s %8s "
+           "%12s %12s\n",
+           "PID", "STATE", "INSTRUCTIONS", "IPS", "BLOCK-PC", "LIVE",
+           "FREE", "BYTES", "LOADP", "IN", "OUT", "COLD", "SAVED",
+           "DEDUP");
+}
+
+/* print_stats
+ * Purpose:    Prints one line describing a UM.
+ * Parameters: Telemetry_stats *stats - the block to print
+ *             double ips - the instruction rate to show
+ * Returns:    none
+ */
+static void print_stats(Telemetry_stats *stats, double ips)
+{
+    printf("%8lld %-13s %14llu %12.0f %10u %8llu %8llu %12llu %10llu "
+           "%10llu %10llu %8llu %12llu %12llu\n",
+           (long long)stats->pid, state_names[stats->state % 3],
+           (unsigned long long)stats->instructions_retired, ips,
+           stats->block_pc,
+           (unsigned long long)stats->live_segments,
+           (unsigned long long)stats->free_segments,
+           (unsigned long long)stats->bytes_allocated,
+           (unsigned long long)stats->loadp_copies,
+           (unsigned long long)stats->bytes_in,
+           (unsigned long long)stats->bytes_out,
+           (unsigned long long)stats->cold_segments,
+           (unsigned long long)stats->cold_bytes_saved,
+           (unsigned long long)stats->dedup_bytes_saved);
+}
+
+/* average_ips
+ * Purpose:    Computes the instruction rate since the UM started.
+ * Parameters: Telemetry_stats *stats - the block
+ * Returns:    double - instructions per second
+ */
+static double average_ips(Telemetry_stats *stats)
+{
+    double seconds = (Telemetry_now_ns() - stats->start_ns) / 1e9;
+    return seconds > 0 ? stats->instructions_retired / seconds : 0;
+}
+
+/* collect_pids
+ * Purpose:    Finds every UM that currently publishes a statistics block.
+ * Parameters: long *pids - array to fill
+ *             int max_pids - capacity of pids
+ * Returns:    int - the number of pids found
+ */
+static int collect_pids(long *pids, int max_pids)
+{
+    DIR *dir = opendir(SHM_DIRECTORY);
+    if (dir == NULL) {
+        return 0;
+    }
+    int count = 0;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL && count < max_pids) {
+        if (strncmp(entry->d_name, SHM_PREFIX, strlen(SHM_PREFIX)) == 0) {
+            pids[count++] = strtol(entry->d_name + strlen(SHM_PREFIX),
+                                   NULL, 10);
+        }
+    }
+    closedir(dir);
+    return count;
+}
+
+/* main
+ * Purpose:    Parses arguments and prints the requested statistics.
+ * Parameters: int argc - number of command-line arguments
+ *             char *argv[] - optional -w interval and pids
+ * Returns:    int - EXIT_SUCCESS if any UM was found
+ */
+int main(int argc, char *argv[])
+{
+    enum { MAX_PIDS = 256 };
+    long pids[MAX_PIDS];
+    int num_pids = 0;
+    double interval = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "w:")) != -1) {
+        if (opt == 'w') {
+            interval = atof(optarg);
+        } else {
+            fprintf(stderr, "Usage: %s [-w seconds] [pid ...]\n", argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+    for (int i = optind; i < argc && num_pids < MAX_PIDS; i++) {
+        pids[num_pids++] = strtol(argv[i], NULL, 10);
+    }
+    if (num_pids == 0) {
+        num_pids = collect_pids(pids, MAX_PIDS);
+    }
+
+    Telemetry_stats *blocks[MAX_PIDS];
+    uint64_t last_count[MAX_PIDS];
+    int found = 0;
+    for (int i = 0; i < num_pids; i++) {
+        blocks[i] = open_stats(pids[i]);
+        if (blocks[i] == NULL) {
+            fprintf(stderr, "umstat: no statistics for pid %ld\n", pids[i]);
+        } else {
+            found++;
+            last_count[i] = blocks[i]->instructions_retired;
+        }
+    }
+    if (found == 0) {
+        exit(EXIT_FAILURE);
+    }
+
+    print_header();
+    for (int i = 0; i < num_pids; i++) {
+        if (blocks[i] != NULL) {
+            print_stats(blocks[i], average_ips(blocks[i]));
+        }
+    }
+    while (interval > 0) {
+        usleep(interval * 1e6);
+        for (int i = 0; i < num_pids; i++) {
+            if (blocks[i] == NULL) {
+                continue;
+            }
+            uint64_t count = blocks[i]->instructions_retired;
+            print_stats(blocks[i], (count - last_count[i]) / interval);
+            last_count[i] = count;
+        }
+        fflush(stdout);
+    }
+    return EXIT_SUCCESS;
+}
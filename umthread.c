@@ -0,0 +1,112 @@
+/******************************************************************************
+ *
+ *                                umthread.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the thread table outlined in
+ *                 umthread.h. Thread id n is entry n - 1 of a table that
+ *                 only grows, guarded by one mutex; joining happens
+ *                 outside it, so a thread may spawn while another waits.
+ *
+ *****************************************************************************/
+
+#include <pthread.h>
+#include <stdlib.h>
+#include "umthread.h"
+#include "assert.h"
+
+#define INITIAL_CAPACITY 16
+
+typedef struct Umthread {
+    pthread_t thread;
+    int joinable;      /* started and not yet claimed by a join */
+} Umthread;
+
+static pthread_mutex_t table_lock = PTHREAD_MUTEX_INITIALIZER;
+static Umthread *threads = NULL;
+static uint32_t num_threads = 0;
+static uint32_t capacity = 0;
+static int num_running = 0;
+
+/* Umthread_spawn
+ * Purpose:    Starts a thread.
+ * Parameters: void *(*run)(void *) - what the thread runs
+ *             void *arg - passed to run
+ * Returns:    uint32_t - the thread's id, or 0 if it could not be started
+ */
+uint32_t Umthread_spawn(void *(*run)(void *), void *arg)
+{
+    pthread_mutex_lock(&table_lock);
+    if (num_threads == capacity) {
+        capacity = capacity == 0 ? INITIAL_CAPACITY : capacity * 2;
+        threads = realloc(threads, capacity * sizeof(*threads));
+        assert(threads != NULL);
+    }
+    Umthread *entry = &threads[num_threads];
+    uint32_t id = 0;
+    if (pthread_create(&entry->thread, NULL, run, arg) == 0) {
+        entry->joinable = 1;
+        id = ++num_threads;
+        num_running++;
+    }
+    pthread_mutex_unlock(&table_lock);
+    return id;
+}
+
+/* Umthread_join
+ * Purpose:    Waits for a thread to finish.
+ * Parameters: uint32_t id - the thread's id
+ * Returns:    none
+ * Notes:      Does nothing for an id that was never handed out or whose
+ *             thread has already been joined.
+ */
+void Umthread_join(uint32_t id)
+{
+    pthread_mutex_lock(&table_lock);
+    if (id == 0 || id > num_threads || !threads[id - 1].joinable) {
+        pthread_mutex_unlock(&table_lock);
+        return;
+    }
+    threads[id - 1].joinable = 0;
+    pthread_t thread = threads[id - 1].thread;
+    pthread_mutex_unlock(&table_lock);
+
+    pthread_join(thread, NULL);
+    pthread_mutex_lock(&table_lock);
+    num_running--;
+    pthread_mutex_unlock(&table_lock);
+}
+
+/* Umthread_running
+ * Purpose:    Counts the threads that have not been joined.
+ * Parameters: none
+ * Returns:    int - the number of threads started and not yet joined
+ */
+int Umthread_running(void)
+{
+    pthread_mutex_lock(&table_lock);
+    int running = num_running;
+    pthread_mutex_unlock(&table_lock);
+    return running;
+}
+
+/* Umthread_join_all
+ * Purpose:    Waits for every thread, including any started meanwhile.
+ * Parameters: none
+ * Returns:    none
+ */
+void Umthread_join_all(void)
+{
+    for (uint32_t id = 1; ; id++) {
+        pthread_mutex_lock(&table_lock);
+        uint32_t started = num_threads;
+        pthread_mutex_unlock(&table_lock);
+        if (id > started) {
+            return;
+        }
+        Umthread_join(id);
+    }
+}
@@ -0,0 +1,28 @@
+/******************************************************************************
+ *
+ *                                umthread.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for the table of UM threads started by the
+ *                 threads extension (--threads). Each UM thread is a host
+ *                 thread known to the program by a nonzero id, which it
+ *                 passes back to join it. Ids are not reused while the
+ *                 table lives, so joining a thread twice, or joining an id
+ *                 that was never handed out, does nothing.
+ *
+ *****************************************************************************/
+
+#ifndef UMTHREAD_H
+#define UMTHREAD_H
+
+#include <stdint.h>
+
+extern uint32_t Umthread_spawn(void *(*run)(void *), void *arg);
+extern void Umthread_join(uint32_t id);
+extern int Umthread_running(void);
+extern void Umthread_join_all(void);
+
+#endif
@@ -0,0 +1,137 @@
+/******************************************************************************
+ *
+ *                                watchdog.c
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Implementation of the limits outlined in watchdog.h. The
+ *                 timeout is a POSIX timer on the monotonic clock
+ *                 signalling SIGRTMIN + 1 (SIGALRM belongs to checkpoints
+ *                 and SIGRTMIN to deduplication). After the timeout it
+ *                 keeps firing once a second. If the flag is still set
+ *                 when it fires again, the interpreter has not reached a
+ *                 block boundary, e.g. because it is blocked in IN, and
+ *                 the handler exits itself.
+ *
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "watchdog.h"
+#include "telemetry.h"
+
+#define GRACE_SECONDS 1
+
+volatile sig_atomic_t Watchdog_expired = 0;
+uint64_t Watchdog_instruction_limit = UINT64_MAX;
+
+static double timeout_seconds = 0;
+static timer_t timer;
+static struct itimerspec timer_spec;
+static int timer_started = 0;
+
+/* timeout_handler
+ * Purpose:    Raises Watchdog_expired, or exits if it was already raised
+ *             and the interpreter has not acted on it.
+ * Parameters: int signum - SIGRTMIN + 1
+ * Returns:    none
+ */
+static void timeout_handler(int signum)
+{
+    static const char message[] = "Timed out outside the interpreter "
+                                  "loop.\n";
+    if (Watchdog_expired) {
+        if (write(STDERR_FILENO, message, sizeof(message) - 1) < 0) {
+            /* Exiting regardless */
+        }
+        Telemetry_dump();
+        _exit(WATCHDOG_EXIT_TIMEOUT);
+    }
+    Watchdog_expired = 1;
+    (void)signum;
+}
+
+/* Watchdog_start
+ * Purpose:    Starts the timeout.
+ * Parameters: double timeout_s - wall-clock seconds the program may run
+ * Returns:    none
+ */
+void Watchdog_start(double timeout_s)
+{
+    timeout_seconds = timeout_s;
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = timeout_handler;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGRTMIN + 1, &action, NULL);
+
+    struct sigevent event;
+    memset(&event, 0, sizeof(event));
+    event.sigev_notify = SIGEV_SIGNAL;
+    event.sigev_signo = SIGRTMIN + 1;
+    if (timer_create(CLOCK_MONOTONIC, &event, &timer) != 0) {
+        fprintf(stderr, "Could not start the timeout.\n");
+        exit(EXIT_FAILURE);
+    }
+    memset(&timer_spec, 0, sizeof(timer_spec));
+    timer_spec.it_value.tv_sec = (time_t)timeout_s;
+    timer_spec.it_value.tv_nsec = (long)((timeout_s - (time_t)timeout_s) *
+                                         1e9);
+    if (timer_spec.it_value.tv_sec == 0 && timer_spec.it_value.tv_nsec == 0) {
+        timer_spec.it_value.tv_nsec = 1;
+    }
+    timer_spec.it_interval.tv_sec = GRACE_SECONDS;
+    timer_started = 1;
+    timer_settime(timer, 0, &timer_spec, NULL);
+}
+
+/* Watchdog_rearm
+ * Purpose:    Restarts the timeout, if there is one, and clears an expiry,
+ *             so the next program gets the full time.
+ * Parameters: none
+ * Returns:    none
+ */
+void Watchdog_rearm(void)
+{
+    if (timer_started) {
+        timer_settime(timer, 0, &timer_spec, NULL);
+    }
+    Watchdog_expired = 0;
+}
+
+/* Watchdog_report
+ * Purpose:    Describes why a program was stopped, where, and how far it
+ *             got.
+ * Parameters: uint32_t block_pc - the first instruction of the block that
+ *                                 was running
+ *             uint32_t pc - the LOADP that ended it
+ *             uint64_t instructions_retired - instructions executed
+ * Returns:    int - the exit status for the limit that was reached
+ */
+int Watchdog_report(uint32_t block_pc, uint32_t pc,
+                    uint64_t instructions_retired)
+{
+    int status;
+    if (Watchdog_expired) {
+        fprintf(stderr, "Timed out after %g seconds", timeout_seconds);
+        status = WATCHDOG_EXIT_TIMEOUT;
+    } else {
+        fprintf(stderr, "Instruction limit of %llu reached",
+                (unsigned long long)Watchdog_instruction_limit);
+        status = WATCHDOG_EXIT_INSTRUCTIONS;
+    }
+    fprintf(stderr, " in the block at pc %u, at the LOADP at pc %u, after "
+            "%llu instructions.\n", block_pc, pc,
+            (unsigned long long)instructions_retired);
+    Telemetry->instructions_retired = instructions_retired;
+    Telemetry->block_pc = block_pc;
+    Telemetry_dump();
+    return status;
+}
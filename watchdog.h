@@ -0,0 +1,43 @@
+/******************************************************************************
+ *
+ *                                watchdog.h
+ *
+ *     Assignment: um
+ *     Authors:    Ryan Beckwith and Victoria Chen
+ *     Date:       11/24/2020
+ *
+ *     Purpose:    Interface for the limits placed on untrusted programs: a
+ *                 budget of instructions and a wall-clock timeout. Both
+ *                 are checked only at block boundaries, where the
+ *                 interpreter already counts instructions. Since every UM
+ *                 loop goes through a LOADP, no program can run past
+ *                 either limit by more than one basic block. The timeout
+ *                 is a timer that raises Watchdog_expired.
+ *
+ *                 A program stopped by a limit exits with a status of its
+ *                 own, after the program counter and statistics are
+ *                 written to stderr.
+ *
+ *****************************************************************************/
+
+#ifndef WATCHDOG_H
+#define WATCHDOG_H
+
+#include <signal.h>
+#include <stdint.h>
+
+#define WATCHDOG_EXIT_INSTRUCTIONS 3
+#define WATCHDOG_EXIT_TIMEOUT 4
+
+/* Set by the timer when the timeout has passed */
+extern volatile sig_atomic_t Watchdog_expired;
+
+/* Instructions the program may retire; UINT64_MAX for no limit */
+extern uint64_t Watchdog_instruction_limit;
+
+extern void Watchdog_start(double timeout_s);
+extern void Watchdog_rearm(void);
+extern int Watchdog_report(uint32_t block_pc, uint32_t pc,
+                           uint64_t instructions_retired);
+
+#endif